@@ -91,6 +91,10 @@
 # Features of found Magnum library are exposed in these variables:
 #  MAGNUM_BUILD_DEPRECATED      - Defined if compiled with deprecated APIs
 #   included
+#  MAGNUM_BUILD_MULTITHREADED   - Defined if compiled with multithreading
+#   support
+#  MAGNUM_BUILD_SIMD            - Defined if compiled with explicit SIMD
+#   implementation of hot math operations
 #  MAGNUM_BUILD_STATIC          - Defined if compiled as static libraries
 #  MAGNUM_TARGET_GLES           - Defined if compiled for OpenGL ES
 #  MAGNUM_TARGET_GLES2          - Defined if compiled for OpenGL ES 2.0
@@ -193,6 +197,8 @@ endif()
 file(READ ${MAGNUM_INCLUDE_DIR}/Magnum/configure.h _magnumConfigure)
 set(_magnumFlags
     BUILD_DEPRECATED
+    BUILD_MULTITHREADED
+    BUILD_SIMD
     BUILD_STATIC
     TARGET_GLES
     TARGET_GLES2
@@ -489,7 +495,14 @@ foreach(component ${Magnum_FIND_COMPONENTS})
     elseif(${component} STREQUAL Primitives)
         set(_MAGNUM_${_COMPONENT}_INCLUDE_PATH_NAMES Cube.h)
 
-    # No special setup for SceneGraph library
+    # SceneGraph library
+    elseif(${component} STREQUAL SceneGraph)
+        # Link to threading library if built with multithreading support
+        if(MAGNUM_BUILD_MULTITHREADED)
+            find_package(Threads REQUIRED)
+            set(_MAGNUM_${_COMPONENT}_LIBRARIES ${CMAKE_THREAD_LIBS_INIT})
+        endif()
+
     # No special setup for Shaders library
     # No special setup for Shapes library
     # No special setup for Text library
@@ -54,6 +54,7 @@ namespace Math {
     #endif
     constexpr Rad<Float> operator "" _radf(long double);
     constexpr Deg<Float> operator "" _degf(long double);
+    Half operator "" _h(long double);
     #endif
 }
 
@@ -77,6 +78,16 @@ deprecated API included.
 #define MAGNUM_BUILD_DEPRECATED
 /* (enabled by default) */
 
+/**
+@brief Multithreaded build
+
+Defined if built with multithreading support, e.g. @ref SceneGraph::ThreadPool.
+Disabled by default.
+@see @ref building, @ref cmake
+*/
+#define MAGNUM_BUILD_MULTITHREADED
+#undef MAGNUM_BUILD_MULTITHREADED
+
 /**
 @brief Static library build
 
@@ -186,6 +197,13 @@ typedef std::int64_t Long;
 /** @brief Float (32bit) */
 typedef float Float;
 
+/**
+@brief Half (16bit)
+
+Storage-only type, see @ref Math::Half for more information.
+*/
+typedef Math::Half Half;
+
 /** @brief Two-component float vector */
 typedef Math::Vector2<Float> Vector2;
 
@@ -213,6 +231,15 @@ typedef Math::Vector3<Int> Vector3i;
 /** @brief Four-component signed integer vector */
 typedef Math::Vector4<Int> Vector4i;
 
+/** @brief Two-component half-float vector */
+typedef Math::Vector2<Half> Vector2h;
+
+/** @brief Three-component half-float vector */
+typedef Math::Vector3<Half> Vector3h;
+
+/** @brief Four-component half-float vector */
+typedef Math::Vector4<Half> Vector4h;
+
 /** @brief Three-component (RGB) float color */
 typedef Math::Color3<Float> Color3;
 
@@ -420,13 +447,14 @@ typedef Math::Range3D<Double> Range3Dd;
 /*@}*/
 #endif
 
-/* Using angle literals from Math namespace */
+/* Using angle and half-float literals from Math namespace */
 #ifndef MAGNUM_TARGET_GLES
 using Math::operator "" _deg;
 using Math::operator "" _rad;
 #endif
 using Math::operator "" _degf;
 using Math::operator "" _radf;
+using Math::operator "" _h;
 
 /* Forward declarations for all types in root namespace */
 
@@ -0,0 +1,267 @@
+#ifndef Magnum_Math_Algorithms_Svd3x3_h
+#define Magnum_Math_Algorithms_Svd3x3_h
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+/** @file
+ * @brief Function @ref Magnum::Math::Algorithms::symmetricEigen3x3(), @ref Magnum::Math::Algorithms::svd3x3()
+ */
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+#include <Corrade/Containers/ArrayView.h>
+
+#include "Magnum/Math/Functions.h"
+#include "Magnum/Math/Matrix.h"
+#include "Magnum/Math/Vector3.h"
+
+#ifdef MAGNUM_BUILD_SIMD
+#include "Magnum/Math/simdImplementation.h"
+#endif
+
+namespace Magnum { namespace Math { namespace Algorithms {
+
+namespace Implementation {
+    /* Count of Jacobi sweeps. The convergence is quadratic, after four sweeps
+       the off-diagonal elements are well below epsilon of both floats and
+       doubles, doubles do one more to have some margin. */
+    template<class T> struct Jacobi3x3Sweeps { enum: std::size_t { Value = 5 }; };
+    template<> struct Jacobi3x3Sweeps<Float> { enum: std::size_t { Value = 4 }; };
+
+    /* Jacobi rotation zeroing the pq element of a symmetric matrix, rp and
+       rq are the remaining two off-diagonal elements. With d being the
+       diagonal difference, o twice the off-diagonal element and
+       h = sqrt(d^2 + o^2), the tangent is o/(|d| + h) with the sign of d and
+       the cosine is (|d| + h)/sqrt(2h(|d| + h)), which needs only a single
+       division on the critical path. Zero o gives zero angle, all-zero input
+       is handled with a select instead of a branch. */
+    template<class T> void jacobiRotate(T& pp, T& qq, T& pq, T& rp, T& rq, Vector<3, T>& vp, Vector<3, T>& vq) {
+        const T d = qq - pp;
+        const T o = d < T(0) ? -(pq + pq) : pq + pq;
+        const T h = std::sqrt(d*d + o*o);
+        const T g = std::abs(d) + h;
+        const T n = std::sqrt(T(2)*h*g);
+        const bool nonzero = n > std::numeric_limits<T>::min();
+        const T t = nonzero ? o/g : T(0);
+        const T nInverted = T(1)/n;
+        const T c = nonzero ? g*nInverted : T(1);
+        const T s = nonzero ? o*nInverted : T(0);
+
+        pp -= t*pq;
+        qq += t*pq;
+        pq = T(0);
+        const T p = rp;
+        rp = c*p - s*rq;
+        rq = s*p + c*rq;
+        const Vector<3, T> v = vp;
+        vp = c*v - s*vq;
+        vq = s*v + c*vq;
+    }
+
+    /* Fixed-sweep cyclic Jacobi on the upper part of a symmetric matrix.
+       Leaves the eigenvalues on the diagonal, the eigenvectors are in
+       columns of v, both unsorted. */
+    template<class T> void jacobi3x3(T& s00, T& s11, T& s22, T& s01, T& s02, T& s12, Matrix3x3<T>& v) {
+        v = Matrix3x3<T>{IdentityInit};
+        for(std::size_t i = 0; i != Jacobi3x3Sweeps<T>::Value; ++i) {
+            jacobiRotate(s00, s11, s01, s02, s12, v[0], v[1]);
+            jacobiRotate(s00, s22, s02, s01, s12, v[0], v[2]);
+            jacobiRotate(s11, s22, s12, s01, s02, v[1], v[2]);
+        }
+    }
+
+    /* Givens rotation of rows p and q zeroing element in row q of given
+       column, accumulated into columns of q */
+    template<class T> void givensRotate(Matrix3x3<T>& b, Matrix3x3<T>& q, std::size_t col, std::size_t p, std::size_t r) {
+        const T x = b[col][p];
+        const T y = b[col][r];
+        const T rho = std::sqrt(x*x + y*y);
+        const bool nonzero = rho > std::numeric_limits<T>::min();
+        const T c = nonzero ? x/rho : T(1);
+        const T s = nonzero ? y/rho : T(0);
+
+        for(std::size_t i = 0; i != 3; ++i) {
+            const T bp = b[i][p];
+            b[i][p] = c*bp + s*b[i][r];
+            b[i][r] = c*b[i][r] - s*bp;
+        }
+        const Vector<3, T> qp = q[p];
+        q[p] = c*qp + s*q[r];
+        q[r] = c*q[r] - s*qp;
+    }
+
+    /* Swaps columns i and j of both matrices if the second column has
+       larger value */
+    template<class T> void sortColumns3x3(Vector3<T>& values, Matrix3x3<T>& a, Matrix3x3<T>& b, std::size_t i, std::size_t j) {
+        if(values[j] > values[i]) {
+            std::swap(values[i], values[j]);
+            std::swap(a[i], a[j]);
+            std::swap(b[i], b[j]);
+        }
+    }
+
+    /* Batch kernels, specialized for floats when SIMD is available. Return
+       count of processed matrices, the rest is done with plain loop. */
+    template<class T> struct Svd3x3Kernels {
+        static std::size_t symmetricEigen(const T*, T*, T*, std::size_t) { return 0; }
+        static std::size_t svd(const T*, T*, T*, T*, std::size_t) { return 0; }
+    };
+
+    #ifdef MAGNUM_MATH_SIMD
+    template<> struct Svd3x3Kernels<Float> {
+        static std::size_t symmetricEigen(const Float* matrices, Float* eigenvalues, Float* eigenvectors, std::size_t count) {
+            return Math::Implementation::Simd::symmetricEigen3x3(matrices, eigenvalues, eigenvectors, count, Jacobi3x3Sweeps<Float>::Value);
+        }
+        static std::size_t svd(const Float* matrices, Float* u, Float* w, Float* v, std::size_t count) {
+            return Math::Implementation::Simd::svd3x3(matrices, u, w, v, count, Jacobi3x3Sweeps<Float>::Value);
+        }
+    };
+    #endif
+}
+
+/**
+@brief Eigen decomposition of symmetric 3x3 matrix
+@param matrix   Symmetric matrix
+@return Eigenvalues and matrix with corresponding eigenvectors in columns
+
+Specialized alternative to @ref svd() for symmetric 3x3 matrices such as
+inertia tensors or covariance matrices. Uses fixed count of cyclic Jacobi
+sweeps with branchless rotations, so the execution time doesn't depend on the
+input. Only the upper part of the matrix is used. The eigenvalues are sorted
+in descending order, the eigenvector matrix is orthonormal, but its
+determinant can be @f$ -1 @f$.
+@see @ref svd3x3()
+*/
+template<class T> std::pair<Vector3<T>, Matrix3x3<T>> symmetricEigen3x3(const Matrix3x3<T>& matrix) {
+    T s00 = matrix[0][0], s11 = matrix[1][1], s22 = matrix[2][2],
+      s01 = matrix[1][0], s02 = matrix[2][0], s12 = matrix[2][1];
+    Matrix3x3<T> v{NoInit};
+    Implementation::jacobi3x3(s00, s11, s22, s01, s02, s12, v);
+
+    Vector3<T> values{s00, s11, s22};
+    Matrix3x3<T> unused{NoInit};
+    Implementation::sortColumns3x3(values, v, unused, 0, 1);
+    Implementation::sortColumns3x3(values, v, unused, 0, 2);
+    Implementation::sortColumns3x3(values, v, unused, 1, 2);
+    return {values, v};
+}
+
+/**
+@brief Singular value decomposition of 3x3 matrix
+@return Tuple with orthonormal matrix @f$ \boldsymbol{U} @f$, singular values
+    and orthonormal matrix @f$ \boldsymbol{V} @f$
+
+Specialized alternative to @ref svd() for 3x3 matrices, returning the same
+decomposition @f$ \boldsymbol{M} = \boldsymbol{U} \boldsymbol{\Sigma} \boldsymbol{V}^T @f$.
+Unlike @ref svd() the singular values are sorted in descending order.
+
+The matrix @f$ \boldsymbol{V} @f$ is calculated using
+@ref symmetricEigen3x3() of @f$ \boldsymbol{M}^T \boldsymbol{M} @f$, the
+columns of @f$ \boldsymbol{M} \boldsymbol{V} @f$ are then sorted by their
+length and @f$ \boldsymbol{U} @f$ with the singular values are extracted from
+its QR decomposition done with Givens rotations. Because of the squaring,
+absolute precision of the smallest singular values is relative to the largest
+one.
+
+Implementation based on *McAdams, A.; Selle, A.; Tamstorf, R.; Teran, J.;
+Sifakis, E. (2011). "Computing the singular value decomposition of 3x3
+matrices with minimal branching and elementary floating point operations"*,
+but using exact Jacobi rotations instead of approximate quaternion ones.
+*/
+template<class T> std::tuple<Matrix3x3<T>, Vector3<T>, Matrix3x3<T>> svd3x3(const Matrix3x3<T>& matrix) {
+    T s00 = dot(matrix[0], matrix[0]), s11 = dot(matrix[1], matrix[1]),
+      s22 = dot(matrix[2], matrix[2]), s01 = dot(matrix[0], matrix[1]),
+      s02 = dot(matrix[0], matrix[2]), s12 = dot(matrix[1], matrix[2]);
+    Matrix3x3<T> v{NoInit};
+    Implementation::jacobi3x3(s00, s11, s22, s01, s02, s12, v);
+
+    /* Sort by lengths of the resulting columns instead of the eigenvalues,
+       as these are more precise */
+    Matrix3x3<T> b = matrix*v;
+    Vector3<T> lengths{b[0].dot(), b[1].dot(), b[2].dot()};
+    Implementation::sortColumns3x3(lengths, b, v, 0, 1);
+    Implementation::sortColumns3x3(lengths, b, v, 0, 2);
+    Implementation::sortColumns3x3(lengths, b, v, 1, 2);
+
+    /* QR decomposition, the R is diagonal, all elements except the last are
+       non-negative */
+    Matrix3x3<T> u{IdentityInit};
+    Implementation::givensRotate(b, u, 0, 0, 1);
+    Implementation::givensRotate(b, u, 0, 0, 2);
+    Implementation::givensRotate(b, u, 1, 1, 2);
+    if(b[2][2] < T(0)) u[2] = -u[2];
+
+    return std::make_tuple(u, Vector3<T>{b[0][0], b[1][1], std::abs(b[2][2])}, v);
+}
+
+/**
+@brief Eigen decomposition of many symmetric 3x3 matrices
+@param[in] matrices         Symmetric matrices
+@param[out] eigenvalues     Where to put the eigenvalues
+@param[out] eigenvectors    Where to put the eigenvectors
+
+Equivalent to calling @ref symmetricEigen3x3(const Matrix3x3<T>&) on each item,
+but for @ref Magnum::Float "Float" four matrices are processed at once when
+Magnum is built with `BUILD_SIMD` enabled. Expects that all arrays have the
+same size.
+*/
+template<class T, class U> void symmetricEigen3x3(Corrade::Containers::ArrayView<U> matrices, Corrade::Containers::ArrayView<Vector3<T>> eigenvalues, Corrade::Containers::ArrayView<Matrix3x3<T>> eigenvectors) {
+    static_assert(std::is_same<typename std::remove_const<U>::type, Matrix3x3<T>>::value, "Math::Algorithms::symmetricEigen3x3(): expected input and output matrices of the same type");
+    CORRADE_ASSERT(eigenvalues.size() == matrices.size() && eigenvectors.size() == matrices.size(),
+        "Math::Algorithms::symmetricEigen3x3(): expected" << matrices.size() << "eigenvalues and eigenvectors but got" << eigenvalues.size() << "and" << eigenvectors.size(), );
+
+    const std::size_t processed = Implementation::Svd3x3Kernels<T>::symmetricEigen(reinterpret_cast<const T*>(matrices.data()), reinterpret_cast<T*>(eigenvalues.data()), reinterpret_cast<T*>(eigenvectors.data()), matrices.size());
+    for(std::size_t i = processed; i != matrices.size(); ++i)
+        std::tie(eigenvalues[i], eigenvectors[i]) = symmetricEigen3x3(matrices[i]);
+}
+
+/**
+@brief Singular value decomposition of many 3x3 matrices
+@param[in] matrices Matrices
+@param[out] u       Where to put the @f$ \boldsymbol{U} @f$ matrices
+@param[out] w       Where to put the singular values
+@param[out] v       Where to put the @f$ \boldsymbol{V} @f$ matrices
+
+Equivalent to calling @ref svd3x3(const Matrix3x3<T>&) on each item, but for
+@ref Magnum::Float "Float" four matrices are processed at once when Magnum is
+built with `BUILD_SIMD` enabled. Expects that all arrays have the same size.
+*/
+template<class T, class U> void svd3x3(Corrade::Containers::ArrayView<U> matrices, Corrade::Containers::ArrayView<Matrix3x3<T>> u, Corrade::Containers::ArrayView<Vector3<T>> w, Corrade::Containers::ArrayView<Matrix3x3<T>> v) {
+    static_assert(std::is_same<typename std::remove_const<U>::type, Matrix3x3<T>>::value, "Math::Algorithms::svd3x3(): expected input and output matrices of the same type");
+    CORRADE_ASSERT(u.size() == matrices.size() && w.size() == matrices.size() && v.size() == matrices.size(),
+        "Math::Algorithms::svd3x3(): expected" << matrices.size() << "decompositions but got" << u.size() << "U," << w.size() << "W and" << v.size() << "V", );
+
+    const std::size_t processed = Implementation::Svd3x3Kernels<T>::svd(reinterpret_cast<const T*>(matrices.data()), reinterpret_cast<T*>(u.data()), reinterpret_cast<T*>(w.data()), reinterpret_cast<T*>(v.data()), matrices.size());
+    for(std::size_t i = processed; i != matrices.size(); ++i)
+        std::tie(u[i], w[i], v[i]) = svd3x3(matrices[i]);
+}
+
+}}}
+
+#endif
@@ -0,0 +1,126 @@
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#include <vector>
+#include <Corrade/TestSuite/Tester.h>
+
+#include "Magnum/Math/Algorithms/Svd.h"
+#include "Magnum/Math/Algorithms/Svd3x3.h"
+#include "Magnum/Test/Benchmark.h"
+
+namespace Magnum { namespace Math { namespace Algorithms { namespace Test {
+
+/* Compares the generic SVD with the specialized 3x3 one and its batch variant
+   on 100k matrices */
+struct Svd3x3Benchmark: Corrade::TestSuite::Tester {
+    explicit Svd3x3Benchmark();
+
+    void symmetricEigen();
+    void svd();
+};
+
+typedef Math::Matrix3x3<Float> Matrix3x3;
+typedef Math::Vector3<Float> Vector3;
+
+Svd3x3Benchmark::Svd3x3Benchmark() {
+    addTests({&Svd3x3Benchmark::symmetricEigen,
+              &Svd3x3Benchmark::svd});
+}
+
+namespace {
+    enum: std::size_t { Count = 100000 };
+
+    std::vector<Matrix3x3> matrices(bool symmetric) {
+        std::vector<Matrix3x3> out;
+        out.reserve(Count);
+        for(std::size_t i = 0; i != Count; ++i) {
+            Matrix3x3 m;
+            for(std::size_t j = 0; j != 9; ++j)
+                m.data()[j] = Float((i*7919 + j*104729) % 10007)*0.002f - 10.0f;
+            out.push_back(symmetric ? m*m.transposed() : m);
+        }
+        return out;
+    }
+
+    using Magnum::Test::measure;
+}
+
+void Svd3x3Benchmark::symmetricEigen() {
+    const std::vector<Matrix3x3> in = matrices(true);
+    std::vector<Vector3> values(Count);
+    std::vector<Matrix3x3> vectors(Count);
+
+    const std::int64_t generic = measure([&]() {
+        for(std::size_t i = 0; i != Count; ++i) {
+            RectangularMatrix<3, 3, Float> u;
+            std::tie(u, values[i], vectors[i]) = Algorithms::svd(RectangularMatrix<3, 3, Float>{in[i]});
+        }
+    });
+    const std::int64_t perItem = measure([&]() {
+        for(std::size_t i = 0; i != Count; ++i)
+            std::tie(values[i], vectors[i]) = Algorithms::symmetricEigen3x3(in[i]);
+    });
+    const Vector3 expected = values[Count - 1];
+    const std::int64_t batch = measure([&]() {
+        Algorithms::symmetricEigen3x3(Corrade::Containers::ArrayView<const Matrix3x3>{in.data(), in.size()},
+            Corrade::Containers::ArrayView<Vector3>{values.data(), values.size()},
+            Corrade::Containers::ArrayView<Matrix3x3>{vectors.data(), vectors.size()});
+    });
+
+    CORRADE_COMPARE(values[Count - 1], expected);
+    Corrade::Utility::Debug() << "symmetricEigen3x3() generic SVD:" << generic << "us, per item:" << perItem << "us, batch:" << batch << "us";
+}
+
+void Svd3x3Benchmark::svd() {
+    const std::vector<Matrix3x3> in = matrices(false);
+    std::vector<Matrix3x3> u(Count), v(Count);
+    std::vector<Vector3> w(Count);
+
+    const std::int64_t generic = measure([&]() {
+        for(std::size_t i = 0; i != Count; ++i) {
+            RectangularMatrix<3, 3, Float> uPart;
+            std::tie(uPart, w[i], v[i]) = Algorithms::svd(RectangularMatrix<3, 3, Float>{in[i]});
+            u[i] = Matrix3x3{uPart};
+        }
+    });
+    const std::int64_t perItem = measure([&]() {
+        for(std::size_t i = 0; i != Count; ++i)
+            std::tie(u[i], w[i], v[i]) = Algorithms::svd3x3(in[i]);
+    });
+    const Vector3 expected = w[Count - 1];
+    const std::int64_t batch = measure([&]() {
+        Algorithms::svd3x3(Corrade::Containers::ArrayView<const Matrix3x3>{in.data(), in.size()},
+            Corrade::Containers::ArrayView<Matrix3x3>{u.data(), u.size()},
+            Corrade::Containers::ArrayView<Vector3>{w.data(), w.size()},
+            Corrade::Containers::ArrayView<Matrix3x3>{v.data(), v.size()});
+    });
+
+    CORRADE_COMPARE(w[Count - 1], expected);
+    Corrade::Utility::Debug() << "svd3x3() generic SVD:" << generic << "us, per item:" << perItem << "us, batch:" << batch << "us";
+}
+
+}}}}
+
+CORRADE_TEST_MAIN(Magnum::Math::Algorithms::Test::Svd3x3Benchmark)
@@ -0,0 +1,267 @@
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#include <algorithm>
+#include <sstream>
+#include <vector>
+#include <Corrade/TestSuite/Tester.h>
+
+#include "Magnum/Math/Algorithms/Svd.h"
+#include "Magnum/Math/Algorithms/Svd3x3.h"
+
+namespace Magnum { namespace Math { namespace Algorithms { namespace Test {
+
+struct Svd3x3Test: Corrade::TestSuite::Tester {
+    explicit Svd3x3Test();
+
+    void symmetricEigen();
+    void symmetricEigenDegenerate();
+    void svdDouble();
+    void svdFloat();
+    void svdRankDeficient();
+    void svdCompareGeneric();
+
+    void symmetricEigenBatch();
+    void svdBatch();
+    void batchSizeMismatch();
+};
+
+typedef Math::Matrix3x3<Float> Matrix3x3;
+typedef Math::Matrix3x3<Double> Matrix3x3d;
+typedef Math::Vector3<Float> Vector3;
+typedef Math::Vector3<Double> Vector3d;
+
+Svd3x3Test::Svd3x3Test() {
+    addTests({&Svd3x3Test::symmetricEigen,
+              &Svd3x3Test::symmetricEigenDegenerate,
+              &Svd3x3Test::svdDouble,
+              &Svd3x3Test::svdFloat,
+              &Svd3x3Test::svdRankDeficient,
+              &Svd3x3Test::svdCompareGeneric,
+
+              &Svd3x3Test::symmetricEigenBatch,
+              &Svd3x3Test::svdBatch,
+              &Svd3x3Test::batchSizeMismatch});
+}
+
+namespace {
+    enum: std::size_t { Count = 23 };
+
+    /* Deterministic pseudo-random matrices with elements in [-10, 10] */
+    std::vector<Matrix3x3> matrices(bool symmetric) {
+        std::vector<Matrix3x3> out;
+        UnsignedInt seed = 1;
+        for(std::size_t i = 0; i != Count; ++i) {
+            Matrix3x3 m;
+            for(std::size_t col = 0; col != 3; ++col) for(std::size_t row = 0; row != 3; ++row) {
+                seed = seed*1664525u + 1013904223u;
+                m[col][row] = Float(seed >> 8)/Float(1 << 24)*20.0f - 10.0f;
+            }
+            out.push_back(symmetric ? m*m.transposed() : m);
+        }
+        return out;
+    }
+
+    template<class T> T maxDifference(const RectangularMatrix<3, 3, T>& a, const RectangularMatrix<3, 3, T>& b) {
+        return Math::abs((a - b).toVector()).max();
+    }
+}
+
+void Svd3x3Test::symmetricEigen() {
+    const Matrix3x3d a{Vector3d{4.0,  1.0, -2.0},
+                       Vector3d{1.0,  2.0,  0.0},
+                       Vector3d{-2.0, 0.0,  3.0}};
+
+    Vector3d values;
+    Matrix3x3d vectors;
+    std::tie(values, vectors) = Algorithms::symmetricEigen3x3(a);
+
+    /* Sorted in descending order */
+    CORRADE_VERIFY(values[0] >= values[1]);
+    CORRADE_VERIFY(values[1] >= values[2]);
+
+    /* Eigenvalues sum to the trace */
+    CORRADE_COMPARE(values.sum(), 9.0);
+
+    /* Orthonormal eigenvectors, composition gives back the original */
+    CORRADE_COMPARE(vectors.transposed()*vectors, Matrix3x3d{IdentityInit});
+    CORRADE_COMPARE(vectors*Matrix3x3d::fromDiagonal(values)*vectors.transposed(), a);
+    for(std::size_t i = 0; i != 3; ++i)
+        CORRADE_COMPARE(a*vectors[i], vectors[i]*values[i]);
+}
+
+void Svd3x3Test::symmetricEigenDegenerate() {
+    /* Already diagonal, the rotations have zero angle */
+    Vector3 values;
+    Matrix3x3 vectors;
+    std::tie(values, vectors) = Algorithms::symmetricEigen3x3(Matrix3x3::fromDiagonal({1.0f, 3.0f, 2.0f}));
+    CORRADE_COMPARE(values, (Vector3{3.0f, 2.0f, 1.0f}));
+    CORRADE_COMPARE(vectors, (Matrix3x3{Vector3::yAxis(), Vector3::zAxis(), Vector3::xAxis()}));
+
+    /* Zero matrix and repeated eigenvalues shouldn't produce NaNs */
+    std::tie(values, vectors) = Algorithms::symmetricEigen3x3(Matrix3x3{ZeroInit});
+    CORRADE_COMPARE(values, Vector3{});
+    CORRADE_COMPARE(vectors, Matrix3x3{IdentityInit});
+
+    const Matrix3x3 a{Vector3{2.0f, 1.0f, 1.0f},
+                      Vector3{1.0f, 2.0f, 1.0f},
+                      Vector3{1.0f, 1.0f, 2.0f}};
+    std::tie(values, vectors) = Algorithms::symmetricEigen3x3(a);
+    CORRADE_COMPARE(values, (Vector3{4.0f, 1.0f, 1.0f}));
+    CORRADE_COMPARE(vectors.transposed()*vectors, Matrix3x3{IdentityInit});
+    CORRADE_COMPARE(vectors*Matrix3x3::fromDiagonal(values)*vectors.transposed(), a);
+}
+
+void Svd3x3Test::svdDouble() {
+    const Matrix3x3d a{Vector3d{ 3.0, -1.0, 7.0},
+                       Vector3d{ 0.5,  4.0, 2.0},
+                       Vector3d{-6.0,  2.0, 1.0}};
+
+    Matrix3x3d u, v;
+    Vector3d w;
+    std::tie(u, w, v) = Algorithms::svd3x3(a);
+
+    CORRADE_COMPARE(u*Matrix3x3d::fromDiagonal(w)*v.transposed(), a);
+    CORRADE_COMPARE(u.transposed()*u, Matrix3x3d{IdentityInit});
+    CORRADE_COMPARE(v.transposed()*v, Matrix3x3d{IdentityInit});
+    CORRADE_VERIFY(w[0] >= w[1]);
+    CORRADE_VERIFY(w[1] >= w[2]);
+    CORRADE_VERIFY(w[2] >= 0.0);
+
+    /* Product of singular values is absolute value of the determinant */
+    CORRADE_COMPARE(w.product(), std::abs(a.determinant()));
+}
+
+void Svd3x3Test::svdFloat() {
+    /* Negative determinant, U has to compensate for that */
+    const Matrix3x3 a{Vector3{ 3.0f, -1.0f, 7.0f},
+                      Vector3{-6.0f,  2.0f, 1.0f},
+                      Vector3{ 0.5f,  4.0f, 2.0f}};
+
+    Matrix3x3 u, v;
+    Vector3 w;
+    std::tie(u, w, v) = Algorithms::svd3x3(a);
+
+    /* Single precision is not enough, test for similarity */
+    CORRADE_VERIFY(maxDifference(u*Matrix3x3::fromDiagonal(w)*v.transposed(), a) < 1.0e-5f*w[0]);
+    CORRADE_COMPARE(u.transposed()*u, Matrix3x3{IdentityInit});
+    CORRADE_COMPARE(v.transposed()*v, Matrix3x3{IdentityInit});
+    CORRADE_VERIFY(w[0] >= w[1]);
+    CORRADE_VERIFY(w[1] >= w[2]);
+    CORRADE_VERIFY(w[2] >= 0.0f);
+}
+
+void Svd3x3Test::svdRankDeficient() {
+    /* Rank one, U still has to be orthonormal */
+    const Matrix3x3 a{Vector3{1.0f, 2.0f, 3.0f},
+                      Vector3{2.0f, 4.0f, 6.0f},
+                      Vector3{-1.0f, -2.0f, -3.0f}};
+
+    Matrix3x3 u, v;
+    Vector3 w;
+    std::tie(u, w, v) = Algorithms::svd3x3(a);
+    CORRADE_COMPARE(w[0], std::sqrt(14.0f*6.0f));
+    CORRADE_VERIFY(w[1] < 1.0e-5f*w[0]);
+    CORRADE_VERIFY(w[2] < 1.0e-5f*w[0]);
+    CORRADE_VERIFY(maxDifference(u*Matrix3x3::fromDiagonal(w)*v.transposed(), a) < 1.0e-5f*w[0]);
+    CORRADE_COMPARE(u.transposed()*u, Matrix3x3{IdentityInit});
+    CORRADE_COMPARE(v.transposed()*v, Matrix3x3{IdentityInit});
+
+    /* Zero matrix gives identities */
+    std::tie(u, w, v) = Algorithms::svd3x3(Matrix3x3{ZeroInit});
+    CORRADE_COMPARE(u, Matrix3x3{IdentityInit});
+    CORRADE_COMPARE(w, Vector3{});
+    CORRADE_COMPARE(v, Matrix3x3{IdentityInit});
+}
+
+void Svd3x3Test::svdCompareGeneric() {
+    for(const Matrix3x3& a: matrices(false)) {
+        Matrix3x3 u, v;
+        Vector3 w;
+        std::tie(u, w, v) = Algorithms::svd3x3(a);
+
+        /* The generic implementation doesn't sort the values */
+        RectangularMatrix<3, 3, Float> uGeneric;
+        Vector3 wGeneric;
+        Matrix3x3 vGeneric;
+        std::tie(uGeneric, wGeneric, vGeneric) = Algorithms::svd(RectangularMatrix<3, 3, Float>{a});
+        std::sort(wGeneric.data(), wGeneric.data() + 3, [](Float a, Float b) { return a > b; });
+
+        CORRADE_VERIFY(Math::abs(w - wGeneric).max() < 1.0e-5f*w[0]);
+        CORRADE_VERIFY(maxDifference(u*Matrix3x3::fromDiagonal(w)*v.transposed(), a) < 1.0e-5f*w[0]);
+    }
+}
+
+void Svd3x3Test::symmetricEigenBatch() {
+    const std::vector<Matrix3x3> in = matrices(true);
+    std::vector<Vector3> values(Count);
+    std::vector<Matrix3x3> vectors(Count);
+    Algorithms::symmetricEigen3x3(Corrade::Containers::ArrayView<const Matrix3x3>{in.data(), in.size()},
+        Corrade::Containers::ArrayView<Vector3>{values.data(), values.size()},
+        Corrade::Containers::ArrayView<Matrix3x3>{vectors.data(), vectors.size()});
+
+    for(std::size_t i = 0; i != Count; ++i) {
+        const std::pair<Vector3, Matrix3x3> expected = Algorithms::symmetricEigen3x3(in[i]);
+        CORRADE_COMPARE(values[i], expected.first);
+        CORRADE_COMPARE(vectors[i], expected.second);
+    }
+}
+
+void Svd3x3Test::svdBatch() {
+    const std::vector<Matrix3x3> in = matrices(false);
+    std::vector<Matrix3x3> u(Count), v(Count);
+    std::vector<Vector3> w(Count);
+    Algorithms::svd3x3(Corrade::Containers::ArrayView<const Matrix3x3>{in.data(), in.size()},
+        Corrade::Containers::ArrayView<Matrix3x3>{u.data(), u.size()},
+        Corrade::Containers::ArrayView<Vector3>{w.data(), w.size()},
+        Corrade::Containers::ArrayView<Matrix3x3>{v.data(), v.size()});
+
+    for(std::size_t i = 0; i != Count; ++i) {
+        Matrix3x3 expectedU, expectedV;
+        Vector3 expectedW;
+        std::tie(expectedU, expectedW, expectedV) = Algorithms::svd3x3(in[i]);
+        CORRADE_COMPARE(u[i], expectedU);
+        CORRADE_COMPARE(w[i], expectedW);
+        CORRADE_COMPARE(v[i], expectedV);
+    }
+}
+
+void Svd3x3Test::batchSizeMismatch() {
+    std::ostringstream out;
+    Error::setOutput(&out);
+
+    const Matrix3x3 in[3];
+    Matrix3x3 u[3], v[2];
+    Vector3 w[3];
+    Algorithms::symmetricEigen3x3(Corrade::Containers::ArrayView<const Matrix3x3>{in}, Corrade::Containers::ArrayView<Vector3>{w}, Corrade::Containers::ArrayView<Matrix3x3>{v});
+    Algorithms::svd3x3(Corrade::Containers::ArrayView<const Matrix3x3>{in}, Corrade::Containers::ArrayView<Matrix3x3>{u}, Corrade::Containers::ArrayView<Vector3>{w}, Corrade::Containers::ArrayView<Matrix3x3>{v});
+    CORRADE_COMPARE(out.str(),
+        "Math::Algorithms::symmetricEigen3x3(): expected 3 eigenvalues and eigenvectors but got 3 and 2\n"
+        "Math::Algorithms::svd3x3(): expected 3 decompositions but got 3 U, 3 W and 2 V\n");
+}
+
+}}}}
+
+CORRADE_TEST_MAIN(Magnum::Math::Algorithms::Test::Svd3x3Test)
@@ -0,0 +1,167 @@
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#include "Batch.h"
+
+#include <cstring>
+#include <limits>
+#include <Corrade/Utility/Assert.h>
+
+#include "Magnum/Math/Constants.h"
+
+namespace Magnum { namespace Math { namespace Implementation {
+
+namespace {
+
+/*
+    Linear -> sRGB conversion of floats in range [2^-13, 1] is done by
+    splitting the range into buckets by exponent and eight upper mantissa
+    bits. Each bucket is narrow enough to contain at most one boundary
+    between neighboring 8-bit codes, so the code is looked up for the bucket
+    start and then incremented if the value is above the threshold for the
+    next code. The thresholds are found by bisecting the scalar
+    implementation, which makes the result bit-identical to it. Everything
+    below 2^-13 rounds to zero.
+*/
+enum: Int {
+    BucketShift = 15,
+    BucketBase = (127 - 13) << (23 - BucketShift),
+    BucketCount = 13 << (23 - BucketShift)
+};
+
+inline Float bitsFloat(const UnsignedInt bits) {
+    Float value;
+    std::memcpy(&value, &bits, sizeof(Float));
+    return value;
+}
+
+inline UnsignedInt floatBits(const Float value) {
+    UnsignedInt bits;
+    std::memcpy(&bits, &value, sizeof(Float));
+    return bits;
+}
+
+inline UnsignedByte linearToSrgb8Reference(const Float value) {
+    return denormalizeRounded<UnsignedByte>(toSrgb(value));
+}
+
+struct SrgbTables {
+    SrgbTables();
+
+    Float toLinear[256];
+    UnsignedByte buckets[BucketCount + 1];
+    /* Lowest value giving given code, thresholds[256] is NaN */
+    Float thresholds[257];
+    Float minValue;
+};
+
+SrgbTables::SrgbTables() {
+    for(Int i = 0; i != 256; ++i)
+        toLinear[i] = fromSrgb(normalize<Float>(UnsignedByte(i)));
+
+    thresholds[0] = -Constants<Float>::inf();
+    for(Int code = 1; code != 256; ++code) {
+        UnsignedInt lo = 0, hi = floatBits(1.0f);
+        while(hi - lo > 1) {
+            const UnsignedInt mid = lo + (hi - lo)/2;
+            (linearToSrgb8Reference(bitsFloat(mid)) >= code ? hi : lo) = mid;
+        }
+        thresholds[code] = bitsFloat(hi);
+    }
+    /* NaN, so even infinity doesn't go over 255 */
+    thresholds[256] = Constants<Float>::nan();
+
+    minValue = bitsFloat(BucketBase << BucketShift);
+    CORRADE_INTERNAL_ASSERT(thresholds[1] > minValue);
+    for(Int i = 0; i <= BucketCount; ++i) {
+        const Float start = bitsFloat((BucketBase + i) << BucketShift);
+        const Float end = bitsFloat((BucketBase + i + 1) << BucketShift);
+        buckets[i] = linearToSrgb8Reference(start);
+        CORRADE_INTERNAL_ASSERT(buckets[i] >= 254 || thresholds[buckets[i] + 2] >= end);
+    }
+}
+
+inline UnsignedByte linearToSrgb8(const SrgbTables& tables, const Float value) {
+    /* Values below the range, negative values and NaNs are zeroed at the
+       end, the index only needs to be in bounds for them */
+    const UnsignedInt bits = floatBits(value);
+    const UnsignedInt index = bits < UnsignedInt(BucketBase << BucketShift) ? 0 :
+        Math::min((bits >> BucketShift) - BucketBase, UnsignedInt(BucketCount));
+    const UnsignedByte code = tables.buckets[index];
+    return UnsignedByte((code + UnsignedByte(value >= tables.thresholds[code + 1]))*UnsignedByte(value >= tables.minValue));
+}
+
+const SrgbTables& srgbTables() {
+    static const SrgbTables tables;
+    return tables;
+}
+
+#ifdef MAGNUM_MATH_SIMD_AVX2
+/* Lookup-table based 8-bit sRGB to linear conversion using gathers. Processes
+   eight components at a time, which is always two whole four-component
+   pixels, so alpha is in lanes 3 and 7. Returns count of processed
+   components. */
+std::size_t srgb8ToLinearGather(const UnsignedByte* in, Float* out, const std::size_t count, const bool alpha, const Float* table) {
+    const __m256 alphaScale = _mm256_set1_ps(255.0f);
+    std::size_t i = 0;
+    for(; i + 8 <= count; i += 8) {
+        const __m256i codes = _mm256_cvtepu8_epi32(_mm_loadl_epi64(reinterpret_cast<const __m128i*>(in + i)));
+        __m256 linear = _mm256_i32gather_ps(table, codes, 4);
+        if(alpha) linear = _mm256_blend_ps(linear, _mm256_div_ps(_mm256_cvtepi32_ps(codes), alphaScale), 0x88);
+        _mm256_storeu_ps(out + i, linear);
+    }
+    return i;
+}
+#endif
+
+}
+
+void srgb8ToLinear(const UnsignedByte* const in, Float* const out, const std::size_t count, const bool alpha) {
+    const SrgbTables& tables = srgbTables();
+
+    #ifdef MAGNUM_MATH_SIMD_AVX2
+    const std::size_t processed = srgb8ToLinearGather(in, out, count, alpha, tables.toLinear);
+    #else
+    const std::size_t processed = 0;
+    #endif
+    for(std::size_t i = processed; i != count; ++i)
+        out[i] = alpha && i % 4 == 3 ? normalize<Float>(in[i]) : tables.toLinear[in[i]];
+}
+
+void linearToSrgb8(const Float* const in, UnsignedByte* const out, const std::size_t count, const bool alpha) {
+    const SrgbTables& tables = srgbTables();
+
+    /* An AVX2 variant using two dependent gathers was measured to be slower
+       than this */
+    if(alpha) for(std::size_t i = 0; i != count; i += 4) {
+        out[i + 0] = linearToSrgb8(tables, in[i + 0]);
+        out[i + 1] = linearToSrgb8(tables, in[i + 1]);
+        out[i + 2] = linearToSrgb8(tables, in[i + 2]);
+        out[i + 3] = denormalizeRounded<UnsignedByte>(in[i + 3]);
+    } else for(std::size_t i = 0; i != count; ++i)
+        out[i] = linearToSrgb8(tables, in[i]);
+}
+
+}}}
@@ -0,0 +1,488 @@
+#ifndef Magnum_Math_Batch_h
+#define Magnum_Math_Batch_h
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+/** @file
+ * @brief Namespace @ref Magnum::Math::Batch
+ */
+
+#include <tuple>
+#include <type_traits>
+#include <utility>
+#include <Corrade/Containers/ArrayView.h>
+
+#include "Magnum/visibility.h"
+#include "Magnum/Math/Color.h"
+#include "Magnum/Math/FastFunctions.h"
+#include "Magnum/Math/Functions.h"
+#include "Magnum/Math/Matrix3.h"
+#include "Magnum/Math/Matrix4.h"
+#include "Magnum/Math/Packing.h"
+#include "Magnum/Math/Quaternion.h"
+#include "Magnum/Math/Range.h"
+
+#ifdef MAGNUM_BUILD_SIMD
+#include "Magnum/Math/simdImplementation.h"
+#endif
+
+namespace Magnum { namespace Math {
+
+namespace Implementation {
+    /* Component type and count of scalar and vector types */
+    template<class T, bool = std::is_arithmetic<T>::value || std::is_same<T, Half>::value> struct BatchComponents {
+        typedef T Type;
+        enum: std::size_t { Size = 1 };
+    };
+    template<class T> struct BatchComponents<T, false> {
+        typedef typename T::Type Type;
+        enum: std::size_t { Size = T::Size };
+    };
+
+    /* Generic kernels, specialized below for SIMD-enabled types. The
+       functions return count of processed items, the rest is done with
+       plain loop. */
+    template<std::size_t size, class T> struct BatchKernels {
+        static std::size_t normalize(T*, std::size_t) { return 0; }
+        static std::size_t minmax(const T*, std::size_t, T*, T*) { return 0; }
+        static std::size_t transform(const Matrix4<T>&, T, T*, std::size_t) { return 0; }
+    };
+
+    #ifdef MAGNUM_MATH_SIMD
+    template<> struct BatchKernels<2, Float> {
+        static std::size_t normalize(Float* data, std::size_t count) {
+            return Simd::normalize2(data, count);
+        }
+        static std::size_t minmax(const Float* data, std::size_t count, Float* min, Float* max) {
+            return Simd::minmax<2>(data, count, min, max);
+        }
+        static std::size_t transform(const Matrix4<Float>&, Float, Float*, std::size_t) { return 0; }
+    };
+    template<> struct BatchKernels<3, Float> {
+        static std::size_t normalize(Float* data, std::size_t count) {
+            return Simd::normalize3(data, count);
+        }
+        static std::size_t minmax(const Float* data, std::size_t count, Float* min, Float* max) {
+            return Simd::minmax<3>(data, count, min, max);
+        }
+        static std::size_t transform(const Matrix4<Float>& matrix, Float w, Float* data, std::size_t count) {
+            return Simd::transform3(matrix.data(), w, data, count);
+        }
+    };
+    template<> struct BatchKernels<4, Float> {
+        static std::size_t normalize(Float* data, std::size_t count) {
+            return Simd::normalize4(data, count);
+        }
+        static std::size_t minmax(const Float* data, std::size_t count, Float* min, Float* max) {
+            return Simd::minmax<4>(data, count, min, max);
+        }
+        static std::size_t transform(const Matrix4<Float>&, Float, Float*, std::size_t) { return 0; }
+    };
+    #endif
+
+    /* Products of 4x4 matrices and quaternions, specialized for floats when
+       SIMD is available. The operators are kept generic to stay usable in
+       constant expressions, so this is the only place where the SIMD
+       kernels are used for them. Return count of processed items. */
+    template<class T> struct MultiplyKernels {
+        static std::size_t matrix4(const T*, T*, std::size_t) { return 0; }
+        static std::size_t quaternion(const T*, T*, std::size_t) { return 0; }
+    };
+
+    #ifdef MAGNUM_MATH_SIMD
+    template<> struct MultiplyKernels<Float> {
+        static std::size_t matrix4(const Float* matrix, Float* data, std::size_t count) {
+            for(std::size_t i = 0; i != count; ++i)
+                Simd::multiplyMatrix(matrix, data + i*16, data + i*16);
+            return count;
+        }
+        static std::size_t quaternion(const Float* quaternion, Float* data, std::size_t count) {
+            for(std::size_t i = 0; i != count; ++i)
+                Simd::multiplyQuaternion(quaternion, data + i*4, data + i*4);
+            return count;
+        }
+    };
+    #endif
+
+    /* Fast approximation kernels, specialized for floats when SIMD is
+       available. Return count of processed values. */
+    template<class T> struct FastKernels {
+        static std::size_t sincos(const T*, T*, T*, std::size_t) { return 0; }
+        static std::size_t sqrtInverted(const T*, T*, std::size_t) { return 0; }
+        static std::size_t acos(const T*, T*, std::size_t) { return 0; }
+    };
+
+    #ifdef MAGNUM_MATH_SIMD_SSE2
+    template<> struct FastKernels<Float> {
+        static std::size_t sincos(const Float* in, Float* sines, Float* cosines, std::size_t count) {
+            return Simd::fastSincos(in, sines, cosines, count);
+        }
+        static std::size_t sqrtInverted(const Float* in, Float* out, std::size_t count) {
+            return Simd::fastSqrtInverted(in, out, count);
+        }
+        static std::size_t acos(const Float* in, Float* out, std::size_t count) {
+            return Simd::fastAcos(in, out, count);
+        }
+    };
+    #endif
+
+    /* Lookup-table based conversion between 8-bit sRGB and linear floats.
+       The count is in components, if alpha is set, every fourth component is
+       treated as alpha and converted linearly. */
+    void MAGNUM_EXPORT srgb8ToLinear(const UnsignedByte* in, Float* out, std::size_t count, bool alpha);
+    void MAGNUM_EXPORT linearToSrgb8(const Float* in, UnsignedByte* out, std::size_t count, bool alpha);
+}
+
+namespace Batch {
+
+/**
+@brief Component-wise minimum and maximum of given values
+
+Equivalent to calling @ref Math::minmax() on all items of the array. Expects
+that the array is not empty. Useful for computing bounding box of a point
+cloud.
+*/
+template<class T> std::pair<typename std::remove_const<T>::type, typename std::remove_const<T>::type> minmax(const Corrade::Containers::ArrayView<T> values) {
+    typedef typename std::remove_const<T>::type Type;
+    typedef Implementation::BatchComponents<Type> Components;
+    CORRADE_ASSERT(!values.empty(), "Math::Batch::minmax(): the array is empty", {});
+
+    std::pair<Type, Type> out{values[0], values[0]};
+    const std::size_t processed = Implementation::BatchKernels<Components::Size, typename Components::Type>::minmax(reinterpret_cast<const typename Components::Type*>(values.data()), values.size(), reinterpret_cast<typename Components::Type*>(&out.first), reinterpret_cast<typename Components::Type*>(&out.second));
+    for(std::size_t i = processed; i != values.size(); ++i) {
+        out.first = Math::min(values[i], out.first);
+        out.second = Math::max(values[i], out.second);
+    }
+
+    return out;
+}
+
+/**
+@brief Range containing given points
+
+Calculates the bounds using @ref minmax(), thus for two- and three-component
+@ref Magnum::Float "Float" vectors it uses SIMD when Magnum is built with
+`BUILD_SIMD` enabled. Expects that the array is not empty.
+*/
+template<class T> Range<Implementation::BatchComponents<typename std::remove_const<T>::type>::Size, typename Implementation::BatchComponents<typename std::remove_const<T>::type>::Type> range(const Corrade::Containers::ArrayView<T> points) {
+    CORRADE_ASSERT(!points.empty(), "Math::Batch::range(): the array is empty", {});
+    const auto bounds = minmax(points);
+    return {bounds.first, bounds.second};
+}
+
+/**
+@brief Normalize vectors in-place
+
+Equivalent to replacing each item with @ref Vector::normalized().
+*/
+template<class T> void normalizeInPlace(const Corrade::Containers::ArrayView<T> vectors) {
+    typedef Implementation::BatchComponents<T> Components;
+    const std::size_t processed = Implementation::BatchKernels<Components::Size, typename Components::Type>::normalize(reinterpret_cast<typename Components::Type*>(vectors.data()), vectors.size());
+    for(std::size_t i = processed; i != vectors.size(); ++i)
+        vectors[i] = vectors[i].normalized();
+}
+
+/**
+@brief Transform vectors in-place using given matrix
+
+Equivalent to replacing each item with @ref Matrix3::transformVector() or
+@ref Matrix4::transformVector().
+@see @ref transformPointsInPlace()
+*/
+template<class T, class U> void transformVectorsInPlace(const Matrix4<T>& matrix, const Corrade::Containers::ArrayView<U> vectors) {
+    static_assert(Implementation::BatchComponents<U>::Size == 3, "Math::Batch::transformVectorsInPlace(): expected three-component vectors");
+    const std::size_t processed = Implementation::BatchKernels<3, T>::transform(matrix, T(0), reinterpret_cast<T*>(vectors.data()), vectors.size());
+    for(std::size_t i = processed; i != vectors.size(); ++i)
+        vectors[i] = matrix.transformVector(vectors[i]);
+}
+
+/** @overload */
+template<class T, class U> void transformVectorsInPlace(const Matrix3<T>& matrix, const Corrade::Containers::ArrayView<U> vectors) {
+    for(U& vector: vectors) vector = matrix.transformVector(vector);
+}
+
+/**
+@brief Transform points in-place using given matrix
+
+Equivalent to replacing each item with @ref Matrix3::transformPoint() or
+@ref Matrix4::transformPoint().
+@see @ref transformVectorsInPlace()
+*/
+template<class T, class U> void transformPointsInPlace(const Matrix4<T>& matrix, const Corrade::Containers::ArrayView<U> points) {
+    static_assert(Implementation::BatchComponents<U>::Size == 3, "Math::Batch::transformPointsInPlace(): expected three-component vectors");
+    const std::size_t processed = Implementation::BatchKernels<3, T>::transform(matrix, T(1), reinterpret_cast<T*>(points.data()), points.size());
+    for(std::size_t i = processed; i != points.size(); ++i)
+        points[i] = matrix.transformPoint(points[i]);
+}
+
+/** @overload */
+template<class T, class U> void transformPointsInPlace(const Matrix3<T>& matrix, const Corrade::Containers::ArrayView<U> points) {
+    for(U& point: points) point = matrix.transformPoint(point);
+}
+
+/**
+@brief Multiply matrices in-place with given matrix
+
+Replaces each item @f$ \boldsymbol{M}_i @f$ of the array with
+@f$ \boldsymbol{A} \boldsymbol{M}_i @f$, i.e. the @p matrix is applied
+after the original transformation. Equivalent to multiplying each item using
+@ref Matrix::operator*(), but for 4x4 float matrices the products are
+calculated using SIMD instructions if enabled at compile time.
+*/
+template<std::size_t size, class T, class U> void multiplyInPlace(const Matrix<size, T>& matrix, const Corrade::Containers::ArrayView<U> matrices) {
+    static_assert(sizeof(U) == sizeof(Matrix<size, T>), "Math::Batch::multiplyInPlace(): expected square matrices of the same size");
+    const std::size_t processed = size == 4 ? Implementation::MultiplyKernels<T>::matrix4(matrix.data(), reinterpret_cast<T*>(matrices.data()), matrices.size()) : 0;
+    for(std::size_t i = processed; i != matrices.size(); ++i)
+        matrices[i] = U(matrix*matrices[i]);
+}
+
+/**
+@brief Multiply quaternions in-place with given quaternion
+
+Replaces each item @f$ q_i @f$ of the array with @f$ q q_i @f$. Equivalent
+to multiplying each item using @ref Quaternion::operator*(), but for float
+quaternions the products are calculated using SIMD instructions if enabled at
+compile time.
+*/
+template<class T, class U> void multiplyInPlace(const Quaternion<T>& quaternion, const Corrade::Containers::ArrayView<U> quaternions) {
+    static_assert(std::is_same<typename std::remove_const<U>::type, Quaternion<T>>::value, "Math::Batch::multiplyInPlace(): expected quaternions of the same type");
+    const std::size_t processed = Implementation::MultiplyKernels<T>::quaternion(reinterpret_cast<const T*>(&quaternion), reinterpret_cast<T*>(quaternions.data()), quaternions.size());
+    for(std::size_t i = processed; i != quaternions.size(); ++i)
+        quaternions[i] = quaternion*quaternions[i];
+}
+
+/**
+@brief Normalize integral values
+
+Equivalent to calling @ref Math::normalize() on each item of @p in and
+storing the result in @p out, e.g. for converting @ref Color3ub array to
+@ref Color3. Expects that both arrays have the same size.
+*/
+template<class Integral, class FloatingPoint> void normalize(const Corrade::Containers::ArrayView<Integral> in, const Corrade::Containers::ArrayView<FloatingPoint> out) {
+    typedef Implementation::BatchComponents<typename std::remove_const<Integral>::type> InComponents;
+    typedef Implementation::BatchComponents<FloatingPoint> OutComponents;
+    static_assert(std::size_t(InComponents::Size) == std::size_t(OutComponents::Size), "Math::Batch::normalize(): input and output component count differs");
+    CORRADE_ASSERT(in.size() == out.size(), "Math::Batch::normalize(): expected output array of size" << in.size() << "but got" << out.size(), );
+
+    /* Operating on components directly to make the loop easy to
+       auto-vectorize */
+    const auto* const input = reinterpret_cast<const typename InComponents::Type*>(in.data());
+    auto* const output = reinterpret_cast<typename OutComponents::Type*>(out.data());
+    for(std::size_t i = 0, count = in.size()*InComponents::Size; i != count; ++i)
+        output[i] = Math::normalize<typename OutComponents::Type>(input[i]);
+}
+
+/**
+@brief Denormalize floating-point values
+
+Equivalent to calling @ref Math::denormalize() on each item of @p in and
+storing the result in @p out, e.g. for converting @ref Color3 array to
+@ref Color3ub. Expects that both arrays have the same size.
+*/
+template<class FloatingPoint, class Integral> void denormalize(const Corrade::Containers::ArrayView<FloatingPoint> in, const Corrade::Containers::ArrayView<Integral> out) {
+    typedef Implementation::BatchComponents<typename std::remove_const<FloatingPoint>::type> InComponents;
+    typedef Implementation::BatchComponents<Integral> OutComponents;
+    static_assert(std::size_t(InComponents::Size) == std::size_t(OutComponents::Size), "Math::Batch::denormalize(): input and output component count differs");
+    CORRADE_ASSERT(in.size() == out.size(), "Math::Batch::denormalize(): expected output array of size" << in.size() << "but got" << out.size(), );
+
+    const auto* const input = reinterpret_cast<const typename InComponents::Type*>(in.data());
+    auto* const output = reinterpret_cast<typename OutComponents::Type*>(out.data());
+    for(std::size_t i = 0, count = in.size()*InComponents::Size; i != count; ++i)
+        output[i] = Math::denormalize<typename OutComponents::Type>(input[i]);
+}
+
+/**
+@brief Pack float values into half-floats
+
+Equivalent to calling @ref Math::packHalf() on each item of @p in and storing
+the result in @p out, e.g. for converting @ref Vector3 array to
+@ref Vector3h. The output can be also an array of
+@ref Magnum::UnsignedShort "UnsignedShort" (vectors). Expects that both arrays
+have the same size. If F16C (on x86) or NEON (on 64-bit ARM) instructions are
+enabled at compile time, the conversion is done using them.
+@see @ref unpackHalf()
+*/
+template<class FloatingPoint, class HalfType> void packHalf(const Corrade::Containers::ArrayView<FloatingPoint> in, const Corrade::Containers::ArrayView<HalfType> out) {
+    typedef Implementation::BatchComponents<typename std::remove_const<FloatingPoint>::type> InComponents;
+    typedef Implementation::BatchComponents<HalfType> OutComponents;
+    static_assert(std::is_same<typename InComponents::Type, Float>::value && sizeof(typename OutComponents::Type) == 2, "Math::Batch::packHalf(): expected conversion from floats to half-floats");
+    static_assert(std::size_t(InComponents::Size) == std::size_t(OutComponents::Size), "Math::Batch::packHalf(): input and output component count differs");
+    CORRADE_ASSERT(in.size() == out.size(), "Math::Batch::packHalf(): expected output array of size" << in.size() << "but got" << out.size(), );
+
+    const Float* const input = reinterpret_cast<const Float*>(in.data());
+    UnsignedShort* const output = reinterpret_cast<UnsignedShort*>(out.data());
+    const std::size_t count = in.size()*InComponents::Size;
+    #ifdef MAGNUM_MATH_SIMD_HALF
+    const std::size_t processed = Implementation::Simd::packHalf(input, output, count);
+    #else
+    const std::size_t processed = 0;
+    #endif
+    for(std::size_t i = processed; i != count; ++i)
+        output[i] = Math::packHalf(input[i]);
+}
+
+/**
+@brief Unpack half-floats into float values
+
+Equivalent to calling @ref Math::unpackHalf() on each item of @p in and
+storing the result in @p out, e.g. for converting @ref Vector3h array to
+@ref Vector3. The input can be also an array of
+@ref Magnum::UnsignedShort "UnsignedShort" (vectors). Expects that both arrays
+have the same size. If F16C (on x86) or NEON (on 64-bit ARM) instructions are
+enabled at compile time, the conversion is done using them.
+@see @ref packHalf()
+*/
+template<class HalfType, class FloatingPoint> void unpackHalf(const Corrade::Containers::ArrayView<HalfType> in, const Corrade::Containers::ArrayView<FloatingPoint> out) {
+    typedef Implementation::BatchComponents<typename std::remove_const<HalfType>::type> InComponents;
+    typedef Implementation::BatchComponents<FloatingPoint> OutComponents;
+    static_assert(sizeof(typename InComponents::Type) == 2 && std::is_same<typename OutComponents::Type, Float>::value, "Math::Batch::unpackHalf(): expected conversion from half-floats to floats");
+    static_assert(std::size_t(InComponents::Size) == std::size_t(OutComponents::Size), "Math::Batch::unpackHalf(): input and output component count differs");
+    CORRADE_ASSERT(in.size() == out.size(), "Math::Batch::unpackHalf(): expected output array of size" << in.size() << "but got" << out.size(), );
+
+    const UnsignedShort* const input = reinterpret_cast<const UnsignedShort*>(in.data());
+    Float* const output = reinterpret_cast<Float*>(out.data());
+    const std::size_t count = in.size()*InComponents::Size;
+    #ifdef MAGNUM_MATH_SIMD_HALF
+    const std::size_t processed = Implementation::Simd::unpackHalf(input, output, count);
+    #else
+    const std::size_t processed = 0;
+    #endif
+    for(std::size_t i = processed; i != count; ++i)
+        output[i] = Math::unpackHalf(input[i]);
+}
+
+/**
+@brief Convert 8-bit sRGB values to linear floats
+
+Equivalent to calling @ref Color3::fromSrgb() or @ref Color4::fromSrgbAlpha()
+on each item of @p in and storing the result in @p out, e.g. for converting
+@ref Color4ub array to @ref Color4. For four-component types the last
+component is treated as alpha and converted linearly. The conversion is done
+using a lookup table, with AVX2 enabled at compile time the lookups are done
+using gather instructions. Expects that both arrays have the same size.
+@see @ref linearToSrgb()
+*/
+template<class Integral, class FloatingPoint> void srgbToLinear(const Corrade::Containers::ArrayView<Integral> in, const Corrade::Containers::ArrayView<FloatingPoint> out) {
+    typedef Implementation::BatchComponents<typename std::remove_const<Integral>::type> InComponents;
+    typedef Implementation::BatchComponents<FloatingPoint> OutComponents;
+    static_assert(std::is_same<typename InComponents::Type, UnsignedByte>::value && std::is_same<typename OutComponents::Type, Float>::value, "Math::Batch::srgbToLinear(): expected conversion from 8-bit sRGB to floats");
+    static_assert(std::size_t(InComponents::Size) == std::size_t(OutComponents::Size), "Math::Batch::srgbToLinear(): input and output component count differs");
+    CORRADE_ASSERT(in.size() == out.size(), "Math::Batch::srgbToLinear(): expected output array of size" << in.size() << "but got" << out.size(), );
+
+    Implementation::srgb8ToLinear(reinterpret_cast<const UnsignedByte*>(in.data()), reinterpret_cast<Float*>(out.data()), in.size()*InComponents::Size, InComponents::Size == 4);
+}
+
+/**
+@brief Convert linear floats to 8-bit sRGB values
+
+Equivalent to calling @ref Color3::toSrgb() const or
+@ref Color4::toSrgbAlpha() const with @ref Magnum::UnsignedByte "UnsignedByte"
+on each item of @p in and storing the result in @p out, e.g. for converting
+@ref Color4 array to @ref Color4ub. For four-component types the last
+component is treated as alpha and converted linearly. The result is
+bit-identical to the above functions (values are clamped and rounded to
+nearest), but instead of evaluating the sRGB curve the result is looked up
+in a table indexed with the float exponent and upper mantissa bits and
+corrected with one comparison. With AVX2 enabled at compile time the lookups
+are done using gather instructions. Expects that both arrays have the same
+size.
+@see @ref srgbToLinear()
+*/
+template<class FloatingPoint, class Integral> void linearToSrgb(const Corrade::Containers::ArrayView<FloatingPoint> in, const Corrade::Containers::ArrayView<Integral> out) {
+    typedef Implementation::BatchComponents<typename std::remove_const<FloatingPoint>::type> InComponents;
+    typedef Implementation::BatchComponents<Integral> OutComponents;
+    static_assert(std::is_same<typename InComponents::Type, Float>::value && std::is_same<typename OutComponents::Type, UnsignedByte>::value, "Math::Batch::linearToSrgb(): expected conversion from floats to 8-bit sRGB");
+    static_assert(std::size_t(InComponents::Size) == std::size_t(OutComponents::Size), "Math::Batch::linearToSrgb(): input and output component count differs");
+    CORRADE_ASSERT(in.size() == out.size(), "Math::Batch::linearToSrgb(): expected output array of size" << in.size() << "but got" << out.size(), );
+
+    Implementation::linearToSrgb8(reinterpret_cast<const Float*>(in.data()), reinterpret_cast<UnsignedByte*>(out.data()), in.size()*InComponents::Size, InComponents::Size == 4);
+}
+
+/**
+@brief Fast approximate sine and cosine of given angles
+
+Equivalent to calling @ref Fast::sincos() on each item of @p angles and
+storing the results in @p sines and @p cosines, with the same error bounds.
+Expects that all arrays have the same size.
+@see @ref Math::sin(), @ref Math::cos()
+*/
+template<class T, class U> void fastSincos(const Corrade::Containers::ArrayView<T> angles, const Corrade::Containers::ArrayView<U> sines, const Corrade::Containers::ArrayView<U> cosines) {
+    static_assert(std::is_same<typename std::remove_const<T>::type, Rad<U>>::value, "Math::Batch::fastSincos(): expected angles in radians of the same underlying type as the output");
+    CORRADE_ASSERT(angles.size() == sines.size() && angles.size() == cosines.size(), "Math::Batch::fastSincos(): expected output arrays of size" << angles.size() << "but got" << sines.size() << "and" << cosines.size(), );
+
+    std::size_t i = Implementation::FastKernels<U>::sincos(reinterpret_cast<const U*>(angles.data()), sines.data(), cosines.data(), angles.size());
+    for(; i != angles.size(); ++i)
+        std::tie(sines[i], cosines[i]) = Fast::sincos(angles[i]);
+}
+
+/**
+@brief Fast approximate inverse square root of given values
+
+Component-wise equivalent of calling @ref Fast::sqrtInverted() on each item of
+@p in and storing the result in @p out, with the same error bound. With SIMD
+enabled, @ref Magnum::Float "Float" values use hardware inverse square root
+estimate instead of the bit manipulation, so the results are not
+bit-identical, moreover zero input results in NaN. Expects that both arrays
+have the same size.
+@see @ref Math::sqrtInverted()
+*/
+template<class T, class U> void fastSqrtInverted(const Corrade::Containers::ArrayView<T> in, const Corrade::Containers::ArrayView<U> out) {
+    typedef Implementation::BatchComponents<typename std::remove_const<T>::type> InComponents;
+    typedef Implementation::BatchComponents<U> OutComponents;
+    static_assert(std::is_same<typename InComponents::Type, typename OutComponents::Type>::value && std::size_t(InComponents::Size) == std::size_t(OutComponents::Size), "Math::Batch::fastSqrtInverted(): input and output type differs");
+    CORRADE_ASSERT(in.size() == out.size(), "Math::Batch::fastSqrtInverted(): expected output array of size" << in.size() << "but got" << out.size(), );
+
+    typedef typename OutComponents::Type Type;
+    const Type* const input = reinterpret_cast<const Type*>(in.data());
+    Type* const output = reinterpret_cast<Type*>(out.data());
+    const std::size_t count = in.size()*InComponents::Size;
+    std::size_t i = Implementation::FastKernels<Type>::sqrtInverted(input, output, count);
+    for(; i != count; ++i)
+        output[i] = Fast::sqrtInverted(input[i]);
+}
+
+/**
+@brief Fast approximate arc cosine of given values
+
+Equivalent to calling @ref Fast::acos() on each item of @p in and storing the
+result in @p out, with the same error bound. Useful for computing angles
+between many pairs of normalized vectors or quaternions at once. Expects that
+both arrays have the same size.
+@see @ref Math::acos()
+*/
+template<class T, class U> void fastAcos(const Corrade::Containers::ArrayView<T> in, const Corrade::Containers::ArrayView<Rad<U>> out) {
+    static_assert(std::is_same<typename std::remove_const<T>::type, U>::value, "Math::Batch::fastAcos(): expected output angles of the same underlying type as the input");
+    CORRADE_ASSERT(in.size() == out.size(), "Math::Batch::fastAcos(): expected output array of size" << in.size() << "but got" << out.size(), );
+
+    std::size_t i = Implementation::FastKernels<U>::acos(in.data(), reinterpret_cast<U*>(out.data()), in.size());
+    for(; i != in.size(); ++i)
+        out[i] = Fast::acos(in[i]);
+}
+
+}
+
+}}
+
+#endif
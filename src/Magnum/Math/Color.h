@@ -123,6 +123,20 @@ template<class T> inline typename Color3<T>::HSV toHSV(typename std::enable_if<s
     return toHSV<typename Color3<T>::FloatingPointType>(normalize<Color3<typename Color3<T>::FloatingPointType>>(color));
 }
 
+/* sRGB transfer functions for a single channel */
+template<class T> inline T fromSrgb(const T value) {
+    return value <= T(0.04045) ? value/T(12.92) : std::pow((value + T(0.055))/T(1.055), T(2.4));
+}
+template<class T> inline T toSrgb(const T value) {
+    return value <= T(0.0031308) ? value*T(12.92) : T(1.055)*std::pow(value, T(1.0)/T(2.4)) - T(0.055);
+}
+
+/* Unlike denormalize() this rounds to nearest and clamps, so the integral
+   sRGB -> linear -> integral sRGB conversion is lossless */
+template<class Integral, class T> inline Integral denormalizeRounded(const T value) {
+    return Integral(Math::clamp(value, T(0), T(1))*std::numeric_limits<Integral>::max() + T(0.5));
+}
+
 /* Value for full channel (1.0f for floats, 255 for unsigned byte) */
 template<class T> constexpr typename std::enable_if<std::is_floating_point<T>::value, T>::type fullChannel() {
     return T(1);
@@ -248,6 +262,40 @@ template<class T> class Color3: public Vector3<T> {
             return fromHSV(std::make_tuple(hue, saturation, value));
         }
 
+        /**
+         * @brief Create linear RGB color from sRGB representation
+         * @param srgb  Color in sRGB color space
+         *
+         * Applies inverse sRGB curve onto the input, returning it in linear
+         * RGB color space: @f[
+         *      \boldsymbol{c}_\mathrm{linear} = \begin{cases}
+         *          \dfrac{\boldsymbol{c}_\mathrm{sRGB}}{12.92}, & \boldsymbol{c}_\mathrm{sRGB} \le 0.04045 \\
+         *          \left( \dfrac{0.055 + \boldsymbol{c}_\mathrm{sRGB}}{1 + 0.055} \right)^{2.4}, & \boldsymbol{c}_\mathrm{sRGB} > 0.04045
+         *      \end{cases}
+         * @f]
+         * Available only for floating-point types.
+         * @see @ref toSrgb(), @ref Batch::srgbToLinear()
+         */
+        static Color3<T> fromSrgb(const Vector3<T>& srgb) {
+            static_assert(std::is_floating_point<T>::value, "Math::Color3::fromSrgb(): the color must be floating-point");
+            return {Implementation::fromSrgb(srgb[0]),
+                    Implementation::fromSrgb(srgb[1]),
+                    Implementation::fromSrgb(srgb[2])};
+        }
+
+        /**
+         * @brief Create linear RGB color from integral sRGB representation
+         *
+         * Normalizes the value using @ref normalize() and then calls
+         * @ref fromSrgb(const Vector3<T>&), useful for converting 8-bit sRGB
+         * colors. For converting large arrays use
+         * @ref Batch::srgbToLinear(), which is done using a lookup table.
+         */
+        template<class Integral> static Color3<T> fromSrgb(const Vector3<Integral>& srgb) {
+            static_assert(std::is_integral<Integral>::value, "Math::Color3::fromSrgb(): expected integral sRGB type");
+            return fromSrgb(normalize<Vector3<T>>(srgb));
+        }
+
         /**
          * @brief Default constructor
          *
@@ -311,6 +359,43 @@ template<class T> class Color3: public Vector3<T> {
             return Implementation::toHSV<T>(*this);
         }
 
+        /**
+         * @brief Convert to sRGB representation
+         *
+         * Assuming the color is in linear RGB color space, applies sRGB
+         * curve onto it: @f[
+         *      \boldsymbol{c}_\mathrm{sRGB} = \begin{cases}
+         *          12.92\boldsymbol{c}_\mathrm{linear}, & \boldsymbol{c}_\mathrm{linear} \le 0.0031308 \\
+         *          (1 + 0.055) \boldsymbol{c}_\mathrm{linear}^{1/2.4}-0.055, & \boldsymbol{c}_\mathrm{linear} > 0.0031308
+         *      \end{cases}
+         * @f]
+         * Available only for floating-point types.
+         * @see @ref fromSrgb(), @ref Batch::linearToSrgb()
+         */
+        Vector3<T> toSrgb() const {
+            static_assert(std::is_floating_point<T>::value, "Math::Color3::toSrgb(): the color must be floating-point");
+            return {Implementation::toSrgb((*this)[0]),
+                    Implementation::toSrgb((*this)[1]),
+                    Implementation::toSrgb((*this)[2])};
+        }
+
+        /**
+         * @brief Convert to integral sRGB representation
+         *
+         * Calls @ref toSrgb() const and converts the result to given integral
+         * type. Unlike @ref denormalize() the values are clamped to
+         * @f$ [0, 1] @f$ and rounded to nearest, so converting integral
+         * sRGB color to linear and back gives the original value. For
+         * converting large arrays use @ref Batch::linearToSrgb().
+         */
+        template<class Integral> Vector3<Integral> toSrgb() const {
+            static_assert(std::is_integral<Integral>::value, "Math::Color3::toSrgb(): expected integral sRGB type");
+            const Vector3<T> srgb = toSrgb();
+            return {Implementation::denormalizeRounded<Integral>(srgb[0]),
+                    Implementation::denormalizeRounded<Integral>(srgb[1]),
+                    Implementation::denormalizeRounded<Integral>(srgb[2])};
+        }
+
         /**
          * @brief Hue
          * @return Hue in range @f$ [0.0, 360.0] @f$.
@@ -419,6 +504,32 @@ class Color4: public Vector4<T> {
             return {Implementation::fullChannel<T>(), green, Implementation::fullChannel<T>(), alpha};
         }
 
+        /**
+         * @brief Create linear RGBA color from sRGB + alpha representation
+         * @param srgbAlpha Color in sRGB color space with linear alpha
+         *
+         * Applies inverse sRGB curve onto RGB channels of the input, alpha
+         * channel is kept as-is. See @ref Color3::fromSrgb() for more
+         * information.
+         * @see @ref toSrgbAlpha(), @ref Batch::srgbToLinear()
+         */
+        static Color4<T> fromSrgbAlpha(const Vector4<T>& srgbAlpha) {
+            return {Color3<T>::fromSrgb(srgbAlpha.rgb()), srgbAlpha.a()};
+        }
+
+        /**
+         * @brief Create linear RGBA color from integral sRGB + alpha representation
+         *
+         * Normalizes the value using @ref normalize() and then calls
+         * @ref fromSrgbAlpha(const Vector4<T>&), useful for converting 8-bit
+         * sRGB colors. For converting large arrays use
+         * @ref Batch::srgbToLinear(), which is done using a lookup table.
+         */
+        template<class Integral> static Color4<T> fromSrgbAlpha(const Vector4<Integral>& srgbAlpha) {
+            static_assert(std::is_integral<Integral>::value, "Math::Color4::fromSrgbAlpha(): expected integral sRGB type");
+            return fromSrgbAlpha(normalize<Vector4<T>>(srgbAlpha));
+        }
+
         /**
          * @brief Yellow color
          *
@@ -511,6 +622,32 @@ class Color4: public Vector4<T> {
             return Implementation::toHSV<T>(Vector4<T>::rgb());
         }
 
+        /**
+         * @brief Convert to sRGB + alpha representation
+         *
+         * Assuming the color is in linear RGB color space, applies sRGB
+         * curve onto RGB channels, alpha channel is kept as-is. See
+         * @ref Color3::toSrgb() for more information.
+         * @see @ref fromSrgbAlpha(), @ref Batch::linearToSrgb()
+         */
+        Vector4<T> toSrgbAlpha() const {
+            return {Color3<T>{Vector4<T>::rgb()}.toSrgb(), (*this)[3]};
+        }
+
+        /**
+         * @brief Convert to integral sRGB + alpha representation
+         *
+         * Calls @ref toSrgbAlpha() const and converts the result to given
+         * integral type. Like in @ref Color3::toSrgb() const, the values are
+         * clamped and rounded to nearest, which is done also for the alpha
+         * channel. For converting large arrays use
+         * @ref Batch::linearToSrgb().
+         */
+        template<class Integral> Vector4<Integral> toSrgbAlpha() const {
+            return {Color3<T>{Vector4<T>::rgb()}.template toSrgb<Integral>(),
+                    Implementation::denormalizeRounded<Integral>((*this)[3])};
+        }
+
         /** @copydoc Color3::hue() */
         constexpr Deg<FloatingPointType> hue() const {
             return Implementation::hue<T>(Vector4<T>::rgb());
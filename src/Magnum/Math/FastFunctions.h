@@ -0,0 +1,183 @@
+#ifndef Magnum_Math_FastFunctions_h
+#define Magnum_Math_FastFunctions_h
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+/** @file
+ * @brief Namespace @ref Magnum::Math::Fast
+ */
+
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+#include <type_traits>
+#include <utility>
+
+#include "Magnum/Math/Angle.h"
+#include "Magnum/Math/Vector.h"
+
+namespace Magnum { namespace Math {
+
+namespace Implementation {
+    /* Cody-Waite split of pi/2, the first two parts have enough trailing
+       zero bits for the products with quadrant index to be exact */
+    template<class T> struct FastSincos {
+        constexpr static T twoOverPi() { return T(0.636619772367581343); }
+        constexpr static T piHalf1() { return T(1.5703125); }
+        constexpr static T piHalf2() { return T(4.837512969970703125e-4); }
+        constexpr static T piHalf3() { return T(7.54978995489188216e-8); }
+    };
+
+    template<class> struct FastSqrtInverted;
+    template<> struct FastSqrtInverted<Float> {
+        typedef UnsignedInt Bits;
+        constexpr static Bits magic() { return 0x5f375a86u; }
+    };
+    template<> struct FastSqrtInverted<Double> {
+        typedef UnsignedLong Bits;
+        constexpr static Bits magic() { return 0x5fe6eb50c7b537a9ull; }
+    };
+}
+
+namespace Fast {
+
+/**
+@brief Fast approximate sine and cosine
+
+Reduces the angle to @f$ [-\frac{\pi}{4}, \frac{\pi}{4}] @f$ and evaluates
+minimax polynomials of degree 7 and 8. The absolute error is below
+@f$ 2 \cdot 10^{-7} @f$ for angles up to @f$ 10^4 @f$ radians, further
+from zero the range reduction loses precision. Computing both values at once
+is about as fast as computing one of them.
+@see @ref Math::sin(), @ref Math::cos(), @ref Batch::fastSincos()
+*/
+#ifdef DOXYGEN_GENERATING_OUTPUT
+template<class T> inline std::pair<T, T> sincos(Rad<T> angle);
+#else
+template<class T> inline std::pair<T, T> sincos(Unit<Rad, T> angle) {
+    typedef Implementation::FastSincos<T> Constants;
+
+    /* Quadrant index, rounded half away from zero */
+    const T scaled = T(angle)*Constants::twoOverPi();
+    const Int q = Int(scaled + (scaled < T(0) ? T(-0.5) : T(0.5)));
+    const T qf = T(q);
+    const T r = ((T(angle) - qf*Constants::piHalf1()) - qf*Constants::piHalf2()) - qf*Constants::piHalf3();
+    const T r2 = r*r;
+
+    const T s = r + r*r2*(T(-1.6666654611e-1) + r2*(T(8.3321608736e-3) + r2*T(-1.9515295891e-4)));
+    const T c = T(1) - T(0.5)*r2 + r2*r2*(T(4.166664568298827e-2) + r2*(T(-1.388731625493765e-3) + r2*T(2.443315711809948e-5)));
+
+    /* Odd quadrants swap the functions, sine is negative in quadrants 2 and
+       3, cosine in quadrants 1 and 2 */
+    const T sr = q & 1 ? c : s;
+    const T cr = q & 1 ? s : c;
+    return {q & 2 ? -sr : sr, (q + 1) & 2 ? -cr : cr};
+}
+template<class T> inline std::pair<T, T> sincos(Unit<Deg, T> angle) { return sincos(Rad<T>(angle)); }
+#endif
+
+/**
+@brief Fast approximate sine
+
+Same as @ref sincos(), see its documentation for error bounds.
+@see @ref Math::sin()
+*/
+#ifdef DOXYGEN_GENERATING_OUTPUT
+template<class T> inline T sin(Rad<T> angle);
+#else
+template<class T> inline T sin(Unit<Rad, T> angle) { return sincos(angle).first; }
+template<class T> inline T sin(Unit<Deg, T> angle) { return sin(Rad<T>(angle)); }
+#endif
+
+/**
+@brief Fast approximate cosine
+
+Same as @ref sincos(), see its documentation for error bounds.
+@see @ref Math::cos()
+*/
+#ifdef DOXYGEN_GENERATING_OUTPUT
+template<class T> inline T cos(Rad<T> angle);
+#else
+template<class T> inline T cos(Unit<Rad, T> angle) { return sincos(angle).second; }
+template<class T> inline T cos(Unit<Deg, T> angle) { return cos(Rad<T>(angle)); }
+#endif
+
+/**
+@brief Fast approximate inverse square root
+
+Initial estimate from bit representation of the value refined with two Newton
+iterations. The relative error is below @f$ 5 \cdot 10^{-6} @f$. Expects
+that the value is positive and finite, for zero the result is a large finite
+value instead of infinity. Note that on CPUs with fast hardware square root
+and division this function may not be faster than @ref Math::sqrtInverted(),
+the SIMD implementation in @ref Batch::fastSqrtInverted() is.
+@see @ref Math::sqrtInverted()
+*/
+#ifdef DOXYGEN_GENERATING_OUTPUT
+template<class T> inline T sqrtInverted(const T& value);
+#else
+template<class T> inline typename std::enable_if<std::is_floating_point<T>::value, T>::type sqrtInverted(T value) {
+    typedef Implementation::FastSqrtInverted<T> Traits;
+
+    typename Traits::Bits bits;
+    std::memcpy(&bits, &value, sizeof(T));
+    bits = Traits::magic() - (bits >> 1);
+    T y;
+    std::memcpy(&y, &bits, sizeof(T));
+
+    const T half = value*T(0.5);
+    y *= T(1.5) - half*y*y;
+    y *= T(1.5) - half*y*y;
+    return y;
+}
+template<std::size_t size, class T> Vector<size, T> sqrtInverted(const Vector<size, T>& value) {
+    Vector<size, T> out;
+    for(std::size_t i = 0; i != size; ++i)
+        out[i] = Fast::sqrtInverted(value[i]);
+    return out;
+}
+#endif
+
+/**
+@brief Fast approximate arc cosine
+
+Polynomial approximation from *Abramowitz and Stegun, Handbook of Mathematical
+Functions, formula 4.4.46*. The absolute error is below @f$ 10^{-6} @f$.
+Unlike @ref Math::acos(), values outside of @f$ [-1, 1] @f$ are clamped
+instead of returning NaN, which makes it usable for dot products of
+normalized vectors that are slightly off due to rounding errors.
+@see @ref Batch::fastAcos()
+*/
+template<class T> inline Rad<T> acos(T value) {
+    const T a = std::min(std::abs(value), T(1));
+    const T p = std::sqrt(T(1) - a)*(T(1.5707963050) + a*(T(-0.2145988016) + a*(T(0.0889789874) + a*(T(-0.0501743046) + a*(T(0.0308918810) + a*(T(-0.0170881256) + a*(T(0.0066700901) + a*T(-0.0012624911))))))));
+    return Rad<T>{value < T(0) ? T(3.141592653589793) - p : p};
+}
+
+}
+
+}}
+
+#endif
@@ -117,6 +117,76 @@ template<class T> inline T cos(Unit<Rad, T> angle) { return std::cos(T(angle));
 template<class T> inline T cos(Unit<Deg, T> angle) { return cos(Rad<T>(angle)); }
 #endif
 
+namespace Implementation {
+    /* Taylor series of sin() and cos() in Horner form, precise to double
+       precision on [-π/4, π/4] */
+    constexpr Double constexprSinSeries(Double x, Double x2) {
+        return x*(1.0 - x2/6.0*(1.0 - x2/20.0*(1.0 - x2/42.0*(1.0 - x2/72.0*(1.0 - x2/110.0*(1.0 - x2/156.0*(1.0 - x2/210.0*(1.0 - x2/272.0*(1.0 - x2/342.0)))))))));
+    }
+    constexpr Double constexprCosSeries(Double x2) {
+        return 1.0 - x2/2.0*(1.0 - x2/12.0*(1.0 - x2/30.0*(1.0 - x2/56.0*(1.0 - x2/90.0*(1.0 - x2/132.0*(1.0 - x2/182.0*(1.0 - x2/240.0*(1.0 - x2/306.0*(1.0 - x2/380.0)))))))));
+    }
+
+    /* Sine of the reduced argument in given quadrant */
+    constexpr Double constexprSinQuadrant(Double x, long long quadrant) {
+        return quadrant == 0 ? constexprSinSeries(x, x*x) :
+               quadrant == 1 ? constexprCosSeries(x*x) :
+               quadrant == 2 ? -constexprSinSeries(x, x*x) :
+                               -constexprCosSeries(x*x);
+    }
+
+    /* Cody-Waite reduction by k·π/2 with π/2 split into three parts */
+    constexpr Double constexprSinReduced(Double x, long long k, long long quadrantOffset) {
+        return constexprSinQuadrant(
+            ((x - Double(k)*1.57079632673412561417e+00)
+                - Double(k)*6.07710050630396597660e-11)
+                - Double(k)*2.02226624879595063154e-21,
+            (((k + quadrantOffset) % 4) + 4) % 4);
+    }
+
+    constexpr Double constexprSin(Double x, long long quadrantOffset) {
+        return constexprSinReduced(x, static_cast<long long>(x*0.636619772367581343 + (x < 0.0 ? -0.5 : 0.5)), quadrantOffset);
+    }
+}
+
+/**
+@brief Sine usable in constant expressions
+
+Unlike @ref sin(), which calls @ref std::sin(), this can be evaluated at
+compile time, for example to fill static transformation tables together
+with @ref Matrix4::rotationX(T, T) and similar. The result is within one ULP
+of @ref std::sin() for @ref Magnum::Float "Float" angles and within two ULP
+for @ref Magnum::Double "Double" angles, as long as the angle magnitude is
+below @f$ 10^5 @f$. It is slower than @ref sin() when evaluated at runtime.
+@see @ref constexprCos()
+*/
+#ifdef DOXYGEN_GENERATING_OUTPUT
+template<class T> constexpr T constexprSin(Rad<T> angle);
+#else
+template<class T> constexpr T constexprSin(Unit<Rad, T> angle) {
+    return T(Implementation::constexprSin(Double(T(angle)), 0));
+}
+template<class T> constexpr T constexprSin(Unit<Deg, T> angle) {
+    return constexprSin(Rad<T>(angle));
+}
+#endif
+
+/**
+@brief Cosine usable in constant expressions
+
+See @ref constexprSin() for more information.
+*/
+#ifdef DOXYGEN_GENERATING_OUTPUT
+template<class T> constexpr T constexprCos(Rad<T> angle);
+#else
+template<class T> constexpr T constexprCos(Unit<Rad, T> angle) {
+    return T(Implementation::constexprSin(Double(T(angle)), 1));
+}
+template<class T> constexpr T constexprCos(Unit<Deg, T> angle) {
+    return constexprCos(Rad<T>(angle));
+}
+#endif
+
 /** @brief Tangent */
 #ifdef DOXYGEN_GENERATING_OUTPUT
 template<class T> inline T tan(Rad<T> angle);
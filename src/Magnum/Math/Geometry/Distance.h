@@ -29,11 +29,48 @@
  * @brief Class @ref Magnum::Math::Geometry::Distance
  */
 
+#include <utility>
+#include <Corrade/Containers/ArrayView.h>
+
+#include "Magnum/Math/Constants.h"
 #include "Magnum/Math/Functions.h"
 #include "Magnum/Math/Vector3.h"
 
+#ifdef MAGNUM_BUILD_SIMD
+#include "Magnum/Math/simdImplementation.h"
+#endif
+
 namespace Magnum { namespace Math { namespace Geometry {
 
+namespace Implementation {
+    /* Batch distance kernels, specialized for floats when SIMD is available.
+       They update the minimal squared distance and its index and return count
+       of processed items, the rest is done with plain loop. */
+    template<class T> struct DistanceKernels {
+        static std::size_t linePointSquared2(const T*, const T*, const T*, std::size_t, T&, std::size_t&) { return 0; }
+        static std::size_t linePointSquared3(const T*, const T*, const T*, std::size_t, T&, std::size_t&) { return 0; }
+        static std::size_t lineSegmentPointSquared2(const T*, const T*, const T*, std::size_t, T&, std::size_t&) { return 0; }
+        static std::size_t lineSegmentPointSquared3(const T*, const T*, const T*, std::size_t, T&, std::size_t&) { return 0; }
+    };
+
+    #ifdef MAGNUM_MATH_SIMD
+    template<> struct DistanceKernels<Float> {
+        static std::size_t linePointSquared2(const Float* a, const Float* b, const Float* point, std::size_t count, Float& min, std::size_t& index) {
+            return Math::Implementation::Simd::linePointSquared2(a, b, point, count, min, index);
+        }
+        static std::size_t linePointSquared3(const Float* a, const Float* b, const Float* point, std::size_t count, Float& min, std::size_t& index) {
+            return Math::Implementation::Simd::linePointSquared3(a, b, point, count, min, index);
+        }
+        static std::size_t lineSegmentPointSquared2(const Float* a, const Float* b, const Float* point, std::size_t count, Float& min, std::size_t& index) {
+            return Math::Implementation::Simd::lineSegmentPointSquared2(a, b, point, count, min, index);
+        }
+        static std::size_t lineSegmentPointSquared3(const Float* a, const Float* b, const Float* point, std::size_t count, Float& min, std::size_t& index) {
+            return Math::Implementation::Simd::lineSegmentPointSquared3(a, b, point, count, min, index);
+        }
+    };
+    #endif
+}
+
 /** @brief Functions for computing distances */
 class Distance {
     public:
@@ -162,6 +199,110 @@ class Distance {
          * the square root.
          */
         template<class T> static T lineSegmentPointSquared(const Vector3<T>& a, const Vector3<T>& b, const Vector3<T>& point);
+
+        /**
+         * @brief Minimal distance of point from lines in 2D, squared
+         * @param a         First points of the lines
+         * @param b         Second points of the lines
+         * @param point     Point
+         * @return Minimal squared distance and index of the first line with
+         *      it
+         *
+         * Equivalent to calling
+         * @ref linePointSquared(const Vector2<T>&, const Vector2<T>&, const Vector2<T>&)
+         * for each pair of items in @p a and @p b and picking the smallest
+         * value, but for @ref Magnum::Float "Float" it uses SIMD when Magnum
+         * is built with `BUILD_SIMD` enabled. Lines with NaN or infinite
+         * distance (i.e. when both points are the same) are skipped. If there
+         * is no line with finite distance, returns infinity and size of the
+         * arrays. Expects that both arrays have the same size.
+         */
+        template<class T, class U> static std::pair<T, std::size_t> linePointSquared(Corrade::Containers::ArrayView<U> a, Corrade::Containers::ArrayView<U> b, const Vector2<T>& point) {
+            static_assert(std::is_same<typename std::remove_const<U>::type, Vector2<T>>::value, "Math::Geometry::Distance::linePointSquared(): expected arrays of vectors of the same type as the point");
+            CORRADE_ASSERT(a.size() == b.size(), "Math::Geometry::Distance::linePointSquared(): expected arrays of the same size but got" << a.size() << "and" << b.size(), {});
+            return minimumSquared(a.data(), b.data(), a.size(), point, Implementation::DistanceKernels<T>::linePointSquared2, linePointSquared<T>);
+        }
+
+        /**
+         * @brief Minimal distance of point from lines in 3D, squared
+         *
+         * Equivalent to calling
+         * @ref linePointSquared(const Vector3<T>&, const Vector3<T>&, const Vector3<T>&)
+         * for each pair of items in @p a and @p b and picking the smallest
+         * value. See
+         * @ref linePointSquared(Corrade::Containers::ArrayView<U>, Corrade::Containers::ArrayView<U>, const Vector2<T>&)
+         * for more information.
+         */
+        template<class T, class U> static std::pair<T, std::size_t> linePointSquared(Corrade::Containers::ArrayView<U> a, Corrade::Containers::ArrayView<U> b, const Vector3<T>& point) {
+            static_assert(std::is_same<typename std::remove_const<U>::type, Vector3<T>>::value, "Math::Geometry::Distance::linePointSquared(): expected arrays of vectors of the same type as the point");
+            CORRADE_ASSERT(a.size() == b.size(), "Math::Geometry::Distance::linePointSquared(): expected arrays of the same size but got" << a.size() << "and" << b.size(), {});
+            return minimumSquared(a.data(), b.data(), a.size(), point, Implementation::DistanceKernels<T>::linePointSquared3, linePointSquared<T>);
+        }
+
+        /**
+         * @brief Minimal distance of point from line segments in 2D
+         * @param a         Starting points of the line segments
+         * @param b         Ending points of the line segments
+         * @param point     Point
+         * @return Minimal distance and index of the first line segment with
+         *      it
+         *
+         * Square root of the result of
+         * @ref lineSegmentPointSquared(Corrade::Containers::ArrayView<U>, Corrade::Containers::ArrayView<U>, const Vector2<T>&),
+         * useful for snapping and picking against many line segments at once.
+         */
+        template<class T, class U> static std::pair<T, std::size_t> lineSegmentPoint(Corrade::Containers::ArrayView<U> a, Corrade::Containers::ArrayView<U> b, const Vector2<T>& point) {
+            const std::pair<T, std::size_t> out = lineSegmentPointSquared(a, b, point);
+            return {std::sqrt(out.first), out.second};
+        }
+
+        /**
+         * @brief Minimal distance of point from line segments in 2D, squared
+         *
+         * Equivalent to calling
+         * @ref lineSegmentPointSquared(const Vector2<T>&, const Vector2<T>&, const Vector2<T>&)
+         * for each pair of items in @p a and @p b and picking the smallest
+         * value, but for @ref Magnum::Float "Float" it uses SIMD when Magnum
+         * is built with `BUILD_SIMD` enabled. Degenerate line segments with
+         * NaN distance are skipped. If there is no line segment with finite
+         * distance, returns infinity and size of the arrays. Expects that both
+         * arrays have the same size.
+         */
+        template<class T, class U> static std::pair<T, std::size_t> lineSegmentPointSquared(Corrade::Containers::ArrayView<U> a, Corrade::Containers::ArrayView<U> b, const Vector2<T>& point) {
+            static_assert(std::is_same<typename std::remove_const<U>::type, Vector2<T>>::value, "Math::Geometry::Distance::lineSegmentPointSquared(): expected arrays of vectors of the same type as the point");
+            CORRADE_ASSERT(a.size() == b.size(), "Math::Geometry::Distance::lineSegmentPointSquared(): expected arrays of the same size but got" << a.size() << "and" << b.size(), {});
+            return minimumSquared(a.data(), b.data(), a.size(), point, Implementation::DistanceKernels<T>::lineSegmentPointSquared2, lineSegmentPointSquared<T>);
+        }
+
+        /**
+         * @brief Minimal distance of point from line segments in 3D
+         *
+         * Square root of the result of
+         * @ref lineSegmentPointSquared(Corrade::Containers::ArrayView<U>, Corrade::Containers::ArrayView<U>, const Vector3<T>&).
+         */
+        template<class T, class U> static std::pair<T, std::size_t> lineSegmentPoint(Corrade::Containers::ArrayView<U> a, Corrade::Containers::ArrayView<U> b, const Vector3<T>& point) {
+            const std::pair<T, std::size_t> out = lineSegmentPointSquared(a, b, point);
+            return {std::sqrt(out.first), out.second};
+        }
+
+        /**
+         * @brief Minimal distance of point from line segments in 3D, squared
+         *
+         * Equivalent to calling
+         * @ref lineSegmentPointSquared(const Vector3<T>&, const Vector3<T>&, const Vector3<T>&)
+         * for each pair of items in @p a and @p b and picking the smallest
+         * value. See
+         * @ref lineSegmentPointSquared(Corrade::Containers::ArrayView<U>, Corrade::Containers::ArrayView<U>, const Vector2<T>&)
+         * for more information.
+         */
+        template<class T, class U> static std::pair<T, std::size_t> lineSegmentPointSquared(Corrade::Containers::ArrayView<U> a, Corrade::Containers::ArrayView<U> b, const Vector3<T>& point) {
+            static_assert(std::is_same<typename std::remove_const<U>::type, Vector3<T>>::value, "Math::Geometry::Distance::lineSegmentPointSquared(): expected arrays of vectors of the same type as the point");
+            CORRADE_ASSERT(a.size() == b.size(), "Math::Geometry::Distance::lineSegmentPointSquared(): expected arrays of the same size but got" << a.size() << "and" << b.size(), {});
+            return minimumSquared(a.data(), b.data(), a.size(), point, Implementation::DistanceKernels<T>::lineSegmentPointSquared3, lineSegmentPointSquared<T>);
+        }
+
+    private:
+        template<class T, template<class> class V> static std::pair<T, std::size_t> minimumSquared(const V<T>* a, const V<T>* b, std::size_t count, const V<T>& point, std::size_t(*kernel)(const T*, const T*, const T*, std::size_t, T&, std::size_t&), T(*distance)(const V<T>&, const V<T>&, const V<T>&));
 };
 
 template<class T> T Distance::lineSegmentPoint(const Vector2<T>& a, const Vector2<T>& b, const Vector2<T>& point) {
@@ -223,6 +364,20 @@ template<class T> T Distance::lineSegmentPointSquared(const Vector3<T>& a, const
     return cross(pointMinusA, pointMinusB).dot()/bDistanceA;
 }
 
+template<class T, template<class> class V> std::pair<T, std::size_t> Distance::minimumSquared(const V<T>* const a, const V<T>* const b, const std::size_t count, const V<T>& point, std::size_t(*const kernel)(const T*, const T*, const T*, std::size_t, T&, std::size_t&), T(*const distance)(const V<T>&, const V<T>&, const V<T>&)) {
+    std::pair<T, std::size_t> out{Constants<T>::inf(), count};
+
+    /* The kernel processes items in groups, the rest is done here. Strict
+       comparison keeps the first item with the minimal distance. */
+    std::size_t i = kernel(reinterpret_cast<const T*>(a), reinterpret_cast<const T*>(b), point.data(), count, out.first, out.second);
+    for(; i != count; ++i) {
+        const T d = distance(a[i], b[i], point);
+        if(d < out.first) out = {d, i};
+    }
+
+    return out;
+}
+
 }}}
 
 #endif
@@ -29,10 +29,33 @@
  * @brief Class @ref Magnum::Math::Geometry::Intersection
  */
 
+#include <Corrade/Containers/ArrayView.h>
+
 #include "Magnum/Math/Vector3.h"
 
+#ifdef MAGNUM_BUILD_SIMD
+#include "Magnum/Math/simdImplementation.h"
+#endif
+
 namespace Magnum { namespace Math { namespace Geometry {
 
+namespace Implementation {
+    /* Batch intersection kernels, specialized for floats when SIMD is
+       available. Return count of processed items, the rest is done with
+       plain loop. */
+    template<class T> struct IntersectionKernels {
+        static std::size_t planeLine(const T*, const T*, const T*, const T*, T*, std::size_t) { return 0; }
+    };
+
+    #ifdef MAGNUM_MATH_SIMD
+    template<> struct IntersectionKernels<Float> {
+        static std::size_t planeLine(const Float* planePositions, const Float* planeNormals, const Float* p, const Float* r, Float* out, std::size_t count) {
+            return Math::Implementation::Simd::planeLine(planePositions, planeNormals, p, r, out, count);
+        }
+    };
+    #endif
+}
+
 /** @brief Functions for computing intersections */
 class Intersection {
     public:
@@ -123,6 +146,35 @@ class Intersection {
             const T f = dot(planePosition, planeNormal);
             return (f-dot(planeNormal, p))/dot(planeNormal, r);
         }
+
+        /**
+         * @brief Intersections of planes and a line
+         * @param planePositions    Plane positions
+         * @param planeNormals      Plane normals
+         * @param p                 Starting point of the line
+         * @param r                 Direction of the line
+         * @param out               Where to put intersection point
+         *      positions `t` on the line, the points are then `p + t*r`
+         *
+         * Equivalent to calling
+         * @ref planeLine(const Vector3<T>&, const Vector3<T>&, const Vector3<T>&, const Vector3<T>&)
+         * for each pair of items in @p planePositions and @p planeNormals and
+         * storing the result in @p out, but for @ref Magnum::Float "Float" it
+         * uses SIMD when Magnum is built with `BUILD_SIMD` enabled. Useful
+         * for picking, where the line is the picking ray. Expects that all
+         * arrays have the same size.
+         */
+        template<class T, class U> static void planeLine(Corrade::Containers::ArrayView<U> planePositions, Corrade::Containers::ArrayView<U> planeNormals, const Vector3<T>& p, const Vector3<T>& r, Corrade::Containers::ArrayView<T> out) {
+            static_assert(std::is_same<typename std::remove_const<U>::type, Vector3<T>>::value, "Math::Geometry::Intersection::planeLine(): expected arrays of vectors of the same type as the line");
+            CORRADE_ASSERT(planePositions.size() == planeNormals.size(),
+                "Math::Geometry::Intersection::planeLine(): expected plane position and normal arrays of the same size but got" << planePositions.size() << "and" << planeNormals.size(), );
+            CORRADE_ASSERT(planePositions.size() == out.size(),
+                "Math::Geometry::Intersection::planeLine(): expected output array of size" << planePositions.size() << "but got" << out.size(), );
+
+            std::size_t i = Implementation::IntersectionKernels<T>::planeLine(reinterpret_cast<const T*>(planePositions.data()), reinterpret_cast<const T*>(planeNormals.data()), p.data(), r.data(), out.data(), out.size());
+            for(; i != out.size(); ++i)
+                out[i] = planeLine(planePositions[i], planeNormals[i], p, r);
+        }
 };
 
 }}}
@@ -0,0 +1,152 @@
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#include <vector>
+#include <Corrade/TestSuite/Tester.h>
+
+#include "Magnum/Math/Geometry/Distance.h"
+#include "Magnum/Math/Geometry/Intersection.h"
+#include "Magnum/Test/Benchmark.h"
+
+namespace Magnum { namespace Math { namespace Geometry { namespace Test {
+
+/* Compares per-item distance and intersection queries against 100k line
+   segments and planes with the batch ones */
+struct DistanceBenchmark: Corrade::TestSuite::Tester {
+    explicit DistanceBenchmark();
+
+    void lineSegmentPoint2D();
+    void lineSegmentPoint3D();
+    void planeLine();
+};
+
+typedef Math::Vector2<Float> Vector2;
+typedef Math::Vector3<Float> Vector3;
+
+DistanceBenchmark::DistanceBenchmark() {
+    addTests({&DistanceBenchmark::lineSegmentPoint2D,
+              &DistanceBenchmark::lineSegmentPoint3D,
+              &DistanceBenchmark::planeLine});
+}
+
+namespace {
+    enum: std::size_t { Count = 100000 };
+
+    template<class T> std::vector<T> points(Float offset) {
+        std::vector<T> out;
+        out.reserve(Count);
+        for(std::size_t i = 0; i != Count; ++i) {
+            T v;
+            for(std::size_t j = 0; j != T::Size; ++j)
+                v[j] = Float((i*7919 + j*104729) % 10007)*0.1f + offset;
+            out.push_back(v);
+        }
+        return out;
+    }
+
+    template<class T> Corrade::Containers::ArrayView<const T> view(const std::vector<T>& data) {
+        return {data.data(), data.size()};
+    }
+
+    using Magnum::Test::measure;
+
+    void print(const char* name, std::int64_t perItem, std::int64_t batch) {
+        Corrade::Utility::Debug() << name << "per item:" << perItem << "us, batch:" << batch << "us";
+    }
+}
+
+void DistanceBenchmark::lineSegmentPoint2D() {
+    const std::vector<Vector2> a = points<Vector2>(0.0f);
+    const std::vector<Vector2> b = points<Vector2>(1.5f);
+    const Vector2 point{512.3f, 87.1f};
+
+    std::pair<Float, std::size_t> expected;
+    const std::int64_t perItem = measure([&]() {
+        expected = {Constants<Float>::inf(), Count};
+        for(std::size_t i = 0; i != Count; ++i) {
+            const Float d = Distance::lineSegmentPointSquared(a[i], b[i], point);
+            if(d < expected.first) expected = {d, i};
+        }
+    });
+
+    std::pair<Float, std::size_t> out;
+    const std::int64_t batch = measure([&]() {
+        out = Distance::lineSegmentPointSquared(view(a), view(b), point);
+    });
+
+    CORRADE_COMPARE(out.first, expected.first);
+    CORRADE_COMPARE(out.second, expected.second);
+    print("lineSegmentPointSquared() 2D", perItem, batch);
+}
+
+void DistanceBenchmark::lineSegmentPoint3D() {
+    const std::vector<Vector3> a = points<Vector3>(0.0f);
+    const std::vector<Vector3> b = points<Vector3>(-2.5f);
+    const Vector3 point{512.3f, 87.1f, 300.0f};
+
+    std::pair<Float, std::size_t> expected;
+    const std::int64_t perItem = measure([&]() {
+        expected = {Constants<Float>::inf(), Count};
+        for(std::size_t i = 0; i != Count; ++i) {
+            const Float d = Distance::lineSegmentPointSquared(a[i], b[i], point);
+            if(d < expected.first) expected = {d, i};
+        }
+    });
+
+    std::pair<Float, std::size_t> out;
+    const std::int64_t batch = measure([&]() {
+        out = Distance::lineSegmentPointSquared(view(a), view(b), point);
+    });
+
+    CORRADE_COMPARE(out.first, expected.first);
+    CORRADE_COMPARE(out.second, expected.second);
+    print("lineSegmentPointSquared() 3D", perItem, batch);
+}
+
+void DistanceBenchmark::planeLine() {
+    const std::vector<Vector3> positions = points<Vector3>(0.0f);
+    std::vector<Vector3> normals = points<Vector3>(-500.0f);
+    for(Vector3& normal: normals) normal = normal.normalized();
+    const Vector3 p{1.0f, 0.5f, 0.5f};
+    const Vector3 r{-1.0f, 0.5f, 0.25f};
+    std::vector<Float> out(Count);
+
+    const std::int64_t perItem = measure([&]() {
+        for(std::size_t i = 0; i != Count; ++i)
+            out[i] = Intersection::planeLine(positions[i], normals[i], p, r);
+    });
+    const Float expected = out[Count - 1];
+
+    const std::int64_t batch = measure([&]() {
+        Intersection::planeLine(view(positions), view(normals), p, r, Corrade::Containers::ArrayView<Float>{out.data(), out.size()});
+    });
+
+    CORRADE_COMPARE(out[Count - 1], expected);
+    print("planeLine()", perItem, batch);
+}
+
+}}}}
+
+CORRADE_TEST_MAIN(Magnum::Math::Geometry::Test::DistanceBenchmark)
@@ -23,6 +23,8 @@
     DEALINGS IN THE SOFTWARE.
 */
 
+#include <sstream>
+#include <vector>
 #include <Corrade/TestSuite/Tester.h>
 
 #include "Magnum/Math/Constants.h"
@@ -37,6 +39,14 @@ struct DistanceTest: Corrade::TestSuite::Tester {
     void linePoint3D();
     void lineSegmentPoint2D();
     void lineSegmentPoint3D();
+
+    void linePoint2DBatch();
+    void linePoint3DBatch();
+    void lineSegmentPoint2DBatch();
+    void lineSegmentPoint3DBatch();
+    void batchTies();
+    void batchDegenerate();
+    void batchSizeMismatch();
 };
 
 typedef Math::Vector2<Float> Vector2;
@@ -47,7 +57,15 @@ DistanceTest::DistanceTest() {
     addTests({&DistanceTest::linePoint2D,
               &DistanceTest::linePoint3D,
               &DistanceTest::lineSegmentPoint2D,
-              &DistanceTest::lineSegmentPoint3D});
+              &DistanceTest::lineSegmentPoint3D,
+
+              &DistanceTest::linePoint2DBatch,
+              &DistanceTest::linePoint3DBatch,
+              &DistanceTest::lineSegmentPoint2DBatch,
+              &DistanceTest::lineSegmentPoint3DBatch,
+              &DistanceTest::batchTies,
+              &DistanceTest::batchDegenerate,
+              &DistanceTest::batchSizeMismatch});
 }
 
 void DistanceTest::linePoint2D() {
@@ -156,6 +174,141 @@ void DistanceTest::lineSegmentPoint3D() {
                     Constants::sqrt2());
 }
 
+namespace {
+    /* Count not divisible by four to exercise also the remainder, pseudo-random
+       segments with distinct distances from the query points */
+    enum: std::size_t { Count = 39 };
+
+    template<class T> std::vector<T> points(Float offset) {
+        std::vector<T> out;
+        for(std::size_t i = 0; i != Count; ++i) {
+            T v;
+            for(std::size_t j = 0; j != T::Size; ++j)
+                v[j] = Float((i*7 + j*5) % 23) - 11.0f + Float(i)*0.0625f + offset*Float(j + 1);
+            out.push_back(v);
+        }
+        return out;
+    }
+
+    template<class T> Corrade::Containers::ArrayView<const T> view(const std::vector<T>& data) {
+        return {data.data(), data.size()};
+    }
+
+    /* Expected minimum using the single-item function */
+    template<class T> std::pair<Float, std::size_t> expectedMinimum(const std::vector<T>& a, const std::vector<T>& b, const T& point, Float(*distance)(const T&, const T&, const T&)) {
+        std::pair<Float, std::size_t> out{Constants::inf(), a.size()};
+        for(std::size_t i = 0; i != a.size(); ++i) {
+            const Float d = distance(a[i], b[i], point);
+            if(d < out.first) out = {d, i};
+        }
+        return out;
+    }
+}
+
+void DistanceTest::linePoint2DBatch() {
+    const std::vector<Vector2> a = points<Vector2>(0.0f);
+    const std::vector<Vector2> b = points<Vector2>(3.5f);
+    const Vector2 point{2.5f, -1.25f};
+
+    const std::pair<Float, std::size_t> expected = expectedMinimum(a, b, point, Distance::linePointSquared<Float>);
+    const std::pair<Float, std::size_t> out = Distance::linePointSquared(view(a), view(b), point);
+    CORRADE_COMPARE(out.first, expected.first);
+    CORRADE_COMPARE(out.second, expected.second);
+}
+
+void DistanceTest::linePoint3DBatch() {
+    const std::vector<Vector3> a = points<Vector3>(0.0f);
+    const std::vector<Vector3> b = points<Vector3>(-1.5f);
+    const Vector3 point{0.5f, 3.0f, -1.25f};
+
+    const std::pair<Float, std::size_t> expected = expectedMinimum(a, b, point, Distance::linePointSquared<Float>);
+    const std::pair<Float, std::size_t> out = Distance::linePointSquared(view(a), view(b), point);
+    CORRADE_COMPARE(out.first, expected.first);
+    CORRADE_COMPARE(out.second, expected.second);
+}
+
+void DistanceTest::lineSegmentPoint2DBatch() {
+    const std::vector<Vector2> a = points<Vector2>(0.0f);
+    const std::vector<Vector2> b = points<Vector2>(2.0f);
+
+    /* Query points covering all three cases of the segment distance */
+    for(const Vector2& point: {Vector2{2.5f, -1.25f}, Vector2{-15.0f, 7.0f}, Vector2{20.0f, 20.0f}}) {
+        const std::pair<Float, std::size_t> expected = expectedMinimum(a, b, point, Distance::lineSegmentPointSquared<Float>);
+        const std::pair<Float, std::size_t> squared = Distance::lineSegmentPointSquared(view(a), view(b), point);
+        CORRADE_COMPARE(squared.first, expected.first);
+        CORRADE_COMPARE(squared.second, expected.second);
+
+        const std::pair<Float, std::size_t> out = Distance::lineSegmentPoint(view(a), view(b), point);
+        CORRADE_COMPARE(out.first, std::sqrt(expected.first));
+        CORRADE_COMPARE(out.second, expected.second);
+    }
+}
+
+void DistanceTest::lineSegmentPoint3DBatch() {
+    const std::vector<Vector3> a = points<Vector3>(0.0f);
+    const std::vector<Vector3> b = points<Vector3>(-2.5f);
+
+    for(const Vector3& point: {Vector3{0.5f, 3.0f, -1.25f}, Vector3{-20.0f, -15.0f, 8.0f}, Vector3{25.0f}}) {
+        const std::pair<Float, std::size_t> expected = expectedMinimum(a, b, point, Distance::lineSegmentPointSquared<Float>);
+        const std::pair<Float, std::size_t> squared = Distance::lineSegmentPointSquared(view(a), view(b), point);
+        CORRADE_COMPARE(squared.first, expected.first);
+        CORRADE_COMPARE(squared.second, expected.second);
+
+        const std::pair<Float, std::size_t> out = Distance::lineSegmentPoint(view(a), view(b), point);
+        CORRADE_COMPARE(out.first, std::sqrt(expected.first));
+        CORRADE_COMPARE(out.second, expected.second);
+    }
+}
+
+void DistanceTest::batchTies() {
+    /* The same closest segment in different SIMD lanes and in the remainder,
+       the first one should be picked */
+    std::vector<Vector3> a = points<Vector3>(0.0f);
+    std::vector<Vector3> b = points<Vector3>(-2.5f);
+    for(std::size_t i: {37, 9, 6, 14}) {
+        a[i] = {-0.5f, 0.0f, 0.0f};
+        b[i] = {0.5f, 0.0f, 0.0f};
+    }
+
+    const std::pair<Float, std::size_t> out = Distance::lineSegmentPointSquared(view(a), view(b), Vector3{0.0f, 0.125f, 0.0f});
+    CORRADE_COMPARE(out.first, 0.015625f);
+    CORRADE_COMPARE(out.second, 6);
+}
+
+void DistanceTest::batchDegenerate() {
+    /* Lines with both points the same have NaN distance and are skipped */
+    std::vector<Vector2> a{{1.0f, 2.0f}, {0.0f, 0.0f}, {3.0f, 3.0f}, {1.0f, 1.0f}, {0.0f, 5.0f}};
+    std::vector<Vector2> b{{1.0f, 2.0f}, {0.0f, 0.0f}, {3.0f, 3.0f}, {1.0f, 0.0f}, {0.0f, 5.0f}};
+    const std::pair<Float, std::size_t> out = Distance::linePointSquared(view(a), view(b), Vector2{0.0f});
+    CORRADE_COMPARE(out.first, 1.0f);
+    CORRADE_COMPARE(out.second, 3);
+
+    /* No valid line */
+    a.erase(a.begin() + 3);
+    b.erase(b.begin() + 3);
+    const std::pair<Float, std::size_t> none = Distance::linePointSquared(view(a), view(b), Vector2{0.0f});
+    CORRADE_COMPARE(none.first, Constants::inf());
+    CORRADE_COMPARE(none.second, 4);
+
+    /* Empty arrays */
+    const std::pair<Float, std::size_t> empty = Distance::lineSegmentPointSquared(Corrade::Containers::ArrayView<const Vector3>{}, Corrade::Containers::ArrayView<const Vector3>{}, Vector3{});
+    CORRADE_COMPARE(empty.first, Constants::inf());
+    CORRADE_COMPARE(empty.second, 0);
+}
+
+void DistanceTest::batchSizeMismatch() {
+    std::ostringstream out;
+    Error::setOutput(&out);
+
+    const Vector2 a[3];
+    const Vector2 b[2];
+    Distance::linePointSquared(Corrade::Containers::ArrayView<const Vector2>{a}, Corrade::Containers::ArrayView<const Vector2>{b}, Vector2{});
+    Distance::lineSegmentPoint(Corrade::Containers::ArrayView<const Vector2>{a}, Corrade::Containers::ArrayView<const Vector2>{b}, Vector2{});
+    CORRADE_COMPARE(out.str(),
+        "Math::Geometry::Distance::linePointSquared(): expected arrays of the same size but got 3 and 2\n"
+        "Math::Geometry::Distance::lineSegmentPointSquared(): expected arrays of the same size but got 3 and 2\n");
+}
+
 }}}}
 
 CORRADE_TEST_MAIN(Magnum::Math::Geometry::Test::DistanceTest)
@@ -23,6 +23,8 @@
     DEALINGS IN THE SOFTWARE.
 */
 
+#include <sstream>
+#include <vector>
 #include <Corrade/TestSuite/Tester.h>
 
 #include "Magnum/Math/Geometry/Intersection.h"
@@ -34,6 +36,9 @@ struct IntersectionTest: Corrade::TestSuite::Tester {
 
     void planeLine();
     void lineLine();
+
+    void planeLineBatch();
+    void planeLineBatchSizeMismatch();
 };
 
 typedef Math::Vector2<Float> Vector2;
@@ -42,7 +47,10 @@ typedef Math::Constants<Float> Constants;
 
 IntersectionTest::IntersectionTest() {
     addTests({&IntersectionTest::planeLine,
-              &IntersectionTest::lineLine});
+              &IntersectionTest::lineLine,
+
+              &IntersectionTest::planeLineBatch,
+              &IntersectionTest::planeLineBatchSizeMismatch});
 }
 
 void IntersectionTest::planeLine() {
@@ -97,6 +105,46 @@ void IntersectionTest::lineLine() {
         {0.0f, 0.0f}, {1.0f, 2.0f}), Constants::inf());
 }
 
+void IntersectionTest::planeLineBatch() {
+    /* Count not divisible by four to exercise also the remainder */
+    std::vector<Vector3> positions, normals;
+    for(std::size_t i = 0; i != 11; ++i) {
+        positions.emplace_back(Float(i) - 3.0f, Float(i % 3)*0.5f, Float(i)*0.25f);
+        normals.push_back(Vector3(Float(i % 4), 1.0f, Float(i % 5) - 2.0f).normalized());
+    }
+    /* Line lying on the plane and parallel to it */
+    positions[5] = {-1.0f, 1.0f, 0.5f};
+    normals[5] = {0.0f, 0.0f, 1.0f};
+    positions[9] = {-1.0f, 1.0f, 0.5f};
+    normals[9] = {0.0f, 0.0f, 1.0f};
+
+    const Vector3 p{1.0f, 0.5f, 0.5f};
+    const Vector3 r{-1.0f, 0.5f, 0.0f};
+    std::vector<Float> out(positions.size());
+    Intersection::planeLine(Corrade::Containers::ArrayView<const Vector3>{positions.data(), positions.size()}, Corrade::Containers::ArrayView<const Vector3>{normals.data(), normals.size()}, p, r, Corrade::Containers::ArrayView<Float>{out.data(), out.size()});
+
+    for(std::size_t i = 0; i != out.size(); ++i) {
+        if(i == 5 || i == 9) continue;
+        CORRADE_COMPARE(out[i], Intersection::planeLine(positions[i], normals[i], p, r));
+    }
+    CORRADE_COMPARE(out[5], Constants::nan());
+    CORRADE_COMPARE(out[9], Constants::nan());
+}
+
+void IntersectionTest::planeLineBatchSizeMismatch() {
+    std::ostringstream out;
+    Error::setOutput(&out);
+
+    const Vector3 positions[3];
+    const Vector3 normals[2];
+    Float t[2];
+    Intersection::planeLine(Corrade::Containers::ArrayView<const Vector3>{positions}, Corrade::Containers::ArrayView<const Vector3>{normals}, {}, {}, Corrade::Containers::ArrayView<Float>{t});
+    Intersection::planeLine(Corrade::Containers::ArrayView<const Vector3>{normals}, Corrade::Containers::ArrayView<const Vector3>{normals}, {}, {}, Corrade::Containers::ArrayView<Float>{t, 1});
+    CORRADE_COMPARE(out.str(),
+        "Math::Geometry::Intersection::planeLine(): expected plane position and normal arrays of the same size but got 3 and 2\n"
+        "Math::Geometry::Intersection::planeLine(): expected output array of size 2 but got 1\n");
+}
+
 }}}}
 
 CORRADE_TEST_MAIN(Magnum::Math::Geometry::Test::IntersectionTest)
@@ -0,0 +1,150 @@
+#ifndef Magnum_Math_Half_h
+#define Magnum_Math_Half_h
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+/** @file
+ * @brief Class @ref Magnum::Math::Half, literal @link Magnum::Math::operator""_h() @endlink
+ */
+
+#include <Corrade/Utility/Debug.h>
+
+#include "Magnum/Math/Math.h"
+#include "Magnum/Math/Packing.h"
+#include "Magnum/Math/Tags.h"
+
+namespace Magnum { namespace Math {
+
+/**
+@brief Half-precision float
+
+Storage-only 16-bit floating-point type, useful for reducing memory footprint
+of vertex data, animation tracks or textures where full precision is not
+needed. No arithmetic operations are provided, convert the value to
+@ref Magnum::Float "Float" for calculations:
+@code
+Half a{3.5f};
+Float b = Float(a)*2.0f;
+Half c = 1.0_h;
+@endcode
+
+Vectors of half-floats (@ref Magnum::Vector2h "Vector2h",
+@ref Magnum::Vector3h "Vector3h" and @ref Magnum::Vector4h "Vector4h") can be
+converted from and to float vectors using the usual conversion constructor,
+e.g. `Vector3h{Vector3{...}}`. For converting large arrays use
+@ref Batch::packHalf() and @ref Batch::unpackHalf(), which make use of F16C or
+NEON instructions if available.
+
+Comparison is done on the underlying bit representation, thus negative and
+positive zero are not equal and NaN with the same bits compares equal to
+itself.
+@see @ref packHalf(), @ref unpackHalf()
+*/
+class Half {
+    public:
+        /**
+         * @brief Default constructor
+         *
+         * Creates positive zero.
+         */
+        constexpr /*implicit*/ Half(ZeroInitT = ZeroInit) noexcept: _data{} {}
+
+        /** @brief Construct half value from underlying 16-bit representation */
+        constexpr explicit Half(UnsignedShort data) noexcept: _data{data} {}
+
+        /**
+         * @brief Construct half value from 32-bit float representation
+         *
+         * @see @ref packHalf()
+         */
+        explicit Half(Float value) noexcept: _data{packHalf(value)} {}
+
+        /**
+         * @brief Construct half value from 64-bit float representation
+         *
+         * The value is converted to 32-bit float first.
+         */
+        explicit Half(Double value) noexcept: _data{packHalf(Float(value))} {}
+
+        /** @brief Construct without initializing the contents */
+        explicit Half(NoInitT) noexcept {}
+
+        /** @brief Equality comparison */
+        constexpr bool operator==(Half other) const {
+            return _data == other._data;
+        }
+
+        /** @brief Non-equality comparison */
+        constexpr bool operator!=(Half other) const {
+            return _data != other._data;
+        }
+
+        /**
+         * @brief Negated value
+         *
+         * Flips the sign bit.
+         */
+        constexpr Half operator-() const {
+            return Half{UnsignedShort(_data ^ (1 << 15))};
+        }
+
+        /**
+         * @brief Conversion to underlying representation
+         *
+         * @see @ref data()
+         */
+        constexpr explicit operator UnsignedShort() const { return _data; }
+
+        /**
+         * @brief Conversion to 32-bit float representation
+         *
+         * @see @ref unpackHalf()
+         */
+        explicit operator Float() const { return unpackHalf(_data); }
+
+        /** @brief Underlying representation */
+        constexpr UnsignedShort data() const { return _data; }
+
+    private:
+        UnsignedShort _data;
+};
+
+/** @relatesalso Half
+@brief Half-float literal
+
+Example usage:
+@code
+Half a = 3.5_h;
+@endcode
+*/
+inline Half operator "" _h(long double value) { return Half(Float(value)); }
+
+/** @debugoperator{Magnum::Math::Half} */
+inline Corrade::Utility::Debug& operator<<(Corrade::Utility::Debug& debug, Half value) {
+    return debug << Float(value);
+}
+
+}}
+
+#endif
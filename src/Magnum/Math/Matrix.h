@@ -29,12 +29,20 @@
  * @brief Class @ref Magnum::Math::Matrix, typedef @ref Magnum::Math::Matrix2x2, @ref Magnum::Math::Matrix3x3, @ref Magnum::Math::Matrix4x4
  */
 
+#include <utility>
+
 #include "Magnum/Math/RectangularMatrix.h"
 
+#ifdef MAGNUM_BUILD_SIMD
+#include "Magnum/Math/simdImplementation.h"
+#endif
+
 namespace Magnum { namespace Math {
 
 namespace Implementation {
     template<std::size_t, class> struct MatrixDeterminant;
+    template<std::size_t, class> struct MatrixInverse;
+    template<std::size_t, class> struct MatrixMultiply;
 }
 
 /**
@@ -187,14 +195,17 @@ template<std::size_t size, class T> class Matrix: public RectangularMatrix<size,
         /**
          * @brief Inverted matrix
          *
-         * Computed using Cramer's rule: @f[
+         * For matrices up to 4x4 computed in closed form using Cramer's
+         * rule: @f[
          *      A^{-1} = \frac{1}{\det(A)} Adj(A)
          * @f]
-         * See @ref invertedOrthogonal(), @ref Matrix3::invertedRigid() and
-         * @ref Matrix4::invertedRigid() which are faster alternatives for
-         * particular matrix types.
+         * with the adjugate of 4x4 matrices expressed using 2x2
+         * subdeterminants. Larger matrices are inverted using LU
+         * decomposition with partial pivoting. See @ref invertedOrthogonal(),
+         * @ref Matrix3::invertedRigid() and @ref Matrix4::invertedRigid()
+         * which are faster alternatives for particular matrix types.
          */
-        Matrix<size, T> inverted() const;
+        Matrix<size, T> inverted() const { return Implementation::MatrixInverse<size, T>()(*this); }
 
         /**
          * @brief Inverted orthogonal matrix
@@ -215,13 +226,13 @@ template<std::size_t size, class T> class Matrix: public RectangularMatrix<size,
 
         #ifndef DOXYGEN_GENERATING_OUTPUT
         /* Reimplementation of functions to return correct type */
-        Matrix<size, T> operator*(const Matrix<size, T>& other) const {
+        constexpr Matrix<size, T> operator*(const Matrix<size, T>& other) const {
             return RectangularMatrix<size, size, T>::operator*(other);
         }
-        template<std::size_t otherCols> RectangularMatrix<otherCols, size, T> operator*(const RectangularMatrix<otherCols, size, T>& other) const {
+        template<std::size_t otherCols> constexpr RectangularMatrix<otherCols, size, T> operator*(const RectangularMatrix<otherCols, size, T>& other) const {
             return RectangularMatrix<size, size, T>::operator*(other);
         }
-        Vector<size, T> operator*(const Vector<size, T>& other) const {
+        constexpr Vector<size, T> operator*(const Vector<size, T>& other) const {
             return RectangularMatrix<size, size, T>::operator*(other);
         }
         MAGNUM_RECTANGULARMATRIX_SUBCLASS_IMPLEMENTATION(size, size, Matrix<size, T>)
@@ -282,13 +293,13 @@ template<std::size_t size, class T> inline Corrade::Utility::Debug& operator<<(C
         return VectorType<T>(Matrix<size, T>::row(row));                    \
     }                                                                       \
                                                                             \
-    Type<T> operator*(const Matrix<size, T>& other) const {                 \
+    constexpr Type<T> operator*(const Matrix<size, T>& other) const {       \
         return Matrix<size, T>::operator*(other);                           \
     }                                                                       \
-    template<std::size_t otherCols> RectangularMatrix<otherCols, size, T> operator*(const RectangularMatrix<otherCols, size, T>& other) const { \
+    template<std::size_t otherCols> constexpr RectangularMatrix<otherCols, size, T> operator*(const RectangularMatrix<otherCols, size, T>& other) const { \
         return Matrix<size, T>::operator*(other);                           \
     }                                                                       \
-    VectorType<T> operator*(const Vector<size, T>& other) const {           \
+    constexpr VectorType<T> operator*(const Vector<size, T>& other) const { \
         return Matrix<size, T>::operator*(other);                           \
     }                                                                       \
                                                                             \
@@ -326,6 +337,177 @@ template<class T> struct MatrixDeterminant<1, T> {
     }
 };
 
+template<std::size_t size, class T> struct MatrixInverse {
+    Matrix<size, T> operator()(const Matrix<size, T>& m) const;
+};
+
+template<std::size_t size, class T> Matrix<size, T> MatrixInverse<size, T>::operator()(const Matrix<size, T>& m) const {
+    /* LU decomposition with partial pivoting. Operating on transposed
+       matrix, so lu[row][col] and row swaps are just vector swaps. */
+    Matrix<size, T> lu = m.transposed();
+    std::size_t permutation[size];
+    for(std::size_t i = 0; i != size; ++i) permutation[i] = i;
+
+    for(std::size_t k = 0; k != size; ++k) {
+        std::size_t pivot = k;
+        for(std::size_t i = k + 1; i != size; ++i)
+            if(std::abs(lu[i][k]) > std::abs(lu[pivot][k])) pivot = i;
+        if(pivot != k) {
+            std::swap(lu[pivot], lu[k]);
+            std::swap(permutation[pivot], permutation[k]);
+        }
+
+        for(std::size_t i = k + 1; i != size; ++i) {
+            lu[i][k] /= lu[k][k];
+            for(std::size_t j = k + 1; j != size; ++j)
+                lu[i][j] -= lu[i][k]*lu[k][j];
+        }
+    }
+
+    /* Solve L*U*x = P*e for each column e of identity matrix, the solution is
+       corresponding column of the inverse */
+    Matrix<size, T> out{ZeroInit};
+    for(std::size_t col = 0; col != size; ++col) {
+        Vector<size, T>& x = out[col];
+        for(std::size_t i = 0; i != size; ++i) {
+            T value = permutation[i] == col ? T(1) : T(0);
+            for(std::size_t j = 0; j != i; ++j)
+                value -= lu[i][j]*x[j];
+            x[i] = value;
+        }
+        for(std::size_t i = size; i != 0; --i) {
+            T value = x[i - 1];
+            for(std::size_t j = i; j != size; ++j)
+                value -= lu[i - 1][j]*x[j];
+            x[i - 1] = value/lu[i - 1][i - 1];
+        }
+    }
+
+    return out;
+}
+
+/* Closed-form inversions for common sizes. Matrix columns are used as rows,
+   which gives transposed inverse of transposed matrix, i.e. the inverse. */
+template<class T> struct MatrixInverse<4, T> {
+    Matrix<4, T> operator()(const Matrix<4, T>& a) const {
+        /* 2x2 subdeterminants of the first two and the last two rows */
+        const T s0 = a[0][0]*a[1][1] - a[1][0]*a[0][1];
+        const T s1 = a[0][0]*a[1][2] - a[1][0]*a[0][2];
+        const T s2 = a[0][0]*a[1][3] - a[1][0]*a[0][3];
+        const T s3 = a[0][1]*a[1][2] - a[1][1]*a[0][2];
+        const T s4 = a[0][1]*a[1][3] - a[1][1]*a[0][3];
+        const T s5 = a[0][2]*a[1][3] - a[1][2]*a[0][3];
+        const T c5 = a[2][2]*a[3][3] - a[3][2]*a[2][3];
+        const T c4 = a[2][1]*a[3][3] - a[3][1]*a[2][3];
+        const T c3 = a[2][1]*a[3][2] - a[3][1]*a[2][2];
+        const T c2 = a[2][0]*a[3][3] - a[3][0]*a[2][3];
+        const T c1 = a[2][0]*a[3][2] - a[3][0]*a[2][2];
+        const T c0 = a[2][0]*a[3][1] - a[3][0]*a[2][1];
+
+        const T determinant = s0*c5 - s1*c4 + s2*c3 + s3*c2 - s4*c1 + s5*c0;
+
+        Matrix<4, T> out{NoInit};
+        out[0][0] = ( a[1][1]*c5 - a[1][2]*c4 + a[1][3]*c3)/determinant;
+        out[0][1] = (-a[0][1]*c5 + a[0][2]*c4 - a[0][3]*c3)/determinant;
+        out[0][2] = ( a[3][1]*s5 - a[3][2]*s4 + a[3][3]*s3)/determinant;
+        out[0][3] = (-a[2][1]*s5 + a[2][2]*s4 - a[2][3]*s3)/determinant;
+        out[1][0] = (-a[1][0]*c5 + a[1][2]*c2 - a[1][3]*c1)/determinant;
+        out[1][1] = ( a[0][0]*c5 - a[0][2]*c2 + a[0][3]*c1)/determinant;
+        out[1][2] = (-a[3][0]*s5 + a[3][2]*s2 - a[3][3]*s1)/determinant;
+        out[1][3] = ( a[2][0]*s5 - a[2][2]*s2 + a[2][3]*s1)/determinant;
+        out[2][0] = ( a[1][0]*c4 - a[1][1]*c2 + a[1][3]*c0)/determinant;
+        out[2][1] = (-a[0][0]*c4 + a[0][1]*c2 - a[0][3]*c0)/determinant;
+        out[2][2] = ( a[3][0]*s4 - a[3][1]*s2 + a[3][3]*s0)/determinant;
+        out[2][3] = (-a[2][0]*s4 + a[2][1]*s2 - a[2][3]*s0)/determinant;
+        out[3][0] = (-a[1][0]*c3 + a[1][1]*c1 - a[1][2]*c0)/determinant;
+        out[3][1] = ( a[0][0]*c3 - a[0][1]*c1 + a[0][2]*c0)/determinant;
+        out[3][2] = (-a[3][0]*s3 + a[3][1]*s1 - a[3][2]*s0)/determinant;
+        out[3][3] = ( a[2][0]*s3 - a[2][1]*s1 + a[2][2]*s0)/determinant;
+        return out;
+    }
+};
+
+#ifdef MAGNUM_MATH_SIMD
+template<> struct MatrixInverse<4, Float> {
+    Matrix<4, Float> operator()(const Matrix<4, Float>& a) const {
+        Matrix<4, Float> out{NoInit};
+        Simd::invertMatrix(a.data(), out.data());
+        return out;
+    }
+};
+#endif
+
+template<class T> struct MatrixInverse<3, T> {
+    Matrix<3, T> operator()(const Matrix<3, T>& a) const {
+        /* Cofactors of the first row */
+        const T c0 = a[1][1]*a[2][2] - a[1][2]*a[2][1];
+        const T c1 = a[1][2]*a[2][0] - a[1][0]*a[2][2];
+        const T c2 = a[1][0]*a[2][1] - a[1][1]*a[2][0];
+
+        const T determinant = a[0][0]*c0 + a[0][1]*c1 + a[0][2]*c2;
+
+        Matrix<3, T> out{NoInit};
+        out[0][0] = c0/determinant;
+        out[0][1] = (a[0][2]*a[2][1] - a[0][1]*a[2][2])/determinant;
+        out[0][2] = (a[0][1]*a[1][2] - a[0][2]*a[1][1])/determinant;
+        out[1][0] = c1/determinant;
+        out[1][1] = (a[0][0]*a[2][2] - a[0][2]*a[2][0])/determinant;
+        out[1][2] = (a[0][2]*a[1][0] - a[0][0]*a[1][2])/determinant;
+        out[2][0] = c2/determinant;
+        out[2][1] = (a[0][1]*a[2][0] - a[0][0]*a[2][1])/determinant;
+        out[2][2] = (a[0][0]*a[1][1] - a[0][1]*a[1][0])/determinant;
+        return out;
+    }
+};
+
+template<class T> struct MatrixInverse<2, T> {
+    Matrix<2, T> operator()(const Matrix<2, T>& a) const {
+        const T determinant = a[0][0]*a[1][1] - a[1][0]*a[0][1];
+
+        Matrix<2, T> out{NoInit};
+        out[0][0] =  a[1][1]/determinant;
+        out[0][1] = -a[0][1]/determinant;
+        out[1][0] = -a[1][0]/determinant;
+        out[1][1] =  a[0][0]/determinant;
+        return out;
+    }
+};
+
+template<class T> struct MatrixInverse<1, T> {
+    Matrix<1, T> operator()(const Matrix<1, T>& a) const {
+        Matrix<1, T> out{NoInit};
+        out[0][0] = T(1)/a[0][0];
+        return out;
+    }
+};
+
+/* Runtime matrix products. The operators stay generic so they're usable in
+   constant expressions, non-constexpr functions such as
+   Matrix4::transformPoint() go through this to use SIMD where available. */
+template<std::size_t size, class T> struct MatrixMultiply {
+    static Matrix<size, T> multiply(const Matrix<size, T>& a, const Matrix<size, T>& b) {
+        return a*b;
+    }
+    static Vector<size, T> multiply(const Matrix<size, T>& a, const Vector<size, T>& b) {
+        return a*b;
+    }
+};
+
+#ifdef MAGNUM_MATH_SIMD
+template<> struct MatrixMultiply<4, Float> {
+    static Matrix<4, Float> multiply(const Matrix<4, Float>& a, const Matrix<4, Float>& b) {
+        Matrix<4, Float> out{NoInit};
+        Simd::multiplyMatrix(a.data(), b.data(), out.data());
+        return out;
+    }
+    static Vector<4, Float> multiply(const Matrix<4, Float>& a, const Vector<4, Float>& b) {
+        Vector<4, Float> out{NoInit};
+        Simd::multiplyMatrixVector(a.data(), b.data(), out.data());
+        return out;
+    }
+};
+#endif
+
 }
 #endif
 
@@ -354,18 +536,6 @@ template<std::size_t size, class T> Matrix<size-1, T> Matrix<size, T>::ij(const
     return out;
 }
 
-template<std::size_t size, class T> Matrix<size, T> Matrix<size, T>::inverted() const {
-    Matrix<size, T> out{ZeroInit};
-
-    const T _determinant = determinant();
-
-    for(std::size_t col = 0; col != size; ++col)
-        for(std::size_t row = 0; row != size; ++row)
-            out[col][row] = (((row+col) & 1) ? -1 : 1)*ij(row, col).determinant()/_determinant;
-
-    return out;
-}
-
 }}
 
 namespace Corrade { namespace Utility {
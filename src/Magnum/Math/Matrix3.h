@@ -83,6 +83,20 @@ template<class T> class Matrix3: public Matrix3x3<T> {
          */
         static Matrix3<T> rotation(Rad<T> angle);
 
+        /**
+         * @brief 2D rotation matrix from precomputed sine and cosine
+         * @param sine      Sine of the rotation angle
+         * @param cosine    Cosine of the rotation angle
+         *
+         * Same as @ref rotation(Rad), but usable in constant expressions
+         * together with @ref Math::constexprSin() and @ref Math::constexprCos().
+         */
+        constexpr static Matrix3<T> rotation(T sine, T cosine) {
+            return {{ cosine,   sine, T(0)},
+                    {  -sine, cosine, T(0)},
+                    {   T(0),   T(0), T(1)}};
+        }
+
         /**
          * @brief 2D reflection matrix
          * @param normal    Normal of the line through which to reflect
@@ -384,13 +398,8 @@ template<class T> inline Corrade::Utility::Debug& operator<<(Corrade::Utility::D
     return debug << static_cast<const Matrix3x3<T>&>(value);
 }
 
-template<class T> Matrix3<T> Matrix3<T>::rotation(const Rad<T> angle) {
-    const T sine = std::sin(T(angle));
-    const T cosine = std::cos(T(angle));
-
-    return {{ cosine,   sine, T(0)},
-            {  -sine, cosine, T(0)},
-            {   T(0),   T(0), T(1)}};
+template<class T> inline Matrix3<T> Matrix3<T>::rotation(const Rad<T> angle) {
+    return rotation(std::sin(T(angle)), std::cos(T(angle)));
 }
 
 template<class T> inline Matrix3<T> Matrix3<T>::invertedRigid() const {
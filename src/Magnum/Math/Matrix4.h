@@ -97,6 +97,35 @@ template<class T> class Matrix4: public Matrix4x4<T> {
          */
         static Matrix4<T> rotation(Rad<T> angle, const Vector3<T>& normalizedAxis);
 
+        /**
+         * @brief 3D rotation around arbitrary axis from precomputed sine and cosine
+         * @param sine              Sine of the rotation angle
+         * @param cosine            Cosine of the rotation angle
+         * @param normalizedAxis    Normalized rotation axis
+         *
+         * Same as @ref rotation(Rad, const Vector3<T>&), but usable in
+         * constant expressions together with @ref Math::constexprSin() and
+         * @ref Math::constexprCos(). Unlike the above, the axis is not
+         * checked for being normalized.
+         */
+        constexpr static Matrix4<T> rotation(T sine, T cosine, const Vector3<T>& normalizedAxis) {
+            return {
+                {cosine + normalizedAxis.x()*normalizedAxis.x()*(T(1) - cosine),
+                    normalizedAxis.x()*normalizedAxis.y()*(T(1) - cosine) + normalizedAxis.z()*sine,
+                        normalizedAxis.x()*normalizedAxis.z()*(T(1) - cosine) - normalizedAxis.y()*sine,
+                            T(0)},
+                {normalizedAxis.x()*normalizedAxis.y()*(T(1) - cosine) - normalizedAxis.z()*sine,
+                    cosine + normalizedAxis.y()*normalizedAxis.y()*(T(1) - cosine),
+                        normalizedAxis.y()*normalizedAxis.z()*(T(1) - cosine) + normalizedAxis.x()*sine,
+                            T(0)},
+                {normalizedAxis.x()*normalizedAxis.z()*(T(1) - cosine) + normalizedAxis.y()*sine,
+                    normalizedAxis.y()*normalizedAxis.z()*(T(1) - cosine) - normalizedAxis.x()*sine,
+                        cosine + normalizedAxis.z()*normalizedAxis.z()*(T(1) - cosine),
+                            T(0)},
+                {T(0), T(0), T(0), T(1)}
+            };
+        }
+
         /**
          * @brief 3D rotation around X axis
          * @param angle Rotation angle (counterclockwise)
@@ -108,6 +137,21 @@ template<class T> class Matrix4: public Matrix4x4<T> {
          */
         static Matrix4<T> rotationX(Rad<T> angle);
 
+        /**
+         * @brief 3D rotation around X axis from precomputed sine and cosine
+         * @param sine      Sine of the rotation angle
+         * @param cosine    Cosine of the rotation angle
+         *
+         * Same as @ref rotationX(Rad), but usable in constant expressions
+         * together with @ref Math::constexprSin() and @ref Math::constexprCos().
+         */
+        constexpr static Matrix4<T> rotationX(T sine, T cosine) {
+            return {{T(1),   T(0),   T(0), T(0)},
+                    {T(0), cosine,   sine, T(0)},
+                    {T(0),  -sine, cosine, T(0)},
+                    {T(0),   T(0),   T(0), T(1)}};
+        }
+
         /**
          * @brief 3D rotation around Y axis
          * @param angle Rotation angle (counterclockwise)
@@ -119,6 +163,21 @@ template<class T> class Matrix4: public Matrix4x4<T> {
          */
         static Matrix4<T> rotationY(Rad<T> angle);
 
+        /**
+         * @brief 3D rotation around Y axis from precomputed sine and cosine
+         * @param sine      Sine of the rotation angle
+         * @param cosine    Cosine of the rotation angle
+         *
+         * Same as @ref rotationY(Rad), but usable in constant expressions
+         * together with @ref Math::constexprSin() and @ref Math::constexprCos().
+         */
+        constexpr static Matrix4<T> rotationY(T sine, T cosine) {
+            return {{cosine, T(0),  -sine, T(0)},
+                    {  T(0), T(1),   T(0), T(0)},
+                    {  sine, T(0), cosine, T(0)},
+                    {  T(0), T(0),   T(0), T(1)}};
+        }
+
         /**
          * @brief 3D rotation matrix around Z axis
          * @param angle Rotation angle (counterclockwise)
@@ -130,6 +189,21 @@ template<class T> class Matrix4: public Matrix4x4<T> {
          */
         static Matrix4<T> rotationZ(Rad<T> angle);
 
+        /**
+         * @brief 3D rotation around Z axis from precomputed sine and cosine
+         * @param sine      Sine of the rotation angle
+         * @param cosine    Cosine of the rotation angle
+         *
+         * Same as @ref rotationZ(Rad), but usable in constant expressions
+         * together with @ref Math::constexprSin() and @ref Math::constexprCos().
+         */
+        constexpr static Matrix4<T> rotationZ(T sine, T cosine) {
+            return {{cosine,   sine, T(0), T(0)},
+                    { -sine, cosine, T(0), T(0)},
+                    {  T(0),   T(0), T(1), T(0)},
+                    {  T(0),   T(0), T(0), T(1)}};
+        }
+
         /**
          * @brief 3D reflection matrix
          * @param normal    Normal of the plane through which to reflect
@@ -450,12 +524,14 @@ template<class T> class Matrix4: public Matrix4x4<T> {
          * transformation. @f[
          *      \boldsymbol v' = \boldsymbol M \begin{pmatrix} v_x \\ v_y \\ v_z \\ 0 \end{pmatrix}
          * @f]
+         * For @ref Magnum::Float "Float" matrices the product is
+         * SIMD-accelerated if Magnum is built with `BUILD_SIMD` enabled.
          * @see @ref Quaternion::transformVector(),
          *      @ref Matrix3::transformVector()
          * @todo extract 3x3 matrix and multiply directly? (benchmark that)
          */
         Vector3<T> transformVector(const Vector3<T>& vector) const {
-            return ((*this)*Vector4<T>(vector, T(0))).xyz();
+            return Vector4<T>(Implementation::MatrixMultiply<4, T>::multiply(*this, Vector4<T>(vector, T(0)))).xyz();
         }
 
         /**
@@ -465,11 +541,13 @@ template<class T> class Matrix4: public Matrix4x4<T> {
          * the transformation. @f[
          *      \boldsymbol v' = \boldsymbol M \begin{pmatrix} v_x \\ v_y \\ v_z \\ 1 \end{pmatrix}
          * @f]
+         * For @ref Magnum::Float "Float" matrices the product is
+         * SIMD-accelerated if Magnum is built with `BUILD_SIMD` enabled.
          * @see @ref DualQuaternion::transformPoint(),
          *      @ref Matrix3::transformPoint()
          */
         Vector3<T> transformPoint(const Vector3<T>& vector) const {
-            return ((*this)*Vector4<T>(vector, T(1))).xyz();
+            return Vector4<T>(Implementation::MatrixMultiply<4, T>::multiply(*this, Vector4<T>(vector, T(1)))).xyz();
         }
 
         MAGNUM_RECTANGULARMATRIX_SUBCLASS_IMPLEMENTATION(4, 4, Matrix4<T>)
@@ -485,66 +563,23 @@ template<class T> inline Corrade::Utility::Debug& operator<<(Corrade::Utility::D
     return debug << static_cast<const Matrix4x4<T>&>(value);
 }
 
-template<class T> Matrix4<T> Matrix4<T>::rotation(const Rad<T> angle, const Vector3<T>& normalizedAxis) {
+template<class T> inline Matrix4<T> Matrix4<T>::rotation(const Rad<T> angle, const Vector3<T>& normalizedAxis) {
     CORRADE_ASSERT(normalizedAxis.isNormalized(),
                    "Math::Matrix4::rotation(): axis must be normalized", {});
 
-    const T sine = std::sin(T(angle));
-    const T cosine = std::cos(T(angle));
-    const T oneMinusCosine = T(1) - cosine;
-
-    const T xx = normalizedAxis.x()*normalizedAxis.x();
-    const T xy = normalizedAxis.x()*normalizedAxis.y();
-    const T xz = normalizedAxis.x()*normalizedAxis.z();
-    const T yy = normalizedAxis.y()*normalizedAxis.y();
-    const T yz = normalizedAxis.y()*normalizedAxis.z();
-    const T zz = normalizedAxis.z()*normalizedAxis.z();
-
-    return {
-        {cosine + xx*oneMinusCosine,
-            xy*oneMinusCosine + normalizedAxis.z()*sine,
-                xz*oneMinusCosine - normalizedAxis.y()*sine,
-                   T(0)},
-        {xy*oneMinusCosine - normalizedAxis.z()*sine,
-            cosine + yy*oneMinusCosine,
-                yz*oneMinusCosine + normalizedAxis.x()*sine,
-                   T(0)},
-        {xz*oneMinusCosine + normalizedAxis.y()*sine,
-            yz*oneMinusCosine - normalizedAxis.x()*sine,
-                cosine + zz*oneMinusCosine,
-                   T(0)},
-        {T(0), T(0), T(0), T(1)}
-    };
+    return rotation(std::sin(T(angle)), std::cos(T(angle)), normalizedAxis);
 }
 
-template<class T> Matrix4<T> Matrix4<T>::rotationX(const Rad<T> angle) {
-    const T sine = std::sin(T(angle));
-    const T cosine = std::cos(T(angle));
-
-    return {{T(1),   T(0),   T(0), T(0)},
-            {T(0), cosine,   sine, T(0)},
-            {T(0),  -sine, cosine, T(0)},
-            {T(0),   T(0),   T(0), T(1)}};
+template<class T> inline Matrix4<T> Matrix4<T>::rotationX(const Rad<T> angle) {
+    return rotationX(std::sin(T(angle)), std::cos(T(angle)));
 }
 
-template<class T> Matrix4<T> Matrix4<T>::rotationY(const Rad<T> angle) {
-    const T sine = std::sin(T(angle));
-    const T cosine = std::cos(T(angle));
-
-    return {{cosine, T(0),  -sine, T(0)},
-            {  T(0), T(1),   T(0), T(0)},
-            {  sine, T(0), cosine, T(0)},
-            {  T(0), T(0),   T(0), T(1)}};
+template<class T> inline Matrix4<T> Matrix4<T>::rotationY(const Rad<T> angle) {
+    return rotationY(std::sin(T(angle)), std::cos(T(angle)));
 }
 
-template<class T> Matrix4<T> Matrix4<T>::rotationZ(const Rad<T> angle) {
-    const T sine = std::sin(T(angle));
-    const T cosine = std::cos(T(angle));
-
-    return {{cosine,   sine, T(0), T(0)},
-            { -sine, cosine, T(0), T(0)},
-            {  T(0),   T(0), T(1), T(0)},
-            {  T(0),   T(0), T(0), T(1)}};
+template<class T> inline Matrix4<T> Matrix4<T>::rotationZ(const Rad<T> angle) {
+    return rotationZ(std::sin(T(angle)), std::cos(T(angle)));
 }
 
 template<class T> Matrix4<T> Matrix4<T>::reflection(const Vector3<T>& normal) {
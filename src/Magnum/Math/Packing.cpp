@@ -0,0 +1,102 @@
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#include "Packing.h"
+
+#include <cstring>
+
+namespace Magnum { namespace Math {
+
+/* Based on the branchy float <-> half conversions by Fabian Giesen,
+   https://gist.github.com/rygorous/2156668. Going through memcpy() to avoid
+   strict aliasing issues, the compiler optimizes it out. */
+
+namespace {
+    inline UnsignedInt floatBits(const Float value) {
+        UnsignedInt bits;
+        std::memcpy(&bits, &value, sizeof(Float));
+        return bits;
+    }
+
+    inline Float bitsFloat(const UnsignedInt bits) {
+        Float value;
+        std::memcpy(&value, &bits, sizeof(Float));
+        return value;
+    }
+}
+
+UnsignedShort packHalf(const Float value) {
+    constexpr UnsignedInt infinity = 255 << 23;
+    constexpr UnsignedInt halfMax = (127 + 16) << 23;
+    constexpr UnsignedInt denormMagic = ((127 - 15) + (23 - 10) + 1) << 23;
+
+    UnsignedInt bits = floatBits(value);
+    const UnsignedInt sign = bits & 0x80000000u;
+    bits ^= sign;
+
+    UnsignedShort out;
+
+    /* Infinity or NaN, keep the upper mantissa bits of NaN and make it
+       quiet */
+    if(bits >= halfMax)
+        out = bits > infinity ? 0x7e00|((bits >> 13) & 0x3ff) : 0x7c00;
+
+    /* Resulting half is subnormal or zero. Adding the magic value aligns the
+       ten mantissa bits at the bottom and rounds to nearest even as a side
+       effect, subtracting it again gives the final bits. */
+    else if(bits < (113 << 23))
+        out = floatBits(bitsFloat(bits) + bitsFloat(denormMagic)) - denormMagic;
+
+    /* Normalized value, rebias the exponent and round to nearest even */
+    else {
+        const UnsignedInt mantissaOdd = (bits >> 13) & 1;
+        bits -= (127 - 15) << 23;
+        bits += 0xfff + mantissaOdd;
+        out = bits >> 13;
+    }
+
+    return out|(sign >> 16);
+}
+
+Float unpackHalf(const UnsignedShort value) {
+    constexpr UnsignedInt shiftedExponent = 0x7c00 << 13;
+    constexpr UnsignedInt magic = 113 << 23;
+
+    UnsignedInt bits = (value & 0x7fff) << 13;
+    const UnsignedInt exponent = bits & shiftedExponent;
+    bits += (127 - 15) << 23;
+
+    /* Infinity or NaN, adjust the exponent once more */
+    if(exponent == shiftedExponent)
+        bits += (128 - 16) << 23;
+
+    /* Zero or subnormal, renormalize */
+    else if(exponent == 0)
+        bits = floatBits(bitsFloat(bits + (1 << 23)) - bitsFloat(magic));
+
+    return bitsFloat(bits|((value & 0x8000) << 16));
+}
+
+}}
@@ -0,0 +1,178 @@
+#ifndef Magnum_Math_Packing_h
+#define Magnum_Math_Packing_h
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+/** @file
+ * @brief Functions @ref Magnum::Math::packHalf(), @ref Magnum::Math::unpackHalf(), @ref Magnum::Math::packOctahedral(), @ref Magnum::Math::unpackOctahedral(), @ref Magnum::Math::packUnsigned1010102(), @ref Magnum::Math::unpackUnsigned1010102(), @ref Magnum::Math::packSigned1010102(), @ref Magnum::Math::unpackSigned1010102()
+ */
+
+#include <type_traits>
+
+#include "Magnum/Types.h"
+#include "Magnum/visibility.h"
+#include "Magnum/Math/Functions.h"
+#include "Magnum/Math/Vector4.h"
+
+namespace Magnum { namespace Math {
+
+/**
+@{ @name Packing functions
+
+Conversion of floating-point values to compact representations suitable for
+storing vertex attributes or animation data and back.
+*/
+
+/**
+@brief Pack 32-bit float value into 16-bit half-float representation
+
+Rounds to nearest, ties to even, same as the F16C and NEON conversion
+instructions. Values larger than the maximal representable half-float value
+are converted to infinity, NaNs are kept as (quiet) NaNs. Subnormal values are
+handled correctly.
+@see @ref unpackHalf(), @ref Half, @ref Batch::packHalf()
+*/
+UnsignedShort MAGNUM_EXPORT packHalf(Float value);
+
+/**
+@brief Unpack 16-bit half-float value into 32-bit float representation
+
+The conversion is exact.
+@see @ref packHalf(), @ref Half, @ref Batch::unpackHalf()
+*/
+Float MAGNUM_EXPORT unpackHalf(UnsignedShort value);
+
+/**
+@brief Pack unit vector into octahedral representation
+
+Projects the normalized @p vector onto an octahedron and unfolds it into a
+two-component vector in range @f$ [-1, 1] @f$. Combined with
+@ref denormalize() into two @ref Magnum::Short "Short"s it needs just one
+third of the memory of three-component float vector with negligible precision
+loss, two @ref Magnum::Byte "Byte"s are usually enough for shading normals. Zero-length vectors are not allowed.
+@see @ref unpackOctahedral()
+*/
+template<class T> Vector2<T> packOctahedral(const Vector3<T>& vector) {
+    static_assert(std::is_floating_point<T>::value, "Math::packOctahedral(): expected floating-point type");
+    const Vector2<T> projected = vector.xy()/(std::abs(vector.x()) + std::abs(vector.y()) + std::abs(vector.z()));
+    if(vector.z() >= T(0)) return projected;
+
+    /* Fold the lower hemisphere over the diagonals */
+    return {(T(1) - std::abs(projected.y()))*(projected.x() >= T(0) ? T(1) : T(-1)),
+            (T(1) - std::abs(projected.x()))*(projected.y() >= T(0) ? T(1) : T(-1))};
+}
+
+/**
+@brief Unpack unit vector from octahedral representation
+
+Inverse to @ref packOctahedral(), the result is normalized.
+*/
+template<class T> Vector3<T> unpackOctahedral(const Vector2<T>& packed) {
+    static_assert(std::is_floating_point<T>::value, "Math::unpackOctahedral(): expected floating-point type");
+    Vector3<T> vector{packed, T(1) - std::abs(packed.x()) - std::abs(packed.y())};
+
+    /* Unfold the lower hemisphere */
+    const T fold = Math::max(-vector.z(), T(0));
+    vector.x() += vector.x() >= T(0) ? -fold : fold;
+    vector.y() += vector.y() >= T(0) ? -fold : fold;
+    return vector.normalized();
+}
+
+/**
+@brief Pack unsigned normalized vector into 10_10_10_2 representation
+
+Converts values in range @f$ [0, 1] @f$ to integers in range
+@f$ [0, 1023] @f$ for the first three components and @f$ [0, 3] @f$ for the
+last component, rounding to nearest. Values outside the range are clamped.
+The bit layout is the same as of the `GL_UNSIGNED_INT_2_10_10_10_REV`
+vertex attribute type, i.e. the first component is in the lowest bits.
+@see @ref unpackUnsigned1010102(), @ref packSigned1010102()
+*/
+template<class T> UnsignedInt packUnsigned1010102(const Vector4<T>& vector) {
+    static_assert(std::is_floating_point<T>::value, "Math::packUnsigned1010102(): expected floating-point type");
+    const Vector4<T> clamped = Math::clamp(vector, T(0), T(1));
+    return (UnsignedInt(clamped.x()*T(1023) + T(0.5)) <<  0)|
+           (UnsignedInt(clamped.y()*T(1023) + T(0.5)) << 10)|
+           (UnsignedInt(clamped.z()*T(1023) + T(0.5)) << 20)|
+           (UnsignedInt(clamped.w()*T(3) + T(0.5)) << 30);
+}
+
+/**
+@brief Unpack unsigned normalized vector from 10_10_10_2 representation
+
+Inverse to @ref packUnsigned1010102().
+*/
+template<class T> Vector4<T> unpackUnsigned1010102(const UnsignedInt packed) {
+    static_assert(std::is_floating_point<T>::value, "Math::unpackUnsigned1010102(): expected floating-point type");
+    return {T((packed >>  0) & 0x3ff)/T(1023),
+            T((packed >> 10) & 0x3ff)/T(1023),
+            T((packed >> 20) & 0x3ff)/T(1023),
+            T((packed >> 30) & 0x3)/T(3)};
+}
+
+/**
+@brief Pack signed normalized vector into 10_10_10_2 representation
+
+Converts values in range @f$ [-1, 1] @f$ to integers in range
+@f$ [-511, 511] @f$ for the first three components and @f$ [-1, 1] @f$ for the
+last component, rounding to nearest. Values outside the range are clamped.
+The bit layout is the same as of the `GL_INT_2_10_10_10_REV` vertex attribute
+type, i.e. the first component is in the lowest bits.
+@see @ref unpackSigned1010102(), @ref packUnsigned1010102()
+*/
+template<class T> UnsignedInt packSigned1010102(const Vector4<T>& vector) {
+    static_assert(std::is_floating_point<T>::value, "Math::packSigned1010102(): expected floating-point type");
+    const Vector4<T> clamped = Math::clamp(vector, T(-1), T(1));
+    const auto round = [](T value) {
+        return UnsignedInt(Int(value + (value < T(0) ? T(-0.5) : T(0.5))));
+    };
+    return ((round(clamped.x()*T(511)) & 0x3ff) <<  0)|
+           ((round(clamped.y()*T(511)) & 0x3ff) << 10)|
+           ((round(clamped.z()*T(511)) & 0x3ff) << 20)|
+           ((round(clamped.w()) & 0x3) << 30);
+}
+
+/**
+@brief Unpack signed normalized vector from 10_10_10_2 representation
+
+Inverse to @ref packSigned1010102(). Similarly to @ref normalize(), the
+lowest values (`-512` and `-2`) are both converted to @f$ -1 @f$.
+*/
+template<class T> Vector4<T> unpackSigned1010102(const UnsignedInt packed) {
+    static_assert(std::is_floating_point<T>::value, "Math::unpackSigned1010102(): expected floating-point type");
+    /* Sign-extend the fields without relying on arithmetic right shift */
+    const auto field = [](UnsignedInt value, UnsignedInt sign) {
+        return T(Int(value ^ sign) - Int(sign));
+    };
+    return {Math::max(field((packed >>  0) & 0x3ff, 0x200)/T(511), T(-1)),
+            Math::max(field((packed >> 10) & 0x3ff, 0x200)/T(511), T(-1)),
+            Math::max(field((packed >> 20) & 0x3ff, 0x200)/T(511), T(-1)),
+            Math::max(field((packed >> 30) & 0x3, 0x2), T(-1))};
+}
+
+/*@}*/
+
+}}
+
+#endif
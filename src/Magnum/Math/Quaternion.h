@@ -181,6 +181,23 @@ template<class T> class Quaternion {
          */
         static Quaternion<T> rotation(Rad<T> angle, const Vector3<T>& normalizedAxis);
 
+        /**
+         * @brief Rotation quaternion from precomputed half-angle sine and cosine
+         * @param halfAngleSine     Sine of half the rotation angle
+         * @param halfAngleCosine   Cosine of half the rotation angle
+         * @param normalizedAxis    Normalized rotation axis
+         *
+         * Same as @ref rotation(Rad, const Vector3<T>&), but usable in
+         * constant expressions together with @ref Math::constexprSin() and
+         * @ref Math::constexprCos(). Unlike the above, the axis is not
+         * checked for being normalized.
+         */
+        constexpr static Quaternion<T> rotation(T halfAngleSine, T halfAngleCosine, const Vector3<T>& normalizedAxis) {
+            return {{normalizedAxis.x()*halfAngleSine,
+                     normalizedAxis.y()*halfAngleSine,
+                     normalizedAxis.z()*halfAngleSine}, halfAngleCosine};
+        }
+
         /**
          * @brief Create quaternion from rotation matrix
          *
@@ -399,8 +416,11 @@ template<class T> class Quaternion {
          *      p q = [p_S \boldsymbol q_V + q_S \boldsymbol p_V + \boldsymbol p_V \times \boldsymbol q_V,
          *             p_S q_S - \boldsymbol p_V \cdot \boldsymbol q_V]
          * @f]
+         *
+         * Usable in constant expressions. For SIMD-accelerated multiplication
+         * of many quaternions at runtime see @ref Batch::multiplyInPlace().
          */
-        Quaternion<T> operator*(const Quaternion<T>& other) const;
+        constexpr Quaternion<T> operator*(const Quaternion<T>& other) const;
 
         /**
          * @brief Dot product of the quaternion
@@ -621,10 +641,41 @@ template<class T> Matrix3x3<T> Quaternion<T>::toMatrix() const {
     };
 }
 
-template<class T> inline Quaternion<T> Quaternion<T>::operator*(const Quaternion<T>& other) const {
-    return {_scalar*other._vector + other._scalar*_vector + Math::cross(_vector, other._vector),
-            _scalar*other._scalar - Math::dot(_vector, other._vector)};
+/* Expanded by hand to be usable in constant expressions, the operation order
+   is the same as with the vector operations */
+template<class T> constexpr Quaternion<T> Quaternion<T>::operator*(const Quaternion<T>& other) const {
+    return {{_scalar*other._vector.x() + other._scalar*_vector.x() + (_vector.y()*other._vector.z() - other._vector.y()*_vector.z()),
+             _scalar*other._vector.y() + other._scalar*_vector.y() + (_vector.z()*other._vector.x() - other._vector.z()*_vector.x()),
+             _scalar*other._vector.z() + other._scalar*_vector.z() + (_vector.x()*other._vector.y() - other._vector.x()*_vector.y())},
+            _scalar*other._scalar - (_vector.x()*other._vector.x() + _vector.y()*other._vector.y() + _vector.z()*other._vector.z())};
+}
+
+#ifndef DOXYGEN_GENERATING_OUTPUT
+namespace Implementation {
+
+/* Runtime quaternion product, the operator stays generic so it's usable in
+   constant expressions. Used by non-constexpr code such as the scene graph
+   to use SIMD where available. */
+template<class T> struct QuaternionMultiply {
+    static Quaternion<T> multiply(const Quaternion<T>& a, const Quaternion<T>& b) {
+        return a*b;
+    }
+};
+
+#ifdef MAGNUM_MATH_SIMD
+template<> struct QuaternionMultiply<Float> {
+    static Quaternion<Float> multiply(const Quaternion<Float>& a, const Quaternion<Float>& b) {
+        const Float av[]{a.vector().x(), a.vector().y(), a.vector().z(), a.scalar()};
+        const Float bv[]{b.vector().x(), b.vector().y(), b.vector().z(), b.scalar()};
+        Float out[4];
+        Simd::multiplyQuaternion(av, bv, out);
+        return {{out[0], out[1], out[2]}, out[3]};
+    }
+};
+#endif
+
 }
+#endif
 
 template<class T> inline Quaternion<T> Quaternion<T>::invertedNormalized() const {
     CORRADE_ASSERT(isNormalized(), "Math::Quaternion::invertedNormalized(): quaternion must be normalized", {});
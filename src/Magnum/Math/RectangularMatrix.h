@@ -344,8 +344,11 @@ template<std::size_t cols, std::size_t rows, class T> class RectangularMatrix {
          * @f[
          *      (\boldsymbol {AB})_{ji} = \sum_{k=0}^{m-1} \boldsymbol A_{ki} \boldsymbol B_{jk}
          * @f]
+         *
+         * Usable in constant expressions. For SIMD-accelerated multiplication
+         * of many matrices at runtime see @ref Batch::multiplyInPlace().
          */
-        template<std::size_t size> RectangularMatrix<size, rows, T> operator*(const RectangularMatrix<size, cols, T>& other) const;
+        template<std::size_t size> constexpr RectangularMatrix<size, rows, T> operator*(const RectangularMatrix<size, cols, T>& other) const;
 
         /**
          * @brief Multiply vector
@@ -355,8 +358,8 @@ template<std::size_t cols, std::size_t rows, class T> class RectangularMatrix {
          *      (\boldsymbol {Aa})_i = \sum_{k=0}^{m-1} \boldsymbol A_{ki} \boldsymbol a_k
          * @f]
          */
-        Vector<rows, T> operator*(const Vector<cols, T>& other) const {
-            return operator*(RectangularMatrix<1, cols, T>(other))[0];
+        constexpr Vector<rows, T> operator*(const Vector<cols, T>& other) const {
+            return operator*(RectangularMatrix<1, cols, T>(other))._data[0];
         }
 
         /**
@@ -404,6 +407,11 @@ template<std::size_t cols, std::size_t rows, class T> class RectangularMatrix {
 
         template<std::size_t ...sequence> constexpr Vector<DiagonalSize, T> diagonalInternal(Implementation::Sequence<sequence...>) const;
 
+        /* Implementation for operator*(const RectangularMatrix<size, cols, T>&) */
+        template<std::size_t size, std::size_t ...sequence> constexpr RectangularMatrix<size, rows, T> multiplyInternal(Implementation::Sequence<sequence...>, const RectangularMatrix<size, cols, T>& other) const;
+        template<std::size_t ...sequence> constexpr Vector<rows, T> multiplyColumnInternal(Implementation::Sequence<sequence...>, const Vector<cols, T>& column) const;
+        template<std::size_t ...sequence> constexpr T multiplyRowInternal(Implementation::Sequence<sequence...>, std::size_t row, const Vector<cols, T>& column) const;
+
         Vector<rows, T> _data[cols];
 };
 
@@ -661,17 +669,32 @@ template<std::size_t cols, std::size_t rows, class T> inline RectangularMatrix<c
     return out;
 }
 
-template<std::size_t cols, std::size_t rows, class T> template<std::size_t size> inline RectangularMatrix<size, rows, T> RectangularMatrix<cols, rows, T>::operator*(const RectangularMatrix<size, cols, T>& other) const {
-    RectangularMatrix<size, rows, T> out;
+namespace Implementation {
+    /* Left fold, so the summation order is the same as in a loop */
+    template<class T> constexpr T sumLeft(T sum) { return sum; }
+    template<class T, class ...U> constexpr T sumLeft(T sum, T next, U... rest) {
+        return sumLeft<T>(sum + next, rest...);
+    }
+}
 
-    for(std::size_t col = 0; col != size; ++col)
-        for(std::size_t row = 0; row != rows; ++row)
-            for(std::size_t pos = 0; pos != cols; ++pos)
-                out[col][row] += _data[pos][row]*other._data[col][pos];
+template<std::size_t cols, std::size_t rows, class T> template<std::size_t size> constexpr RectangularMatrix<size, rows, T> RectangularMatrix<cols, rows, T>::operator*(const RectangularMatrix<size, cols, T>& other) const {
+    return multiplyInternal(typename Implementation::GenerateSequence<size>::Type(), other);
+}
 
-    return out;
+#ifndef DOXYGEN_GENERATING_OUTPUT
+template<std::size_t cols, std::size_t rows, class T> template<std::size_t size, std::size_t ...sequence> constexpr RectangularMatrix<size, rows, T> RectangularMatrix<cols, rows, T>::multiplyInternal(Implementation::Sequence<sequence...>, const RectangularMatrix<size, cols, T>& other) const {
+    return RectangularMatrix<size, rows, T>{multiplyColumnInternal(typename Implementation::GenerateSequence<rows>::Type(), other._data[sequence])...};
+}
+
+template<std::size_t cols, std::size_t rows, class T> template<std::size_t ...sequence> constexpr Vector<rows, T> RectangularMatrix<cols, rows, T>::multiplyColumnInternal(Implementation::Sequence<sequence...>, const Vector<cols, T>& column) const {
+    return Vector<rows, T>{multiplyRowInternal(typename Implementation::GenerateSequence<cols>::Type(), sequence, column)...};
 }
 
+template<std::size_t cols, std::size_t rows, class T> template<std::size_t ...sequence> constexpr T RectangularMatrix<cols, rows, T>::multiplyRowInternal(Implementation::Sequence<sequence...>, const std::size_t row, const Vector<cols, T>& column) const {
+    return Implementation::sumLeft<T>(T(0), _data[sequence][row]*column[sequence]...);
+}
+#endif
+
 template<std::size_t cols, std::size_t rows, class T> inline RectangularMatrix<rows, cols, T> RectangularMatrix<cols, rows, T>::transposed() const {
     RectangularMatrix<rows, cols, T> out;
 
@@ -0,0 +1,545 @@
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+#include <cmath>
+#include <sstream>
+#include <vector>
+#include <Corrade/TestSuite/Tester.h>
+
+#include "Magnum/Math/Batch.h"
+#include "Magnum/Math/Color.h"
+#include "Magnum/Math/Constants.h"
+#include "Magnum/Math/Half.h"
+
+namespace Magnum { namespace Math { namespace Test {
+
+struct BatchTest: Corrade::TestSuite::Tester {
+    explicit BatchTest();
+
+    void minmax();
+    void minmaxScalar();
+    void minmaxInteger();
+    void minmaxEmpty();
+    void range();
+    void rangeEmpty();
+    void normalizeInPlace();
+    void transformVectorsInPlace();
+    void transformPointsInPlace();
+    void transformPointsInPlace2D();
+    void multiplyInPlace();
+    void normalize();
+    void denormalize();
+    void normalizeSizeMismatch();
+    void packHalf();
+    void unpackHalf();
+    void packHalfSizeMismatch();
+    void srgbToLinear();
+    void srgbToLinearAlpha();
+    void linearToSrgb();
+    void linearToSrgbAlpha();
+    void linearToSrgbSpecial();
+    void srgbSizeMismatch();
+
+    void fastSincos();
+    void fastSqrtInverted();
+    void fastAcos();
+    void fastSizeMismatch();
+};
+
+typedef Math::Deg<Float> Deg;
+typedef Math::Rad<Float> Rad;
+typedef Math::Matrix3<Float> Matrix3;
+typedef Math::Matrix4<Float> Matrix4;
+typedef Math::Quaternion<Float> Quaternion;
+typedef Math::Vector2<Float> Vector2;
+typedef Math::Vector3<Float> Vector3;
+typedef Math::Vector3<Int> Vector3i;
+typedef Math::Vector4<Float> Vector4;
+typedef Math::Color3<Float> Color3;
+typedef Math::Color3<UnsignedByte> Color3ub;
+typedef Math::Color4<Float> Color4;
+typedef Math::Color4<UnsignedByte> Color4ub;
+typedef Math::Vector3<Half> Vector3h;
+
+BatchTest::BatchTest() {
+    addTests({&BatchTest::minmax,
+              &BatchTest::minmaxScalar,
+              &BatchTest::minmaxInteger,
+              &BatchTest::minmaxEmpty,
+              &BatchTest::range,
+              &BatchTest::rangeEmpty,
+              &BatchTest::normalizeInPlace,
+              &BatchTest::transformVectorsInPlace,
+              &BatchTest::transformPointsInPlace,
+              &BatchTest::transformPointsInPlace2D,
+              &BatchTest::multiplyInPlace,
+              &BatchTest::normalize,
+              &BatchTest::denormalize,
+              &BatchTest::normalizeSizeMismatch,
+              &BatchTest::packHalf,
+              &BatchTest::unpackHalf,
+              &BatchTest::packHalfSizeMismatch,
+              &BatchTest::srgbToLinear,
+              &BatchTest::srgbToLinearAlpha,
+              &BatchTest::linearToSrgb,
+              &BatchTest::linearToSrgbAlpha,
+              &BatchTest::linearToSrgbSpecial,
+              &BatchTest::srgbSizeMismatch,
+
+              &BatchTest::fastSincos,
+              &BatchTest::fastSqrtInverted,
+              &BatchTest::fastAcos,
+              &BatchTest::fastSizeMismatch});
+}
+
+namespace {
+    /* Count not divisible by four to exercise also the remainder */
+    template<class T> std::vector<T> data(std::size_t count = 11) {
+        std::vector<T> out;
+        for(std::size_t i = 0; i != count; ++i) {
+            T v;
+            for(std::size_t j = 0; j != T::Size; ++j)
+                v[j] = Float((i*7 + j*3) % 13) - 6.5f + Float(i)*0.125f;
+            out.push_back(v);
+        }
+        return out;
+    }
+
+    template<class T> Corrade::Containers::ArrayView<T> view(std::vector<T>& data) {
+        return {data.data(), data.size()};
+    }
+}
+
+void BatchTest::minmax() {
+    /* All sizes with SIMD implementation */
+    std::vector<Vector2> a = data<Vector2>();
+    std::vector<Vector3> b = data<Vector3>();
+    std::vector<Vector4> c = data<Vector4>();
+    b[9] = {-100.0f, 100.0f, 0.5f};
+
+    const auto expectedA = std::make_pair(Vector2{-6.5f, -5.625f}, Vector2{5.625f, 6.125f});
+    const auto expectedB = std::make_pair(Vector3{-100.0f, -5.625f, -6.375f}, Vector3{4.375f, 100.0f, 5.75f});
+    const auto expectedC = std::make_pair(Vector4{-6.5f, -5.625f, -6.375f, -5.5f}, Vector4{5.625f, 6.125f, 5.75f, 6.25f});
+
+    CORRADE_COMPARE(Batch::minmax(view(a)), expectedA);
+    CORRADE_COMPARE(Batch::minmax(view(b)), expectedB);
+    CORRADE_COMPARE(Batch::minmax(view(c)), expectedC);
+
+    /* Fewer items than SIMD step */
+    CORRADE_COMPARE(Batch::minmax(view(b).prefix(3)), std::make_pair(Vector3{-6.5f, -3.5f, -6.375f}, Vector3{0.625f, 3.625f, 0.75f}));
+
+    /* Const view */
+    const Corrade::Containers::ArrayView<const Vector3> constView = view(b);
+    CORRADE_COMPARE(Batch::minmax(constView), expectedB);
+}
+
+void BatchTest::minmaxScalar() {
+    Float data[]{3.0f, -1.0f, 7.5f, 2.0f};
+    CORRADE_COMPARE(Batch::minmax(Corrade::Containers::ArrayView<Float>{data}), std::make_pair(-1.0f, 7.5f));
+}
+
+void BatchTest::minmaxInteger() {
+    Vector3i data[]{{3, 5, -1}, {-2, 8, 0}, {4, -7, 1}};
+    CORRADE_COMPARE(Batch::minmax(Corrade::Containers::ArrayView<Vector3i>{data}), std::make_pair(Vector3i{-2, -7, -1}, Vector3i{4, 8, 1}));
+}
+
+void BatchTest::minmaxEmpty() {
+    std::ostringstream out;
+    Error::setOutput(&out);
+
+    Batch::minmax(Corrade::Containers::ArrayView<Vector3>{});
+    CORRADE_COMPARE(out.str(), "Math::Batch::minmax(): the array is empty\n");
+}
+
+void BatchTest::range() {
+    /* Enough items for more than one iteration of the unrolled SIMD loop */
+    std::vector<Vector2> a = data<Vector2>(37);
+    std::vector<Vector3> b = data<Vector3>(37);
+    b[21] = {-100.0f, 100.0f, 0.5f};
+
+    Vector2 minA = a[0], maxA = a[0];
+    for(const Vector2& v: a) {
+        minA = Math::min(minA, v);
+        maxA = Math::max(maxA, v);
+    }
+    Vector3 minB = b[0], maxB = b[0];
+    for(const Vector3& v: b) {
+        minB = Math::min(minB, v);
+        maxB = Math::max(maxB, v);
+    }
+
+    const Range2D<Float> rangeA = Batch::range(view(a));
+    const Range3D<Float> rangeB = Batch::range(view(b));
+    CORRADE_COMPARE(rangeA.min(), minA);
+    CORRADE_COMPARE(rangeA.max(), maxA);
+    CORRADE_COMPARE(rangeB.min(), minB);
+    CORRADE_COMPARE(rangeB.max(), maxB);
+    CORRADE_COMPARE(rangeB.min().x(), -100.0f);
+    CORRADE_COMPARE(rangeB.max().y(), 100.0f);
+
+    /* Scalars give one-dimensional range */
+    Float c[]{3.0f, -1.0f, 7.5f, 2.0f};
+    const Range1D<Float> rangeC = Batch::range(Corrade::Containers::ArrayView<Float>{c});
+    CORRADE_COMPARE(rangeC.min(), -1.0f);
+    CORRADE_COMPARE(rangeC.max(), 7.5f);
+}
+
+void BatchTest::rangeEmpty() {
+    std::ostringstream out;
+    Error::setOutput(&out);
+
+    Batch::range(Corrade::Containers::ArrayView<Vector3>{});
+    CORRADE_COMPARE(out.str(), "Math::Batch::range(): the array is empty\n");
+}
+
+void BatchTest::normalizeInPlace() {
+    std::vector<Vector2> a = data<Vector2>();
+    std::vector<Vector3> b = data<Vector3>();
+    std::vector<Vector4> c = data<Vector4>();
+    const std::vector<Vector2> originalA = a;
+    const std::vector<Vector3> originalB = b;
+    const std::vector<Vector4> originalC = c;
+
+    Batch::normalizeInPlace(view(a));
+    Batch::normalizeInPlace(view(b));
+    Batch::normalizeInPlace(view(c));
+
+    /* The result should be bit-identical to the single-value operation */
+    for(std::size_t i = 0; i != a.size(); ++i) {
+        CORRADE_VERIFY(a[i] == originalA[i].normalized());
+        CORRADE_VERIFY(b[i] == originalB[i].normalized());
+        CORRADE_VERIFY(c[i] == originalC[i].normalized());
+        for(std::size_t j = 0; j != 3; ++j) {
+            CORRADE_VERIFY(b[i][j] == originalB[i].normalized()[j]);
+        }
+    }
+}
+
+void BatchTest::transformVectorsInPlace() {
+    const Matrix4 matrix = Matrix4::rotation(Deg(37.0f), Vector3(1.0f, -2.0f, 0.5f).normalized())*
+                           Matrix4::scaling({2.0f, 0.5f, 1.5f})*
+                           Matrix4::translation({1.0f, 2.0f, -3.0f});
+    std::vector<Vector3> vectors = data<Vector3>();
+    const std::vector<Vector3> original = vectors;
+
+    Batch::transformVectorsInPlace(matrix, view(vectors));
+    for(std::size_t i = 0; i != vectors.size(); ++i) {
+        const Vector3 expected = matrix.transformVector(original[i]);
+        for(std::size_t j = 0; j != 3; ++j) {
+            CORRADE_VERIFY(vectors[i][j] == expected[j]);
+        }
+    }
+}
+
+void BatchTest::transformPointsInPlace() {
+    const Matrix4 matrix = Matrix4::rotation(Deg(37.0f), Vector3(1.0f, -2.0f, 0.5f).normalized())*
+                           Matrix4::scaling({2.0f, 0.5f, 1.5f})*
+                           Matrix4::translation({1.0f, 2.0f, -3.0f});
+    std::vector<Vector3> points = data<Vector3>();
+    const std::vector<Vector3> original = points;
+
+    Batch::transformPointsInPlace(matrix, view(points));
+    for(std::size_t i = 0; i != points.size(); ++i) {
+        const Vector3 expected = matrix.transformPoint(original[i]);
+        for(std::size_t j = 0; j != 3; ++j) {
+            CORRADE_VERIFY(points[i][j] == expected[j]);
+        }
+    }
+}
+
+void BatchTest::transformPointsInPlace2D() {
+    const Matrix3 matrix = Matrix3::rotation(Deg(37.0f))*Matrix3::translation({1.0f, -2.0f});
+    std::vector<Vector2> points = data<Vector2>();
+    const std::vector<Vector2> original = points;
+
+    Batch::transformPointsInPlace(matrix, view(points));
+    Batch::transformVectorsInPlace(matrix, view(points));
+    for(std::size_t i = 0; i != points.size(); ++i)
+        CORRADE_COMPARE(points[i], matrix.transformVector(matrix.transformPoint(original[i])));
+}
+
+void BatchTest::multiplyInPlace() {
+    const Matrix4 matrix = Matrix4::rotation(Deg(37.0f), Vector3(1.0f, -2.0f, 0.5f).normalized());
+    std::vector<Matrix4> matrices;
+    for(std::size_t i = 0; i != 5; ++i)
+        matrices.push_back(Matrix4::translation({Float(i), 1.0f, -2.0f})*Matrix4::scaling(Vector3(Float(i + 1))));
+    const std::vector<Matrix4> original = matrices;
+
+    Batch::multiplyInPlace(matrix, view(matrices));
+    for(std::size_t i = 0; i != matrices.size(); ++i)
+        CORRADE_COMPARE(matrices[i], matrix*original[i]);
+
+    const Quaternion quaternion = Quaternion::rotation(Deg(37.0f), Vector3(1.0f, -2.0f, 0.5f).normalized());
+    std::vector<Quaternion> quaternions;
+    for(std::size_t i = 0; i != 5; ++i)
+        quaternions.push_back(Quaternion::rotation(Deg(Float(i)*15.0f), Vector3::xAxis()));
+    const std::vector<Quaternion> originalQuaternions = quaternions;
+
+    Batch::multiplyInPlace(quaternion, view(quaternions));
+    for(std::size_t i = 0; i != quaternions.size(); ++i)
+        CORRADE_COMPARE(quaternions[i], quaternion*originalQuaternions[i]);
+}
+
+void BatchTest::normalize() {
+    Color3ub in[]{{0, 255, 128}, {64, 32, 16}, {255, 255, 255}};
+    Color3 out[3];
+    Batch::normalize(Corrade::Containers::ArrayView<const Color3ub>{in}, Corrade::Containers::ArrayView<Color3>{out});
+
+    for(std::size_t i = 0; i != 3; ++i)
+        CORRADE_COMPARE(out[i], Math::normalize<Color3>(in[i]));
+
+    /* Scalars */
+    Short inShort[]{-32767, 0, 16384};
+    Float outShort[3];
+    Batch::normalize(Corrade::Containers::ArrayView<Short>{inShort}, Corrade::Containers::ArrayView<Float>{outShort});
+    CORRADE_COMPARE(outShort[0], -1.0f);
+    CORRADE_COMPARE(outShort[1], 0.0f);
+    CORRADE_COMPARE(outShort[2], Math::normalize<Float>(Short(16384)));
+}
+
+void BatchTest::denormalize() {
+    Color4 in[]{{0.0f, 1.0f, 0.5f, 1.0f}, {0.25f, 0.125f, 0.0625f, 0.0f}};
+    Color4ub out[2];
+    Batch::denormalize(Corrade::Containers::ArrayView<Color4>{in}, Corrade::Containers::ArrayView<Color4ub>{out});
+
+    for(std::size_t i = 0; i != 2; ++i)
+        CORRADE_COMPARE(out[i], Math::denormalize<Color4ub>(in[i]));
+}
+
+void BatchTest::normalizeSizeMismatch() {
+    std::ostringstream out;
+    Error::setOutput(&out);
+
+    Color3ub in[3];
+    Color3 output[2];
+    Color3ub outputub[4];
+    Batch::normalize(Corrade::Containers::ArrayView<Color3ub>{in}, Corrade::Containers::ArrayView<Color3>{output});
+    Batch::denormalize(Corrade::Containers::ArrayView<Color3>{output}, Corrade::Containers::ArrayView<Color3ub>{outputub});
+    CORRADE_COMPARE(out.str(),
+        "Math::Batch::normalize(): expected output array of size 3 but got 2\n"
+        "Math::Batch::denormalize(): expected output array of size 2 but got 4\n");
+}
+
+void BatchTest::packHalf() {
+    /* Normal and subnormal values, rounding ties, overflow and infinities,
+       count not divisible by four or eight */
+    std::vector<Float> in{0.0f, -0.0f, 1.0f, -2.5f, 65504.0f, 65520.0f,
+        -1.0e6f, 5.96046448e-8f, 2.98023224e-8f, 6.09755516e-5f, 1.00048828f,
+        1.00146484f, 0.1f, -3.3333f, 1.0e-10f, 1.0f/0.0f, -1.0f/0.0f, 123.456f,
+        0.000123f};
+    std::vector<Half> out(in.size());
+    Batch::packHalf(view(in), view(out));
+
+    for(std::size_t i = 0; i != in.size(); ++i)
+        CORRADE_COMPARE(out[i].data(), Math::packHalf(in[i]));
+
+    /* Vectors */
+    std::vector<Vector3> vectors = data<Vector3>();
+    std::vector<Vector3h> vectorsh(vectors.size());
+    Batch::packHalf(view(vectors), view(vectorsh));
+    for(std::size_t i = 0; i != vectors.size(); ++i)
+        CORRADE_COMPARE(vectorsh[i], Vector3h{vectors[i]});
+}
+
+void BatchTest::unpackHalf() {
+    /* All values except NaNs, which may differ in signaling bit */
+    std::vector<UnsignedShort> in;
+    for(UnsignedInt i = 0; i != 65536; ++i)
+        if((i & 0x7c00) != 0x7c00 || (i & 0x3ff) == 0) in.push_back(i);
+    std::vector<Float> out(in.size());
+    Batch::unpackHalf(view(in), view(out));
+
+    std::size_t mismatches = 0;
+    for(std::size_t i = 0; i != in.size(); ++i)
+        if(Half{out[i]}.data() != in[i] || out[i] != Math::unpackHalf(in[i]))
+            ++mismatches;
+    CORRADE_COMPARE(mismatches, 0);
+}
+
+void BatchTest::packHalfSizeMismatch() {
+    std::ostringstream out;
+    Error::setOutput(&out);
+
+    Float in[3];
+    Half output[2];
+    Float outputf[4];
+    Batch::packHalf(Corrade::Containers::ArrayView<Float>{in}, Corrade::Containers::ArrayView<Half>{output});
+    Batch::unpackHalf(Corrade::Containers::ArrayView<Half>{output}, Corrade::Containers::ArrayView<Float>{outputf});
+    CORRADE_COMPARE(out.str(),
+        "Math::Batch::packHalf(): expected output array of size 3 but got 2\n"
+        "Math::Batch::unpackHalf(): expected output array of size 2 but got 4\n");
+}
+
+void BatchTest::srgbToLinear() {
+    /* All values, the result should be bit-identical */
+    std::vector<Color3ub> in;
+    for(UnsignedInt i = 0; i != 256; ++i)
+        in.emplace_back(UnsignedByte(i), UnsignedByte(255 - i), UnsignedByte(i*7));
+    std::vector<Color3> out(in.size());
+    Batch::srgbToLinear(view(in), view(out));
+
+    for(std::size_t i = 0; i != in.size(); ++i)
+        CORRADE_VERIFY(out[i] == Color3::fromSrgb(in[i]));
+}
+
+void BatchTest::srgbToLinearAlpha() {
+    std::vector<Color4ub> in;
+    for(UnsignedInt i = 0; i != 11; ++i)
+        in.emplace_back(UnsignedByte(i*23), UnsignedByte(255 - i), UnsignedByte(i*7), UnsignedByte(i*25));
+    std::vector<Color4> out(in.size());
+    Batch::srgbToLinear(view(in), view(out));
+
+    for(std::size_t i = 0; i != in.size(); ++i)
+        CORRADE_VERIFY(out[i] == Color4::fromSrgbAlpha(in[i]));
+}
+
+void BatchTest::linearToSrgb() {
+    /* Dense sampling of the whole range with some values outside, should
+       be bit-identical to the scalar version */
+    std::vector<Float> in;
+    for(Int i = -100; i != 1100000; ++i)
+        in.push_back(Float(i)/1000000.0f);
+    for(Float value = 1.0e-5f; value < 1.0f; value *= 1.001f)
+        in.push_back(value);
+    std::vector<UnsignedByte> out(in.size());
+    Batch::linearToSrgb(view(in), view(out));
+
+    std::size_t mismatches = 0;
+    for(std::size_t i = 0; i != in.size(); ++i)
+        if(out[i] != Color3{in[i]}.toSrgb<UnsignedByte>()[0]) ++mismatches;
+    CORRADE_COMPARE(mismatches, 0);
+
+    /* Roundtrip */
+    std::vector<Color3ub> srgb;
+    for(UnsignedInt i = 0; i != 256; ++i)
+        srgb.emplace_back(UnsignedByte(i), UnsignedByte(255 - i), UnsignedByte(i*7));
+    std::vector<Color3> linear(srgb.size());
+    std::vector<Color3ub> srgb2(srgb.size());
+    Batch::srgbToLinear(view(srgb), view(linear));
+    Batch::linearToSrgb(view(linear), view(srgb2));
+    CORRADE_VERIFY(srgb2 == srgb);
+}
+
+void BatchTest::linearToSrgbAlpha() {
+    std::vector<Color4> in;
+    for(UnsignedInt i = 0; i != 11; ++i)
+        in.emplace_back(Float(i)*0.1f, 1.0f - Float(i)*0.03f, Float(i)*0.001f, Float(i)*0.0999f);
+    std::vector<Color4ub> out(in.size());
+    Batch::linearToSrgb(view(in), view(out));
+
+    for(std::size_t i = 0; i != in.size(); ++i)
+        CORRADE_COMPARE(out[i], Color4ub{in[i].toSrgbAlpha<UnsignedByte>()});
+}
+
+void BatchTest::linearToSrgbSpecial() {
+    /* Enough values to go through the vectorized path as well */
+    const Float in[]{
+        -1.0f, -0.0f, 0.0f, 1.0e-30f, Constants<Float>::inf(), -Constants<Float>::inf(), 1.0f, 2.0f,
+        Constants<Float>::nan(), 0.5f, 1.0e-4f, 2.0e-4f, 0.99999f, 1.00001f, 0.0031308f, 1.0e30f};
+    UnsignedByte out[16];
+    Batch::linearToSrgb(Corrade::Containers::ArrayView<const Float>{in}, Corrade::Containers::ArrayView<UnsignedByte>{out});
+
+    const UnsignedByte expected[]{0, 0, 0, 0, 255, 0, 255, 255,
+                                  0, 188, 0, 1, 255, 255, 10, 255};
+    for(std::size_t i = 0; i != 16; ++i)
+        CORRADE_COMPARE(Int(out[i]), Int(expected[i]));
+}
+
+void BatchTest::srgbSizeMismatch() {
+    std::ostringstream out;
+    Error::setOutput(&out);
+
+    Color4ub in[3];
+    Color4 output[2];
+    Color4ub outputub[4];
+    Batch::srgbToLinear(Corrade::Containers::ArrayView<Color4ub>{in}, Corrade::Containers::ArrayView<Color4>{output});
+    Batch::linearToSrgb(Corrade::Containers::ArrayView<Color4>{output}, Corrade::Containers::ArrayView<Color4ub>{outputub});
+    CORRADE_COMPARE(out.str(),
+        "Math::Batch::srgbToLinear(): expected output array of size 3 but got 2\n"
+        "Math::Batch::linearToSrgb(): expected output array of size 2 but got 4\n");
+}
+
+void BatchTest::fastSincos() {
+    /* Count not divisible by four, covering all quadrants */
+    std::vector<Rad> in;
+    for(Int i = -50; i != 51; ++i) in.emplace_back(Float(i)*0.137f);
+    std::vector<Float> sines(in.size()), cosines(in.size());
+    Batch::fastSincos(view(in), view(sines), view(cosines));
+
+    for(std::size_t i = 0; i != in.size(); ++i) {
+        const std::pair<Float, Float> expected = Fast::sincos(in[i]);
+        CORRADE_COMPARE(sines[i], expected.first);
+        CORRADE_COMPARE(cosines[i], expected.second);
+        CORRADE_VERIFY(std::abs(sines[i] - std::sin(Float(in[i]))) < 2.0e-7f);
+        CORRADE_VERIFY(std::abs(cosines[i] - std::cos(Float(in[i]))) < 2.0e-7f);
+    }
+}
+
+void BatchTest::fastSqrtInverted() {
+    std::vector<Vector3> in;
+    for(std::size_t i = 0; i != 11; ++i)
+        in.emplace_back(Float(i + 1)*0.37f, Float(i*i + 1)*1.0e-3f, Float(i + 1)*1.0e5f);
+    std::vector<Vector3> out(in.size());
+    Batch::fastSqrtInverted(view(in), view(out));
+
+    /* The SIMD implementation isn't bit-identical to the scalar one, check
+       only the error bound */
+    for(std::size_t i = 0; i != in.size(); ++i)
+        for(std::size_t j = 0; j != 3; ++j)
+            CORRADE_VERIFY(std::abs(out[i][j]*std::sqrt(Double(in[i][j])) - 1.0) < 5.0e-6);
+}
+
+void BatchTest::fastAcos() {
+    std::vector<Float> in;
+    for(Int i = -51; i != 52; ++i) in.push_back(Float(i)/50.0f);
+    std::vector<Rad> out(in.size());
+    Batch::fastAcos(view(in), view(out));
+
+    for(std::size_t i = 0; i != in.size(); ++i)
+        CORRADE_COMPARE(out[i], Fast::acos(in[i]));
+
+    /* Values outside of the range are clamped */
+    CORRADE_COMPARE(out.front(), Rad(Constants<Float>::pi()));
+    CORRADE_COMPARE(out.back(), Rad(0.0f));
+}
+
+void BatchTest::fastSizeMismatch() {
+    std::ostringstream out;
+    Error::setOutput(&out);
+
+    Rad angles[3];
+    Float a[3], b[2], c[4];
+    Rad d[2];
+    Batch::fastSincos(Corrade::Containers::ArrayView<Rad>{angles}, Corrade::Containers::ArrayView<Float>{a}, Corrade::Containers::ArrayView<Float>{b});
+    Batch::fastSqrtInverted(Corrade::Containers::ArrayView<Float>{a}, Corrade::Containers::ArrayView<Float>{c});
+    Batch::fastAcos(Corrade::Containers::ArrayView<Float>{a}, Corrade::Containers::ArrayView<Rad>{d});
+    CORRADE_COMPARE(out.str(),
+        "Math::Batch::fastSincos(): expected output arrays of size 3 but got 3 and 2\n"
+        "Math::Batch::fastSqrtInverted(): expected output array of size 3 but got 4\n"
+        "Math::Batch::fastAcos(): expected output array of size 3 but got 2\n");
+}
+
+}}}
+
+CORRADE_TEST_MAIN(Magnum::Math::Test::BatchTest)
@@ -58,6 +58,13 @@ struct ColorTest: Corrade::TestSuite::Tester {
     void hsvOverflow();
     void hsvAlpha();
 
+    void fromSrgb();
+    void fromSrgbIntegral();
+    void toSrgb();
+    void toSrgbIntegral();
+    void srgbRoundtrip();
+    void srgbAlpha();
+
     void swizzleType();
     void debug();
     void configuration();
@@ -98,6 +105,13 @@ ColorTest::ColorTest() {
               &ColorTest::hsvOverflow,
               &ColorTest::hsvAlpha,
 
+              &ColorTest::fromSrgb,
+              &ColorTest::fromSrgbIntegral,
+              &ColorTest::toSrgb,
+              &ColorTest::toSrgbIntegral,
+              &ColorTest::srgbRoundtrip,
+              &ColorTest::srgbAlpha,
+
               &ColorTest::swizzleType,
               &ColorTest::debug,
               &ColorTest::configuration});
@@ -319,6 +333,47 @@ void ColorTest::hsvAlpha() {
     CORRADE_COMPARE(Color4ub::fromHSV(230.0_degf, 0.749f, 0.427f), Color4ub(27, 40, 108, 255));
 }
 
+void ColorTest::fromSrgb() {
+    /* Linear part, curve and the endpoints */
+    CORRADE_COMPARE(Color3::fromSrgb({0.02f, 0.5f, 1.0f}), (Color3{0.001548f, 0.214041f, 1.0f}));
+    CORRADE_COMPARE(Color3::fromSrgb(Vector3{0.0f}), Color3{0.0f});
+}
+
+void ColorTest::fromSrgbIntegral() {
+    CORRADE_COMPARE(Color3::fromSrgb(Color3ub{0x33, 0x66, 0x99}), (Color3{0.033105f, 0.132868f, 0.318547f}));
+    CORRADE_COMPARE(Color3::fromSrgb(Color3ub{0xff}), Color3{1.0f});
+}
+
+void ColorTest::toSrgb() {
+    CORRADE_COMPARE((Color3{0.001f, 0.214041f, 1.0f}.toSrgb()), (Vector3{0.01292f, 0.5f, 1.0f}));
+    CORRADE_COMPARE(Color3{0.1f}.toSrgb(), Vector3{0.34919f});
+}
+
+void ColorTest::toSrgbIntegral() {
+    /* Rounded to nearest, unlike denormalize() */
+    CORRADE_COMPARE((Color3{0.001f, 0.5f, 0.1f}.toSrgb<UnsignedByte>()), (Math::Vector3<UnsignedByte>{3, 188, 89}));
+
+    /* Out-of-range values are clamped */
+    CORRADE_COMPARE((Color3{-1.0f, 2.0f, 1.0f}.toSrgb<UnsignedByte>()), (Math::Vector3<UnsignedByte>{0, 255, 255}));
+}
+
+void ColorTest::srgbRoundtrip() {
+    for(UnsignedInt i = 0; i != 256; ++i) {
+        const Color3ub color{UnsignedByte(i), UnsignedByte(255 - i), UnsignedByte(i/2)};
+        CORRADE_COMPARE(Color3::fromSrgb(color).toSrgb<UnsignedByte>(), color);
+    }
+}
+
+void ColorTest::srgbAlpha() {
+    /* Alpha is kept as-is */
+    CORRADE_COMPARE(Color4::fromSrgbAlpha({0.5f, 0.02f, 1.0f, 0.5f}), (Color4{0.214041f, 0.001548f, 1.0f, 0.5f}));
+    CORRADE_COMPARE((Color4{0.214041f, 0.001f, 1.0f, 0.25f}.toSrgbAlpha()), (Vector4{0.5f, 0.01292f, 1.0f, 0.25f}));
+
+    /* Integral alpha is converted linearly, but rounded as well */
+    CORRADE_COMPARE(Color4::fromSrgbAlpha(Color4ub{0x33, 0x66, 0x99, 0x80}), (Color4{0.033105f, 0.132868f, 0.318547f, 0.501961f}));
+    CORRADE_COMPARE((Color4{0.5f, 0.001f, 1.0f, 0.499f}.toSrgbAlpha<UnsignedByte>()), (Math::Vector4<UnsignedByte>{188, 3, 255, 127}));
+}
+
 void ColorTest::swizzleType() {
     constexpr Color3 origColor3;
     constexpr Color4ub origColor4;
@@ -0,0 +1,152 @@
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#include <cmath>
+#include <vector>
+#include <Corrade/TestSuite/Tester.h>
+
+#include "Magnum/Math/Batch.h"
+#include "Magnum/Test/Benchmark.h"
+
+namespace Magnum { namespace Math { namespace Test {
+
+/* Compares the standard library functions with the fast approximations, both
+   called per value and in batch */
+struct FastFunctionsBenchmark: Corrade::TestSuite::Tester {
+    explicit FastFunctionsBenchmark();
+
+    void sincos();
+    void sqrtInverted();
+    void acos();
+};
+
+typedef Math::Rad<Float> Rad;
+
+FastFunctionsBenchmark::FastFunctionsBenchmark() {
+    addTests({&FastFunctionsBenchmark::sincos,
+              &FastFunctionsBenchmark::sqrtInverted,
+              &FastFunctionsBenchmark::acos});
+}
+
+namespace {
+    enum: std::size_t { Count = 1000000 };
+
+    using Magnum::Test::measure;
+
+    template<class T> Corrade::Containers::ArrayView<T> view(std::vector<T>& data) {
+        return {data.data(), data.size()};
+    }
+
+    void print(const char* name, std::int64_t standard, std::int64_t fast, std::int64_t batch) {
+        Corrade::Utility::Debug() << name << "standard:" << standard << "us, fast:" << fast << "us, batch:" << batch << "us";
+    }
+}
+
+void FastFunctionsBenchmark::sincos() {
+    std::vector<Rad> in;
+    in.reserve(Count);
+    for(std::size_t i = 0; i != Count; ++i)
+        in.emplace_back(Float(i)*0.001f - 500.0f);
+    std::vector<Float> sines(Count), cosines(Count);
+
+    const std::int64_t standard = measure([&]() {
+        for(std::size_t i = 0; i != Count; ++i) {
+            sines[i] = Math::sin(in[i]);
+            cosines[i] = Math::cos(in[i]);
+        }
+    });
+    const Float expected = sines[Count - 1];
+
+    const std::int64_t fast = measure([&]() {
+        for(std::size_t i = 0; i != Count; ++i)
+            std::tie(sines[i], cosines[i]) = Fast::sincos(in[i]);
+    });
+    CORRADE_VERIFY(std::abs(sines[Count - 1] - expected) < 2.0e-7f);
+
+    const std::int64_t batch = measure([&]() {
+        Batch::fastSincos(view(in), view(sines), view(cosines));
+    });
+    CORRADE_VERIFY(std::abs(sines[Count - 1] - expected) < 2.0e-7f);
+
+    print("sincos", standard, fast, batch);
+}
+
+void FastFunctionsBenchmark::sqrtInverted() {
+    std::vector<Float> in;
+    in.reserve(Count);
+    for(std::size_t i = 0; i != Count; ++i)
+        in.push_back(Float(i + 1)*0.01f);
+    std::vector<Float> out(Count);
+
+    const std::int64_t standard = measure([&]() {
+        for(std::size_t i = 0; i != Count; ++i)
+            out[i] = Math::sqrtInverted(in[i]);
+    });
+    const Float expected = out[Count - 1];
+
+    const std::int64_t fast = measure([&]() {
+        for(std::size_t i = 0; i != Count; ++i)
+            out[i] = Fast::sqrtInverted(in[i]);
+    });
+    CORRADE_VERIFY(std::abs(out[Count - 1]/expected - 1.0f) < 5.0e-6f);
+
+    const std::int64_t batch = measure([&]() {
+        Batch::fastSqrtInverted(view(in), view(out));
+    });
+    CORRADE_VERIFY(std::abs(out[Count - 1]/expected - 1.0f) < 5.0e-6f);
+
+    print("sqrtInverted", standard, fast, batch);
+}
+
+void FastFunctionsBenchmark::acos() {
+    std::vector<Float> in;
+    in.reserve(Count);
+    for(std::size_t i = 0; i != Count; ++i)
+        in.push_back(Float(i)*2.0f/Float(Count) - 1.0f);
+    std::vector<Rad> out(Count);
+
+    const std::int64_t standard = measure([&]() {
+        for(std::size_t i = 0; i != Count; ++i)
+            out[i] = Math::acos(in[i]);
+    });
+    const Rad expected = out[Count - 1];
+
+    const std::int64_t fast = measure([&]() {
+        for(std::size_t i = 0; i != Count; ++i)
+            out[i] = Fast::acos(in[i]);
+    });
+    CORRADE_VERIFY(std::abs(Float(out[Count - 1] - expected)) < 1.0e-6f);
+
+    const std::int64_t batch = measure([&]() {
+        Batch::fastAcos(view(in), view(out));
+    });
+    CORRADE_VERIFY(std::abs(Float(out[Count - 1] - expected)) < 1.0e-6f);
+
+    print("acos", standard, fast, batch);
+}
+
+}}}
+
+CORRADE_TEST_MAIN(Magnum::Math::Test::FastFunctionsBenchmark)
@@ -0,0 +1,167 @@
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#include <algorithm>
+#include <cmath>
+#include <Corrade/TestSuite/Tester.h>
+
+#include "Magnum/Math/Constants.h"
+#include "Magnum/Math/FastFunctions.h"
+#include "Magnum/Math/Vector3.h"
+
+namespace Magnum { namespace Math { namespace Test {
+
+struct FastFunctionsTest: Corrade::TestSuite::Tester {
+    explicit FastFunctionsTest();
+
+    void sincos();
+    void sincosDeg();
+    void sincosDouble();
+    void sinCos();
+    void sqrtInverted();
+    void sqrtInvertedDouble();
+    void sqrtInvertedVector();
+    void acos();
+    void acosDouble();
+    void acosClamped();
+};
+
+typedef Math::Rad<Float> Rad;
+typedef Math::Deg<Float> Deg;
+typedef Math::Rad<Double> Radd;
+typedef Math::Vector3<Float> Vector3;
+
+FastFunctionsTest::FastFunctionsTest() {
+    addTests({&FastFunctionsTest::sincos,
+              &FastFunctionsTest::sincosDeg,
+              &FastFunctionsTest::sincosDouble,
+              &FastFunctionsTest::sinCos,
+              &FastFunctionsTest::sqrtInverted,
+              &FastFunctionsTest::sqrtInvertedDouble,
+              &FastFunctionsTest::sqrtInvertedVector,
+              &FastFunctionsTest::acos,
+              &FastFunctionsTest::acosDouble,
+              &FastFunctionsTest::acosClamped});
+}
+
+void FastFunctionsTest::sincos() {
+    /* Exact values in quadrant boundaries */
+    CORRADE_COMPARE(Fast::sincos(Rad(0.0f)).first, 0.0f);
+    CORRADE_COMPARE(Fast::sincos(Rad(0.0f)).second, 1.0f);
+    CORRADE_COMPARE(Fast::sincos(Rad(Constants<Float>::piHalf())).first, 1.0f);
+    CORRADE_COMPARE(Fast::sincos(Rad(-Constants<Float>::pi())).second, -1.0f);
+
+    /* Error bound in the documented range, compared to double-precision
+       result for the same input */
+    Double maxError = 0.0;
+    for(Double angle = -1.0e4; angle <= 1.0e4; angle += 0.0173) {
+        const Float a = Float(angle);
+        const std::pair<Float, Float> result = Fast::sincos(Rad(a));
+        maxError = std::max({maxError,
+            std::abs(result.first - std::sin(Double(a))),
+            std::abs(result.second - std::cos(Double(a)))});
+    }
+    CORRADE_VERIFY(maxError < 2.0e-7);
+}
+
+void FastFunctionsTest::sincosDeg() {
+    CORRADE_COMPARE(Fast::sincos(Deg(30.0f)).first, 0.5f);
+    CORRADE_COMPARE(Fast::sincos(Deg(-120.0f)).second, -0.5f);
+    CORRADE_COMPARE(Fast::sincos(Deg(45.0f)).second, Constants<Float>::sqrt2()/2.0f);
+}
+
+void FastFunctionsTest::sincosDouble() {
+    /* The polynomials are tuned for floats, so the error bound is the same */
+    Double maxError = 0.0;
+    for(Double angle = -1.0e4; angle <= 1.0e4; angle += 0.0173) {
+        const std::pair<Double, Double> result = Fast::sincos(Radd(angle));
+        maxError = std::max({maxError,
+            std::abs(result.first - std::sin(angle)),
+            std::abs(result.second - std::cos(angle))});
+    }
+    CORRADE_VERIFY(maxError < 2.0e-7);
+}
+
+void FastFunctionsTest::sinCos() {
+    CORRADE_COMPARE(Fast::sin(Deg(150.0f)), 0.5f);
+    CORRADE_COMPARE(Fast::sin(Rad(1.2f)), Fast::sincos(Rad(1.2f)).first);
+    CORRADE_COMPARE(Fast::cos(Deg(60.0f)), 0.5f);
+    CORRADE_COMPARE(Fast::cos(Rad(-3.7f)), Fast::sincos(Rad(-3.7f)).second);
+}
+
+void FastFunctionsTest::sqrtInverted() {
+    CORRADE_COMPARE(Fast::sqrtInverted(4.0f), 0.5f);
+    CORRADE_COMPARE(Fast::sqrtInverted(0.01f), 10.0f);
+
+    /* Relative error bound across the whole range of normal values */
+    Double maxError = 0.0;
+    for(Float value = 1.0e-37f; value < 1.0e37f; value *= 1.0013f)
+        maxError = std::max(maxError, std::abs(Fast::sqrtInverted(value)*std::sqrt(Double(value)) - 1.0));
+    CORRADE_VERIFY(maxError < 5.0e-6);
+}
+
+void FastFunctionsTest::sqrtInvertedDouble() {
+    /* Fuzzy compare of doubles is too strict for the approximation */
+    CORRADE_COMPARE(Float(Fast::sqrtInverted(0.25)), 2.0f);
+
+    Double maxError = 0.0;
+    for(Double value = 1.0e-300; value < 1.0e300; value *= 1.013)
+        maxError = std::max(maxError, std::abs(Fast::sqrtInverted(value)*std::sqrt(value) - 1.0));
+    CORRADE_VERIFY(maxError < 5.0e-6);
+}
+
+void FastFunctionsTest::sqrtInvertedVector() {
+    CORRADE_COMPARE(Fast::sqrtInverted(Vector3(1.0f, 4.0f, 16.0f)), Vector3(1.0f, 0.5f, 0.25f));
+}
+
+void FastFunctionsTest::acos() {
+    CORRADE_COMPARE(Fast::acos(1.0f), Rad(0.0f));
+    CORRADE_COMPARE(Fast::acos(0.0f), Rad(Constants<Float>::piHalf()));
+    CORRADE_COMPARE(Fast::acos(-1.0f), Rad(Constants<Float>::pi()));
+    CORRADE_COMPARE(Deg(Fast::acos(0.5f)), Deg(60.0f));
+
+    Double maxError = 0.0;
+    for(Double value = -1.0; value <= 1.0; value += 1.0e-5) {
+        const Float v = Float(value);
+        maxError = std::max(maxError, std::abs(Double(Float(Fast::acos(v))) - std::acos(Double(v))));
+    }
+    CORRADE_VERIFY(maxError < 1.0e-6);
+}
+
+void FastFunctionsTest::acosDouble() {
+    Double maxError = 0.0;
+    for(Double value = -1.0; value <= 1.0; value += 1.0e-5)
+        maxError = std::max(maxError, std::abs(Double(Fast::acos(value)) - std::acos(value)));
+    CORRADE_VERIFY(maxError < 1.0e-6);
+}
+
+void FastFunctionsTest::acosClamped() {
+    CORRADE_COMPARE(Fast::acos(1.0000001f), Rad(0.0f));
+    CORRADE_COMPARE(Fast::acos(-1.5f), Rad(Constants<Float>::pi()));
+}
+
+}}}
+
+CORRADE_TEST_MAIN(Magnum::Math::Test::FastFunctionsTest)
@@ -69,6 +69,7 @@ struct FunctionsTest: Corrade::TestSuite::Tester {
     void div();
     void trigonometric();
     void trigonometricWithBase();
+    void trigonometricConstexpr();
 };
 
 typedef Math::Constants<Float> Constants;
@@ -115,7 +116,8 @@ FunctionsTest::FunctionsTest() {
               &FunctionsTest::log2,
               &FunctionsTest::div,
               &FunctionsTest::trigonometric,
-              &FunctionsTest::trigonometricWithBase});
+              &FunctionsTest::trigonometricWithBase,
+              &FunctionsTest::trigonometricConstexpr});
 }
 
 void FunctionsTest::min() {
@@ -473,6 +475,34 @@ void FunctionsTest::trigonometricWithBase() {
     CORRADE_COMPARE(Math::tan(2*Rad(Constants::pi()/8)), 1.0f);
 }
 
+void FunctionsTest::trigonometricConstexpr() {
+    constexpr Float a = Math::constexprSin(Deg(30.0f));
+    constexpr Float b = Math::constexprCos(Rad(Constants::pi()/3));
+    constexpr Float c = Math::constexprSin(2*Deg(-15.0f));
+    constexpr Double d = Math::constexprCos(Math::Deg<Double>(120.0));
+    CORRADE_COMPARE(a, 0.5f);
+    CORRADE_COMPARE(b, 0.5f);
+    CORRADE_COMPARE(c, -0.5f);
+    CORRADE_COMPARE(d, -0.5);
+
+    /* Exact values in all quadrants */
+    CORRADE_COMPARE(Math::constexprSin(Deg(0.0f)), 0.0f);
+    CORRADE_COMPARE(Math::constexprCos(Deg(0.0f)), 1.0f);
+    CORRADE_COMPARE(Math::constexprSin(Deg(90.0f)), 1.0f);
+    CORRADE_COMPARE(Math::constexprCos(Deg(180.0f)), -1.0f);
+    CORRADE_COMPARE(Math::constexprSin(Deg(-90.0f)), -1.0f);
+    CORRADE_COMPARE(Math::constexprCos(Deg(360.0f)), 1.0f);
+
+    /* Matches the standard functions on a larger range */
+    for(Int i = -2000; i <= 2000; ++i) {
+        const Float angle = i*0.0137f;
+        CORRADE_COMPARE(Math::constexprSin(Rad(angle)), std::sin(angle));
+        CORRADE_COMPARE(Math::constexprCos(Rad(angle)), std::cos(angle));
+        CORRADE_COMPARE(Math::constexprSin(Math::Rad<Double>(angle*7.1)), std::sin(Double(angle)*7.1));
+        CORRADE_COMPARE(Math::constexprCos(Math::Rad<Double>(angle*7.1)), std::cos(Double(angle)*7.1));
+    }
+}
+
 }}}
 
 CORRADE_TEST_MAIN(Magnum::Math::Test::FunctionsTest)
@@ -0,0 +1,134 @@
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#include <sstream>
+#include <Corrade/TestSuite/Tester.h>
+
+#include "Magnum/Math/Half.h"
+#include "Magnum/Math/Vector3.h"
+
+namespace Magnum { namespace Math { namespace Test {
+
+struct HalfTest: Corrade::TestSuite::Tester {
+    explicit HalfTest();
+
+    void construct();
+    void constructNoInit();
+    void constructData();
+    void constructDouble();
+    void compare();
+    void negated();
+    void literal();
+    void vector();
+
+    void debug();
+};
+
+typedef Math::Vector3<Float> Vector3;
+typedef Math::Vector3<Half> Vector3h;
+
+HalfTest::HalfTest() {
+    addTests({&HalfTest::construct,
+              &HalfTest::constructNoInit,
+              &HalfTest::constructData,
+              &HalfTest::constructDouble,
+              &HalfTest::compare,
+              &HalfTest::negated,
+              &HalfTest::literal,
+              &HalfTest::vector,
+
+              &HalfTest::debug});
+}
+
+void HalfTest::construct() {
+    constexpr Half a;
+    constexpr Half b{ZeroInit};
+    CORRADE_COMPARE(a.data(), 0);
+    CORRADE_COMPARE(b.data(), 0);
+
+    const Half c{3.5f};
+    CORRADE_COMPARE(c.data(), 0x4300);
+    CORRADE_COMPARE(Float(c), 3.5f);
+}
+
+void HalfTest::constructNoInit() {
+    Half a{3.5f};
+    new(&a) Half{NoInit};
+    CORRADE_COMPARE(Float(a), 3.5f);
+}
+
+void HalfTest::constructData() {
+    constexpr Half a{UnsignedShort(0x3c00)};
+    constexpr UnsignedShort b = a.data();
+    constexpr UnsignedShort c = UnsignedShort(a);
+    CORRADE_COMPARE(b, 0x3c00);
+    CORRADE_COMPARE(c, 0x3c00);
+    CORRADE_COMPARE(Float(a), 1.0f);
+}
+
+void HalfTest::constructDouble() {
+    const Half a{-2.0};
+    CORRADE_COMPARE(a.data(), 0xc000);
+}
+
+void HalfTest::compare() {
+    constexpr Half a{UnsignedShort(0x3c00)};
+    constexpr Half b{UnsignedShort(0x3c01)};
+    constexpr bool equal = a == a;
+    constexpr bool notEqual = a != b;
+    CORRADE_VERIFY(equal);
+    CORRADE_VERIFY(notEqual);
+
+    /* Comparing bits, so positive and negative zero differ */
+    CORRADE_VERIFY(Half{0.0f} != Half{-0.0f});
+}
+
+void HalfTest::negated() {
+    constexpr Half a = -Half{UnsignedShort(0x3c00)};
+    CORRADE_COMPARE(a.data(), 0xbc00);
+    CORRADE_COMPARE(Float(-Half{0.0f}), -0.0f);
+}
+
+void HalfTest::literal() {
+    Half a = 3.5_h;
+    CORRADE_COMPARE(a, Half{3.5f});
+}
+
+void HalfTest::vector() {
+    const Vector3 a{1.0f, -0.5f, 65504.0f};
+    const Vector3h b{a};
+    CORRADE_COMPARE(b, (Vector3h{Half{UnsignedShort(0x3c00)}, Half{UnsignedShort(0xb800)}, Half{UnsignedShort(0x7bff)}}));
+    CORRADE_COMPARE(Vector3{b}, a);
+}
+
+void HalfTest::debug() {
+    std::ostringstream o;
+    Debug(&o) << Half{3.5f} << Vector3h{Vector3{1.0f, -0.5f, 0.25f}};
+    CORRADE_COMPARE(o.str(), "3.5 Vector(1, -0.5, 0.25)\n");
+}
+
+}}}
+
+CORRADE_TEST_MAIN(Magnum::Math::Test::HalfTest)
@@ -27,6 +27,7 @@
 #include <Corrade/TestSuite/Tester.h>
 #include <Corrade/Utility/Configuration.h>
 
+#include "Magnum/Math/Functions.h"
 #include "Magnum/Math/Matrix3.h"
 
 struct Mat3 {
@@ -254,6 +255,9 @@ void Matrix3Test::rotation() {
                    {      0.0f,      0.0f, 1.0f});
 
     CORRADE_COMPARE(Matrix3::rotation(Deg(15.0f)), matrix);
+
+    constexpr Matrix3 a = Matrix3::rotation(Math::constexprSin(Deg(15.0f)), Math::constexprCos(Deg(15.0f)));
+    CORRADE_COMPARE(a, matrix);
 }
 
 void Matrix3Test::reflection() {
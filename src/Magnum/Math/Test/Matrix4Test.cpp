@@ -27,6 +27,7 @@
 #include <Corrade/TestSuite/Tester.h>
 #include <Corrade/Utility/Configuration.h>
 
+#include "Magnum/Math/Functions.h"
 #include "Magnum/Math/Matrix4.h"
 
 struct Mat4 {
@@ -77,6 +78,7 @@ struct Matrix4Test: Corrade::TestSuite::Tester {
     void rotationX();
     void rotationY();
     void rotationZ();
+    void rotationConstexpr();
     void reflection();
     void reflectionIsScaling();
     void shearingXY();
@@ -95,6 +97,7 @@ struct Matrix4Test: Corrade::TestSuite::Tester {
     void vectorParts();
     void invertedRigid();
     void transform();
+    void transformConstexpr();
 
     void debug();
     void configuration();
@@ -125,6 +128,7 @@ Matrix4Test::Matrix4Test() {
               &Matrix4Test::rotationX,
               &Matrix4Test::rotationY,
               &Matrix4Test::rotationZ,
+              &Matrix4Test::rotationConstexpr,
               &Matrix4Test::reflection,
               &Matrix4Test::reflectionIsScaling,
               &Matrix4Test::shearingXY,
@@ -143,6 +147,7 @@ Matrix4Test::Matrix4Test() {
               &Matrix4Test::vectorParts,
               &Matrix4Test::invertedRigid,
               &Matrix4Test::transform,
+              &Matrix4Test::transformConstexpr,
 
               &Matrix4Test::debug,
               &Matrix4Test::configuration});
@@ -326,6 +331,17 @@ void Matrix4Test::rotationZ() {
     CORRADE_COMPARE(Matrix4::rotationZ(Rad(Constants::pi()/7)), matrix);
 }
 
+void Matrix4Test::rotationConstexpr() {
+    constexpr Matrix4 a = Matrix4::rotation(Math::constexprSin(Deg(-74.0f)), Math::constexprCos(Deg(-74.0f)), {-0.33333333f, 0.66666667f, 0.66666667f});
+    constexpr Matrix4 x = Matrix4::rotationX(Math::constexprSin(Rad(Constants::pi()/7)), Math::constexprCos(Rad(Constants::pi()/7)));
+    constexpr Matrix4 y = Matrix4::rotationY(Math::constexprSin(Rad(Constants::pi()/7)), Math::constexprCos(Rad(Constants::pi()/7)));
+    constexpr Matrix4 z = Matrix4::rotationZ(Math::constexprSin(Rad(Constants::pi()/7)), Math::constexprCos(Rad(Constants::pi()/7)));
+    CORRADE_COMPARE(a, Matrix4::rotation(Deg(-74.0f), Vector3(-1.0f, 2.0f, 2.0f).normalized()));
+    CORRADE_COMPARE(x, Matrix4::rotationX(Rad(Constants::pi()/7)));
+    CORRADE_COMPARE(y, Matrix4::rotationY(Rad(Constants::pi()/7)));
+    CORRADE_COMPARE(z, Matrix4::rotationZ(Rad(Constants::pi()/7)));
+}
+
 void Matrix4Test::reflection() {
     std::ostringstream o;
     Error::setOutput(&o);
@@ -546,6 +562,18 @@ void Matrix4Test::transform() {
     CORRADE_COMPARE(a.transformPoint(v), Vector3(3.0f, -4.0f, 9.0f));
 }
 
+void Matrix4Test::transformConstexpr() {
+    /* Float 4x4 multiplication is SIMD-accelerated in some builds, which
+       isn't usable in a constant expression */
+    typedef Math::Matrix4<Double> Matrix4d;
+    constexpr Matrix4d a = Matrix4d::translation({1.0, -5.0, 3.5})*
+        Matrix4d::rotationZ(Math::constexprSin(Math::Deg<Double>(90.0)), Math::constexprCos(Math::Deg<Double>(90.0)))*
+        Matrix4d::scaling({2.0, 2.0, 2.0});
+    constexpr Math::Vector4<Double> b = a*Math::Vector4<Double>{1.0, -2.0, 5.5, 1.0};
+    CORRADE_COMPARE(a, Matrix4d::translation({1.0, -5.0, 3.5})*Matrix4d::rotationZ(Math::Deg<Double>(90.0))*Matrix4d::scaling({2.0, 2.0, 2.0}));
+    CORRADE_COMPARE(b, Math::Vector4<Double>(5.0, -3.0, 14.5, 1.0));
+}
+
 void Matrix4Test::lookAt() {
     Matrix4 a = Matrix4::lookAt({0.0f, 0.0f, 0.0f},
                                 {0.0f, 1.0f, 0.0f},
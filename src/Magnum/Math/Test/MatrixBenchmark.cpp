@@ -0,0 +1,103 @@
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+#include <vector>
+#include <Corrade/TestSuite/Tester.h>
+
+#include "Magnum/Math/Matrix.h"
+#include "Magnum/Test/Benchmark.h"
+
+namespace Magnum { namespace Math { namespace Test {
+
+/* Compares Matrix::inverted() with the original implementation using
+   recursive cofactor expansion */
+struct MatrixBenchmark: Corrade::TestSuite::Tester {
+    explicit MatrixBenchmark();
+
+    void inverted3();
+    void inverted4();
+    void inverted4Double();
+    void inverted6();
+
+    private:
+        template<std::size_t size, class T> void benchmark(const char* name, std::size_t count);
+};
+
+MatrixBenchmark::MatrixBenchmark() {
+    addTests({&MatrixBenchmark::inverted3,
+              &MatrixBenchmark::inverted4,
+              &MatrixBenchmark::inverted4Double,
+              &MatrixBenchmark::inverted6});
+}
+
+namespace {
+    template<std::size_t size, class T> Matrix<size, T> cofactorInverted(const Matrix<size, T>& m) {
+        Matrix<size, T> out{ZeroInit};
+        const T determinant = m.determinant();
+        for(std::size_t col = 0; col != size; ++col)
+            for(std::size_t row = 0; row != size; ++row)
+                out[col][row] = (((row+col) & 1) ? -1 : 1)*m.ij(row, col).determinant()/determinant;
+        return out;
+    }
+
+    using Magnum::Test::measure;
+}
+
+void MatrixBenchmark::inverted3() { benchmark<3, Float>("3x3 Float", 100000); }
+void MatrixBenchmark::inverted4() { benchmark<4, Float>("4x4 Float", 100000); }
+void MatrixBenchmark::inverted4Double() { benchmark<4, Double>("4x4 Double", 100000); }
+/* Cofactor expansion is O(n!), use less data */
+void MatrixBenchmark::inverted6() { benchmark<6, Float>("6x6 Float", 5000); }
+
+template<std::size_t size, class T> void MatrixBenchmark::benchmark(const char* name, const std::size_t count) {
+    /* Diagonally dominant matrices, so they are well-conditioned */
+    std::vector<Matrix<size, T>> in;
+    in.reserve(count);
+    for(std::size_t i = 0; i != count; ++i) {
+        Matrix<size, T> m{ZeroInit};
+        for(std::size_t col = 0; col != size; ++col)
+            for(std::size_t row = 0; row != size; ++row)
+                m[col][row] = col == row ? T(size + 1 + i % 3) : T((i + col*3 + row*5) % 7)/T(7);
+        in.push_back(m);
+    }
+    std::vector<Matrix<size, T>> out(count);
+
+    const std::int64_t cofactor = measure([&]() {
+        for(std::size_t i = 0; i != count; ++i)
+            out[i] = cofactorInverted(in[i]);
+    });
+    const Matrix<size, T> expected = out[count - 1];
+
+    const std::int64_t library = measure([&]() {
+        for(std::size_t i = 0; i != count; ++i)
+            out[i] = in[i].inverted();
+    });
+
+    CORRADE_COMPARE(out[count - 1], expected);
+    Corrade::Utility::Debug() << name << "cofactor expansion:" << cofactor << "us, inverted():" << library << "us";
+}
+
+}}}
+
+CORRADE_TEST_MAIN(Magnum::Math::Test::MatrixBenchmark)
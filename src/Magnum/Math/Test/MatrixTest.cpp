@@ -73,6 +73,10 @@ struct MatrixTest: Corrade::TestSuite::Tester {
     void ij();
     void determinant();
     void inverted();
+    void invertedSmall();
+    void invertedDouble();
+    void invertedLarge();
+    void invertedPivoting();
     void invertedOrthogonal();
 
     void subclassTypes();
@@ -105,6 +109,10 @@ MatrixTest::MatrixTest() {
               &MatrixTest::ij,
               &MatrixTest::determinant,
               &MatrixTest::inverted,
+              &MatrixTest::invertedSmall,
+              &MatrixTest::invertedDouble,
+              &MatrixTest::invertedLarge,
+              &MatrixTest::invertedPivoting,
               &MatrixTest::invertedOrthogonal,
 
               &MatrixTest::subclassTypes,
@@ -300,6 +308,80 @@ void MatrixTest::inverted() {
     CORRADE_COMPARE(_inverse*m, Matrix4x4());
 }
 
+void MatrixTest::invertedSmall() {
+    Matrix<2, Float> a(Vector<2, Float>(3.0f, 5.0f),
+                       Vector<2, Float>(4.0f, 2.0f));
+    CORRADE_COMPARE(a.inverted(), (Matrix<2, Float>(Vector<2, Float>(-2/14.0f, 5/14.0f),
+                                                    Vector<2, Float>(4/14.0f, -3/14.0f))));
+
+    Matrix3x3 b(Vector3(3.0f,  5.0f, 8.0f),
+                Vector3(4.0f,  4.0f, 7.0f),
+                Vector3(7.0f, -1.0f, 8.0f));
+    Matrix3x3 inverse(Vector3(-39/54.0f,  48/54.0f,  -3/54.0f),
+                      Vector3(-17/54.0f,  32/54.0f, -11/54.0f),
+                      Vector3( 32/54.0f, -38/54.0f,   8/54.0f));
+    CORRADE_COMPARE(b.inverted(), inverse);
+    CORRADE_COMPARE(b.inverted()*b, Matrix3x3());
+
+    Matrix<1, Float> c(Vector<1, Float>(4.0f));
+    CORRADE_COMPARE(c.inverted()[0][0], 0.25f);
+}
+
+void MatrixTest::invertedDouble() {
+    /* Float 4x4 may go through the SIMD implementation, doubles always use
+       the generic one */
+    Matrix<4, Double> m(Vector<4, Double>(3.0,  5.0, 8.0, 4.0),
+                        Vector<4, Double>(4.0,  4.0, 7.0, 3.0),
+                        Vector<4, Double>(7.0, -1.0, 8.0, 0.0),
+                        Vector<4, Double>(9.0,  4.0, 5.0, 9.0));
+
+    Matrix<4, Double> inverse(Vector<4, Double>(-60/103.0,   71/103.0,  -4/103.0,  3/103.0),
+                              Vector<4, Double>(-66/103.0,  109/103.0, -25/103.0, -7/103.0),
+                              Vector<4, Double>(177/412.0,  -97/206.0,  53/412.0, -7/206.0),
+                              Vector<4, Double>(259/412.0, -185/206.0,  31/412.0, 27/206.0));
+
+    CORRADE_COMPARE(m.inverted(), inverse);
+    CORRADE_COMPARE(m.inverted()*m, (Matrix<4, Double>()));
+}
+
+void MatrixTest::invertedLarge() {
+    /* LU decomposition */
+    Matrix<5, Float> m(
+        Vector<5, Float>(1.0f, 2.0f, 2.0f, 1.0f,  0.0f),
+        Vector<5, Float>(2.0f, 3.0f, 2.0f, 1.0f, -2.0f),
+        Vector<5, Float>(1.0f, 1.0f, 1.0f, 1.0f,  0.0f),
+        Vector<5, Float>(2.0f, 0.0f, 0.0f, 1.0f,  2.0f),
+        Vector<5, Float>(3.0f, 1.0f, 0.0f, 1.0f, -2.0f)
+    );
+
+    CORRADE_COMPARE(m.inverted()*m, (Matrix<5, Float>()));
+    CORRADE_COMPARE(m*m.inverted(), (Matrix<5, Float>()));
+
+    /* Compare to the cofactor expansion */
+    Matrix<5, Float> cofactor{ZeroInit};
+    const Float determinant = m.determinant();
+    for(std::size_t col = 0; col != 5; ++col)
+        for(std::size_t row = 0; row != 5; ++row)
+            cofactor[col][row] = (((row+col) & 1) ? -1 : 1)*m.ij(row, col).determinant()/determinant;
+    CORRADE_COMPARE(m.inverted(), cofactor);
+}
+
+void MatrixTest::invertedPivoting() {
+    /* Zeros on the diagonal, needs row swaps */
+    Matrix<6, Float> m{ZeroInit};
+    m[0][3] = 2.0f;
+    m[1][0] = 1.0f;
+    m[2][5] = -4.0f;
+    m[3][1] = 0.5f;
+    m[4][2] = 1.0f;
+    m[5][4] = 8.0f;
+    m[5][0] = 3.0f;
+
+    const Matrix<6, Float> inverse = m.inverted();
+    CORRADE_COMPARE(inverse*m, (Matrix<6, Float>()));
+    CORRADE_COMPARE(m*inverse, (Matrix<6, Float>()));
+}
+
 void MatrixTest::invertedOrthogonal() {
     std::ostringstream o;
     Error::setOutput(&o);
@@ -0,0 +1,196 @@
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#include <Corrade/TestSuite/Tester.h>
+
+#include "Magnum/Math/Constants.h"
+#include "Magnum/Math/Packing.h"
+
+namespace Magnum { namespace Math { namespace Test {
+
+struct PackingTest: Corrade::TestSuite::Tester {
+    explicit PackingTest();
+
+    void packHalf();
+    void packHalfRounding();
+    void packHalfSpecial();
+    void unpackHalf();
+    void unpackHalfRoundtrip();
+
+    void octahedral();
+    void octahedralPrecision();
+
+    void unsigned1010102();
+    void signed1010102();
+};
+
+typedef Math::Vector2<Float> Vector2;
+typedef Math::Vector3<Float> Vector3;
+typedef Math::Vector4<Float> Vector4;
+typedef Math::Vector2<Short> Vector2s;
+
+PackingTest::PackingTest() {
+    addTests({&PackingTest::packHalf,
+              &PackingTest::packHalfRounding,
+              &PackingTest::packHalfSpecial,
+              &PackingTest::unpackHalf,
+              &PackingTest::unpackHalfRoundtrip,
+
+              &PackingTest::octahedral,
+              &PackingTest::octahedralPrecision,
+
+              &PackingTest::unsigned1010102,
+              &PackingTest::signed1010102});
+}
+
+void PackingTest::packHalf() {
+    CORRADE_COMPARE(Math::packHalf(0.0f), 0x0000);
+    CORRADE_COMPARE(Math::packHalf(-0.0f), 0x8000);
+    CORRADE_COMPARE(Math::packHalf(1.0f), 0x3c00);
+    CORRADE_COMPARE(Math::packHalf(-2.0f), 0xc000);
+    CORRADE_COMPARE(Math::packHalf(0.333251953f), 0x3555);
+    CORRADE_COMPARE(Math::packHalf(65504.0f), 0x7bff);
+
+    /* Smallest normal and subnormal values */
+    CORRADE_COMPARE(Math::packHalf(6.10351562e-5f), 0x0400);
+    CORRADE_COMPARE(Math::packHalf(5.96046448e-8f), 0x0001);
+    CORRADE_COMPARE(Math::packHalf(-6.09755516e-5f), 0x83ff);
+}
+
+void PackingTest::packHalfRounding() {
+    /* Ties to even */
+    CORRADE_COMPARE(Math::packHalf(1.00048828f), 0x3c00);
+    CORRADE_COMPARE(Math::packHalf(1.00146484f), 0x3c02);
+    CORRADE_COMPARE(Math::packHalf(2.98023224e-8f), 0x0000);
+    CORRADE_COMPARE(Math::packHalf(8.94069672e-8f), 0x0002);
+
+    /* Not a tie */
+    CORRADE_COMPARE(Math::packHalf(1.00048840f), 0x3c01);
+    CORRADE_COMPARE(Math::packHalf(0.1f), 0x2e66);
+
+    /* Largest value still rounding down and smallest rounding to infinity */
+    CORRADE_COMPARE(Math::packHalf(65519.996f), 0x7bff);
+    CORRADE_COMPARE(Math::packHalf(65520.0f), 0x7c00);
+}
+
+void PackingTest::packHalfSpecial() {
+    CORRADE_COMPARE(Math::packHalf(1.0e10f), 0x7c00);
+    CORRADE_COMPARE(Math::packHalf(-1.0e10f), 0xfc00);
+    CORRADE_COMPARE(Math::packHalf(1.0e-10f), 0x0000);
+    CORRADE_COMPARE(Math::packHalf(Constants<Float>::inf()), 0x7c00);
+    CORRADE_COMPARE(Math::packHalf(-Constants<Float>::inf()), 0xfc00);
+
+    /* NaN stays NaN */
+    const UnsignedShort nan = Math::packHalf(Constants<Float>::nan());
+    CORRADE_COMPARE(nan & 0x7e00, 0x7e00);
+}
+
+void PackingTest::unpackHalf() {
+    CORRADE_COMPARE(Math::unpackHalf(0x0000), 0.0f);
+    CORRADE_COMPARE(Math::unpackHalf(0x3c00), 1.0f);
+    CORRADE_COMPARE(Math::unpackHalf(0xc000), -2.0f);
+    CORRADE_COMPARE(Math::unpackHalf(0x7bff), 65504.0f);
+    CORRADE_COMPARE(Math::unpackHalf(0x0001), 5.96046448e-8f);
+    CORRADE_COMPARE(Math::unpackHalf(0x83ff), -6.09755516e-5f);
+    CORRADE_COMPARE(Math::unpackHalf(0x7c00), Constants<Float>::inf());
+    CORRADE_COMPARE(Math::unpackHalf(0xfc00), -Constants<Float>::inf());
+
+    const Float nan = Math::unpackHalf(0x7e00);
+    CORRADE_VERIFY(nan != nan);
+}
+
+void PackingTest::unpackHalfRoundtrip() {
+    /* Every non-NaN value survives the roundtrip */
+    std::size_t mismatches = 0;
+    for(UnsignedInt i = 0; i != 65536; ++i) {
+        if((i & 0x7c00) == 0x7c00 && (i & 0x3ff)) continue;
+        if(Math::packHalf(Math::unpackHalf(i)) != i) ++mismatches;
+    }
+    CORRADE_COMPARE(mismatches, 0);
+}
+
+void PackingTest::octahedral() {
+    /* Axes and both hemispheres */
+    CORRADE_COMPARE(packOctahedral(Vector3::zAxis()), Vector2{});
+    CORRADE_COMPARE(packOctahedral(-Vector3::zAxis()), Vector2{1.0f});
+    CORRADE_COMPARE(packOctahedral(Vector3::xAxis()), Vector2::xAxis());
+    CORRADE_COMPARE(packOctahedral(-Vector3::yAxis()), -Vector2::yAxis());
+    CORRADE_COMPARE(unpackOctahedral(Vector2{}), Vector3::zAxis());
+    CORRADE_COMPARE(unpackOctahedral(Vector2{1.0f}), -Vector3::zAxis());
+    CORRADE_COMPARE(unpackOctahedral(Vector2{-1.0f}), -Vector3::zAxis());
+
+    const Vector3 vectors[]{
+        Vector3{1.0f, 2.0f, 3.0f}.normalized(),
+        Vector3{-1.0f, 0.5f, -3.0f}.normalized(),
+        Vector3{0.3f, -2.0f, -0.1f}.normalized(),
+        Vector3{-5.0f, -1.0f, 0.0f}.normalized()};
+    for(const Vector3& vector: vectors) {
+        const Vector2 packed = packOctahedral(vector);
+        CORRADE_VERIFY((Math::abs(packed) <= Vector2{1.0f}).all());
+        CORRADE_COMPARE(unpackOctahedral(packed), vector);
+    }
+}
+
+void PackingTest::octahedralPrecision() {
+    /* Stored as two shorts the roundtrip error is far below what's visible
+       in shading */
+    const Vector3 vector = Vector3{-0.3f, 0.7f, -0.2f}.normalized();
+    const Vector2s packed = denormalize<Vector2s>(packOctahedral(vector));
+    const Vector3 unpacked = unpackOctahedral(normalize<Vector2>(packed));
+    CORRADE_VERIFY((unpacked - vector).length() < 1.0e-4f);
+}
+
+void PackingTest::unsigned1010102() {
+    CORRADE_COMPARE(packUnsigned1010102(Vector4{1.0f, 0.0f, 0.5f, 1.0f}), 0xe00003ff);
+    CORRADE_COMPARE(packUnsigned1010102(Vector4{0.0f, 1.0f, 0.0f, 0.333333f}), 0x400ffc00);
+
+    /* Out-of-range values are clamped */
+    CORRADE_COMPARE(packUnsigned1010102(Vector4{2.0f, -1.0f, 0.0f, 5.0f}), 0xc00003ff);
+
+    CORRADE_COMPARE(unpackUnsigned1010102<Float>(0xe00003ff), (Vector4{1.0f, 0.0f, 0.500489f, 1.0f}));
+
+    const Vector4 a{0.25f, 0.75f, 0.125f, 0.666667f};
+    CORRADE_VERIFY((unpackUnsigned1010102<Float>(packUnsigned1010102(a)) - a).length() < 1.0f/1023.0f);
+}
+
+void PackingTest::signed1010102() {
+    CORRADE_COMPARE(packSigned1010102(Vector4{-1.0f, 1.0f, 0.0f, -1.0f}), 0xc007fe01);
+    CORRADE_COMPARE(packSigned1010102(Vector4{0.0f, 0.0f, -0.5f, 1.0f}), 0x70000000);
+
+    /* Out-of-range values are clamped */
+    CORRADE_COMPARE(packSigned1010102(Vector4{-3.0f, 2.0f, 0.0f, -5.0f}), 0xc007fe01);
+
+    CORRADE_COMPARE(unpackSigned1010102<Float>(0xc007fe01), (Vector4{-1.0f, 1.0f, 0.0f, -1.0f}));
+
+    /* The lowest values map to -1 as well */
+    CORRADE_COMPARE(unpackSigned1010102<Float>(0x80000200), (Vector4{-1.0f, 0.0f, 0.0f, -1.0f}));
+
+    const Vector4 a{-0.25f, 0.75f, -0.125f, 0.0f};
+    CORRADE_VERIFY((unpackSigned1010102<Float>(packSigned1010102(a)) - a).length() < 1.0f/511.0f);
+}
+
+}}}
+
+CORRADE_TEST_MAIN(Magnum::Math::Test::PackingTest)
@@ -26,6 +26,7 @@
 #include <sstream>
 #include <Corrade/TestSuite/Tester.h>
 
+#include "Magnum/Math/Functions.h"
 #include "Magnum/Math/Matrix4.h"
 #include "Magnum/Math/Quaternion.h"
 
@@ -250,6 +251,14 @@ void QuaternionTest::multiplyDivideScalar() {
 void QuaternionTest::multiply() {
     CORRADE_COMPARE(Quaternion({-6.0f, -9.0f, 15.0f}, 0.5f)*Quaternion({2.0f, 3.0f, -5.0f}, 2.0f),
                     Quaternion({-11.0f, -16.5f, 27.5f}, 115.0f));
+
+    /* Float multiplication is SIMD-accelerated in some builds, which isn't
+       usable in a constant expression */
+    typedef Math::Quaternion<Double> Quaterniond;
+    constexpr Quaterniond a = Quaterniond({-6.0, -9.0, 15.0}, 0.5)*Quaterniond({2.0, 3.0, -5.0}, 2.0);
+    CORRADE_COMPARE(a, Quaterniond({-11.0, -16.5, 27.5}, 115.0));
+    CORRADE_COMPARE(Quaterniond({1.0, -3.0, 2.5}, 0.5)*Quaterniond({-2.0, 7.0, 4.0}, 3.0),
+                    Quaterniond({-27.5, -14.5, 10.5}, 14.5));
 }
 
 void QuaternionTest::dot() {
@@ -324,6 +333,10 @@ void QuaternionTest::rotation() {
     CORRADE_COMPARE_AS(q2.angle(), Deg(120.0f), Deg);
     CORRADE_COMPARE(q2.axis(), -axis);
 
+    /* Constexpr variant from half-angle sine and cosine */
+    constexpr Quaternion q3 = Quaternion::rotation(Math::constexprSin(Deg(60.0f)), Math::constexprCos(Deg(60.0f)), {0.57735027f, 0.57735027f, 0.57735027f});
+    CORRADE_COMPARE(q3, q);
+
     /* Default-constructed quaternion has zero angle and NaN axis */
     CORRADE_COMPARE_AS(Quaternion().angle(), Deg(0.0f), Deg);
     CORRADE_VERIFY(Quaternion().axis() != Quaternion().axis());
@@ -0,0 +1,215 @@
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+#include <vector>
+#include <Corrade/TestSuite/Tester.h>
+
+#include "Magnum/Math/Batch.h"
+#include "Magnum/Math/Matrix4.h"
+#include "Magnum/Math/Quaternion.h"
+#include "Magnum/Test/Benchmark.h"
+
+namespace Magnum { namespace Math { namespace Test {
+
+/* Compares the library implementation of hot operations with a plain scalar
+   loop. The constexpr operators are not SIMD-accelerated, so the products
+   are measured through the Batch functions and Matrix4::transformPoint(). With
+   MAGNUM_BUILD_SIMD disabled both columns should be roughly the same. */
+struct SimdBenchmark: Corrade::TestSuite::Tester {
+    explicit SimdBenchmark();
+
+    void multiplyMatrix();
+    void transformPoint();
+    void inverted();
+    void multiplyQuaternion();
+};
+
+typedef Math::Deg<Float> Deg;
+typedef Math::Matrix4<Float> Matrix4;
+typedef Math::Quaternion<Float> Quaternion;
+typedef Math::Vector3<Float> Vector3;
+typedef Math::Vector4<Float> Vector4;
+
+SimdBenchmark::SimdBenchmark() {
+    addTests({&SimdBenchmark::multiplyMatrix,
+              &SimdBenchmark::transformPoint,
+              &SimdBenchmark::inverted,
+              &SimdBenchmark::multiplyQuaternion});
+}
+
+namespace {
+    enum: std::size_t { Count = 100000 };
+
+    std::vector<Matrix4> matrices() {
+        std::vector<Matrix4> out;
+        out.reserve(Count);
+        for(std::size_t i = 0; i != Count; ++i)
+            out.push_back(Matrix4::rotation(Deg(Float(i % 360)), Vector3(1.0f, 2.0f, -2.0f).normalized())*
+                          Matrix4::translation({Float(i % 17), Float(i % 5), Float(i % 11)})*
+                          Matrix4::scaling(Vector3(1.0f + Float(i % 3))));
+        return out;
+    }
+
+    using Magnum::Test::measure;
+
+    Vector4 scalarColumn(const Matrix4& a, const Vector4& b) {
+        Vector4 out;
+        for(std::size_t row = 0; row != 4; ++row)
+            for(std::size_t pos = 0; pos != 4; ++pos)
+                out[row] += a[pos][row]*b[pos];
+        return out;
+    }
+
+    /* Same as the generic implementation, cofactor expansion */
+    Matrix4 scalarInverted(const Matrix4& m) {
+        Matrix4 out{ZeroInit};
+        const Float determinant = m.determinant();
+        for(std::size_t col = 0; col != 4; ++col) {
+            for(std::size_t row = 0; row != 4; ++row) {
+                Math::Matrix<3, Float> minor{NoInit};
+                for(std::size_t c = 0, mc = 0; c != 4; ++c) {
+                    if(c == row) continue;
+                    for(std::size_t r = 0, mr = 0; r != 4; ++r) {
+                        if(r == col) continue;
+                        minor[mc][mr++] = m[c][r];
+                    }
+                    ++mc;
+                }
+                out[col][row] = (((row + col) & 1) ? -1.0f : 1.0f)*minor.determinant()/determinant;
+            }
+        }
+        return out;
+    }
+
+    void print(const char* name, std::int64_t scalar, std::int64_t library) {
+        Corrade::Utility::Debug() << name << "scalar:" << scalar << "us, library:" << library << "us";
+    }
+}
+
+void SimdBenchmark::multiplyMatrix() {
+    const std::vector<Matrix4> in = matrices();
+    std::vector<Matrix4> out;
+    const Matrix4 m = in[Count/2];
+
+    const std::int64_t scalar = measure([&]() {
+        out = in;
+        for(std::size_t i = 0; i != Count; ++i) {
+            const Matrix4 b = out[i];
+            for(std::size_t col = 0; col != 4; ++col)
+                out[i][col] = scalarColumn(m, b[col]);
+        }
+    });
+    const Matrix4 expected = out[Count - 1];
+
+    const std::int64_t library = measure([&]() {
+        out = in;
+        Batch::multiplyInPlace(m, Corrade::Containers::ArrayView<Matrix4>{out.data(), out.size()});
+    });
+
+    CORRADE_COMPARE(out[Count - 1], expected);
+    print("Batch::multiplyInPlace(Matrix4)", scalar, library);
+}
+
+void SimdBenchmark::transformPoint() {
+    const Matrix4 m = matrices()[Count/2];
+    std::vector<Vector3> in;
+    in.reserve(Count);
+    for(std::size_t i = 0; i != Count; ++i)
+        in.push_back({Float(i % 17), -Float(i % 5), 0.5f*Float(i % 11)});
+    std::vector<Vector3> out;
+
+    const std::int64_t scalar = measure([&]() {
+        out = in;
+        for(std::size_t i = 0; i != Count; ++i)
+            out[i] = scalarColumn(m, {out[i], 1.0f}).xyz();
+    });
+    const Vector3 expected = out[Count - 1];
+
+    const std::int64_t library = measure([&]() {
+        out = in;
+        Batch::transformPointsInPlace(m, Corrade::Containers::ArrayView<Vector3>{out.data(), out.size()});
+    });
+
+    CORRADE_COMPARE(out[Count - 1], expected);
+    print("Batch::transformPointsInPlace()", scalar, library);
+
+    const std::int64_t single = measure([&]() {
+        out = in;
+        for(std::size_t i = 0; i != Count; ++i)
+            out[i] = m.transformPoint(out[i]);
+    });
+
+    CORRADE_COMPARE(out[Count - 1], expected);
+    print("Matrix4::transformPoint()", scalar, single);
+}
+
+void SimdBenchmark::inverted() {
+    const std::vector<Matrix4> in = matrices();
+    std::vector<Matrix4> out(Count);
+
+    const std::int64_t scalar = measure([&]() {
+        for(std::size_t i = 0; i != Count; ++i)
+            out[i] = scalarInverted(in[i]);
+    });
+    const Matrix4 expected = out[Count - 1];
+
+    const std::int64_t library = measure([&]() {
+        for(std::size_t i = 0; i != Count; ++i)
+            out[i] = in[i].inverted();
+    });
+
+    CORRADE_COMPARE(out[Count - 1], expected);
+    print("Matrix4::inverted()", scalar, library);
+}
+
+void SimdBenchmark::multiplyQuaternion() {
+    std::vector<Quaternion> in;
+    in.reserve(Count);
+    for(std::size_t i = 0; i != Count; ++i)
+        in.push_back(Quaternion::rotation(Deg(Float(i % 360)), Vector3(1.0f, 2.0f, -2.0f).normalized()));
+    std::vector<Quaternion> out;
+    const Quaternion a = in[Count/2];
+
+    const std::int64_t scalar = measure([&]() {
+        out = in;
+        for(std::size_t i = 0; i != Count; ++i) {
+            const Quaternion b = out[i];
+            out[i] = {a.scalar()*b.vector() + b.scalar()*a.vector() + cross(a.vector(), b.vector()),
+                      a.scalar()*b.scalar() - dot(a.vector(), b.vector())};
+        }
+    });
+    const Quaternion expected = out[Count - 1];
+
+    const std::int64_t library = measure([&]() {
+        out = in;
+        Batch::multiplyInPlace(a, Corrade::Containers::ArrayView<Quaternion>{out.data(), out.size()});
+    });
+
+    CORRADE_COMPARE(out[Count - 1], expected);
+    print("Batch::multiplyInPlace(Quaternion)", scalar, library);
+}
+
+}}}
+
+CORRADE_TEST_MAIN(Magnum::Math::Test::SimdBenchmark)
@@ -0,0 +1,211 @@
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+#include <Corrade/TestSuite/Tester.h>
+
+#include "Magnum/Math/Batch.h"
+#include "Magnum/Math/Matrix4.h"
+#include "Magnum/Math/Quaternion.h"
+
+namespace Magnum { namespace Math { namespace Test {
+
+/* Checks the explicit SIMD implementation against plain scalar reference
+   code. The matrix and quaternion operators stay constexpr, the products are
+   SIMD-accelerated in the runtime entry points such as
+   Matrix4::transformPoint() and the Batch functions. If MAGNUM_BUILD_SIMD is
+   not enabled, this verifies the generic implementation, which should give
+   the same results. */
+struct SimdTest: Corrade::TestSuite::Tester {
+    explicit SimdTest();
+
+    void multiplyMatrix();
+    void multiplyConstexpr();
+    void transformPoint();
+    void inverted();
+    void invertedSingular();
+    void multiplyQuaternion();
+};
+
+typedef Math::Deg<Float> Deg;
+typedef Math::Matrix4<Float> Matrix4;
+typedef Math::Matrix4<Double> Matrix4d;
+typedef Math::Quaternion<Float> Quaternion;
+typedef Math::Quaternion<Double> Quaterniond;
+typedef Math::Vector3<Float> Vector3;
+typedef Math::Vector3<Double> Vector3d;
+typedef Math::Vector4<Float> Vector4;
+
+SimdTest::SimdTest() {
+    addTests({&SimdTest::multiplyMatrix,
+              &SimdTest::multiplyConstexpr,
+              &SimdTest::transformPoint,
+              &SimdTest::inverted,
+              &SimdTest::invertedSingular,
+              &SimdTest::multiplyQuaternion});
+}
+
+namespace {
+    const Matrix4 a{Vector4{ 3.0f,  5.0f,  8.0f,  4.0f},
+                    Vector4{ 4.5f,  4.0f,  7.0f,  3.0f},
+                    Vector4{ 7.0f, -1.0f,  8.0f,  0.0f},
+                    Vector4{ 9.5f,  4.0f,  5.0f,  9.0f}};
+    const Matrix4 b{Vector4{-1.25f, 0.0f,   0.5f,   1.0f},
+                    Vector4{ 0.1f,  1.75f, -0.33f,  0.0f},
+                    Vector4{ 2.0f, -0.7f,   0.0f,   0.25f},
+                    Vector4{ 0.0f,  0.0f,   3.5f,  -1.0f}};
+
+    /* Same accumulation order as the generic implementation */
+    Vector4 referenceColumn(const Matrix4& a, const Vector4& b) {
+        Vector4 out;
+        for(std::size_t row = 0; row != 4; ++row) {
+            Float value = 0.0f;
+            for(std::size_t pos = 0; pos != 4; ++pos)
+                value += a[pos][row]*b[pos];
+            out[row] = value;
+        }
+        return out;
+    }
+}
+
+void SimdTest::multiplyMatrix() {
+    Matrix4 expected;
+    for(std::size_t col = 0; col != 4; ++col)
+        expected[col] = referenceColumn(a, b[col]);
+
+    /* Chained product with rotations, used heavily in the scene graph */
+    const Matrix4 rotation = Matrix4::rotation(Deg(37.0f), Vector3(1.0f, -2.0f, 0.5f).normalized())*
+                             Matrix4::translation({1.0f, 2.0f, -3.0f});
+    Matrix4 expectedRotation;
+    for(std::size_t col = 0; col != 4; ++col)
+        expectedRotation[col] = referenceColumn(rotation, a[col]);
+
+    /* The result should be bit-identical, not just fuzzy-equal, both for the
+       operator and the batch function */
+    Matrix4 actual[]{b, b};
+    actual[0] = a*actual[0];
+    Batch::multiplyInPlace(a, Corrade::Containers::ArrayView<Matrix4>{actual}.suffix(1));
+    Matrix4 actualRotation[]{a, a};
+    actualRotation[0] = rotation*actualRotation[0];
+    Batch::multiplyInPlace(rotation, Corrade::Containers::ArrayView<Matrix4>{actualRotation}.suffix(1));
+    for(std::size_t i = 0; i != 2; ++i) {
+        for(std::size_t col = 0; col != 4; ++col) for(std::size_t row = 0; row != 4; ++row) {
+            CORRADE_VERIFY(actual[i][col][row] == expected[col][row]);
+            CORRADE_VERIFY(actualRotation[i][col][row] == expectedRotation[col][row]);
+        }
+    }
+
+    /* Runtime product used by non-constexpr code such as the scene graph */
+    const Matrix4 runtime = Implementation::MatrixMultiply<4, Float>::multiply(rotation, a);
+    for(std::size_t col = 0; col != 4; ++col)
+        for(std::size_t row = 0; row != 4; ++row)
+            CORRADE_VERIFY(runtime[col][row] == expectedRotation[col][row]);
+}
+
+void SimdTest::multiplyConstexpr() {
+    /* Products have to be usable in constant expressions regardless of
+       whether MAGNUM_BUILD_SIMD is enabled */
+    constexpr Matrix4 ca{Vector4{1.0f, 2.0f, 3.0f, 4.0f},
+                         Vector4{0.5f, 1.0f, 0.0f, 0.0f},
+                         Vector4{0.0f, 0.0f, 2.0f, 0.0f},
+                         Vector4{1.0f, 0.0f, 0.0f, 1.0f}};
+    constexpr Matrix4 cb = ca*ca;
+    constexpr Vector4 cv = ca*Vector4{1.0f, 1.0f, 1.0f, 1.0f};
+    constexpr Quaternion cq = Quaternion{{1.0f, 2.0f, 3.0f}, 4.0f}*Quaternion{{0.5f, 0.0f, 0.0f}, 1.0f};
+
+    Matrix4 expected;
+    for(std::size_t col = 0; col != 4; ++col)
+        expected[col] = referenceColumn(ca, ca[col]);
+    CORRADE_COMPARE(cb, expected);
+    CORRADE_COMPARE(cv, (Vector4{2.5f, 3.0f, 5.0f, 5.0f}));
+    CORRADE_COMPARE(cq, (Quaternion{{3.0f, 3.5f, 2.0f}, 3.5f}));
+}
+
+void SimdTest::transformPoint() {
+    const Matrix4 m = Matrix4::rotation(Deg(-17.0f), Vector3(0.3f, 1.0f, -0.2f).normalized())*
+                      Matrix4::scaling({2.0f, 0.5f, 1.5f})*
+                      Matrix4::translation({1.0f, 2.0f, -3.0f});
+    const Vector3 v{2.5f, -1.0f, 0.75f};
+
+    const Vector4 expectedPoint = referenceColumn(m, {v, 1.0f});
+    const Vector4 expectedVector = referenceColumn(m, {v, 0.0f});
+    const Vector3 actualPoint = m.transformPoint(v);
+    const Vector3 actualVector = m.transformVector(v);
+    for(std::size_t i = 0; i != 3; ++i) {
+        CORRADE_VERIFY(actualPoint[i] == expectedPoint[i]);
+        CORRADE_VERIFY(actualVector[i] == expectedVector[i]);
+    }
+}
+
+void SimdTest::inverted() {
+    /* Double-precision implementation is always the generic one */
+    CORRADE_COMPARE(a.inverted(), Matrix4(Matrix4d(a).inverted()));
+    CORRADE_COMPARE(b.inverted(), Matrix4(Matrix4d(b).inverted()));
+    CORRADE_COMPARE(a.inverted()*a, Matrix4());
+
+    const Matrix4 m = Matrix4::rotation(Deg(-17.0f), Vector3(0.3f, 1.0f, -0.2f).normalized())*
+                      Matrix4::scaling({2.0f, 0.5f, 1.5f})*
+                      Matrix4::translation({1.0f, 2.0f, -3.0f});
+    CORRADE_COMPARE(m.inverted(), Matrix4(Matrix4d(m).inverted()));
+    CORRADE_COMPARE(m.inverted()*m, Matrix4());
+}
+
+void SimdTest::invertedSingular() {
+    /* Same as the generic implementation, singular matrix doesn't assert
+       and the result is not finite */
+    const Matrix4 singular{Vector4{1.0f, 2.0f, 3.0f, 4.0f},
+                           Vector4{2.0f, 4.0f, 6.0f, 8.0f},
+                           Vector4{0.0f, 1.0f, 0.0f, 1.0f},
+                           Vector4{1.0f, 0.0f, 1.0f, 0.0f}};
+    const Matrix4 inverted = singular.inverted();
+    CORRADE_VERIFY(!(inverted[0][0] == inverted[0][0]) || std::isinf(inverted[0][0]));
+}
+
+void SimdTest::multiplyQuaternion() {
+    const Quaternion p = Quaternion::rotation(Deg(37.0f), Vector3(1.0f, -2.0f, 0.5f).normalized());
+    const Quaternion q{{-1.25f, 0.5f, 3.0f}, 0.75f};
+
+    const auto reference = [](const Quaternion& a, const Quaternion& b) {
+        const Quaterniond out = Quaterniond{Vector3d(a.vector()), Double(a.scalar())}*
+                                Quaterniond{Vector3d(b.vector()), Double(b.scalar())};
+        return Quaternion{Vector3(out.vector()), Float(out.scalar())};
+    };
+
+    CORRADE_COMPARE(p*q, reference(p, q));
+    CORRADE_COMPARE(q*p, reference(q, p));
+    CORRADE_COMPARE(q*q, reference(q, q));
+    CORRADE_COMPARE(Implementation::QuaternionMultiply<Float>::multiply(p, q), reference(p, q));
+    CORRADE_COMPARE(Implementation::QuaternionMultiply<Float>::multiply(q, p), reference(q, p));
+
+    Quaternion batch[]{q, p, q};
+    Batch::multiplyInPlace(p, Corrade::Containers::ArrayView<Quaternion>{batch}.prefix(1));
+    Batch::multiplyInPlace(q, Corrade::Containers::ArrayView<Quaternion>{batch}.suffix(1));
+    CORRADE_COMPARE(batch[0], reference(p, q));
+    CORRADE_COMPARE(batch[1], reference(q, p));
+    CORRADE_COMPARE(batch[2], reference(q, q));
+    CORRADE_COMPARE(p*p.conjugated(), Quaternion());
+}
+
+}}}
+
+CORRADE_TEST_MAIN(Magnum::Math::Test::SimdTest)
@@ -0,0 +1,99 @@
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#include <vector>
+#include <Corrade/TestSuite/Tester.h>
+
+#include "Magnum/Math/Batch.h"
+#include "Magnum/Test/Benchmark.h"
+
+namespace Magnum { namespace Math { namespace Test {
+
+/* Compares per-pixel sRGB conversion of a 4K RGBA image with the batch
+   lookup-table based one */
+struct SrgbBenchmark: Corrade::TestSuite::Tester {
+    explicit SrgbBenchmark();
+
+    void srgbToLinear();
+    void linearToSrgb();
+
+    private:
+        std::vector<Color4<UnsignedByte>> _srgb;
+        std::vector<Color4<Float>> _linear;
+};
+
+typedef Math::Color4<Float> Color4;
+typedef Math::Color4<UnsignedByte> Color4ub;
+
+namespace {
+    constexpr std::size_t PixelCount = 3840*2160;
+
+    using Magnum::Test::measure;
+}
+
+SrgbBenchmark::SrgbBenchmark(): _srgb(PixelCount), _linear(PixelCount) {
+    addTests({&SrgbBenchmark::srgbToLinear,
+              &SrgbBenchmark::linearToSrgb});
+
+    for(std::size_t i = 0; i != PixelCount; ++i)
+        _srgb[i] = {UnsignedByte(i), UnsignedByte(i/3840), UnsignedByte(i*7/3), UnsignedByte(i/15)};
+}
+
+void SrgbBenchmark::srgbToLinear() {
+    const std::int64_t perPixel = measure([&]() {
+        for(std::size_t i = 0; i != PixelCount; ++i)
+            _linear[i] = Color4::fromSrgbAlpha(_srgb[i]);
+    });
+    const Color4 expected = _linear[PixelCount - 1];
+
+    const std::int64_t batch = measure([&]() {
+        Batch::srgbToLinear(Corrade::Containers::ArrayView<const Color4ub>{_srgb.data(), PixelCount}, Corrade::Containers::ArrayView<Color4>{_linear.data(), PixelCount});
+    });
+
+    CORRADE_COMPARE(_linear[PixelCount - 1], expected);
+    Corrade::Utility::Debug() << "4K RGBA8 sRGB to linear, per-pixel:" << perPixel << "us, batch:" << batch << "us";
+}
+
+void SrgbBenchmark::linearToSrgb() {
+    Batch::srgbToLinear(Corrade::Containers::ArrayView<const Color4ub>{_srgb.data(), PixelCount}, Corrade::Containers::ArrayView<Color4>{_linear.data(), PixelCount});
+    std::vector<Color4ub> out(PixelCount);
+
+    const std::int64_t perPixel = measure([&]() {
+        for(std::size_t i = 0; i != PixelCount; ++i)
+            out[i] = _linear[i].toSrgbAlpha<UnsignedByte>();
+    });
+    CORRADE_VERIFY(out == _srgb);
+
+    const std::int64_t batch = measure([&]() {
+        Batch::linearToSrgb(Corrade::Containers::ArrayView<const Color4>{_linear.data(), PixelCount}, Corrade::Containers::ArrayView<Color4ub>{out.data(), PixelCount});
+    });
+
+    CORRADE_VERIFY(out == _srgb);
+    Corrade::Utility::Debug() << "4K RGBA8 linear to sRGB, per-pixel:" << perPixel << "us, batch:" << batch << "us";
+}
+
+}}}
+
+CORRADE_TEST_MAIN(Magnum::Math::Test::SrgbBenchmark)
@@ -0,0 +1,857 @@
+#ifndef Magnum_Math_simdImplementation_h
+#define Magnum_Math_simdImplementation_h
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+
+#include "Magnum/Types.h"
+
+/* Pick the instruction set. SSE2 is baseline on all x86-64 targets, NEON
+   needs to be explicitly enabled on 32-bit ARM. If nothing usable is found,
+   MAGNUM_MATH_SIMD is not defined and the generic implementation is used
+   everywhere. */
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#define MAGNUM_MATH_SIMD
+#define MAGNUM_MATH_SIMD_SSE2
+#include <emmintrin.h>
+#ifdef __AVX__
+#define MAGNUM_MATH_SIMD_AVX
+#include <immintrin.h>
+#endif
+#ifdef __AVX2__
+#define MAGNUM_MATH_SIMD_AVX2
+#endif
+#ifdef __F16C__
+#define MAGNUM_MATH_SIMD_F16C
+#include <immintrin.h>
+#endif
+#elif defined(__ARM_NEON) || defined(__ARM_NEON__)
+#define MAGNUM_MATH_SIMD
+#define MAGNUM_MATH_SIMD_NEON
+#include <arm_neon.h>
+#endif
+
+/* Half-float conversion instructions. F16C is not implied by SSE2 or AVX and
+   has to be enabled explicitly (e.g. with -mf16c or -march=native), on ARM
+   only the 64-bit NEON has them unconditionally. */
+#if defined(MAGNUM_MATH_SIMD_F16C) || (defined(MAGNUM_MATH_SIMD_NEON) && defined(__aarch64__))
+#define MAGNUM_MATH_SIMD_HALF
+#endif
+
+#ifdef MAGNUM_MATH_SIMD
+namespace Magnum { namespace Math { namespace Implementation { namespace Simd {
+
+/*
+    Thin wrapper over four-component float registers. All kernels below are
+    written against it so they are shared between SSE2 and NEON. Loads and
+    stores are unaligned, as Math types have no alignment requirements.
+
+    shuffle<a, b, c, d>(x, y) returns {x[a], x[b], y[c], y[d]}, which is the
+    semantics of SSE shufps. select(mask, a, b) picks from a where the
+    comparison mask is set and from b elsewhere.
+*/
+
+#ifdef MAGNUM_MATH_SIMD_SSE2
+typedef __m128 Float4;
+
+inline Float4 load(const Float* data) { return _mm_loadu_ps(data); }
+inline void store(Float* data, Float4 a) { _mm_storeu_ps(data, a); }
+inline Float4 zero() { return _mm_setzero_ps(); }
+inline Float4 set(Float a, Float b, Float c, Float d) { return _mm_setr_ps(a, b, c, d); }
+inline Float4 add(Float4 a, Float4 b) { return _mm_add_ps(a, b); }
+inline Float4 sub(Float4 a, Float4 b) { return _mm_sub_ps(a, b); }
+inline Float4 mul(Float4 a, Float4 b) { return _mm_mul_ps(a, b); }
+inline Float4 div(Float4 a, Float4 b) { return _mm_div_ps(a, b); }
+inline Float4 sqrt(Float4 a) { return _mm_sqrt_ps(a); }
+inline Float4 min(Float4 a, Float4 b) { return _mm_min_ps(a, b); }
+inline Float4 max(Float4 a, Float4 b) { return _mm_max_ps(a, b); }
+template<std::size_t a, std::size_t b, std::size_t c, std::size_t d> inline Float4 shuffle(Float4 x, Float4 y) {
+    return _mm_shuffle_ps(x, y, _MM_SHUFFLE(d, c, b, a));
+}
+template<std::size_t i> inline Float4 splat(Float4 a) { return shuffle<i, i, i, i>(a, a); }
+
+typedef __m128 Mask4;
+inline Mask4 lessThan(Float4 a, Float4 b) { return _mm_cmplt_ps(a, b); }
+inline Mask4 greaterThan(Float4 a, Float4 b) { return _mm_cmpgt_ps(a, b); }
+inline Float4 select(Mask4 mask, Float4 a, Float4 b) { return _mm_or_ps(_mm_and_ps(mask, a), _mm_andnot_ps(mask, b)); }
+#elif defined(MAGNUM_MATH_SIMD_NEON)
+typedef float32x4_t Float4;
+
+inline Float4 load(const Float* data) { return vld1q_f32(data); }
+inline void store(Float* data, Float4 a) { vst1q_f32(data, a); }
+inline Float4 zero() { return vdupq_n_f32(0.0f); }
+inline Float4 set(Float a, Float b, Float c, Float d) {
+    const Float data[]{a, b, c, d};
+    return vld1q_f32(data);
+}
+inline Float4 add(Float4 a, Float4 b) { return vaddq_f32(a, b); }
+inline Float4 sub(Float4 a, Float4 b) { return vsubq_f32(a, b); }
+inline Float4 mul(Float4 a, Float4 b) { return vmulq_f32(a, b); }
+inline Float4 min(Float4 a, Float4 b) { return vminq_f32(a, b); }
+inline Float4 max(Float4 a, Float4 b) { return vmaxq_f32(a, b); }
+#ifdef __aarch64__
+inline Float4 div(Float4 a, Float4 b) { return vdivq_f32(a, b); }
+inline Float4 sqrt(Float4 a) { return vsqrtq_f32(a); }
+#else
+/* ARMv7 NEON has only reciprocal estimates, which are not precise enough */
+inline Float4 div(Float4 a, Float4 b) {
+    Float x[4], y[4];
+    vst1q_f32(x, a);
+    vst1q_f32(y, b);
+    for(std::size_t i = 0; i != 4; ++i) x[i] /= y[i];
+    return vld1q_f32(x);
+}
+inline Float4 sqrt(Float4 a) {
+    Float x[4];
+    vst1q_f32(x, a);
+    for(std::size_t i = 0; i != 4; ++i) x[i] = std::sqrt(x[i]);
+    return vld1q_f32(x);
+}
+#endif
+template<std::size_t a, std::size_t b, std::size_t c, std::size_t d> inline Float4 shuffle(Float4 x, Float4 y) {
+    Float4 out = vdupq_n_f32(vgetq_lane_f32(x, a));
+    out = vsetq_lane_f32(vgetq_lane_f32(x, b), out, 1);
+    out = vsetq_lane_f32(vgetq_lane_f32(y, c), out, 2);
+    return vsetq_lane_f32(vgetq_lane_f32(y, d), out, 3);
+}
+template<std::size_t i> inline Float4 splat(Float4 a) { return vdupq_n_f32(vgetq_lane_f32(a, i)); }
+
+typedef uint32x4_t Mask4;
+inline Mask4 lessThan(Float4 a, Float4 b) { return vcltq_f32(a, b); }
+inline Mask4 greaterThan(Float4 a, Float4 b) { return vcgtq_f32(a, b); }
+inline Float4 select(Mask4 mask, Float4 a, Float4 b) { return vbslq_f32(mask, a, b); }
+#endif
+
+/* Column-major 4x4 matrix times four-component vector. The products are
+   accumulated in the same order as in the generic RectangularMatrix
+   implementation (including the initial zero) so the result is
+   bit-identical. */
+inline void multiplyMatrixVector(const Float* a, const Float* b, Float* out) {
+    /* The vector is usually assembled from scalars right before the call
+       (e.g. in Matrix4::transformPoint()), broadcasting the components
+       directly avoids a store-forwarding stall on a vector load */
+    Float4 o = zero();
+    o = add(o, mul(load(a +  0), set(b[0], b[0], b[0], b[0])));
+    o = add(o, mul(load(a +  4), set(b[1], b[1], b[1], b[1])));
+    o = add(o, mul(load(a +  8), set(b[2], b[2], b[2], b[2])));
+    o = add(o, mul(load(a + 12), set(b[3], b[3], b[3], b[3])));
+    store(out, o);
+}
+
+/* Column-major 4x4 matrix times 4x4 matrix, same accumulation order as
+   above. Safe to be called with the output aliasing the second operand.
+   With AVX two result columns are calculated at once. */
+inline void multiplyMatrix(const Float* a, const Float* b, Float* out) {
+    #ifdef MAGNUM_MATH_SIMD_AVX
+    const __m256 a0 = _mm256_broadcast_ps(reinterpret_cast<const __m128*>(a +  0));
+    const __m256 a1 = _mm256_broadcast_ps(reinterpret_cast<const __m128*>(a +  4));
+    const __m256 a2 = _mm256_broadcast_ps(reinterpret_cast<const __m128*>(a +  8));
+    const __m256 a3 = _mm256_broadcast_ps(reinterpret_cast<const __m128*>(a + 12));
+    for(std::size_t col = 0; col != 16; col += 8) {
+        const __m256 v = _mm256_loadu_ps(b + col);
+        __m256 o = _mm256_setzero_ps();
+        o = _mm256_add_ps(o, _mm256_mul_ps(a0, _mm256_shuffle_ps(v, v, _MM_SHUFFLE(0, 0, 0, 0))));
+        o = _mm256_add_ps(o, _mm256_mul_ps(a1, _mm256_shuffle_ps(v, v, _MM_SHUFFLE(1, 1, 1, 1))));
+        o = _mm256_add_ps(o, _mm256_mul_ps(a2, _mm256_shuffle_ps(v, v, _MM_SHUFFLE(2, 2, 2, 2))));
+        o = _mm256_add_ps(o, _mm256_mul_ps(a3, _mm256_shuffle_ps(v, v, _MM_SHUFFLE(3, 3, 3, 3))));
+        _mm256_storeu_ps(out + col, o);
+    }
+    #else
+    const Float4 a0 = load(a +  0);
+    const Float4 a1 = load(a +  4);
+    const Float4 a2 = load(a +  8);
+    const Float4 a3 = load(a + 12);
+    for(std::size_t col = 0; col != 16; col += 4) {
+        const Float4 v = load(b + col);
+        Float4 o = zero();
+        o = add(o, mul(a0, splat<0>(v)));
+        o = add(o, mul(a1, splat<1>(v)));
+        o = add(o, mul(a2, splat<2>(v)));
+        o = add(o, mul(a3, splat<3>(v)));
+        store(out + col, o);
+    }
+    #endif
+}
+
+/* Cofactors of rows p and q for the inverse below, lanes are
+   {C(2, 3), C(2, 3), C(1, 3), C(1, 2)} where
+   C(x, y) = m[x][p]*m[y][q] - m[y][p]*m[x][q] */
+template<std::size_t p, std::size_t q> inline Float4 inverseFactor(Float4 c1, Float4 c2, Float4 c3) {
+    const Float4 yq = shuffle<q, q, q, q>(c3, c2);
+    const Float4 yp = shuffle<p, p, p, p>(c3, c2);
+    return sub(mul(shuffle<p, p, p, p>(c2, c1), shuffle<0, 0, 0, 2>(yq, yq)),
+               mul(shuffle<0, 0, 0, 2>(yp, yp), shuffle<q, q, q, q>(c2, c1)));
+}
+
+/* {m[1][r], m[0][r], m[0][r], m[0][r]} */
+template<std::size_t r> inline Float4 inverseRow(Float4 c0, Float4 c1) {
+    const Float4 x = shuffle<r, r, r, r>(c1, c0);
+    return shuffle<0, 2, 2, 2>(x, x);
+}
+
+/* Inverse of column-major 4x4 matrix using cofactor expansion on 2x2
+   subdeterminants. Rounding differs from the generic recursive
+   implementation, but the result is the same within fuzzy compare
+   precision. */
+inline void invertMatrix(const Float* m, Float* out) {
+    const Float4 c0 = load(m +  0);
+    const Float4 c1 = load(m +  4);
+    const Float4 c2 = load(m +  8);
+    const Float4 c3 = load(m + 12);
+
+    const Float4 f0 = inverseFactor<2, 3>(c1, c2, c3);
+    const Float4 f1 = inverseFactor<1, 3>(c1, c2, c3);
+    const Float4 f2 = inverseFactor<1, 2>(c1, c2, c3);
+    const Float4 f3 = inverseFactor<0, 3>(c1, c2, c3);
+    const Float4 f4 = inverseFactor<0, 2>(c1, c2, c3);
+    const Float4 f5 = inverseFactor<0, 1>(c1, c2, c3);
+
+    const Float4 v0 = inverseRow<0>(c0, c1);
+    const Float4 v1 = inverseRow<1>(c0, c1);
+    const Float4 v2 = inverseRow<2>(c0, c1);
+    const Float4 v3 = inverseRow<3>(c0, c1);
+
+    const Float4 signA = set(1.0f, -1.0f, 1.0f, -1.0f);
+    const Float4 signB = set(-1.0f, 1.0f, -1.0f, 1.0f);
+    const Float4 i0 = mul(add(sub(mul(v1, f0), mul(v2, f1)), mul(v3, f2)), signA);
+    const Float4 i1 = mul(add(sub(mul(v0, f0), mul(v2, f3)), mul(v3, f4)), signB);
+    const Float4 i2 = mul(add(sub(mul(v0, f1), mul(v1, f3)), mul(v3, f5)), signA);
+    const Float4 i3 = mul(add(sub(mul(v0, f2), mul(v1, f4)), mul(v2, f5)), signB);
+
+    /* Determinant is dot product of the first column with the first row of
+       the (not yet divided) inverse */
+    Float d[4];
+    store(d, mul(c0, shuffle<0, 2, 0, 2>(shuffle<0, 0, 0, 0>(i0, i1),
+                                         shuffle<0, 0, 0, 0>(i2, i3))));
+    const Float invDeterminant = 1.0f/(d[0] + d[1] + d[2] + d[3]);
+    const Float4 scale = set(invDeterminant, invDeterminant, invDeterminant, invDeterminant);
+
+    store(out +  0, mul(i0, scale));
+    store(out +  4, mul(i1, scale));
+    store(out +  8, mul(i2, scale));
+    store(out + 12, mul(i3, scale));
+}
+
+/* Quaternion product, both operands and output are {x, y, z, w} */
+inline void multiplyQuaternion(const Float* a, const Float* b, Float* out) {
+    const Float4 qa = load(a);
+    const Float4 qb = load(b);
+    Float4 o = mul(splat<3>(qa), qb);
+    o = add(o, mul(splat<0>(qa), mul(shuffle<3, 2, 1, 0>(qb, qb), set( 1.0f, -1.0f,  1.0f, -1.0f))));
+    o = add(o, mul(splat<1>(qa), mul(shuffle<2, 3, 0, 1>(qb, qb), set( 1.0f,  1.0f, -1.0f, -1.0f))));
+    o = add(o, mul(splat<2>(qa), mul(shuffle<1, 0, 3, 2>(qb, qb), set(-1.0f,  1.0f,  1.0f, -1.0f))));
+    store(out, o);
+}
+
+/* Four two-component vectors {x0 y0 x1 y1} {x2 y2 x3 y3} to {x0 x1 x2 x3}
+   {y0 y1 y2 y3} */
+inline void deinterleave2(const Float* data, Float4& x, Float4& y) {
+    const Float4 r0 = load(data + 0);
+    const Float4 r1 = load(data + 4);
+    x = shuffle<0, 2, 0, 2>(r0, r1);
+    y = shuffle<1, 3, 1, 3>(r0, r1);
+}
+
+/* Four three-component vectors {x0 y0 z0 x1} {y1 z1 x2 y2} {z2 x3 y3 z3} to
+   {x0 x1 x2 x3} {y0 y1 y2 y3} {z0 z1 z2 z3} and back */
+inline void deinterleave3(const Float* data, Float4& x, Float4& y, Float4& z) {
+    const Float4 r0 = load(data + 0);
+    const Float4 r1 = load(data + 4);
+    const Float4 r2 = load(data + 8);
+    x = shuffle<0, 3, 0, 2>(r0, shuffle<2, 2, 1, 1>(r1, r2));
+    y = shuffle<0, 2, 0, 2>(shuffle<1, 1, 0, 0>(r0, r1), shuffle<3, 3, 2, 2>(r1, r2));
+    z = shuffle<0, 2, 0, 2>(shuffle<2, 2, 1, 1>(r0, r1), shuffle<0, 0, 3, 3>(r2, r2));
+}
+inline void interleave3(Float* data, Float4 x, Float4 y, Float4 z) {
+    store(data + 0, shuffle<0, 2, 0, 2>(shuffle<0, 0, 0, 0>(x, y), shuffle<0, 0, 1, 1>(z, x)));
+    store(data + 4, shuffle<0, 2, 0, 2>(shuffle<1, 1, 1, 1>(y, z), shuffle<2, 2, 2, 2>(x, y)));
+    store(data + 8, shuffle<0, 2, 0, 2>(shuffle<2, 2, 3, 3>(z, x), shuffle<3, 3, 3, 3>(y, z)));
+}
+
+/* Four four-component vectors to {x0 x1 x2 x3} {y0 y1 y2 y3} ... */
+inline void deinterleave4(const Float* data, Float4& x, Float4& y, Float4& z, Float4& w) {
+    const Float4 xy01 = shuffle<0, 1, 0, 1>(load(data + 0), load(data + 4));
+    const Float4 zw01 = shuffle<2, 3, 2, 3>(load(data + 0), load(data + 4));
+    const Float4 xy23 = shuffle<0, 1, 0, 1>(load(data + 8), load(data + 12));
+    const Float4 zw23 = shuffle<2, 3, 2, 3>(load(data + 8), load(data + 12));
+    x = shuffle<0, 2, 0, 2>(xy01, xy23);
+    y = shuffle<1, 3, 1, 3>(xy01, xy23);
+    z = shuffle<0, 2, 0, 2>(zw01, zw23);
+    w = shuffle<1, 3, 1, 3>(zw01, zw23);
+}
+
+/* Inverse length 1/sqrt(dot), summed in the same order as Math::dot() */
+inline Float4 lengthInverted(Float4 x, Float4 y) {
+    return div(set(1.0f, 1.0f, 1.0f, 1.0f), sqrt(add(mul(x, x), mul(y, y))));
+}
+inline Float4 lengthInverted(Float4 x, Float4 y, Float4 z) {
+    return div(set(1.0f, 1.0f, 1.0f, 1.0f), sqrt(add(add(mul(x, x), mul(y, y)), mul(z, z))));
+}
+inline Float4 lengthInverted(Float4 x, Float4 y, Float4 z, Float4 w) {
+    return div(set(1.0f, 1.0f, 1.0f, 1.0f), sqrt(add(add(add(mul(x, x), mul(y, y)), mul(z, z)), mul(w, w))));
+}
+
+/* Batch vector normalization, bit-identical to Vector::normalized(). The
+   functions process vectors in groups of four and return count of processed
+   vectors, the rest is left for the caller. */
+inline std::size_t normalize2(Float* data, const std::size_t count) {
+    std::size_t i = 0;
+    for(; i + 4 <= count; i += 4) {
+        Float* const d = data + i*2;
+        Float4 x, y;
+        deinterleave2(d, x, y);
+        const Float4 inv = lengthInverted(x, y);
+        store(d + 0, mul(load(d + 0), shuffle<0, 0, 1, 1>(inv, inv)));
+        store(d + 4, mul(load(d + 4), shuffle<2, 2, 3, 3>(inv, inv)));
+    }
+    return i;
+}
+inline std::size_t normalize3(Float* data, const std::size_t count) {
+    std::size_t i = 0;
+    for(; i + 4 <= count; i += 4) {
+        Float* const d = data + i*3;
+        Float4 x, y, z;
+        deinterleave3(d, x, y, z);
+        const Float4 inv = lengthInverted(x, y, z);
+        store(d + 0, mul(load(d + 0), shuffle<0, 0, 0, 1>(inv, inv)));
+        store(d + 4, mul(load(d + 4), shuffle<1, 1, 2, 2>(inv, inv)));
+        store(d + 8, mul(load(d + 8), shuffle<2, 3, 3, 3>(inv, inv)));
+    }
+    return i;
+}
+inline std::size_t normalize4(Float* data, const std::size_t count) {
+    std::size_t i = 0;
+    for(; i + 4 <= count; i += 4) {
+        Float* const d = data + i*4;
+        Float4 x, y, z, w;
+        deinterleave4(d, x, y, z, w);
+        const Float4 inv = lengthInverted(x, y, z, w);
+        store(d +  0, mul(load(d +  0), splat<0>(inv)));
+        store(d +  4, mul(load(d +  4), splat<1>(inv)));
+        store(d +  8, mul(load(d +  8), splat<2>(inv)));
+        store(d + 12, mul(load(d + 12), splat<3>(inv)));
+    }
+    return i;
+}
+
+/* Batch transformation of three-component vectors with column-major 4x4
+   matrix, w is 1 for points and 0 for vectors. Bit-identical to
+   Matrix4::transformPoint() and Matrix4::transformVector(), returns count of
+   processed vectors. */
+inline std::size_t transform3(const Float* m, const Float w, Float* data, const std::size_t count) {
+    const Float4 c0 = load(m +  0);
+    const Float4 c1 = load(m +  4);
+    const Float4 c2 = load(m +  8);
+    const Float4 c3 = mul(load(m + 12), set(w, w, w, w));
+
+    std::size_t i = 0;
+    for(; i + 4 <= count; i += 4) {
+        Float* const d = data + i*3;
+        Float4 x, y, z;
+        deinterleave3(d, x, y, z);
+        interleave3(d,
+            add(add(add(add(zero(), mul(splat<0>(c0), x)), mul(splat<0>(c1), y)), mul(splat<0>(c2), z)), splat<0>(c3)),
+            add(add(add(add(zero(), mul(splat<1>(c0), x)), mul(splat<1>(c1), y)), mul(splat<1>(c2), z)), splat<1>(c3)),
+            add(add(add(add(zero(), mul(splat<2>(c0), x)), mul(splat<2>(c1), y)), mul(splat<2>(c2), z)), splat<2>(c3)));
+    }
+    return i;
+}
+
+/* Batch component-wise minimum and maximum of two-, three- or
+   four-component vectors. The @p min and @p max arrays are expected to be
+   already initialized, returns count of processed vectors. */
+template<std::size_t size> std::size_t minmax(const Float* data, const std::size_t count, Float* min, Float* max) {
+    /* Count of registers that contain a whole number of vectors and count
+       of vectors in them. Two such groups for three-component vectors and
+       four single registers otherwise are processed in parallel so the loop
+       isn't bound by latency of the min/max instructions. */
+    enum: std::size_t {
+        Registers = size == 3 ? 6 : 4,
+        Step = Registers*4/size
+    };
+
+    if(count < Step) return 0;
+
+    Float4 lo[Registers], hi[Registers];
+    for(std::size_t r = 0; r != Registers; ++r)
+        lo[r] = hi[r] = load(data + r*4);
+
+    std::size_t i = Step;
+    for(; i + Step <= count; i += Step) {
+        for(std::size_t r = 0; r != Registers; ++r) {
+            const Float4 v = load(data + i*size + r*4);
+            lo[r] = Simd::min(lo[r], v);
+            hi[r] = Simd::max(hi[r], v);
+        }
+    }
+
+    Float l[Registers*4], h[Registers*4];
+    for(std::size_t r = 0; r != Registers; ++r) {
+        store(l + r*4, lo[r]);
+        store(h + r*4, hi[r]);
+    }
+    for(std::size_t j = 0; j != Registers*4; ++j) {
+        if(l[j] < min[j % size]) min[j % size] = l[j];
+        if(h[j] > max[j % size]) max[j % size] = h[j];
+    }
+
+    return i;
+}
+
+/* Minimum of per-item values computed from two arrays of two- or
+   three-component vectors, used for batch distance queries. The distance
+   function gets components of four items from both arrays. Updates @p min
+   and @p index if a value smaller than @p min is found, on ties the lowest
+   index wins. Item indices are tracked as floats per block of four, so the
+   array is processed in chunks to keep them exact. Returns count of
+   processed items. */
+template<std::size_t size, class F> std::size_t minimum(const Float* a, const Float* b, const std::size_t count, Float& min, std::size_t& index, F distance) {
+    enum: std::size_t { MaxChunkSize = std::size_t(4) << 24 };
+
+    std::size_t i = 0;
+    while(i + 4 <= count) {
+        const std::size_t chunkBegin = i;
+        const std::size_t chunkEnd = chunkBegin + std::min((count - i)/4*4, std::size_t(MaxChunkSize));
+        Float4 best = set(min, min, min, min);
+        Float4 bestBlock = set(-1.0f, -1.0f, -1.0f, -1.0f);
+        Float4 block = zero();
+        for(; i != chunkEnd; i += 4) {
+            Float4 ax, ay, az, bx, by, bz;
+            if(size == 2) {
+                deinterleave2(a + i*2, ax, ay);
+                deinterleave2(b + i*2, bx, by);
+                az = bz = zero();
+            } else {
+                deinterleave3(a + i*3, ax, ay, az);
+                deinterleave3(b + i*3, bx, by, bz);
+            }
+
+            const Float4 d = distance(ax, ay, az, bx, by, bz);
+            const Mask4 less = lessThan(d, best);
+            best = select(less, d, best);
+            bestBlock = select(less, block, bestBlock);
+            block = add(block, set(1.0f, 1.0f, 1.0f, 1.0f));
+        }
+
+        Float values[4], blocks[4];
+        store(values, best);
+        store(blocks, bestBlock);
+        for(std::size_t lane = 0; lane != 4; ++lane) {
+            if(blocks[lane] < 0.0f) continue;
+            const std::size_t candidate = chunkBegin + std::size_t(blocks[lane])*4 + lane;
+            if(values[lane] < min || (values[lane] == min && candidate < index)) {
+                min = values[lane];
+                index = candidate;
+            }
+        }
+    }
+
+    return i;
+}
+
+/* Squared distance of a point from lines and line segments, calculated the
+   same way as in Math::Geometry::Distance */
+inline std::size_t linePointSquared2(const Float* a, const Float* b, const Float* point, const std::size_t count, Float& min, std::size_t& index) {
+    const Float4 px = set(point[0], point[0], point[0], point[0]);
+    const Float4 py = set(point[1], point[1], point[1], point[1]);
+    return minimum<2>(a, b, count, min, index, [&](Float4 ax, Float4 ay, Float4, Float4 bx, Float4 by, Float4) {
+        const Float4 bax = sub(bx, ax), bay = sub(by, ay);
+        const Float4 c = sub(mul(bax, sub(ay, py)), mul(bay, sub(ax, px)));
+        return div(mul(c, c), add(mul(bax, bax), mul(bay, bay)));
+    });
+}
+inline std::size_t linePointSquared3(const Float* a, const Float* b, const Float* point, const std::size_t count, Float& min, std::size_t& index) {
+    const Float4 px = set(point[0], point[0], point[0], point[0]);
+    const Float4 py = set(point[1], point[1], point[1], point[1]);
+    const Float4 pz = set(point[2], point[2], point[2], point[2]);
+    return minimum<3>(a, b, count, min, index, [&](Float4 ax, Float4 ay, Float4 az, Float4 bx, Float4 by, Float4 bz) {
+        const Float4 pax = sub(px, ax), pay = sub(py, ay), paz = sub(pz, az);
+        const Float4 pbx = sub(px, bx), pby = sub(py, by), pbz = sub(pz, bz);
+        const Float4 cx = sub(mul(pay, pbz), mul(paz, pby));
+        const Float4 cy = sub(mul(paz, pbx), mul(pax, pbz));
+        const Float4 cz = sub(mul(pax, pby), mul(pay, pbx));
+        const Float4 bax = sub(bx, ax), bay = sub(by, ay), baz = sub(bz, az);
+        return div(add(add(mul(cx, cx), mul(cy, cy)), mul(cz, cz)),
+                   add(add(mul(bax, bax), mul(bay, bay)), mul(baz, baz)));
+    });
+}
+inline std::size_t lineSegmentPointSquared2(const Float* a, const Float* b, const Float* point, const std::size_t count, Float& min, std::size_t& index) {
+    const Float4 px = set(point[0], point[0], point[0], point[0]);
+    const Float4 py = set(point[1], point[1], point[1], point[1]);
+    return minimum<2>(a, b, count, min, index, [&](Float4 ax, Float4 ay, Float4, Float4 bx, Float4 by, Float4) {
+        const Float4 pax = sub(px, ax), pay = sub(py, ay);
+        const Float4 pbx = sub(px, bx), pby = sub(py, by);
+        const Float4 bax = sub(bx, ax), bay = sub(by, ay);
+        const Float4 pointDistanceA = add(mul(pax, pax), mul(pay, pay));
+        const Float4 pointDistanceB = add(mul(pbx, pbx), mul(pby, pby));
+        const Float4 bDistanceA = add(mul(bax, bax), mul(bay, bay));
+        const Float4 c = sub(mul(bax, sub(ay, py)), mul(bay, sub(ax, px)));
+        return select(greaterThan(pointDistanceB, add(bDistanceA, pointDistanceA)), pointDistanceA,
+               select(greaterThan(pointDistanceA, add(bDistanceA, pointDistanceB)), pointDistanceB,
+               div(mul(c, c), bDistanceA)));
+    });
+}
+inline std::size_t lineSegmentPointSquared3(const Float* a, const Float* b, const Float* point, const std::size_t count, Float& min, std::size_t& index) {
+    const Float4 px = set(point[0], point[0], point[0], point[0]);
+    const Float4 py = set(point[1], point[1], point[1], point[1]);
+    const Float4 pz = set(point[2], point[2], point[2], point[2]);
+    return minimum<3>(a, b, count, min, index, [&](Float4 ax, Float4 ay, Float4 az, Float4 bx, Float4 by, Float4 bz) {
+        const Float4 pax = sub(px, ax), pay = sub(py, ay), paz = sub(pz, az);
+        const Float4 pbx = sub(px, bx), pby = sub(py, by), pbz = sub(pz, bz);
+        const Float4 bax = sub(bx, ax), bay = sub(by, ay), baz = sub(bz, az);
+        const Float4 pointDistanceA = add(add(mul(pax, pax), mul(pay, pay)), mul(paz, paz));
+        const Float4 pointDistanceB = add(add(mul(pbx, pbx), mul(pby, pby)), mul(pbz, pbz));
+        const Float4 bDistanceA = add(add(mul(bax, bax), mul(bay, bay)), mul(baz, baz));
+        const Float4 cx = sub(mul(pay, pbz), mul(paz, pby));
+        const Float4 cy = sub(mul(paz, pbx), mul(pax, pbz));
+        const Float4 cz = sub(mul(pax, pby), mul(pay, pbx));
+        return select(greaterThan(pointDistanceB, add(bDistanceA, pointDistanceA)), pointDistanceA,
+               select(greaterThan(pointDistanceA, add(bDistanceA, pointDistanceB)), pointDistanceB,
+               div(add(add(mul(cx, cx), mul(cy, cy)), mul(cz, cz)), bDistanceA)));
+    });
+}
+
+/* Intersections of a line with many planes, calculated the same way as in
+   Math::Geometry::Intersection::planeLine(). Returns count of processed
+   planes. */
+inline std::size_t planeLine(const Float* planePositions, const Float* planeNormals, const Float* p, const Float* r, Float* out, const std::size_t count) {
+    const Float4 px = set(p[0], p[0], p[0], p[0]);
+    const Float4 py = set(p[1], p[1], p[1], p[1]);
+    const Float4 pz = set(p[2], p[2], p[2], p[2]);
+    const Float4 rx = set(r[0], r[0], r[0], r[0]);
+    const Float4 ry = set(r[1], r[1], r[1], r[1]);
+    const Float4 rz = set(r[2], r[2], r[2], r[2]);
+    std::size_t i = 0;
+    for(; i + 4 <= count; i += 4) {
+        Float4 x, y, z, nx, ny, nz;
+        deinterleave3(planePositions + i*3, x, y, z);
+        deinterleave3(planeNormals + i*3, nx, ny, nz);
+        const Float4 f = add(add(mul(x, nx), mul(y, ny)), mul(z, nz));
+        const Float4 np = add(add(mul(nx, px), mul(ny, py)), mul(nz, pz));
+        const Float4 nr = add(add(mul(nx, rx), mul(ny, ry)), mul(nz, rz));
+        store(out + i, div(sub(f, np), nr));
+    }
+    return i;
+}
+
+/* In-place transpose of four registers */
+inline void transpose(Float4& a, Float4& b, Float4& c, Float4& d) {
+    const Float4 ab0 = shuffle<0, 1, 0, 1>(a, b);
+    const Float4 ab1 = shuffle<2, 3, 2, 3>(a, b);
+    const Float4 cd0 = shuffle<0, 1, 0, 1>(c, d);
+    const Float4 cd1 = shuffle<2, 3, 2, 3>(c, d);
+    a = shuffle<0, 2, 0, 2>(ab0, cd0);
+    b = shuffle<1, 3, 1, 3>(ab0, cd0);
+    c = shuffle<0, 2, 0, 2>(ab1, cd1);
+    d = shuffle<1, 3, 1, 3>(ab1, cd1);
+}
+
+/* Four 3x3 matrices to nine registers {a0 b0 c0 d0} {a1 b1 c1 d1} ... and
+   back, the ninth component is gathered with scalar loads and stores */
+inline void deinterleave9(const Float* data, Float4* out) {
+    for(std::size_t i = 0; i != 4; ++i) {
+        out[i] = load(data + 9*i);
+        out[4 + i] = load(data + 9*i + 4);
+    }
+    transpose(out[0], out[1], out[2], out[3]);
+    transpose(out[4], out[5], out[6], out[7]);
+    out[8] = set(data[8], data[17], data[26], data[35]);
+}
+inline void interleave9(Float* data, const Float4* in) {
+    Float4 lo[4]{in[0], in[1], in[2], in[3]};
+    Float4 hi[4]{in[4], in[5], in[6], in[7]};
+    transpose(lo[0], lo[1], lo[2], lo[3]);
+    transpose(hi[0], hi[1], hi[2], hi[3]);
+    Float last[4];
+    store(last, in[8]);
+    for(std::size_t i = 0; i != 4; ++i) {
+        store(data + 9*i, lo[i]);
+        store(data + 9*i + 4, hi[i]);
+        data[9*i + 8] = last[i];
+    }
+}
+
+/* Jacobi rotation, Givens rotation and conditional column swap of four 3x3
+   matrices at once, doing the same operations as the scalar variants in
+   Math/Algorithms/Svd3x3.h. Matrices are in the deinterleaved layout from
+   above, vp and vq point to the first component of a column. */
+inline void jacobiRotate3x3(Float4& pp, Float4& qq, Float4& pq, Float4& rp, Float4& rq, Float4* vp, Float4* vq) {
+    const Float4 d = sub(qq, pp);
+    const Float4 o = select(lessThan(d, zero()), sub(zero(), add(pq, pq)), add(pq, pq));
+    const Float4 h = sqrt(add(mul(d, d), mul(o, o)));
+    const Float4 g = add(max(d, sub(zero(), d)), h);
+    const Float4 n = sqrt(mul(mul(set(2.0f, 2.0f, 2.0f, 2.0f), h), g));
+    const Mask4 nonzero = greaterThan(n, set(1.175494351e-38f, 1.175494351e-38f, 1.175494351e-38f, 1.175494351e-38f));
+    const Float4 t = select(nonzero, div(o, g), zero());
+    const Float4 nInverted = div(set(1.0f, 1.0f, 1.0f, 1.0f), n);
+    const Float4 c = select(nonzero, mul(g, nInverted), set(1.0f, 1.0f, 1.0f, 1.0f));
+    const Float4 s = select(nonzero, mul(o, nInverted), zero());
+
+    pp = sub(pp, mul(t, pq));
+    qq = add(qq, mul(t, pq));
+    pq = zero();
+    const Float4 p = rp;
+    rp = sub(mul(c, p), mul(s, rq));
+    rq = add(mul(s, p), mul(c, rq));
+    for(std::size_t i = 0; i != 3; ++i) {
+        const Float4 v = vp[i];
+        vp[i] = sub(mul(c, v), mul(s, vq[i]));
+        vq[i] = add(mul(s, v), mul(c, vq[i]));
+    }
+}
+inline void jacobi3x3(Float4& s00, Float4& s11, Float4& s22, Float4& s01, Float4& s02, Float4& s12, Float4* v, const std::size_t sweeps) {
+    const Float4 one = set(1.0f, 1.0f, 1.0f, 1.0f);
+    for(std::size_t i = 0; i != 9; ++i) v[i] = i % 4 ? zero() : one;
+    for(std::size_t i = 0; i != sweeps; ++i) {
+        jacobiRotate3x3(s00, s11, s01, s02, s12, v + 0, v + 3);
+        jacobiRotate3x3(s00, s22, s02, s01, s12, v + 0, v + 6);
+        jacobiRotate3x3(s11, s22, s12, s01, s02, v + 3, v + 6);
+    }
+}
+inline void givensRotate3x3(Float4* b, Float4* q, const std::size_t col, const std::size_t p, const std::size_t r) {
+    const Float4 x = b[3*col + p];
+    const Float4 y = b[3*col + r];
+    const Float4 rho = sqrt(add(mul(x, x), mul(y, y)));
+    const Mask4 nonzero = greaterThan(rho, set(1.175494351e-38f, 1.175494351e-38f, 1.175494351e-38f, 1.175494351e-38f));
+    const Float4 c = select(nonzero, div(x, rho), set(1.0f, 1.0f, 1.0f, 1.0f));
+    const Float4 s = select(nonzero, div(y, rho), zero());
+
+    for(std::size_t i = 0; i != 3; ++i) {
+        const Float4 bp = b[3*i + p];
+        b[3*i + p] = add(mul(c, bp), mul(s, b[3*i + r]));
+        b[3*i + r] = sub(mul(c, b[3*i + r]), mul(s, bp));
+    }
+    for(std::size_t i = 0; i != 3; ++i) {
+        const Float4 qp = q[3*p + i];
+        q[3*p + i] = add(mul(c, qp), mul(s, q[3*r + i]));
+        q[3*r + i] = sub(mul(c, q[3*r + i]), mul(s, qp));
+    }
+}
+inline void swapColumns3x3(const Mask4 mask, Float4* a, const std::size_t i, const std::size_t j) {
+    for(std::size_t k = 0; k != 3; ++k) {
+        const Float4 ai = a[3*i + k];
+        a[3*i + k] = select(mask, a[3*j + k], ai);
+        a[3*j + k] = select(mask, ai, a[3*j + k]);
+    }
+}
+inline void sortColumns3x3(Float4* values, Float4* a, Float4* b, const std::size_t i, const std::size_t j) {
+    const Mask4 mask = greaterThan(values[j], values[i]);
+    const Float4 vi = values[i];
+    values[i] = select(mask, values[j], vi);
+    values[j] = select(mask, vi, values[j]);
+    swapColumns3x3(mask, a, i, j);
+    if(b) swapColumns3x3(mask, b, i, j);
+}
+
+/* Eigen decomposition of symmetric 3x3 matrices and SVD of 3x3 matrices,
+   four at a time. Return count of processed matrices. */
+inline std::size_t symmetricEigen3x3(const Float* matrices, Float* eigenvalues, Float* eigenvectors, const std::size_t count, const std::size_t sweeps) {
+    std::size_t i = 0;
+    for(; i + 4 <= count; i += 4) {
+        Float4 m[9];
+        deinterleave9(matrices + 9*i, m);
+        Float4 v[9];
+        jacobi3x3(m[0], m[4], m[8], m[3], m[6], m[7], v, sweeps);
+
+        Float4 values[3]{m[0], m[4], m[8]};
+        sortColumns3x3(values, v, nullptr, 0, 1);
+        sortColumns3x3(values, v, nullptr, 0, 2);
+        sortColumns3x3(values, v, nullptr, 1, 2);
+        interleave3(eigenvalues + 3*i, values[0], values[1], values[2]);
+        interleave9(eigenvectors + 9*i, v);
+    }
+    return i;
+}
+
+inline std::size_t svd3x3(const Float* matrices, Float* u, Float* w, Float* v, const std::size_t count, const std::size_t sweeps) {
+    std::size_t i = 0;
+    for(; i + 4 <= count; i += 4) {
+        Float4 m[9];
+        deinterleave9(matrices + 9*i, m);
+
+        /* Dot products of columns, summed in the same order as Math::dot() */
+        Float4 s[6];
+        const std::size_t columns[][2]{{0, 0}, {1, 1}, {2, 2}, {0, 1}, {0, 2}, {1, 2}};
+        for(std::size_t j = 0; j != 6; ++j) {
+            const Float4* a = m + 3*columns[j][0];
+            const Float4* b = m + 3*columns[j][1];
+            s[j] = add(add(mul(a[0], b[0]), mul(a[1], b[1])), mul(a[2], b[2]));
+        }
+        Float4 vv[9];
+        jacobi3x3(s[0], s[1], s[2], s[3], s[4], s[5], vv, sweeps);
+
+        /* B = MV, summed in the same order as matrix multiplication */
+        Float4 b[9];
+        for(std::size_t col = 0; col != 3; ++col) for(std::size_t row = 0; row != 3; ++row)
+            b[3*col + row] = add(add(add(zero(), mul(m[row], vv[3*col])), mul(m[3 + row], vv[3*col + 1])), mul(m[6 + row], vv[3*col + 2]));
+
+        Float4 lengths[3];
+        for(std::size_t col = 0; col != 3; ++col)
+            lengths[col] = add(add(mul(b[3*col], b[3*col]), mul(b[3*col + 1], b[3*col + 1])), mul(b[3*col + 2], b[3*col + 2]));
+        sortColumns3x3(lengths, b, vv, 0, 1);
+        sortColumns3x3(lengths, b, vv, 0, 2);
+        sortColumns3x3(lengths, b, vv, 1, 2);
+
+        Float4 uu[9];
+        const Float4 one = set(1.0f, 1.0f, 1.0f, 1.0f);
+        for(std::size_t j = 0; j != 9; ++j) uu[j] = j % 4 ? zero() : one;
+        givensRotate3x3(b, uu, 0, 0, 1);
+        givensRotate3x3(b, uu, 0, 0, 2);
+        givensRotate3x3(b, uu, 1, 1, 2);
+        const Mask4 negative = lessThan(b[8], zero());
+        for(std::size_t j = 6; j != 9; ++j)
+            uu[j] = select(negative, sub(zero(), uu[j]), uu[j]);
+
+        interleave9(u + 9*i, uu);
+        interleave3(w + 3*i, b[0], b[4], max(b[8], sub(zero(), b[8])));
+        interleave9(v + 9*i, vv);
+    }
+    return i;
+}
+
+#ifdef MAGNUM_MATH_SIMD_SSE2
+/* Fast approximations of sine, cosine and arc cosine, doing the same
+   operations in the same order as Math::Fast::sincos() and Math::Fast::acos().
+   Inverse square root uses the hardware estimate refined with one Newton
+   iteration instead. Return count of processed values. */
+inline std::size_t fastSincos(const Float* in, Float* sines, Float* cosines, const std::size_t count) {
+    const __m128 signMask = _mm_set1_ps(-0.0f);
+    const __m128 half = _mm_set1_ps(0.5f);
+    const __m128i one = _mm_set1_epi32(1);
+    const __m128i two = _mm_set1_epi32(2);
+    std::size_t i = 0;
+    for(; i + 4 <= count; i += 4) {
+        const __m128 x = _mm_loadu_ps(in + i);
+
+        /* Quadrant index, rounded half away from zero */
+        const __m128 scaled = _mm_mul_ps(x, _mm_set1_ps(0.636619772367581343f));
+        const __m128i q = _mm_cvttps_epi32(_mm_add_ps(scaled, _mm_or_ps(_mm_and_ps(scaled, signMask), half)));
+        const __m128 qf = _mm_cvtepi32_ps(q);
+        const __m128 r = _mm_sub_ps(_mm_sub_ps(_mm_sub_ps(x,
+            _mm_mul_ps(qf, _mm_set1_ps(1.5703125f))),
+            _mm_mul_ps(qf, _mm_set1_ps(4.837512969970703125e-4f))),
+            _mm_mul_ps(qf, _mm_set1_ps(7.54978995489188216e-8f)));
+        const __m128 r2 = _mm_mul_ps(r, r);
+
+        const __m128 s = _mm_add_ps(r, _mm_mul_ps(_mm_mul_ps(r, r2),
+            _mm_add_ps(_mm_set1_ps(-1.6666654611e-1f), _mm_mul_ps(r2,
+            _mm_add_ps(_mm_set1_ps(8.3321608736e-3f), _mm_mul_ps(r2, _mm_set1_ps(-1.9515295891e-4f)))))));
+        const __m128 c = _mm_add_ps(_mm_sub_ps(_mm_set1_ps(1.0f), _mm_mul_ps(half, r2)), _mm_mul_ps(_mm_mul_ps(r2, r2),
+            _mm_add_ps(_mm_set1_ps(4.166664568298827e-2f), _mm_mul_ps(r2,
+            _mm_add_ps(_mm_set1_ps(-1.388731625493765e-3f), _mm_mul_ps(r2, _mm_set1_ps(2.443315711809948e-5f)))))));
+
+        /* Swap in odd quadrants, flip signs based on bit 1 of the index */
+        const __m128 swap = _mm_castsi128_ps(_mm_cmpeq_epi32(_mm_and_si128(q, one), one));
+        const __m128 sr = _mm_or_ps(_mm_and_ps(swap, c), _mm_andnot_ps(swap, s));
+        const __m128 cr = _mm_or_ps(_mm_and_ps(swap, s), _mm_andnot_ps(swap, c));
+        _mm_storeu_ps(sines + i, _mm_xor_ps(sr, _mm_castsi128_ps(_mm_slli_epi32(_mm_and_si128(q, two), 30))));
+        _mm_storeu_ps(cosines + i, _mm_xor_ps(cr, _mm_castsi128_ps(_mm_slli_epi32(_mm_and_si128(_mm_add_epi32(q, one), two), 30))));
+    }
+    return i;
+}
+
+inline std::size_t fastSqrtInverted(const Float* in, Float* out, const std::size_t count) {
+    const __m128 half = _mm_set1_ps(0.5f);
+    const __m128 threeHalves = _mm_set1_ps(1.5f);
+    std::size_t i = 0;
+    for(; i + 4 <= count; i += 4) {
+        const __m128 x = _mm_loadu_ps(in + i);
+        const __m128 y = _mm_rsqrt_ps(x);
+        _mm_storeu_ps(out + i, _mm_mul_ps(y, _mm_sub_ps(threeHalves, _mm_mul_ps(_mm_mul_ps(_mm_mul_ps(half, x), y), y))));
+    }
+    return i;
+}
+
+inline std::size_t fastAcos(const Float* in, Float* out, const std::size_t count) {
+    const __m128 one = _mm_set1_ps(1.0f);
+    std::size_t i = 0;
+    for(; i + 4 <= count; i += 4) {
+        const __m128 x = _mm_loadu_ps(in + i);
+        const __m128 a = _mm_min_ps(one, _mm_andnot_ps(_mm_set1_ps(-0.0f), x));
+        __m128 t = _mm_add_ps(_mm_set1_ps(0.0066700901f), _mm_mul_ps(a, _mm_set1_ps(-0.0012624911f)));
+        t = _mm_add_ps(_mm_set1_ps(-0.0170881256f), _mm_mul_ps(a, t));
+        t = _mm_add_ps(_mm_set1_ps(0.0308918810f), _mm_mul_ps(a, t));
+        t = _mm_add_ps(_mm_set1_ps(-0.0501743046f), _mm_mul_ps(a, t));
+        t = _mm_add_ps(_mm_set1_ps(0.0889789874f), _mm_mul_ps(a, t));
+        t = _mm_add_ps(_mm_set1_ps(-0.2145988016f), _mm_mul_ps(a, t));
+        t = _mm_add_ps(_mm_set1_ps(1.5707963050f), _mm_mul_ps(a, t));
+        const __m128 p = _mm_mul_ps(_mm_sqrt_ps(_mm_sub_ps(one, a)), t);
+        const __m128 negative = _mm_cmplt_ps(x, _mm_setzero_ps());
+        _mm_storeu_ps(out + i, _mm_or_ps(_mm_and_ps(negative, _mm_sub_ps(_mm_set1_ps(3.141592653589793f), p)), _mm_andnot_ps(negative, p)));
+    }
+    return i;
+}
+#endif
+
+#ifdef MAGNUM_MATH_SIMD_HALF
+/* Batch conversion of floats to half-floats and back, bit-identical to
+   Math::packHalf() and Math::unpackHalf() for all non-NaN values. Returns
+   count of processed values. */
+#ifdef MAGNUM_MATH_SIMD_F16C
+inline std::size_t packHalf(const Float* in, UnsignedShort* out, const std::size_t count) {
+    std::size_t i = 0;
+    #ifdef MAGNUM_MATH_SIMD_AVX
+    for(; i + 8 <= count; i += 8)
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(out + i), _mm256_cvtps_ph(_mm256_loadu_ps(in + i), _MM_FROUND_TO_NEAREST_INT));
+    #endif
+    for(; i + 4 <= count; i += 4)
+        _mm_storel_epi64(reinterpret_cast<__m128i*>(out + i), _mm_cvtps_ph(_mm_loadu_ps(in + i), _MM_FROUND_TO_NEAREST_INT));
+    return i;
+}
+
+inline std::size_t unpackHalf(const UnsignedShort* in, Float* out, const std::size_t count) {
+    std::size_t i = 0;
+    #ifdef MAGNUM_MATH_SIMD_AVX
+    for(; i + 8 <= count; i += 8)
+        _mm256_storeu_ps(out + i, _mm256_cvtph_ps(_mm_loadu_si128(reinterpret_cast<const __m128i*>(in + i))));
+    #endif
+    for(; i + 4 <= count; i += 4)
+        _mm_storeu_ps(out + i, _mm_cvtph_ps(_mm_loadl_epi64(reinterpret_cast<const __m128i*>(in + i))));
+    return i;
+}
+#else
+inline std::size_t packHalf(const Float* in, UnsignedShort* out, const std::size_t count) {
+    std::size_t i = 0;
+    for(; i + 4 <= count; i += 4)
+        vst1_u16(out + i, vreinterpret_u16_f16(vcvt_f16_f32(vld1q_f32(in + i))));
+    return i;
+}
+
+inline std::size_t unpackHalf(const UnsignedShort* in, Float* out, const std::size_t count) {
+    std::size_t i = 0;
+    for(; i + 4 <= count; i += 4)
+        vst1q_f32(out + i, vcvt_f32_f16(vreinterpret_f16_u16(vld1_u16(in + i))));
+    return i;
+}
+#endif
+#endif
+
+}}}}
+#endif
+
+#endif
@@ -31,11 +31,13 @@
 
 #include <limits>
 #include <numeric>
+#include <tuple>
 #include <unordered_map>
 #include <vector>
 #include <Corrade/Utility/MurmurHash2.h>
 
 #include "Magnum/Magnum.h"
+#include "Magnum/Math/Batch.h"
 #include "Magnum/Math/Functions.h"
 
 namespace Magnum { namespace MeshTools {
@@ -94,11 +96,8 @@ std::vector<UnsignedInt> indices = MeshTools::combineIndexedArrays(
 */
 template<class Vector> std::vector<UnsignedInt> removeDuplicates(std::vector<Vector>& data, typename Vector::Type epsilon = Math::TypeTraits<typename Vector::Type>::epsilon()) {
     /* Get bounds */
-    Vector min = data[0], max = data[0];
-    for(const auto& v: data) {
-        min = Math::min(v, min);
-        max = Math::max(v, max);
-    }
+    Vector min, max;
+    std::tie(min, max) = Math::Batch::minmax(Containers::ArrayView<const Vector>{data.data(), data.size()});
 
     /* Make epsilon so large that std::size_t can index all vectors inside the
        bounds. */
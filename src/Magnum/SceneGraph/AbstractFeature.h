@@ -37,6 +37,8 @@
 
 namespace Magnum { namespace SceneGraph {
 
+template<UnsignedInt, class> class AbstractFeatureGroup;
+
 /**
 @brief Which transformation to cache in given feature
 
@@ -159,6 +161,8 @@ template<UnsignedInt dimensions, class T> class AbstractFeature
     friend Containers::LinkedList<AbstractFeature<dimensions, T>>;
     friend Containers::LinkedListItem<AbstractFeature<dimensions, T>, AbstractObject<dimensions, T>>;
     template<class> friend class Object;
+    template<UnsignedInt, class> friend class FlatObject;
+    template<UnsignedInt, class> friend class AbstractFeatureGroup;
 
     public:
         /**
@@ -277,7 +281,12 @@ template<UnsignedInt dimensions, class T> class AbstractFeature
         /*@}*/
 
     private:
+        /* Clean this feature as part of a batch, if the group it belongs to
+           is currently being cleaned. Returns false otherwise. */
+        bool cleanBatched(const MatrixTypeFor<dimensions, T>& absoluteTransformationMatrix);
+
         CachedTransformations _cachedTransformations;
+        AbstractFeatureGroup<dimensions, T>* _batchGroup;
 };
 
 /**
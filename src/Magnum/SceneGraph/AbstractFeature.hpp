@@ -30,10 +30,11 @@
  */
 
 #include "Magnum/SceneGraph/AbstractFeature.h"
+#include "Magnum/SceneGraph/FeatureGroup.h"
 
 namespace Magnum { namespace SceneGraph {
 
-template<UnsignedInt dimensions, class T> AbstractFeature<dimensions, T>::AbstractFeature(AbstractObject<dimensions, T>& object) {
+template<UnsignedInt dimensions, class T> AbstractFeature<dimensions, T>::AbstractFeature(AbstractObject<dimensions, T>& object): _batchGroup{nullptr} {
     object.Containers::template LinkedList<AbstractFeature<dimensions, T>>::insert(this);
 }
 
@@ -45,6 +46,14 @@ template<UnsignedInt dimensions, class T> void AbstractFeature<dimensions, T>::c
 
 template<UnsignedInt dimensions, class T> void AbstractFeature<dimensions, T>::cleanInverted(const MatrixTypeFor<dimensions, T>&) {}
 
+template<UnsignedInt dimensions, class T> bool AbstractFeature<dimensions, T>::cleanBatched(const MatrixTypeFor<dimensions, T>& absoluteTransformationMatrix) {
+    if(!_batchGroup || !_batchGroup->_cleaning) return false;
+
+    _batchGroup->_cleanFeatures.push_back(*this);
+    _batchGroup->_cleanMatrices.push_back(absoluteTransformationMatrix);
+    return true;
+}
+
 }}
 
 #endif
@@ -201,7 +201,23 @@ template<UnsignedInt dimensions, class T> class AbstractObject
          *      when possible.
          */
         std::vector<MatrixType> transformationMatrices(const std::vector<std::reference_wrapper<AbstractObject<dimensions, T>>>& objects, const MatrixType& initialTransformationMatrix = MatrixType()) const {
-            return doTransformationMatrices(objects, initialTransformationMatrix);
+            std::vector<MatrixType> transformationMatrices;
+            doTransformationMatrices(objects, transformationMatrices, initialTransformationMatrix);
+            return transformationMatrices;
+        }
+
+        /**
+         * @brief Transformation matrices of given set of objects relative to this object
+         *
+         * Same as above, but the result is written into
+         * @p transformationMatrices. Memory of the vector is reused, so
+         * repeated calls with the same vector don't allocate.
+         * @warning This function cannot check if all objects are of the same
+         *      @ref Object type, use typesafe @ref Object::transformationMatrices()
+         *      when possible.
+         */
+        void transformationMatrices(const std::vector<std::reference_wrapper<AbstractObject<dimensions, T>>>& objects, std::vector<MatrixType>& transformationMatrices, const MatrixType& initialTransformationMatrix = MatrixType()) const {
+            doTransformationMatrices(objects, transformationMatrices, initialTransformationMatrix);
         }
 
         /*@}*/
@@ -271,7 +287,7 @@ template<UnsignedInt dimensions, class T> class AbstractObject
 
         virtual MatrixType doTransformationMatrix() const = 0;
         virtual MatrixType doAbsoluteTransformationMatrix() const = 0;
-        virtual std::vector<MatrixType> doTransformationMatrices(const std::vector<std::reference_wrapper<AbstractObject<dimensions, T>>>& objects, const MatrixType& initialTransformationMatrix) const = 0;
+        virtual void doTransformationMatrices(const std::vector<std::reference_wrapper<AbstractObject<dimensions, T>>>& objects, std::vector<MatrixType>& transformationMatrices, const MatrixType& initialTransformationMatrix) const = 0;
 
         virtual bool doIsDirty() const = 0;
         virtual void doSetDirty() = 0;
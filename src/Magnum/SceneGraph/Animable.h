@@ -34,6 +34,10 @@
 
 namespace Magnum { namespace SceneGraph {
 
+namespace Implementation {
+    enum: UnsignedInt { AnimableNotRunning = ~UnsignedInt{} };
+}
+
 /**
 @brief Animation state
 
@@ -123,13 +127,20 @@ void MyApplication::drawEvent() {
 }
 @endcode
 
-## Using multiple animable groups to improve performance
+## Performance considerations
 
-@ref AnimableGroup is optimized for case when no animation is running -- it
-just puts itself to rest and waits until some animation changes its state to
-@ref AnimationState::Running again. If you put animations which are not
-pernamently running into separate group, they will not be traversed every time
-the @ref AnimableGroup::step() gets called, saving precious frame time.
+@ref AnimableGroup keeps a dense list of running animations next to the list
+of all group members. State changes done with @ref setState() are only queued
+and applied in the next @ref AnimableGroup::step(), which then traverses just
+the running animations -- stopped and paused animables are not touched at all,
+so a group can contain thousands of mostly sleeping animations without
+affecting frame time. If there is no running animation and no pending state
+change, the step does nothing. Order in which the running animations are
+stepped is unspecified.
+
+If Magnum is compiled with `BUILD_MULTITHREADED` enabled, large amounts of
+running animations can be stepped in parallel, see
+@ref AnimableGroup::setThreadPool() for more information.
 
 ## Explicit template specializations
 
@@ -321,6 +332,11 @@ template<UnsignedInt dimensions, class T> class Animable: public AbstractGrouped
         bool _repeated;
         UnsignedShort _repeatCount;
         UnsignedShort repeats;
+
+        /* Bookkeeping of AnimableGroup running list and state change queue */
+        bool _pending;
+        UnsignedInt _runningIndex;
+        AnimableGroup<dimensions, T>* _listGroup;
 };
 
 /**
@@ -29,16 +29,26 @@
  * @brief @ref compilation-speedup-hpp "Template implementation" for @ref Animable.h and @ref AnimableGroup.h
  */
 
+#include <algorithm>
+
 #include "Magnum/Timeline.h"
 #include "Magnum/Math/Constants.h"
 #include "Magnum/SceneGraph/AnimableGroup.h"
 #include "Magnum/SceneGraph/Animable.h"
 
+#ifdef MAGNUM_BUILD_MULTITHREADED
+#include "Magnum/SceneGraph/ThreadPool.h"
+#endif
+
 namespace Magnum { namespace SceneGraph {
 
-template<UnsignedInt dimensions, class T> Animable<dimensions, T>::Animable(AbstractObject<dimensions, T>& object, AnimableGroup<dimensions, T>* group): AbstractGroupedFeature<dimensions, Animable<dimensions, T>, T>(object, group), _duration(0.0f), startTime(Constants::inf()), pauseTime(-Constants::inf()), previousState(AnimationState::Stopped), currentState(AnimationState::Stopped), _repeated(false), _repeatCount(0), repeats(0) {}
+template<UnsignedInt dimensions, class T> Animable<dimensions, T>::Animable(AbstractObject<dimensions, T>& object, AnimableGroup<dimensions, T>* group): AbstractGroupedFeature<dimensions, Animable<dimensions, T>, T>(object, group), _duration(0.0f), startTime(Constants::inf()), pauseTime(-Constants::inf()), previousState(AnimationState::Stopped), currentState(AnimationState::Stopped), _repeated(false), _repeatCount(0), repeats(0), _pending(false), _runningIndex(Implementation::AnimableNotRunning), _listGroup(nullptr) {}
 
-template<UnsignedInt dimensions, class T> Animable<dimensions, T>::~Animable() {}
+template<UnsignedInt dimensions, class T> Animable<dimensions, T>::~Animable() {
+    /* Remove itself from running list and state change queue, so the group
+       doesn't access deleted animable in next step */
+    if(_listGroup) _listGroup->detach(*this);
+}
 
 template<UnsignedInt dimensions, class T> Animable<dimensions, T>& Animable<dimensions, T>::setState(AnimationState state) {
     if(currentState == state) return *this;
@@ -47,8 +57,10 @@ template<UnsignedInt dimensions, class T> Animable<dimensions, T>& Animable<dime
     if(previousState == AnimationState::Stopped && state == AnimationState::Paused)
         return *this;
 
-    /* Wake up the group in case no animations are running */
-    animables()->wakeUp = true;
+    /* Queue the animable for state change in next step. If the animable is
+       not part of any group, the change is applied after it's added to one. */
+    if(AnimableGroup<dimensions, T>* const group = animables())
+        group->enqueue(*this);
     currentState = state;
     return *this;
 }
@@ -61,52 +73,145 @@ template<UnsignedInt dimensions, class T> const AnimableGroup<dimensions, T>* An
     return static_cast<const AnimableGroup<dimensions, T>*>(AbstractGroupedFeature<dimensions, Animable<dimensions, T>, T>::group());
 }
 
+template<UnsignedInt dimensions, class T> AnimableGroup<dimensions, T>::AnimableGroup() = default;
+
+template<UnsignedInt dimensions, class T> AnimableGroup<dimensions, T>::~AnimableGroup() {
+    /* Animables outliving the group shouldn't try to detach from it */
+    for(Animable<dimensions, T>* animable: _running) {
+        animable->_runningIndex = Implementation::AnimableNotRunning;
+        animable->_listGroup = nullptr;
+    }
+    for(Animable<dimensions, T>* animable: _pending) if(animable) {
+        animable->_pending = false;
+        animable->_listGroup = nullptr;
+    }
+}
+
+template<UnsignedInt dimensions, class T> AnimableGroup<dimensions, T>& AnimableGroup<dimensions, T>::add(Animable<dimensions, T>& animable) {
+    if(animable._listGroup) animable._listGroup->detach(animable);
+    FeatureGroup<dimensions, Animable<dimensions, T>, T>::add(animable);
+
+    /* Running animations or animations with pending state change need to be
+       picked up by next step() */
+    if(animable.previousState != animable.currentState || animable.previousState == AnimationState::Running)
+        enqueue(animable);
+    return *this;
+}
+
+template<UnsignedInt dimensions, class T> AnimableGroup<dimensions, T>& AnimableGroup<dimensions, T>::remove(Animable<dimensions, T>& animable) {
+    if(animable._listGroup == this) detach(animable);
+    FeatureGroup<dimensions, Animable<dimensions, T>, T>::remove(animable);
+    return *this;
+}
+
+template<UnsignedInt dimensions, class T> void AnimableGroup<dimensions, T>::enqueue(Animable<dimensions, T>& animable) {
+    if(animable._listGroup && animable._listGroup != this)
+        animable._listGroup->detach(animable);
+    animable._listGroup = this;
+
+    if(animable._pending) return;
+    animable._pending = true;
+    _pending.push_back(&animable);
+}
+
+template<UnsignedInt dimensions, class T> void AnimableGroup<dimensions, T>::detach(Animable<dimensions, T>& animable) {
+    CORRADE_INTERNAL_ASSERT(animable._listGroup == this);
+
+    removeRunning(animable);
+
+    /* Only clear the slot, the queue might be just processed in step() */
+    if(animable._pending) {
+        auto found = std::find(_pending.begin(), _pending.end(), &animable);
+        CORRADE_INTERNAL_ASSERT(found != _pending.end());
+        *found = nullptr;
+        animable._pending = false;
+    }
+
+    animable._listGroup = nullptr;
+}
+
+template<UnsignedInt dimensions, class T> void AnimableGroup<dimensions, T>::addRunning(Animable<dimensions, T>& animable) {
+    CORRADE_INTERNAL_ASSERT(animable._runningIndex == Implementation::AnimableNotRunning);
+    animable._runningIndex = _running.size();
+    _running.push_back(&animable);
+}
+
+template<UnsignedInt dimensions, class T> void AnimableGroup<dimensions, T>::removeRunning(Animable<dimensions, T>& animable) {
+    /* Not running here, e.g. moved from another group before the step */
+    if(animable._runningIndex == Implementation::AnimableNotRunning) return;
+
+    /* Move the last running animable into its place */
+    Animable<dimensions, T>* const last = _running.back();
+    _running[animable._runningIndex] = last;
+    last->_runningIndex = animable._runningIndex;
+    _running.pop_back();
+    animable._runningIndex = Implementation::AnimableNotRunning;
+}
+
+template<UnsignedInt dimensions, class T> void AnimableGroup<dimensions, T>::release(Animable<dimensions, T>& animable) {
+    if(!animable._pending && animable._runningIndex == Implementation::AnimableNotRunning)
+        animable._listGroup = nullptr;
+}
+
 template<UnsignedInt dimensions, class T> void AnimableGroup<dimensions, T>::step(const Float time, const Float delta) {
-    if(!_runningCount && !wakeUp) return;
-    wakeUp = false;
+    CORRADE_ASSERT(delta >= 0.0f,
+        "SceneGraph::AnimableGroup::step(): negative delta passed", );
+
+    /* Apply state changes queued since last step. The callbacks might change
+       state of other animables, so the queue can grow while iterating. */
+    for(std::size_t i = 0; i != _pending.size(); ++i) {
+        /* Removed from the group in the meantime */
+        if(!_pending[i]) continue;
 
-    for(std::size_t i = 0; i != AnimableGroup<dimensions, T>::size(); ++i) {
-        Animable<dimensions, T>& animable = (*this)[i];
+        Animable<dimensions, T>& animable = *_pending[i];
+        animable._pending = false;
 
-        /* The animation was stopped recently, just decrease count of running
-           animations if the animation was running before */
+        /* The animation was stopped recently, remove it from running list */
         if(animable.previousState != AnimationState::Stopped && animable.currentState == AnimationState::Stopped) {
-            if(animable.previousState == AnimationState::Running)
-                --_runningCount;
+            removeRunning(animable);
             animable.previousState = AnimationState::Stopped;
             animable.animationStopped();
-            continue;
 
         /* The animation was paused recently, set pause time to previous frame time */
         } else if(animable.previousState == AnimationState::Running && animable.currentState == AnimationState::Paused) {
             animable.previousState = AnimationState::Paused;
             animable.pauseTime = time;
-            --_runningCount;
+            removeRunning(animable);
             animable.animationPaused();
-            continue;
-
-        /* Skip the rest for not running animations */
-        } else if(animable.currentState != AnimationState::Running) {
-            CORRADE_INTERNAL_ASSERT(animable.previousState == animable.currentState);
-            continue;
 
         /* The animation was started recently, set start time to previous frame
            time, reset repeat count */
-        } else if(animable.previousState == AnimationState::Stopped) {
+        } else if(animable.previousState == AnimationState::Stopped && animable.currentState == AnimationState::Running) {
             animable.previousState = AnimationState::Running;
             animable.startTime = time;
             animable.repeats = 0;
-            ++_runningCount;
+            addRunning(animable);
             animable.animationStarted();
 
         /* The animation was resumed recently, add pause duration to start time */
-        } else if(animable.previousState == AnimationState::Paused) {
+        } else if(animable.previousState == AnimationState::Paused && animable.currentState == AnimationState::Running) {
             animable.previousState = AnimationState::Running;
             animable.startTime += time - animable.pauseTime;
-            ++_runningCount;
+            addRunning(animable);
             animable.animationResumed();
+
+        /* State was changed back before the step or the animable was moved
+           here from another group while running */
+        } else {
+            CORRADE_INTERNAL_ASSERT(animable.previousState == animable.currentState);
+            if(animable.currentState == AnimationState::Running && animable._runningIndex == Implementation::AnimableNotRunning)
+                addRunning(animable);
         }
 
+        release(animable);
+    }
+    _pending.clear();
+
+    /* Handle duration and repeats of running animations. Stopping an
+       animation moves the last one in its place, so the index is not
+       advanced in that case. */
+    for(std::size_t i = 0; i < _running.size(); ) {
+        Animable<dimensions, T>& animable = *_running[i];
         CORRADE_INTERNAL_ASSERT(animable.previousState == AnimationState::Running);
 
         /* Animation time exceeded duration */
@@ -115,7 +220,8 @@ template<UnsignedInt dimensions, class T> void AnimableGroup<dimensions, T>::ste
             if(!animable._repeated || animable.repeats+1 == animable._repeatCount) {
                 animable.previousState = AnimationState::Stopped;
                 animable.currentState = AnimationState::Stopped;
-                --_runningCount;
+                removeRunning(animable);
+                release(animable);
                 animable.animationStopped();
                 continue;
             }
@@ -125,15 +231,28 @@ template<UnsignedInt dimensions, class T> void AnimableGroup<dimensions, T>::ste
             animable.startTime += animable._duration;
         }
 
-        /* Animation is still running, perform animation step */
         CORRADE_ASSERT(time-animable.startTime >= 0.0f,
             "SceneGraph::AnimableGroup::step(): animation was started in future - probably wrong time passed", );
-        CORRADE_ASSERT(delta >= 0.0f,
-            "SceneGraph::AnimableGroup::step(): negative delta passed", );
-        animable.animationStep(time - animable.startTime, delta);
+        ++i;
+    }
+
+    /* Perform animation step of animations which are still running */
+    const auto stepRunning = [this, time, delta](std::size_t begin, std::size_t end) {
+        for(std::size_t i = begin; i != end; ++i) {
+            Animable<dimensions, T>& animable = *_running[i];
+            animable.animationStep(time - animable.startTime, delta);
+        }
+    };
+
+    #ifdef MAGNUM_BUILD_MULTITHREADED
+    /* Not worth distributing few animations among threads */
+    if(_threadPool && _running.size() >= 256) {
+        _threadPool->run(_running.size(), stepRunning);
+        return;
     }
+    #endif
 
-    CORRADE_INTERNAL_ASSERT((_runningCount <= AnimableGroup<dimensions, T>::size()));
+    stepRunning(0, _running.size());
 }
 
 }}
@@ -48,28 +48,106 @@ template<UnsignedInt dimensions, class T> class AnimableGroup: public FeatureGro
         /**
          * @brief Constructor
          */
-        explicit AnimableGroup(): _runningCount(0), wakeUp(false) {}
+        explicit AnimableGroup();
+
+        /**
+         * @brief Destructor
+         *
+         * The animables are not deleted, only removed from the group.
+         */
+        ~AnimableGroup();
 
         /**
          * @brief Count of running animations
          *
-         * @see @ref step()
+         * Updated in @ref step(), state changes done with
+         * @ref Animable::setState() since last step are not reflected.
+         */
+        std::size_t runningCount() const { return _running.size(); }
+
+        /**
+         * @brief Add animable to the group
+         * @return Reference to self (for method chaining)
+         *
+         * Same as @ref FeatureGroup::add(), but also moves the animable
+         * between lists of running animations. If the animable is running,
+         * it continues running in this group from the next @ref step().
+         * @note Adding or removing animables through a reference to
+         *      @ref FeatureGroup base desynchronizes the list of running
+         *      animations, use this function instead.
+         */
+        AnimableGroup<dimensions, T>& add(Animable<dimensions, T>& animable);
+
+        /**
+         * @brief Remove animable from the group
+         * @return Reference to self (for method chaining)
+         *
+         * Same as @ref FeatureGroup::remove(), but also removes the animable
+         * from the list of running animations. The animation state is not
+         * changed and no state change callbacks are called.
+         */
+        AnimableGroup<dimensions, T>& remove(Animable<dimensions, T>& animable);
+
+        #if defined(MAGNUM_BUILD_MULTITHREADED) || defined(DOXYGEN_GENERATING_OUTPUT)
+        /**
+         * @brief Thread pool
+         *
+         * @see @ref setThreadPool()
+         * @note Available only if Magnum is compiled with
+         *      `BUILD_MULTITHREADED` enabled.
+         */
+        ThreadPool* threadPool() const { return _threadPool; }
+
+        /**
+         * @brief Set thread pool
+         * @return Reference to self (for method chaining)
+         *
+         * If set, @ref step() calls @ref Animable::animationStep() of large
+         * amounts of running animations using threads from given pool. State
+         * changes, repeat handling and all other callbacks are still done in
+         * the calling thread. The animation steps must then be independent
+         * of each other and must not call @ref Animable::setState(). The
+         * pool is not owned by the group and must not be destroyed before
+         * it. Set to `nullptr` to step everything in the calling thread,
+         * which is the default.
+         * @note Available only if Magnum is compiled with
+         *      `BUILD_MULTITHREADED` enabled.
          */
-        std::size_t runningCount() const { return _runningCount; }
+        AnimableGroup<dimensions, T>& setThreadPool(ThreadPool* pool) {
+            _threadPool = pool;
+            return *this;
+        }
+        #endif
 
         /**
          * @brief Perform animation step
          * @param time      Absolute time (e.g. @ref Timeline::previousFrameTime())
          * @param delta     Time delta for current frame (e.g. @ref Timeline::previousFrameDuration())
          *
-         * If there are no running animations the function does nothing.
+         * First applies state changes queued by @ref Animable::setState(),
+         * then handles duration and repeats of running animations and
+         * finally calls @ref Animable::animationStep() on all animations
+         * which are still running. Stopped and paused animations are not
+         * traversed. If there are no running animations and no pending
+         * state changes the function does nothing.
          * @see @ref runningCount()
          */
         void step(Float time, Float delta);
 
     private:
-        std::size_t _runningCount;
-        bool wakeUp;
+        void enqueue(Animable<dimensions, T>& animable);
+        void detach(Animable<dimensions, T>& animable);
+        void addRunning(Animable<dimensions, T>& animable);
+        void removeRunning(Animable<dimensions, T>& animable);
+        void release(Animable<dimensions, T>& animable);
+
+        /* Dense list of running animables and queue of animables with state
+           changed since last step() */
+        std::vector<Animable<dimensions, T>*> _running, _pending;
+
+        #ifdef MAGNUM_BUILD_MULTITHREADED
+        ThreadPool* _threadPool{};
+        #endif
 };
 
 /**
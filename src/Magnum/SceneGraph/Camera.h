@@ -52,8 +52,29 @@ enum class AspectRatioPolicy: UnsignedByte {
     Clip            /**< Clip on smaller side of view */
 };
 
+/**
+@brief Drawable order
+
+@see @ref Camera::setDrawOrder()
+*/
+enum class DrawOrder: UnsignedByte {
+    /** Draw in the order the drawables were added to the group (default) */
+    Insertion,
+
+    /**
+     * Draw sorted by @ref Drawable::sortKey() and camera-space depth, see
+     * @ref SceneGraph-Drawable-sorting "Drawable documentation" for more
+     * information.
+     */
+    Sorted
+};
+
 namespace Implementation {
     template<UnsignedInt dimensions, class T> MatrixTypeFor<dimensions, T> aspectRatioFix(AspectRatioPolicy aspectRatioPolicy, const Math::Vector2<T>& projectionScale, const Vector2i& viewport);
+
+    /* Camera-space depth of given transformation as 16-bit key. Zero for 2D
+       and for objects behind the camera. */
+    template<UnsignedInt dimensions, class T> UnsignedShort depthSortKey(const MatrixTypeFor<dimensions, T>& transformationMatrix);
 }
 
 /**
@@ -235,10 +256,88 @@ template<UnsignedInt dimensions, class T> class Camera: public AbstractFeature<d
         /**
          * @brief Draw
          *
-         * Draws given group of drawables.
+         * Draws given group of drawables. Drawables with a bounding volume
+         * that lies completely outside of the view frustum are not drawn,
+         * see @ref SceneGraph-Drawable-frustum-culling "Drawable documentation" for more
+         * information. Memory used for computing the transformations and
+         * culling is kept between calls, so drawing doesn't allocate once the
+         * buffers are large enough.
+         * @see @ref visibleCount(), @ref culledCount()
          */
         virtual void draw(DrawableGroup<dimensions, T>& group);
 
+        /**
+         * @brief Whether drawables get float transformations
+         *
+         * @see @ref setFloatOutput()
+         */
+        bool isFloatOutput() const { return _floatOutput; }
+
+        /**
+         * @brief Enable or disable float transformations for drawables
+         * @return Reference to self (for method chaining)
+         *
+         * If enabled, @ref draw() converts transformations of all drawables
+         * relative to the camera to @ref Magnum::Float "Float" in one batch
+         * and passes them to @ref Drawable::drawFloat() instead of
+         * @ref Drawable::draw(). Useful for @ref Magnum::Double "Double"
+         * scenes, see @ref SceneGraph-Drawable-large-worlds "Drawable documentation"
+         * for more information. Default is `false`.
+         */
+        Camera<dimensions, T>& setFloatOutput(bool enabled) {
+            _floatOutput = enabled;
+            return *this;
+        }
+
+        /** @brief Draw order */
+        DrawOrder drawOrder() const { return _drawOrder; }
+
+        /**
+         * @brief Set draw order
+         * @return Reference to self (for method chaining)
+         *
+         * Default is @ref DrawOrder::Insertion.
+         * @see @ref shaderRebindsAvoided(), @ref textureRebindsAvoided()
+         */
+        Camera<dimensions, T>& setDrawOrder(DrawOrder order) {
+            _drawOrder = order;
+            return *this;
+        }
+
+        /**
+         * @brief Count of shader rebinds avoided in last @ref draw() call
+         *
+         * Difference between count of shader changes among the visible
+         * drawables in insertion order and in sorted order. Always `0` if
+         * draw order is @ref DrawOrder::Insertion.
+         */
+        std::size_t shaderRebindsAvoided() const { return _shaderRebindsAvoided; }
+
+        /**
+         * @brief Count of texture rebinds avoided in last @ref draw() call
+         *
+         * Difference between count of shader or material changes among the
+         * visible drawables in insertion order and in sorted order. Always
+         * `0` if draw order is @ref DrawOrder::Insertion.
+         */
+        std::size_t textureRebindsAvoided() const { return _textureRebindsAvoided; }
+
+        /**
+         * @brief Count of drawables drawn in last @ref draw() call
+         *
+         * Includes drawables without any bounding volume.
+         * @see @ref culledCount(), @ref Drawable::setBoundingSphere(),
+         *      @ref Drawable::setBoundingBox()
+         */
+        std::size_t visibleCount() const { return _visibleCount; }
+
+        /**
+         * @brief Count of drawables culled in last @ref draw() call
+         *
+         * @see @ref visibleCount()
+         */
+        std::size_t culledCount() const { return _culledCount; }
+
     private:
         /** Recalculates camera matrix */
         void cleanInverted(const MatrixTypeFor<dimensions, T>& invertedAbsoluteTransformationMatrix) override {
@@ -247,6 +346,8 @@ template<UnsignedInt dimensions, class T> class Camera: public AbstractFeature<d
 
         void fixAspectRatio();
 
+        void cull(DrawableGroup<dimensions, T>& group, const std::vector<MatrixTypeFor<dimensions, T>>& transformations, std::vector<UnsignedInt>& indices, std::vector<T>& data, std::vector<UnsignedByte>& visible) const;
+
         MatrixTypeFor<dimensions, T> _rawProjectionMatrix;
         AspectRatioPolicy _aspectRatioPolicy;
 
@@ -254,6 +355,20 @@ template<UnsignedInt dimensions, class T> class Camera: public AbstractFeature<d
         MatrixTypeFor<dimensions, T> _cameraMatrix;
 
         Vector2i _viewport;
+
+        /* Kept between draw() calls to avoid allocations */
+        std::vector<std::reference_wrapper<AbstractObject<dimensions, T>>> _drawableObjects;
+        std::vector<MatrixTypeFor<dimensions, T>> _drawableTransformations;
+        std::vector<MatrixTypeFor<dimensions, Float>> _drawableTransformationsFloat;
+        std::vector<UnsignedInt> _cullIndices;
+        std::vector<T> _cullData;
+        std::vector<UnsignedByte> _cullVisible;
+        std::vector<UnsignedLong> _sortKeys, _sortKeyScratch;
+        std::vector<UnsignedInt> _sortOrder, _sortOrderScratch;
+
+        DrawOrder _drawOrder;
+        bool _floatOutput;
+        std::size_t _visibleCount, _culledCount, _shaderRebindsAvoided, _textureRebindsAvoided;
 };
 
 /**
@@ -29,9 +29,12 @@
  * @brief @ref compilation-speedup-hpp "Template implementation" for @ref Camera.h
  */
 
+#include <cstring>
+
 #include "Magnum/Math/Functions.h"
 #include "Magnum/SceneGraph/Camera.h"
 #include "Magnum/SceneGraph/Drawable.h"
+#include "Magnum/SceneGraph/frustumImplementation.h"
 
 namespace Magnum { namespace SceneGraph {
 
@@ -49,13 +52,55 @@ template<UnsignedInt dimensions, class T> MatrixTypeFor<dimensions, T> aspectRat
        Clip on smaller side = scale smaller side up */
     return MatrixTypeFor<dimensions, T>::scaling(Math::Vector<dimensions, T>::pad(
         (relativeAspectRatio.x() > relativeAspectRatio.y()) == (aspectRatioPolicy == AspectRatioPolicy::Extend) ?
-        Vector2(relativeAspectRatio.y()/relativeAspectRatio.x(), T(1)) :
-        Vector2(T(1), relativeAspectRatio.x()/relativeAspectRatio.y()), T(1)));
+        Math::Vector2<T>(relativeAspectRatio.y()/relativeAspectRatio.x(), T(1)) :
+        Math::Vector2<T>(T(1), relativeAspectRatio.x()/relativeAspectRatio.y()), T(1)));
+}
+
+template<UnsignedInt dimensions, class T> UnsignedShort depthSortKey(const MatrixTypeFor<dimensions, T>& transformationMatrix) {
+    if(dimensions != 3) return 0;
+
+    /* Bit representation of positive floats has the same ordering as their
+       values, upper 16 bits are precise enough for sorting */
+    const Float depth = Math::max(Float(-transformationMatrix[dimensions][dimensions - 1]), 0.0f);
+    UnsignedInt bits;
+    std::memcpy(&bits, &depth, sizeof(Float));
+    return bits >> 16;
 }
 
+/* Converts all transformations to float in one go. The matrices are
+   contiguous, so it's done as a single loop over all elements which the
+   compiler can vectorize. Float transformations are passed through. */
+template<UnsignedInt dimensions, class T> struct FloatTransformations {
+    static const std::vector<MatrixTypeFor<dimensions, Float>>& convert(const std::vector<MatrixTypeFor<dimensions, T>>& transformations, std::vector<MatrixTypeFor<dimensions, Float>>& out) {
+        static_assert(sizeof(MatrixTypeFor<dimensions, T>) == (dimensions + 1)*(dimensions + 1)*sizeof(T), "Improper matrix size");
+        out.resize(transformations.size());
+        if(transformations.empty()) return out;
+
+        const std::size_t count = transformations.size()*(dimensions + 1)*(dimensions + 1);
+        const T* const in = transformations.front().data();
+        Float* const result = out.front().data();
+        for(std::size_t i = 0; i != count; ++i)
+            result[i] = Float(in[i]);
+        return out;
+    }
+};
+
+template<UnsignedInt dimensions> struct FloatTransformations<dimensions, Float> {
+    static const std::vector<MatrixTypeFor<dimensions, Float>>& convert(const std::vector<MatrixTypeFor<dimensions, Float>>& transformations, std::vector<MatrixTypeFor<dimensions, Float>>&) {
+        return transformations;
+    }
+};
+
+inline std::size_t stateChanges(const std::vector<UnsignedLong>& keys, const UnsignedInt shift) {
+    std::size_t changes = 0;
+    for(std::size_t i = 0; i != keys.size(); ++i)
+        if(!i || keys[i] >> shift != keys[i - 1] >> shift) ++changes;
+    return changes;
 }
 
-template<UnsignedInt dimensions, class T> Camera<dimensions, T>::Camera(AbstractObject<dimensions, T>& object): AbstractFeature<dimensions, T>(object), _aspectRatioPolicy(AspectRatioPolicy::NotPreserved) {
+}
+
+template<UnsignedInt dimensions, class T> Camera<dimensions, T>::Camera(AbstractObject<dimensions, T>& object): AbstractFeature<dimensions, T>(object), _aspectRatioPolicy(AspectRatioPolicy::NotPreserved), _drawOrder{DrawOrder::Insertion}, _floatOutput{}, _visibleCount{}, _culledCount{}, _shaderRebindsAvoided{}, _textureRebindsAvoided{} {
     AbstractFeature<dimensions, T>::setCachedTransformations(CachedTransformation::InvertedAbsolute);
 }
 
@@ -89,17 +134,153 @@ template<UnsignedInt dimensions, class T> void Camera<dimensions, T>::draw(Drawa
     /* Compute camera matrix */
     AbstractFeature<dimensions, T>::object().setClean();
 
+    /* Take over the buffers from previous call, so they don't need to be
+       allocated again. Moving them out (and back) also makes nested draw()
+       calls from inside drawables work. */
+    std::vector<std::reference_wrapper<AbstractObject<dimensions, T>>> objects = std::move(_drawableObjects);
+    std::vector<MatrixTypeFor<dimensions, T>> transformations = std::move(_drawableTransformations);
+
     /* Compute transformations of all objects in the group relative to the camera */
-    std::vector<std::reference_wrapper<AbstractObject<dimensions, T>>> objects;
+    objects.clear();
     objects.reserve(group.size());
     for(std::size_t i = 0; i != group.size(); ++i)
         objects.push_back(group[i].object());
-    std::vector<MatrixTypeFor<dimensions, T>> transformations =
-        scene->transformationMatrices(objects, _cameraMatrix);
+    scene->transformationMatrices(objects, transformations, _cameraMatrix);
+
+    /* Cull drawables having a bounding volume against the view frustum */
+    std::vector<UnsignedInt> cullIndices = std::move(_cullIndices);
+    std::vector<T> cullData = std::move(_cullData);
+    std::vector<UnsignedByte> cullVisible = std::move(_cullVisible);
+    cull(group, transformations, cullIndices, cullData, cullVisible);
+
+    /* Convert the camera-relative transformations to float in a single batch,
+       if requested */
+    std::vector<MatrixTypeFor<dimensions, Float>> transformationsFloat = std::move(_drawableTransformationsFloat);
+    const std::vector<MatrixTypeFor<dimensions, Float>>* const floatTransformations = _floatOutput ?
+        &Implementation::FloatTransformations<dimensions, T>::convert(transformations, transformationsFloat) : nullptr;
+
+    /* Perform the drawing, skipping culled drawables. In sorted mode only
+       collect the sort keys. */
+    const bool sorted = _drawOrder == DrawOrder::Sorted;
+    std::vector<UnsignedLong> sortKeys = std::move(_sortKeys);
+    std::vector<UnsignedInt> sortOrder = std::move(_sortOrder);
+    sortKeys.clear();
+    sortOrder.clear();
+    const std::size_t cullCount = cullIndices.size();
+    std::size_t culled = 0;
+    for(std::size_t i = 0, next = 0; i != transformations.size(); ++i) {
+        if(next != cullCount && cullIndices[next] == i && !cullVisible[next++]) {
+            ++culled;
+            continue;
+        }
+
+        if(sorted) {
+            sortKeys.push_back(group[i].sortKey()|Implementation::depthSortKey<dimensions, T>(transformations[i]));
+            sortOrder.push_back(i);
+        } else if(floatTransformations) group[i].drawFloat((*floatTransformations)[i], *this);
+        else group[i].draw(transformations[i], *this);
+    }
+
+    _visibleCount = transformations.size() - culled;
+    _culledCount = culled;
+    _shaderRebindsAvoided = _textureRebindsAvoided = 0;
 
-    /* Perform the drawing */
+    /* Sort the visible drawables and draw them */
+    if(sorted) {
+        const std::size_t shaderChanges = Implementation::stateChanges(sortKeys, 48);
+        const std::size_t textureChanges = Implementation::stateChanges(sortKeys, 32);
+
+        std::vector<UnsignedLong> sortKeyScratch = std::move(_sortKeyScratch);
+        std::vector<UnsignedInt> sortOrderScratch = std::move(_sortOrderScratch);
+        Implementation::radixSort(sortKeys, sortOrder, sortKeyScratch, sortOrderScratch);
+
+        _shaderRebindsAvoided = shaderChanges - Implementation::stateChanges(sortKeys, 48);
+        _textureRebindsAvoided = textureChanges - Implementation::stateChanges(sortKeys, 32);
+
+        for(const UnsignedInt i: sortOrder) {
+            if(floatTransformations) group[i].drawFloat((*floatTransformations)[i], *this);
+            else group[i].draw(transformations[i], *this);
+        }
+
+        _sortKeyScratch = std::move(sortKeyScratch);
+        _sortOrderScratch = std::move(sortOrderScratch);
+    }
+
+    _drawableObjects = std::move(objects);
+    _drawableTransformations = std::move(transformations);
+    _drawableTransformationsFloat = std::move(transformationsFloat);
+    _cullIndices = std::move(cullIndices);
+    _cullData = std::move(cullData);
+    _cullVisible = std::move(cullVisible);
+    _sortKeys = std::move(sortKeys);
+    _sortOrder = std::move(sortOrder);
+}
+
+template<UnsignedInt dimensions, class T> void Camera<dimensions, T>::cull(DrawableGroup<dimensions, T>& group, const std::vector<MatrixTypeFor<dimensions, T>>& transformations, std::vector<UnsignedInt>& indices, std::vector<T>& data, std::vector<UnsignedByte>& visible) const {
+    indices.clear();
     for(std::size_t i = 0; i != transformations.size(); ++i)
-        group[i].draw(transformations[i], *this);
+        if(group[i].boundingVolume() != BoundingVolume::None) indices.push_back(i);
+
+    const std::size_t count = indices.size();
+    visible.assign(count, 1);
+    if(!count) return;
+
+    /* Transform the bounding volumes to camera space and store them as
+       structure of arrays -- centers, then box half-sizes (as axis-aligned
+       box enclosing the transformed one), then sphere radii. Spheres have
+       zero half-size and boxes zero radius, so both are tested the same way
+       below. */
+    data.resize(count*(2*dimensions + 1));
+    T* const centers = data.data();
+    T* const extents = centers + count*dimensions;
+    T* const radii = extents + count*dimensions;
+    for(std::size_t i = 0; i != count; ++i) {
+        const Drawable<dimensions, T>& drawable = group[indices[i]];
+        const MatrixTypeFor<dimensions, T>& transformation = transformations[indices[i]];
+        const VectorTypeFor<dimensions, T> center = transformation.transformPoint(drawable.boundingCenter());
+        const VectorTypeFor<dimensions, T> halfSize = drawable.boundingHalfSize();
+
+        T maxScaleSquared{};
+        for(UnsignedInt k = 0; k != dimensions; ++k) {
+            T extent{}, scaleSquared{};
+            for(UnsignedInt j = 0; j != dimensions; ++j) {
+                extent += Math::abs(transformation[j][k])*halfSize[j];
+                scaleSquared += transformation[k][j]*transformation[k][j];
+            }
+
+            centers[k*count + i] = center[k];
+            extents[k*count + i] = extent;
+            maxScaleSquared = Math::max(maxScaleSquared, scaleSquared);
+        }
+
+        radii[i] = drawable.boundingRadius()*Math::sqrt(maxScaleSquared);
+    }
+
+    /* Test all volumes against one plane at a time. The planes are not
+       normalized, so the sphere radius is scaled by normal length instead.
+       The inner loop is branchless to allow the compiler to vectorize it. */
+    Math::Vector<dimensions + 1, T> planes[dimensions*2];
+    Implementation::frustumPlanes<dimensions, T>(_projectionMatrix, planes);
+    UnsignedByte* const out = visible.data();
+    for(const Math::Vector<dimensions + 1, T>& plane: planes) {
+        T absNormal[dimensions];
+        T normalLengthSquared{};
+        for(UnsignedInt k = 0; k != dimensions; ++k) {
+            absNormal[k] = Math::abs(plane[k]);
+            normalLengthSquared += plane[k]*plane[k];
+        }
+        const T normalLength = Math::sqrt(normalLengthSquared);
+
+        for(std::size_t i = 0; i != count; ++i) {
+            T distance = plane[dimensions];
+            T reach = radii[i]*normalLength;
+            for(UnsignedInt k = 0; k != dimensions; ++k) {
+                distance += plane[k]*centers[k*count + i];
+                reach += absNormal[k]*extents[k*count + i];
+            }
+            out[i] &= UnsignedByte(distance + reach >= T(0));
+        }
+    }
 }
 
 }}
@@ -0,0 +1,89 @@
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#include "Drawable.h"
+
+#include <Corrade/Utility/Assert.h>
+#include <Corrade/Utility/Debug.h>
+
+namespace Magnum { namespace SceneGraph { namespace Implementation {
+
+void radixSort(std::vector<UnsignedLong>& keys, std::vector<UnsignedInt>& values, std::vector<UnsignedLong>& keyScratch, std::vector<UnsignedInt>& valueScratch) {
+    CORRADE_ASSERT(keys.size() == values.size(),
+        "SceneGraph::Implementation::radixSort(): expected the same count of keys and values but got" << keys.size() << "and" << values.size(), );
+
+    const std::size_t size = keys.size();
+    if(size < 2) return;
+
+    keyScratch.resize(size);
+    valueScratch.resize(size);
+
+    /* Histograms of all eight bytes in a single pass over the keys */
+    std::size_t histograms[8][256]{};
+    for(std::size_t i = 0; i != size; ++i) {
+        const UnsignedLong key = keys[i];
+        for(std::size_t byte = 0; byte != 8; ++byte)
+            ++histograms[byte][(key >> byte*8) & 0xff];
+    }
+
+    UnsignedLong* keysIn = keys.data();
+    UnsignedLong* keysOut = keyScratch.data();
+    UnsignedInt* valuesIn = values.data();
+    UnsignedInt* valuesOut = valueScratch.data();
+    bool swapped = false;
+    for(std::size_t byte = 0; byte != 8; ++byte) {
+        std::size_t* const histogram = histograms[byte];
+        const std::size_t shift = byte*8;
+
+        /* All keys have the same value of this byte, nothing to do */
+        if(histogram[(keysIn[0] >> shift) & 0xff] == size) continue;
+
+        /* Convert counts to output offsets */
+        std::size_t offset = 0;
+        for(std::size_t i = 0; i != 256; ++i) {
+            const std::size_t count = histogram[i];
+            histogram[i] = offset;
+            offset += count;
+        }
+
+        for(std::size_t i = 0; i != size; ++i) {
+            const std::size_t position = histogram[(keysIn[i] >> shift) & 0xff]++;
+            keysOut[position] = keysIn[i];
+            valuesOut[position] = valuesIn[i];
+        }
+
+        std::swap(keysIn, keysOut);
+        std::swap(valuesIn, valuesOut);
+        swapped = !swapped;
+    }
+
+    /* The result ended up in the scratch buffers, swap them with the output */
+    if(swapped) {
+        std::swap(keys, keyScratch);
+        std::swap(values, valueScratch);
+    }
+}
+
+}}}
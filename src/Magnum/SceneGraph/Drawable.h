@@ -29,10 +29,31 @@
  * @brief Class @ref Magnum::SceneGraph::Drawable, @ref Magnum::SceneGraph::DrawableGroup, alias @ref Magnum::SceneGraph::BasicDrawable2D, @ref Magnum::SceneGraph::BasicDrawable3D, @ref Magnum::SceneGraph::BasicDrawableGroup2D, @ref Magnum::SceneGraph::BasicDrawableGroup3D, typedef @ref Magnum::SceneGraph::Drawable2D, @ref Magnum::SceneGraph::Drawable3D, @ref Magnum::SceneGraph::DrawableGroup2D, @ref Magnum::SceneGraph::DrawableGroup3D
  */
 
+#include "Magnum/Math/Range.h"
 #include "Magnum/SceneGraph/AbstractGroupedFeature.h"
 
 namespace Magnum { namespace SceneGraph {
 
+/**
+@brief Drawable bounding volume
+
+@see @ref Drawable::boundingVolume(), @ref Drawable::setBoundingSphere(),
+    @ref Drawable::setBoundingBox()
+*/
+enum class BoundingVolume: UnsignedByte {
+    None,       /**< No bounding volume, the drawable is never culled (default) */
+    Sphere,     /**< Bounding sphere */
+    Box         /**< Axis-aligned bounding box */
+};
+
+namespace Implementation {
+    /* Stable LSD radix sort of 64-bit keys together with 32-bit values.
+       Passes over bytes that are the same in all keys are skipped. The
+       scratch vectors are resized as needed and might get swapped with the
+       input. */
+    MAGNUM_SCENEGRAPH_EXPORT void radixSort(std::vector<UnsignedLong>& keys, std::vector<UnsignedInt>& values, std::vector<UnsignedLong>& keyScratch, std::vector<UnsignedInt>& valueScratch);
+}
+
 /**
 @brief Drawable
 
@@ -155,6 +176,80 @@ void MyApplication::drawEvent() {
 }
 @endcode
 
+@anchor SceneGraph-Drawable-frustum-culling
+## Frustum culling
+
+Each drawable can optionally have a bounding sphere or box in the local
+coordinate system of the object it is attached to. @ref Camera::draw() tests
+all drawables with a bounding volume against the view frustum in a single
+batch and skips calling @ref draw() on those that are completely outside.
+Drawables without a bounding volume are always drawn.
+@code
+auto sphere = new RedCube(&scene, &drawables);
+sphere->setBoundingSphere({}, 1.0f);
+@endcode
+
+Numbers of drawn and culled drawables in the last @ref Camera::draw() call are
+available through @ref Camera::visibleCount() and @ref Camera::culledCount().
+
+@anchor SceneGraph-Drawable-sorting
+## Sorting to minimize state changes
+
+By default the drawables are drawn in the order they were added to the group.
+With @ref DrawOrder::Sorted set via @ref Camera::setDrawOrder() the visible
+drawables are sorted by a key composed of shader, material (texture set) and
+mesh ID set via @ref setSortKey() and camera-space depth, so drawables sharing
+the same shader and textures are drawn one after another and opaque geometry
+is drawn front to back. It is then up to the @ref draw() implementation to
+skip binding state that's already bound.
+@code
+drawable->setSortKey(phongShaderId, brickMaterialId, cubeMeshId);
+
+camera->setDrawOrder(SceneGraph::DrawOrder::Sorted);
+camera->draw(drawables);
+@endcode
+
+Number of shader and texture rebinds saved by the sorting in the last draw is
+available through @ref Camera::shaderRebindsAvoided() and
+@ref Camera::textureRebindsAvoided().
+
+@anchor SceneGraph-Drawable-large-worlds
+## Large worlds
+
+For scenes spanning large distances (such as planet-scale terrain) single
+precision isn't enough to store absolute transformations without visible
+jitter. The scene can be instantiated with @ref Magnum::Double "Double"
+instead. The transformations of drawables relative to the camera are then
+computed in double precision and are small enough to be represented in
+single precision again. With @ref Camera::setFloatOutput() enabled, the
+camera converts all of them to @ref Magnum::Float "Float" in one batch and
+calls @ref drawFloat() instead of @ref draw(), so the drawables don't need to
+convert anything themselves:
+@code
+typedef SceneGraph::Object<SceneGraph::BasicMatrixTransformation3D<Double>> Object3Dd;
+
+class Terrain: public Object3Dd, public SceneGraph::BasicDrawable3D<Double> {
+    // ...
+
+    private:
+        // Used only if float output is disabled on the camera
+        void draw(const Matrix4d& transformationMatrix, SceneGraph::BasicCamera3D<Double>& camera) override {
+            drawFloat(Matrix4{transformationMatrix}, camera);
+        }
+
+        void drawFloat(const Matrix4& transformationMatrix, SceneGraph::BasicCamera3D<Double>& camera) override {
+            _shader.setTransformationMatrix(transformationMatrix);
+            // ...
+        }
+};
+
+camera->setFloatOutput(true)
+    .draw(drawables);
+@endcode
+
+Double-precision scene graph types are not compiled into the library, include
+the @ref compilation-speedup-hpp "template implementation files" to use them.
+
 ## Explicit template specializations
 
 The following specializations are explicitly compiled into @ref SceneGraph
@@ -194,6 +289,84 @@ template<UnsignedInt dimensions, class T> class Drawable: public AbstractGrouped
             return AbstractGroupedFeature<dimensions, Drawable<dimensions, T>, T>::group();
         }
 
+        /**
+         * @brief Bounding volume type
+         *
+         * Default is @ref BoundingVolume::None.
+         * @see @ref setBoundingSphere(), @ref setBoundingBox()
+         */
+        BoundingVolume boundingVolume() const { return _boundingVolume; }
+
+        /**
+         * @brief Bounding volume center
+         *
+         * Center of the bounding sphere or box in object-local coordinates.
+         */
+        VectorTypeFor<dimensions, T> boundingCenter() const { return _boundingCenter; }
+
+        /**
+         * @brief Bounding sphere radius
+         *
+         * Zero if the bounding volume is not a sphere.
+         */
+        T boundingRadius() const { return _boundingRadius; }
+
+        /**
+         * @brief Bounding box half size
+         *
+         * Zero if the bounding volume is not a box.
+         */
+        VectorTypeFor<dimensions, T> boundingHalfSize() const { return _boundingHalfSize; }
+
+        /**
+         * @brief Set bounding sphere
+         * @return Reference to self (for method chaining)
+         *
+         * The sphere is in object-local coordinates and is used for frustum
+         * culling in @ref Camera::draw().
+         */
+        Drawable<dimensions, T>& setBoundingSphere(const VectorTypeFor<dimensions, T>& center, T radius);
+
+        /**
+         * @brief Set bounding box
+         * @return Reference to self (for method chaining)
+         *
+         * The box is in object-local coordinates and is used for frustum
+         * culling in @ref Camera::draw().
+         */
+        Drawable<dimensions, T>& setBoundingBox(const RangeTypeFor<dimensions, T>& box);
+
+        /**
+         * @brief Reset bounding volume
+         * @return Reference to self (for method chaining)
+         *
+         * The drawable is then never culled.
+         */
+        Drawable<dimensions, T>& resetBoundingVolume();
+
+        /**
+         * @brief Sort key
+         *
+         * Shader ID in bits 48--63, material ID in bits 32--47 and mesh ID in
+         * bits 16--31. Default is `0`.
+         * @see @ref setSortKey(), @ref DrawOrder::Sorted
+         */
+        UnsignedLong sortKey() const { return _sortKey; }
+
+        /**
+         * @brief Set sort key
+         * @return Reference to self (for method chaining)
+         *
+         * The IDs are arbitrary, drawables with the same shader and the same
+         * material are expected to share the same GL state. Used only if the
+         * camera draw order is @ref DrawOrder::Sorted.
+         * @see @ref Camera::setDrawOrder()
+         */
+        Drawable<dimensions, T>& setSortKey(UnsignedShort shader, UnsignedShort material, UnsignedShort mesh) {
+            _sortKey = UnsignedLong(shader) << 48 | UnsignedLong(material) << 32 | UnsignedLong(mesh) << 16;
+            return *this;
+        }
+
         /**
          * @brief Draw the object using given camera
          * @param transformationMatrix  Object transformation relative to camera
@@ -203,6 +376,28 @@ template<UnsignedInt dimensions, class T> class Drawable: public AbstractGrouped
          * @ref SceneGraph::Camera::projectionMatrix() "Camera::projectionMatrix()".
          */
         virtual void draw(const MatrixTypeFor<dimensions, T>& transformationMatrix, Camera<dimensions, T>& camera) = 0;
+
+        /**
+         * @brief Draw the object using given camera with float transformation
+         * @param transformationMatrix  Object transformation relative to
+         *      camera, converted to @ref Magnum::Float "Float"
+         * @param camera                Camera
+         *
+         * Called instead of @ref draw() if float output is enabled on the
+         * camera, see @ref SceneGraph-Drawable-large-worlds "Large worlds"
+         * for more information. Default implementation converts the matrix
+         * back and calls @ref draw().
+         * @see @ref Camera::setFloatOutput()
+         */
+        virtual void drawFloat(const MatrixTypeFor<dimensions, Float>& transformationMatrix, Camera<dimensions, T>& camera) {
+            draw(MatrixTypeFor<dimensions, T>{transformationMatrix}, camera);
+        }
+
+    private:
+        UnsignedLong _sortKey;
+        VectorTypeFor<dimensions, T> _boundingCenter, _boundingHalfSize;
+        T _boundingRadius;
+        BoundingVolume _boundingVolume;
 };
 
 /**
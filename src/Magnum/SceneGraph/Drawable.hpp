@@ -29,11 +29,37 @@
  * @brief @ref compilation-speedup-hpp "Template implementation" for @ref Drawable.h
  */
 
+#include "Magnum/Math/Functions.h"
 #include "Magnum/SceneGraph/Drawable.h"
 
 namespace Magnum { namespace SceneGraph {
 
-template<UnsignedInt dimensions, class T> Drawable<dimensions, T>::Drawable(AbstractObject<dimensions, T>& object, DrawableGroup<dimensions, T>* drawables): AbstractGroupedFeature<dimensions, Drawable<dimensions, T>, T>(object, drawables) {}
+template<UnsignedInt dimensions, class T> Drawable<dimensions, T>::Drawable(AbstractObject<dimensions, T>& object, DrawableGroup<dimensions, T>* drawables): AbstractGroupedFeature<dimensions, Drawable<dimensions, T>, T>(object, drawables), _sortKey{}, _boundingRadius{}, _boundingVolume{BoundingVolume::None} {}
+
+template<UnsignedInt dimensions, class T> Drawable<dimensions, T>& Drawable<dimensions, T>::setBoundingSphere(const VectorTypeFor<dimensions, T>& center, const T radius) {
+    CORRADE_ASSERT(radius >= T(0), "SceneGraph::Drawable::setBoundingSphere(): negative radius", *this);
+    _boundingVolume = BoundingVolume::Sphere;
+    _boundingCenter = center;
+    _boundingHalfSize = {};
+    _boundingRadius = radius;
+    return *this;
+}
+
+template<UnsignedInt dimensions, class T> Drawable<dimensions, T>& Drawable<dimensions, T>::setBoundingBox(const RangeTypeFor<dimensions, T>& box) {
+    _boundingVolume = BoundingVolume::Box;
+    _boundingCenter = box.center();
+    _boundingHalfSize = Math::abs(box.size())/T(2);
+    _boundingRadius = T(0);
+    return *this;
+}
+
+template<UnsignedInt dimensions, class T> Drawable<dimensions, T>& Drawable<dimensions, T>::resetBoundingVolume() {
+    _boundingVolume = BoundingVolume::None;
+    _boundingCenter = {};
+    _boundingHalfSize = {};
+    _boundingRadius = T(0);
+    return *this;
+}
 
 }}
 
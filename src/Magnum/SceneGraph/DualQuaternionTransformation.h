@@ -288,12 +288,22 @@ template<class T> struct Transformation<BasicDualQuaternionTransformation<T>> {
         return transformation.toMatrix();
     }
 
+    /* The dual quaternions are expected to stay normalized, so the product is
+       not renormalized after every step. Accumulated drift can be removed
+       with normalizeRotation(). The product is expanded to not use the
+       (constexpr) operator, so the quaternion products are SIMD-accelerated
+       where available. */
     static Math::DualQuaternion<T> compose(const Math::DualQuaternion<T>& parent, const Math::DualQuaternion<T>& child) {
-        return parent*child;
+        typedef Math::Implementation::QuaternionMultiply<T> Multiply;
+        return {Multiply::multiply(parent.real(), child.real()),
+                Multiply::multiply(parent.real(), child.dual()) + Multiply::multiply(parent.dual(), child.real())};
     }
 
+    /* Same as DualQuaternion::invertedNormalized(), but without the
+       normalization check, which is already done when setting the
+       transformation */
     static Math::DualQuaternion<T> inverted(const Math::DualQuaternion<T>& transformation) {
-        return transformation.invertedNormalized();
+        return transformation.quaternionConjugated();
     }
 };
 
@@ -32,6 +32,7 @@
 #include <vector>
 #include <Corrade/Utility/Assert.h>
 
+#include "Magnum/DimensionTraits.h"
 #include "Magnum/SceneGraph/SceneGraph.h"
 #include "Magnum/SceneGraph/visibility.h"
 
@@ -44,14 +45,40 @@ See @ref FeatureGroup.
 */
 template<UnsignedInt dimensions, class T> class AbstractFeatureGroup {
     template<UnsignedInt, class, class> friend class FeatureGroup;
+    friend AbstractFeature<dimensions, T>;
 
     explicit AbstractFeatureGroup();
     virtual ~AbstractFeatureGroup();
 
     void add(AbstractFeature<dimensions, T>& feature);
     void remove(AbstractFeature<dimensions, T>& feature);
+    void setClean();
 
     std::vector<std::reference_wrapper<AbstractFeature<dimensions, T>>> features;
+
+    /* Scratch memory for batch cleaning, kept to avoid reallocations */
+    bool _cleaning;
+    std::vector<std::reference_wrapper<AbstractObject<dimensions, T>>> _cleanObjects;
+    std::vector<std::reference_wrapper<AbstractFeature<dimensions, T>>> _cleanFeatures;
+    std::vector<MatrixTypeFor<dimensions, T>> _cleanMatrices;
+
+    protected:
+        /**
+         * @brief Clean features in a batch
+         * @param features                      Features to clean
+         * @param absoluteTransformationMatrices Absolute transformation
+         *      matrices of objects holding the features
+         *
+         * Called from @ref FeatureGroup::setClean() with all features which
+         * have @ref CachedTransformation::Absolute enabled and whose objects
+         * were dirty, together with their absolute transformations in one
+         * contiguous array. Reimplement to clean all of them at once instead
+         * of one virtual @ref AbstractFeature::clean() call per feature.
+         *
+         * Default implementation calls @ref AbstractFeature::clean() on each
+         * feature.
+         */
+        virtual void doClean(const std::vector<std::reference_wrapper<AbstractFeature<dimensions, T>>>& features, const std::vector<MatrixTypeFor<dimensions, T>>& absoluteTransformationMatrices);
 };
 
 /**
@@ -111,6 +138,21 @@ template<UnsignedInt dimensions, class Feature, class T> class FeatureGroup: pub
          * @see @ref add()
          */
         FeatureGroup<dimensions, Feature, T>& remove(Feature& feature);
+
+        /**
+         * @brief Clean all features in the group
+         *
+         * Cleans objects of all features in the group in one batch using
+         * @ref AbstractObject::setClean(const std::vector<std::reference_wrapper<AbstractObject<dimensions, T>>>&).
+         * Instead of calling @ref AbstractFeature::clean() on each feature of
+         * this group separately, their absolute transformations are collected
+         * and passed to @ref doClean() at once. Other features of the objects
+         * and @ref AbstractFeature::cleanInverted() are handled as usual.
+         * Expects that all objects are part of the same scene.
+         */
+        void setClean() {
+            AbstractFeatureGroup<dimensions, T>::setClean();
+        }
 };
 
 /**
@@ -31,20 +31,51 @@
 
 #include <algorithm>
 
+#include "Magnum/SceneGraph/AbstractFeature.h"
 #include "Magnum/SceneGraph/FeatureGroup.h"
 
 namespace Magnum { namespace SceneGraph {
 
-template<UnsignedInt dimensions, class T> AbstractFeatureGroup<dimensions, T>::AbstractFeatureGroup() = default;
-template<UnsignedInt dimensions, class T> AbstractFeatureGroup<dimensions, T>::~AbstractFeatureGroup() = default;
+template<UnsignedInt dimensions, class T> AbstractFeatureGroup<dimensions, T>::AbstractFeatureGroup(): _cleaning{false} {}
+
+template<UnsignedInt dimensions, class T> AbstractFeatureGroup<dimensions, T>::~AbstractFeatureGroup() {
+    for(AbstractFeature<dimensions, T>& feature: features) feature._batchGroup = nullptr;
+}
 
 template<UnsignedInt dimensions, class T> void AbstractFeatureGroup<dimensions, T>::add(AbstractFeature<dimensions, T>& feature) {
     features.push_back(feature);
+    feature._batchGroup = this;
 }
 
 template<UnsignedInt dimensions, class T> void AbstractFeatureGroup<dimensions, T>::remove(AbstractFeature<dimensions, T>& feature) {
     features.erase(std::find_if(features.begin(), features.end(),
         [&feature](AbstractFeature<dimensions, T>& f) { return &f == &feature; }));
+    feature._batchGroup = nullptr;
+}
+
+template<UnsignedInt dimensions, class T> void AbstractFeatureGroup<dimensions, T>::setClean() {
+    /* Collect objects which need cleaning. One object may be there more than
+       once if it has more features in this group, that's handled by
+       AbstractObject::setClean(). */
+    _cleanObjects.clear();
+    for(AbstractFeature<dimensions, T>& feature: features)
+        if(feature.object().isDirty()) _cleanObjects.push_back(feature.object());
+    if(_cleanObjects.empty()) return;
+
+    /* Clean the objects, features of this group put themselves into the
+       batch instead of being cleaned directly */
+    _cleaning = true;
+    AbstractObject<dimensions, T>::setClean(_cleanObjects);
+    _cleaning = false;
+
+    if(!_cleanFeatures.empty()) doClean(_cleanFeatures, _cleanMatrices);
+    _cleanFeatures.clear();
+    _cleanMatrices.clear();
+}
+
+template<UnsignedInt dimensions, class T> void AbstractFeatureGroup<dimensions, T>::doClean(const std::vector<std::reference_wrapper<AbstractFeature<dimensions, T>>>& features, const std::vector<MatrixTypeFor<dimensions, T>>& absoluteTransformationMatrices) {
+    for(std::size_t i = 0; i != features.size(); ++i)
+        features[i].get().clean(absoluteTransformationMatrices[i]);
 }
 
 }}
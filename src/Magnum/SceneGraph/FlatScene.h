@@ -0,0 +1,372 @@
+#ifndef Magnum_SceneGraph_FlatScene_h
+#define Magnum_SceneGraph_FlatScene_h
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+
+/** @file
+ * @brief Class @ref Magnum::SceneGraph::FlatScene, @ref Magnum::SceneGraph::FlatObject, alias @ref Magnum::SceneGraph::BasicFlatScene2D, @ref Magnum::SceneGraph::BasicFlatScene3D, @ref Magnum::SceneGraph::BasicFlatObject2D, @ref Magnum::SceneGraph::BasicFlatObject3D, typedef @ref Magnum::SceneGraph::FlatScene2D, @ref Magnum::SceneGraph::FlatScene3D, @ref Magnum::SceneGraph::FlatObject2D, @ref Magnum::SceneGraph::FlatObject3D
+ */
+
+#include <vector>
+
+#include "Magnum/SceneGraph/AbstractObject.h"
+
+namespace Magnum { namespace SceneGraph {
+
+/**
+@brief Object in flat scene
+
+Lightweight handle to transformation stored in @ref FlatScene. The object
+has its own feature list, so @ref Drawable, @ref Camera and other features
+can be attached to it the same way as to @ref Object. Instances can be created
+only through @ref FlatScene::addObject() and are owned by the scene.
+
+@anchor SceneGraph-FlatObject-explicit-specializations
+## Explicit template specializations
+
+The following specializations are explicitly compiled into @ref SceneGraph
+library. For other specializations (e.g. using @ref Magnum::Double "Double"
+type) you have to use @ref FlatScene.hpp implementation file to avoid linker
+errors. See also @ref compilation-speedup-hpp for more information.
+
+-   @ref FlatObject2D
+-   @ref FlatObject3D
+
+@see @ref BasicFlatObject2D, @ref BasicFlatObject3D
+*/
+template<UnsignedInt dimensions, class T> class FlatObject: public AbstractObject<dimensions, T> {
+    friend FlatScene<dimensions, T>;
+
+    public:
+        /** @brief Matrix type */
+        typedef MatrixTypeFor<dimensions, T> MatrixType;
+
+        /** @brief Scene the object belongs to */
+        FlatScene<dimensions, T>& flatScene() { return _scene; }
+        const FlatScene<dimensions, T>& flatScene() const { return _scene; } /**< @overload */
+
+        /**
+         * @brief Parent object
+         *
+         * Returns `nullptr` if the object is direct child of the scene.
+         */
+        FlatObject<dimensions, T>* parent();
+        const FlatObject<dimensions, T>* parent() const; /**< @overload */
+
+        /**
+         * @brief Object ID
+         *
+         * Index of the object in the arrays of @ref FlatScene. Parent object
+         * has always smaller ID than its children.
+         */
+        UnsignedInt id() const { return _id; }
+
+        /** @brief Object transformation */
+        MatrixType transformation() const;
+
+        /**
+         * @brief Set transformation
+         * @return Reference to self (for method chaining)
+         *
+         * Only marks this object as dirty, children are not touched.
+         */
+        FlatObject<dimensions, T>& setTransformation(const MatrixType& transformation);
+
+        /**
+         * @brief Reset transformation
+         * @return Reference to self (for method chaining)
+         */
+        FlatObject<dimensions, T>& resetTransformation() {
+            return setTransformation({});
+        }
+
+        /**
+         * @brief Transform object
+         * @return Reference to self (for method chaining)
+         *
+         * The transformation is applied after the current one.
+         */
+        FlatObject<dimensions, T>& transform(const MatrixType& transformation) {
+            return setTransformation(transformation*this->transformation());
+        }
+
+        /**
+         * @brief Transform object as a local transformation
+         * @return Reference to self (for method chaining)
+         *
+         * The transformation is applied before the current one.
+         */
+        FlatObject<dimensions, T>& transformLocal(const MatrixType& transformation) {
+            return setTransformation(this->transformation()*transformation);
+        }
+
+    private:
+        explicit FlatObject(FlatScene<dimensions, T>& scene, UnsignedInt id);
+
+        ~FlatObject();
+
+        AbstractObject<dimensions, T>* doScene() override final;
+        const AbstractObject<dimensions, T>* doScene() const override final;
+
+        MatrixType MAGNUM_SCENEGRAPH_LOCAL doTransformationMatrix() const override final;
+        MatrixType MAGNUM_SCENEGRAPH_LOCAL doAbsoluteTransformationMatrix() const override final;
+        void doTransformationMatrices(const std::vector<std::reference_wrapper<AbstractObject<dimensions, T>>>& objects, std::vector<MatrixType>& transformationMatrices, const MatrixType& initialTransformationMatrix) const override final;
+
+        bool MAGNUM_SCENEGRAPH_LOCAL doIsDirty() const override final;
+        void MAGNUM_SCENEGRAPH_LOCAL doSetDirty() override final;
+        void MAGNUM_SCENEGRAPH_LOCAL doSetClean() override final;
+        void doSetClean(const std::vector<std::reference_wrapper<AbstractObject<dimensions, T>>>& objects) override final;
+
+        void MAGNUM_SCENEGRAPH_LOCAL setCleanInternal(const MatrixType& absoluteTransformationMatrix);
+
+        FlatScene<dimensions, T>& _scene;
+        UnsignedInt _id;
+};
+
+/**
+@brief Flat scene
+
+Data-oriented alternative to @ref Scene and @ref Object. Instead of a tree of
+individually allocated objects the scene stores local transformations, parent
+indices and absolute transformations of all objects in contiguous arrays.
+Objects are stored in order in which they were added and because the parent
+has to exist before its children are added, every parent precedes all its
+children in the arrays. Absolute transformations of all objects are then
+computed in a single linear pass over the arrays, without any pointer chasing
+or recursion.
+
+The scene and its objects implement @ref AbstractObject interface, so
+@ref Drawable, @ref Camera and other features work with them unchanged:
+@code
+FlatScene3D scene;
+FlatObject3D& cameraObject = scene.addObject();
+Camera3D camera{cameraObject};
+
+FlatObject3D& parent = scene.addObject();
+FlatObject3D& child = scene.addObject(&parent);
+DrawableGroup3D drawables;
+MyDrawable drawable{child, &drawables};
+
+parent.setTransformation(Matrix4::translation(Vector3::xAxis(5.0f)));
+camera.draw(drawables);
+@endcode
+
+Changing transformation of an object is @f$ \mathcal{O}(1) @f$, as only the
+object itself is marked as dirty and the dirty state is propagated to its
+children during the next linear pass. Cleaning any object with
+@ref AbstractObject::setClean() cleans the whole scene at once, features of
+dirty objects are notified with @ref AbstractFeature::markDirty() right before
+being cleaned, similarly to @ref DirtyPropagation::Lazy.
+
+Objects cannot be reparented or removed individually, they are destroyed
+together with the scene.
+
+@anchor SceneGraph-FlatScene-explicit-specializations
+## Explicit template specializations
+
+The following specializations are explicitly compiled into @ref SceneGraph
+library. For other specializations (e.g. using @ref Magnum::Double "Double"
+type) you have to use @ref FlatScene.hpp implementation file to avoid linker
+errors. See also @ref compilation-speedup-hpp for more information.
+
+-   @ref FlatScene2D
+-   @ref FlatScene3D
+
+@see @ref BasicFlatScene2D, @ref BasicFlatScene3D
+*/
+template<UnsignedInt dimensions, class T> class FlatScene: public AbstractObject<dimensions, T> {
+    friend FlatObject<dimensions, T>;
+
+    public:
+        /** @brief Matrix type */
+        typedef MatrixTypeFor<dimensions, T> MatrixType;
+
+        explicit FlatScene();
+
+        /** @brief Copying is not allowed */
+        FlatScene(const FlatScene<dimensions, T>&) = delete;
+
+        /** @brief Moving is not allowed */
+        FlatScene(FlatScene<dimensions, T>&&) = delete;
+
+        /**
+         * @brief Destructor
+         *
+         * Destroys all objects and their features.
+         */
+        ~FlatScene();
+
+        /** @brief Copying is not allowed */
+        FlatScene<dimensions, T>& operator=(const FlatScene<dimensions, T>&) = delete;
+
+        /** @brief Moving is not allowed */
+        FlatScene<dimensions, T>& operator=(FlatScene<dimensions, T>&&) = delete;
+
+        /** @brief Object count */
+        std::size_t objectCount() const { return _objects.size(); }
+
+        /** @brief Object with given ID */
+        FlatObject<dimensions, T>& object(UnsignedInt id);
+        const FlatObject<dimensions, T>& object(UnsignedInt id) const; /**< @overload */
+
+        /**
+         * @brief Reserve memory for given object count
+         * @return Reference to self (for method chaining)
+         */
+        FlatScene<dimensions, T>& reserve(std::size_t count);
+
+        /**
+         * @brief Add object
+         * @param parent    Parent object or `nullptr` if the object should be
+         *      direct child of the scene
+         *
+         * The object has identity transformation and is dirty.
+         */
+        FlatObject<dimensions, T>& addObject(FlatObject<dimensions, T>* parent = nullptr);
+
+        /**
+         * @brief Absolute transformation matrices of all objects
+         *
+         * Updates the transformations if any of them changed, indexed by
+         * @ref FlatObject::id(). As parents always precede their children,
+         * only objects starting from the first changed one are recomputed.
+         * Unlike @ref AbstractObject::setClean() this
+         * doesn't clean object features.
+         */
+        const std::vector<MatrixType>& absoluteTransformationMatrices() const;
+
+    private:
+        enum: UnsignedInt { NoParent = ~UnsignedInt{} };
+
+        AbstractObject<dimensions, T>* doScene() override final;
+        const AbstractObject<dimensions, T>* doScene() const override final;
+
+        MatrixType MAGNUM_SCENEGRAPH_LOCAL doTransformationMatrix() const override final;
+        MatrixType MAGNUM_SCENEGRAPH_LOCAL doAbsoluteTransformationMatrix() const override final;
+        void doTransformationMatrices(const std::vector<std::reference_wrapper<AbstractObject<dimensions, T>>>& objects, std::vector<MatrixType>& transformationMatrices, const MatrixType& initialTransformationMatrix) const override final;
+
+        bool MAGNUM_SCENEGRAPH_LOCAL doIsDirty() const override final;
+        void MAGNUM_SCENEGRAPH_LOCAL doSetDirty() override final;
+        void doSetClean() override final;
+        void doSetClean(const std::vector<std::reference_wrapper<AbstractObject<dimensions, T>>>& objects) override final;
+
+        bool MAGNUM_SCENEGRAPH_LOCAL isDirtyInternal(UnsignedInt id) const;
+
+        std::vector<MatrixType> _transformations;
+        std::vector<UnsignedInt> _parents;
+        std::vector<UnsignedByte> _dirty;
+        std::vector<FlatObject<dimensions, T>*> _objects;
+
+        /* Lazily updated from const functions */
+        mutable std::vector<MatrixType> _absoluteTransformations;
+        /* Index of the first object with changed transformation, equal to
+           object count if there is none */
+        mutable std::size_t _firstDirtyTransformation;
+        bool _anyDirty;
+};
+
+/**
+@brief Flat scene for two-dimensional scenes
+
+Convenience alternative to `FlatScene<2, T>`. See @ref FlatScene for more
+information.
+@see @ref FlatScene2D, @ref BasicFlatScene3D
+*/
+#ifndef CORRADE_MSVC2015_COMPATIBILITY /* Multiple definitions still broken */
+template<class T> using BasicFlatScene2D = FlatScene<2, T>;
+#endif
+
+/**
+@brief Flat scene for two-dimensional float scenes
+
+@see @ref FlatScene3D
+*/
+typedef BasicFlatScene2D<Float> FlatScene2D;
+
+/**
+@brief Flat scene for three-dimensional scenes
+
+Convenience alternative to `FlatScene<3, T>`. See @ref FlatScene for more
+information.
+@see @ref FlatScene3D, @ref BasicFlatScene2D
+*/
+#ifndef CORRADE_MSVC2015_COMPATIBILITY /* Multiple definitions still broken */
+template<class T> using BasicFlatScene3D = FlatScene<3, T>;
+#endif
+
+/**
+@brief Flat scene for three-dimensional float scenes
+
+@see @ref FlatScene2D
+*/
+typedef BasicFlatScene3D<Float> FlatScene3D;
+
+/**
+@brief Object in flat scene for two-dimensional scenes
+
+Convenience alternative to `FlatObject<2, T>`. See @ref FlatObject for more
+information.
+@see @ref FlatObject2D, @ref BasicFlatObject3D
+*/
+#ifndef CORRADE_MSVC2015_COMPATIBILITY /* Multiple definitions still broken */
+template<class T> using BasicFlatObject2D = FlatObject<2, T>;
+#endif
+
+/**
+@brief Object in flat scene for two-dimensional float scenes
+
+@see @ref FlatObject3D
+*/
+typedef BasicFlatObject2D<Float> FlatObject2D;
+
+/**
+@brief Object in flat scene for three-dimensional scenes
+
+Convenience alternative to `FlatObject<3, T>`. See @ref FlatObject for more
+information.
+@see @ref FlatObject3D, @ref BasicFlatObject2D
+*/
+#ifndef CORRADE_MSVC2015_COMPATIBILITY /* Multiple definitions still broken */
+template<class T> using BasicFlatObject3D = FlatObject<3, T>;
+#endif
+
+/**
+@brief Object in flat scene for three-dimensional float scenes
+
+@see @ref FlatObject2D
+*/
+typedef BasicFlatObject3D<Float> FlatObject3D;
+
+#if defined(CORRADE_TARGET_WINDOWS) && !defined(__MINGW32__)
+extern template class MAGNUM_SCENEGRAPH_EXPORT FlatObject<2, Float>;
+extern template class MAGNUM_SCENEGRAPH_EXPORT FlatObject<3, Float>;
+extern template class MAGNUM_SCENEGRAPH_EXPORT FlatScene<2, Float>;
+extern template class MAGNUM_SCENEGRAPH_EXPORT FlatScene<3, Float>;
+#endif
+
+}}
+
+#endif
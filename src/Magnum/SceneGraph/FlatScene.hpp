@@ -0,0 +1,243 @@
+#ifndef Magnum_SceneGraph_FlatScene_hpp
+#define Magnum_SceneGraph_FlatScene_hpp
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+
+/** @file
+ * @brief @ref compilation-speedup-hpp "Template implementation" for @ref FlatScene.h
+ */
+
+#include <algorithm>
+
+#include "Magnum/SceneGraph/AbstractFeature.h"
+#include "Magnum/SceneGraph/FlatScene.h"
+
+namespace Magnum { namespace SceneGraph {
+
+template<UnsignedInt dimensions, class T> FlatObject<dimensions, T>::FlatObject(FlatScene<dimensions, T>& scene, const UnsignedInt id): _scene(scene), _id{id} {}
+
+template<UnsignedInt dimensions, class T> FlatObject<dimensions, T>::~FlatObject() = default;
+
+template<UnsignedInt dimensions, class T> FlatObject<dimensions, T>* FlatObject<dimensions, T>::parent() {
+    const UnsignedInt parent = _scene._parents[_id];
+    return parent == FlatScene<dimensions, T>::NoParent ? nullptr : _scene._objects[parent];
+}
+
+template<UnsignedInt dimensions, class T> const FlatObject<dimensions, T>* FlatObject<dimensions, T>::parent() const {
+    const UnsignedInt parent = _scene._parents[_id];
+    return parent == FlatScene<dimensions, T>::NoParent ? nullptr : _scene._objects[parent];
+}
+
+template<UnsignedInt dimensions, class T> auto FlatObject<dimensions, T>::transformation() const -> MatrixType {
+    return _scene._transformations[_id];
+}
+
+template<UnsignedInt dimensions, class T> FlatObject<dimensions, T>& FlatObject<dimensions, T>::setTransformation(const MatrixType& transformation) {
+    _scene._transformations[_id] = transformation;
+    _scene._firstDirtyTransformation = std::min(_scene._firstDirtyTransformation, std::size_t(_id));
+    doSetDirty();
+    return *this;
+}
+
+template<UnsignedInt dimensions, class T> AbstractObject<dimensions, T>* FlatObject<dimensions, T>::doScene() { return &_scene; }
+template<UnsignedInt dimensions, class T> const AbstractObject<dimensions, T>* FlatObject<dimensions, T>::doScene() const { return &_scene; }
+
+template<UnsignedInt dimensions, class T> auto FlatObject<dimensions, T>::doTransformationMatrix() const -> MatrixType {
+    return transformation();
+}
+
+template<UnsignedInt dimensions, class T> auto FlatObject<dimensions, T>::doAbsoluteTransformationMatrix() const -> MatrixType {
+    return _scene.absoluteTransformationMatrices()[_id];
+}
+
+template<UnsignedInt dimensions, class T> void FlatObject<dimensions, T>::doTransformationMatrices(const std::vector<std::reference_wrapper<AbstractObject<dimensions, T>>>&, std::vector<MatrixType>& transformationMatrices, const MatrixType&) const {
+    transformationMatrices.clear();
+    CORRADE_ASSERT(false, "SceneGraph::FlatObject::transformationMatrices(): currently implemented only for FlatScene", );
+}
+
+template<UnsignedInt dimensions, class T> bool FlatObject<dimensions, T>::doIsDirty() const {
+    return _scene.isDirtyInternal(_id);
+}
+
+template<UnsignedInt dimensions, class T> void FlatObject<dimensions, T>::doSetDirty() {
+    /* Children are marked implicitly during next cleaning pass */
+    _scene._dirty[_id] = true;
+    _scene._anyDirty = true;
+}
+
+template<UnsignedInt dimensions, class T> void FlatObject<dimensions, T>::doSetClean() {
+    _scene.doSetClean();
+}
+
+template<UnsignedInt dimensions, class T> void FlatObject<dimensions, T>::doSetClean(const std::vector<std::reference_wrapper<AbstractObject<dimensions, T>>>&) {
+    _scene.doSetClean();
+}
+
+template<UnsignedInt dimensions, class T> void FlatObject<dimensions, T>::setCleanInternal(const MatrixType& absoluteTransformationMatrix) {
+    /* "Lazy storage" for inverted transformation matrix */
+    bool invertedComputed = false;
+    MatrixType invertedMatrix;
+
+    for(AbstractFeature<dimensions, T>& feature: this->features()) {
+        /* The feature wasn't notified when the object got dirty, do it now */
+        feature.markDirty();
+
+        if(feature.cachedTransformations() & CachedTransformation::Absolute && !feature.cleanBatched(absoluteTransformationMatrix))
+            feature.clean(absoluteTransformationMatrix);
+
+        if(feature.cachedTransformations() & CachedTransformation::InvertedAbsolute) {
+            if(!invertedComputed) {
+                invertedComputed = true;
+                invertedMatrix = absoluteTransformationMatrix.inverted();
+            }
+
+            feature.cleanInverted(invertedMatrix);
+        }
+    }
+}
+
+template<UnsignedInt dimensions, class T> FlatScene<dimensions, T>::FlatScene(): _firstDirtyTransformation{0}, _anyDirty{false} {}
+
+template<UnsignedInt dimensions, class T> FlatScene<dimensions, T>::~FlatScene() {
+    /* Destroy children before their parents */
+    for(auto it = _objects.rbegin(); it != _objects.rend(); ++it) delete *it;
+}
+
+template<UnsignedInt dimensions, class T> FlatObject<dimensions, T>& FlatScene<dimensions, T>::object(const UnsignedInt id) {
+    /* There's no object to return on failure, so not a graceful assert */
+    CORRADE_INTERNAL_ASSERT(id < _objects.size());
+    return *_objects[id];
+}
+
+template<UnsignedInt dimensions, class T> const FlatObject<dimensions, T>& FlatScene<dimensions, T>::object(const UnsignedInt id) const {
+    /* There's no object to return on failure, so not a graceful assert */
+    CORRADE_INTERNAL_ASSERT(id < _objects.size());
+    return *_objects[id];
+}
+
+template<UnsignedInt dimensions, class T> FlatScene<dimensions, T>& FlatScene<dimensions, T>::reserve(const std::size_t count) {
+    _transformations.reserve(count);
+    _parents.reserve(count);
+    _dirty.reserve(count);
+    _objects.reserve(count);
+    _absoluteTransformations.reserve(count);
+    return *this;
+}
+
+template<UnsignedInt dimensions, class T> FlatObject<dimensions, T>& FlatScene<dimensions, T>::addObject(FlatObject<dimensions, T>* const parent) {
+    CORRADE_ASSERT(!parent || &parent->_scene == this,
+        "SceneGraph::FlatScene::addObject(): parent is not part of this scene", *parent);
+
+    const UnsignedInt id = _objects.size();
+    _transformations.emplace_back();
+    _parents.push_back(parent ? parent->_id : NoParent);
+    _dirty.push_back(true);
+    _absoluteTransformations.emplace_back();
+    _objects.push_back(new FlatObject<dimensions, T>{*this, id});
+
+    _firstDirtyTransformation = std::min(_firstDirtyTransformation, std::size_t(id));
+    _anyDirty = true;
+    return *_objects.back();
+}
+
+template<UnsignedInt dimensions, class T> auto FlatScene<dimensions, T>::absoluteTransformationMatrices() const -> const std::vector<MatrixType>& {
+    /* Parent always precedes its children, so its absolute transformation is
+       already computed when we get to them. Objects before the first changed
+       one are thus not affected by the change. */
+    for(std::size_t i = _firstDirtyTransformation; i < _transformations.size(); ++i) {
+        const UnsignedInt parent = _parents[i];
+        _absoluteTransformations[i] = parent == NoParent ? _transformations[i] :
+            _absoluteTransformations[parent]*_transformations[i];
+    }
+
+    _firstDirtyTransformation = _transformations.size();
+    return _absoluteTransformations;
+}
+
+template<UnsignedInt dimensions, class T> AbstractObject<dimensions, T>* FlatScene<dimensions, T>::doScene() { return this; }
+template<UnsignedInt dimensions, class T> const AbstractObject<dimensions, T>* FlatScene<dimensions, T>::doScene() const { return this; }
+
+template<UnsignedInt dimensions, class T> auto FlatScene<dimensions, T>::doTransformationMatrix() const -> MatrixType {
+    return {};
+}
+
+template<UnsignedInt dimensions, class T> auto FlatScene<dimensions, T>::doAbsoluteTransformationMatrix() const -> MatrixType {
+    return {};
+}
+
+template<UnsignedInt dimensions, class T> void FlatScene<dimensions, T>::doTransformationMatrices(const std::vector<std::reference_wrapper<AbstractObject<dimensions, T>>>& objects, std::vector<MatrixType>& transformationMatrices, const MatrixType& initialTransformationMatrix) const {
+    const std::vector<MatrixType>& absoluteTransformations = absoluteTransformationMatrices();
+
+    transformationMatrices.clear();
+    for(const AbstractObject<dimensions, T>& object: objects) {
+        if(&object == this) {
+            transformationMatrices.push_back(initialTransformationMatrix);
+            continue;
+        }
+
+        /* Cannot check the type, so at least check the scene */
+        if(object.scene() != this) {
+            transformationMatrices.clear();
+            CORRADE_ASSERT(false, "SceneGraph::FlatScene::transformationMatrices(): the objects are not part of the same scene", );
+        }
+        transformationMatrices.push_back(initialTransformationMatrix*absoluteTransformations[static_cast<const FlatObject<dimensions, T>&>(object)._id]);
+    }
+}
+
+template<UnsignedInt dimensions, class T> bool FlatScene<dimensions, T>::doIsDirty() const { return false; }
+
+template<UnsignedInt dimensions, class T> void FlatScene<dimensions, T>::doSetDirty() {}
+
+template<UnsignedInt dimensions, class T> void FlatScene<dimensions, T>::doSetClean() {
+    if(!_anyDirty) return;
+
+    const std::vector<MatrixType>& absoluteTransformations = absoluteTransformationMatrices();
+
+    /* Propagate the dirty state from parents in the same pass as cleaning.
+       The flags are reset only afterwards, so the children see it. */
+    for(std::size_t i = 0; i != _objects.size(); ++i) {
+        const UnsignedInt parent = _parents[i];
+        if(parent != NoParent && _dirty[parent]) _dirty[i] = true;
+        if(_dirty[i]) _objects[i]->setCleanInternal(absoluteTransformations[i]);
+    }
+
+    std::fill(_dirty.begin(), _dirty.end(), false);
+    _anyDirty = false;
+}
+
+template<UnsignedInt dimensions, class T> void FlatScene<dimensions, T>::doSetClean(const std::vector<std::reference_wrapper<AbstractObject<dimensions, T>>>&) {
+    doSetClean();
+}
+
+template<UnsignedInt dimensions, class T> bool FlatScene<dimensions, T>::isDirtyInternal(UnsignedInt id) const {
+    for(; id != NoParent; id = _parents[id])
+        if(_dirty[id]) return true;
+    return false;
+}
+
+}}
+
+#endif
@@ -0,0 +1,356 @@
+#ifndef Magnum_SceneGraph_InstancedDrawable_h
+#define Magnum_SceneGraph_InstancedDrawable_h
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+/** @file
+ * @brief Class @ref Magnum::SceneGraph::InstancedDrawable, @ref Magnum::SceneGraph::Instance, alias @ref Magnum::SceneGraph::InstanceGroup, @ref Magnum::SceneGraph::BasicInstanceGroup2D, @ref Magnum::SceneGraph::BasicInstanceGroup3D, @ref Magnum::SceneGraph::BasicInstancedDrawable2D, @ref Magnum::SceneGraph::BasicInstancedDrawable3D, @ref Magnum::SceneGraph::BasicInstance2D, @ref Magnum::SceneGraph::BasicInstance3D, typedef @ref Magnum::SceneGraph::InstanceGroup2D, @ref Magnum::SceneGraph::InstanceGroup3D, @ref Magnum::SceneGraph::InstancedDrawable2D, @ref Magnum::SceneGraph::InstancedDrawable3D, @ref Magnum::SceneGraph::Instance2D, @ref Magnum::SceneGraph::Instance3D
+ */
+
+#include "Magnum/Buffer.h"
+#include "Magnum/SceneGraph/Drawable.h"
+#include "Magnum/SceneGraph/FeatureGroup.h"
+
+namespace Magnum { namespace SceneGraph {
+
+/**
+@brief Instance of instanced drawable
+
+Marks the object as one instance of an @ref InstancedDrawable. The object
+itself doesn't need any drawable, its transformation is collected and drawn
+by the instanced drawable. See @ref InstancedDrawable for more information.
+@see @ref scenegraph, @ref BasicInstance2D, @ref BasicInstance3D,
+    @ref Instance2D, @ref Instance3D
+*/
+template<UnsignedInt dimensions, class T> class Instance: public AbstractGroupedFeature<dimensions, Instance<dimensions, T>, T> {
+    public:
+        /**
+         * @brief Constructor
+         * @param object    Object this instance belongs to
+         * @param instances Instance group, usually
+         *      @ref InstancedDrawable::instances()
+         */
+        explicit Instance(AbstractObject<dimensions, T>& object, InstanceGroup<dimensions, T>* instances = nullptr): AbstractGroupedFeature<dimensions, Instance<dimensions, T>, T>(object, instances) {}
+
+        /**
+         * @brief Group containing this instance
+         *
+         * If the instance doesn't belong to any group, returns `nullptr`.
+         */
+        InstanceGroup<dimensions, T>* instances() {
+            return AbstractGroupedFeature<dimensions, Instance<dimensions, T>, T>::group();
+        }
+
+        /** @overload */
+        const InstanceGroup<dimensions, T>* instances() const {
+            return AbstractGroupedFeature<dimensions, Instance<dimensions, T>, T>::group();
+        }
+};
+
+/**
+@brief Instance for two-dimensional scenes
+
+Convenience alternative to `Instance<2, T>`. See @ref InstancedDrawable for
+more information.
+@see @ref Instance2D, @ref BasicInstance3D
+*/
+#ifndef CORRADE_MSVC2015_COMPATIBILITY /* Multiple definitions still broken */
+template<class T> using BasicInstance2D = Instance<2, T>;
+#endif
+
+/**
+@brief Instance for two-dimensional float scenes
+
+@see @ref Instance3D
+*/
+typedef BasicInstance2D<Float> Instance2D;
+
+/**
+@brief Instance for three-dimensional scenes
+
+Convenience alternative to `Instance<3, T>`. See @ref InstancedDrawable for
+more information.
+@see @ref Instance3D, @ref BasicInstance2D
+*/
+#ifndef CORRADE_MSVC2015_COMPATIBILITY /* Multiple definitions still broken */
+template<class T> using BasicInstance3D = Instance<3, T>;
+#endif
+
+/**
+@brief Instance for three-dimensional float scenes
+
+@see @ref Instance2D
+*/
+typedef BasicInstance3D<Float> Instance3D;
+
+/**
+@brief Group of instances
+
+See @ref InstancedDrawable for more information.
+@see @ref BasicInstanceGroup2D, @ref BasicInstanceGroup3D,
+    @ref InstanceGroup2D, @ref InstanceGroup3D
+*/
+#ifndef CORRADE_MSVC2015_COMPATIBILITY /* Multiple definitions still broken */
+template<UnsignedInt dimensions, class T> using InstanceGroup = FeatureGroup<dimensions, Instance<dimensions, T>, T>;
+#endif
+
+/**
+@brief Group of instances for two-dimensional scenes
+
+Convenience alternative to `InstanceGroup<2, T>`. See
+@ref InstancedDrawable for more information.
+@see @ref InstanceGroup2D, @ref BasicInstanceGroup3D
+*/
+#ifndef CORRADE_MSVC2015_COMPATIBILITY /* Multiple definitions still broken */
+template<class T> using BasicInstanceGroup2D = InstanceGroup<2, T>;
+#endif
+
+/**
+@brief Group of instances for two-dimensional float scenes
+
+@see @ref InstanceGroup3D
+*/
+typedef BasicInstanceGroup2D<Float> InstanceGroup2D;
+
+/**
+@brief Group of instances for three-dimensional scenes
+
+Convenience alternative to `InstanceGroup<3, T>`. See
+@ref InstancedDrawable for more information.
+@see @ref InstanceGroup3D, @ref BasicInstanceGroup2D
+*/
+#ifndef CORRADE_MSVC2015_COMPATIBILITY /* Multiple definitions still broken */
+template<class T> using BasicInstanceGroup3D = InstanceGroup<3, T>;
+#endif
+
+/**
+@brief Group of instances for three-dimensional float scenes
+
+@see @ref InstanceGroup2D
+*/
+typedef BasicInstanceGroup3D<Float> InstanceGroup3D;
+
+/**
+@brief Instanced drawable
+
+Draws many copies of the same mesh with a single instanced draw call. Each
+copy is an object with an @ref Instance feature added to @ref instances().
+Every time the drawable is drawn, transformations of all instances relative
+to the camera are collected, uploaded into @ref instanceBuffer() and
+@ref drawInstances() is called to issue the draw.
+
+## Usage
+
+Subclass the drawable and implement @ref drawInstances(). The instance buffer
+contains one @ref Matrix3 or @ref Matrix4 per instance, bind it to the mesh
+as an instanced attribute:
+@code
+class Crowd: public SceneGraph::InstancedDrawable3D {
+    public:
+        explicit Crowd(Object3D& object, SceneGraph::DrawableGroup3D& drawables): SceneGraph::InstancedDrawable3D{object, &drawables} {
+            _mesh.addVertexBufferInstanced(instanceBuffer(), 1, 0,
+                MyShader::TransformationMatrix{});
+        }
+
+    private:
+        void drawInstances(Int count, UnsignedInt baseInstance, SceneGraph::Camera3D& camera) override {
+            _shader.setProjectionMatrix(camera.projectionMatrix());
+            _mesh.setInstanceCount(count)
+                .setBaseInstance(baseInstance)
+                .draw(_shader);
+        }
+
+        Mesh _mesh;
+        MyShader _shader;
+};
+
+Crowd crowd{scene, drawables};
+for(Object3D* person: people)
+    new SceneGraph::Instance3D{*person, &crowd.instances()};
+@endcode
+
+The transformation of the object the instanced drawable itself is attached
+to doesn't affect the instances. If @ref setInstanceRadius() is set,
+instances outside of the camera frustum are not drawn.
+
+## Double buffering
+
+On desktop OpenGL with @extension{ARB,base_instance} (part of OpenGL 4.2)
+the instance buffer is split into two halves and each draw writes into the
+half not used by the previous draw, so the GPU can still read the previous
+data while the next one is being written. The mapping is synchronized and
+invalidates the written range, so it's safe even if the drawable is drawn
+more than once per frame (e.g. from more cameras or in a shadow pass). The
+half is selected via @p baseInstance parameter of @ref drawInstances(), which
+needs to be passed to @ref Mesh::setBaseInstance(). Without the extension the
+whole buffer is invalidated on each draw and @p baseInstance is always `0`.
+On OpenGL ES and WebGL the buffer data are respecified on each draw instead
+and @p baseInstance is always `0` as well. The buffer grows as needed and is
+created on first use, so the drawable can be constructed without OpenGL
+context.
+
+## Explicit template specializations
+
+The following specializations are explicitly compiled into @ref SceneGraph
+library. For other specializations you have to use
+@ref InstancedDrawable.hpp implementation file to avoid linker errors. See
+also @ref compilation-speedup-hpp for more information.
+
+-   @ref InstancedDrawable2D, @ref Instance2D
+-   @ref InstancedDrawable3D, @ref Instance3D
+
+@see @ref scenegraph, @ref BasicInstancedDrawable2D,
+    @ref BasicInstancedDrawable3D, @ref InstancedDrawable2D,
+    @ref InstancedDrawable3D
+*/
+template<UnsignedInt dimensions, class T> class InstancedDrawable: public Drawable<dimensions, T> {
+    public:
+        /**
+         * @brief Constructor
+         * @param object    Object this drawable belongs to
+         * @param drawables Group this drawable belongs to
+         */
+        explicit InstancedDrawable(AbstractObject<dimensions, T>& object, DrawableGroup<dimensions, T>* drawables = nullptr);
+
+        ~InstancedDrawable();
+
+        /** @brief Instances */
+        InstanceGroup<dimensions, T>& instances() { return _instances; }
+        const InstanceGroup<dimensions, T>& instances() const { return _instances; } /**< @overload */
+
+        /**
+         * @brief Instance bounding sphere radius
+         *
+         * @see @ref setInstanceRadius()
+         */
+        T instanceRadius() const { return _instanceRadius; }
+
+        /**
+         * @brief Set instance bounding sphere radius
+         * @return Reference to self (for method chaining)
+         *
+         * Radius of bounding sphere around origin of each instance, in
+         * instance-local coordinates. If nonzero, instances outside of the
+         * camera frustum are not drawn. Default is `0`.
+         */
+        InstancedDrawable<dimensions, T>& setInstanceRadius(T radius);
+
+        /**
+         * @brief Instance buffer
+         *
+         * Contains transformation matrix of each drawn instance relative to
+         * the camera. The buffer is created on first call.
+         */
+        Buffer& instanceBuffer();
+
+        /**
+         * @brief Count of instances drawn in last draw
+         *
+         * Instances culled against the camera frustum are not counted.
+         */
+        std::size_t instanceCount() const { return _instanceCount; }
+
+        /**
+         * @brief Collect instance transformations
+         * @param camera                Camera
+         * @param transformationMatrices Where to put the transformations
+         *
+         * Puts transformation of each visible instance relative to @p camera
+         * into @p transformationMatrices. Memory of the vector is reused.
+         * Called from @ref draw(), useful for custom upload paths.
+         */
+        void collectInstances(Camera<dimensions, T>& camera, std::vector<MatrixTypeFor<dimensions, T>>& transformationMatrices);
+
+    protected:
+        /**
+         * @brief Draw the instances
+         * @param count         Instance count
+         * @param baseInstance  First instance in @ref instanceBuffer().
+         *      Nonzero only if @extension{ARB,base_instance} is supported.
+         * @param camera        Camera
+         *
+         * Called from @ref Camera::draw() after the instance transformations
+         * are uploaded. Not called if there are no visible instances.
+         */
+        virtual void drawInstances(Int count, UnsignedInt baseInstance, Camera<dimensions, T>& camera) = 0;
+
+    private:
+        void draw(const MatrixTypeFor<dimensions, T>& transformationMatrix, Camera<dimensions, T>& camera) override final;
+
+        InstanceGroup<dimensions, T> _instances;
+        Buffer _buffer;
+        T _instanceRadius;
+        std::size_t _instanceCount, _capacity;
+        UnsignedInt _region;
+
+        /* Kept between calls to avoid allocations */
+        std::vector<std::reference_wrapper<AbstractObject<dimensions, T>>> _objects;
+        std::vector<MatrixTypeFor<dimensions, T>> _transformations;
+};
+
+/**
+@brief Instanced drawable for two-dimensional scenes
+
+Convenience alternative to `InstancedDrawable<2, T>`. See
+@ref InstancedDrawable for more information.
+@see @ref InstancedDrawable2D, @ref BasicInstancedDrawable3D
+*/
+#ifndef CORRADE_MSVC2015_COMPATIBILITY /* Multiple definitions still broken */
+template<class T> using BasicInstancedDrawable2D = InstancedDrawable<2, T>;
+#endif
+
+/**
+@brief Instanced drawable for two-dimensional float scenes
+
+@see @ref InstancedDrawable3D
+*/
+typedef BasicInstancedDrawable2D<Float> InstancedDrawable2D;
+
+/**
+@brief Instanced drawable for three-dimensional scenes
+
+Convenience alternative to `InstancedDrawable<3, T>`. See
+@ref InstancedDrawable for more information.
+@see @ref InstancedDrawable3D, @ref BasicInstancedDrawable2D
+*/
+#ifndef CORRADE_MSVC2015_COMPATIBILITY /* Multiple definitions still broken */
+template<class T> using BasicInstancedDrawable3D = InstancedDrawable<3, T>;
+#endif
+
+/**
+@brief Instanced drawable for three-dimensional float scenes
+
+@see @ref InstancedDrawable2D
+*/
+typedef BasicInstancedDrawable3D<Float> InstancedDrawable3D;
+
+#if defined(CORRADE_TARGET_WINDOWS) && !defined(__MINGW32__)
+extern template class MAGNUM_SCENEGRAPH_EXPORT InstancedDrawable<2, Float>;
+extern template class MAGNUM_SCENEGRAPH_EXPORT InstancedDrawable<3, Float>;
+#endif
+
+}}
+
+#endif
@@ -0,0 +1,162 @@
+#ifndef Magnum_SceneGraph_InstancedDrawable_hpp
+#define Magnum_SceneGraph_InstancedDrawable_hpp
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+/** @file
+ * @brief @ref compilation-speedup-hpp "Template implementation" for @ref InstancedDrawable.h
+ */
+
+#include <algorithm>
+
+#include "Magnum/Context.h"
+#include "Magnum/Extensions.h"
+#include "Magnum/Math/Functions.h"
+#include "Magnum/SceneGraph/AbstractObject.h"
+#include "Magnum/SceneGraph/Camera.h"
+#include "Magnum/SceneGraph/Drawable.hpp"
+#include "Magnum/SceneGraph/InstancedDrawable.h"
+#include "Magnum/SceneGraph/frustumImplementation.h"
+
+namespace Magnum { namespace SceneGraph {
+
+template<UnsignedInt dimensions, class T> InstancedDrawable<dimensions, T>::InstancedDrawable(AbstractObject<dimensions, T>& object, DrawableGroup<dimensions, T>* drawables): Drawable<dimensions, T>{object, drawables}, _buffer{NoCreate}, _instanceRadius{}, _instanceCount{}, _capacity{}, _region{} {}
+
+template<UnsignedInt dimensions, class T> InstancedDrawable<dimensions, T>::~InstancedDrawable() = default;
+
+template<UnsignedInt dimensions, class T> InstancedDrawable<dimensions, T>& InstancedDrawable<dimensions, T>::setInstanceRadius(const T radius) {
+    CORRADE_ASSERT(radius >= T(0), "SceneGraph::InstancedDrawable::setInstanceRadius(): negative radius", *this);
+    _instanceRadius = radius;
+    return *this;
+}
+
+template<UnsignedInt dimensions, class T> Buffer& InstancedDrawable<dimensions, T>::instanceBuffer() {
+    if(!_buffer.id()) _buffer = Buffer{Buffer::TargetHint::Array};
+    return _buffer;
+}
+
+template<UnsignedInt dimensions, class T> void InstancedDrawable<dimensions, T>::collectInstances(Camera<dimensions, T>& camera, std::vector<MatrixTypeFor<dimensions, T>>& transformationMatrices) {
+    AbstractObject<dimensions, T>* scene = camera.object().scene();
+    CORRADE_ASSERT(scene, "SceneGraph::InstancedDrawable::collectInstances(): camera is not part of any scene", );
+
+    /* Transformations of all instances relative to the camera */
+    _objects.clear();
+    _objects.reserve(_instances.size());
+    for(std::size_t i = 0; i != _instances.size(); ++i)
+        _objects.push_back(_instances[i].object());
+    scene->transformationMatrices(_objects, transformationMatrices, camera.cameraMatrix());
+
+    if(_instanceRadius == T(0)) return;
+
+    /* Cull the bounding spheres against the view frustum, keeping the
+       visible transformations in place. The planes are not normalized, so
+       the radius is scaled by normal length instead. */
+    Math::Vector<dimensions + 1, T> planes[dimensions*2];
+    Implementation::frustumPlanes<dimensions, T>(camera.projectionMatrix(), planes);
+    T normalLengths[dimensions*2];
+    for(std::size_t p = 0; p != dimensions*2; ++p) {
+        T normalLengthSquared{};
+        for(UnsignedInt k = 0; k != dimensions; ++k)
+            normalLengthSquared += planes[p][k]*planes[p][k];
+        normalLengths[p] = Math::sqrt(normalLengthSquared);
+    }
+
+    std::size_t visibleCount = 0;
+    for(std::size_t i = 0; i != transformationMatrices.size(); ++i) {
+        const MatrixTypeFor<dimensions, T>& transformation = transformationMatrices[i];
+
+        /* Scale the radius by the largest axis scale */
+        T maxScaleSquared{};
+        for(UnsignedInt k = 0; k != dimensions; ++k)
+            maxScaleSquared = Math::max(maxScaleSquared, transformation[k].dot());
+        const T radius = _instanceRadius*Math::sqrt(maxScaleSquared);
+
+        bool visible = true;
+        for(std::size_t p = 0; p != dimensions*2; ++p) {
+            T distance = planes[p][dimensions];
+            for(UnsignedInt k = 0; k != dimensions; ++k)
+                distance += planes[p][k]*transformation[dimensions][k];
+            visible &= distance + radius*normalLengths[p] >= T(0);
+        }
+
+        if(visible) transformationMatrices[visibleCount++] = transformation;
+    }
+
+    transformationMatrices.resize(visibleCount);
+}
+
+template<UnsignedInt dimensions, class T> void InstancedDrawable<dimensions, T>::draw(const MatrixTypeFor<dimensions, T>&, Camera<dimensions, T>& camera) {
+    collectInstances(camera, _transformations);
+    _instanceCount = _transformations.size();
+    if(_transformations.empty()) return;
+
+    Buffer& buffer = instanceBuffer();
+    const std::size_t count = _transformations.size();
+    UnsignedInt baseInstance = 0;
+
+    #ifndef MAGNUM_TARGET_GLES
+    /* Selecting the half via base instance needs ARB_base_instance, without
+       it the whole buffer is orphaned on every draw instead */
+    const bool doubleBuffered = Context::current()->isExtensionSupported<Extensions::GL::ARB::base_instance>();
+    const std::size_t regionCount = doubleBuffered ? 2 : 1;
+
+    /* Grow the buffer, with some headroom so it doesn't need to be
+       reallocated every time an instance is added */
+    if(count > _capacity) {
+        _capacity = std::max(count, 2*_capacity);
+        buffer.setData({nullptr, regionCount*_capacity*sizeof(MatrixTypeFor<dimensions, T>)}, BufferUsage::StreamDraw);
+    }
+
+    /* Write into the half which wasn't used by the previous draw. The drawable
+       can be drawn more than once per frame and the driver can queue any
+       number of frames, so the GPU might still read even this half. The
+       mapping is thus synchronized, the range invalidation lets the driver
+       avoid the wait in most cases. Without base instance support the whole
+       buffer is invalidated, which lets the driver allocate new storage
+       instead of waiting for the GPU. */
+    Buffer::MapFlags flags = Buffer::MapFlag::Write;
+    if(doubleBuffered) {
+        _region ^= 1;
+        baseInstance = _region*_capacity;
+        flags |= Buffer::MapFlag::InvalidateRange;
+    } else flags |= Buffer::MapFlag::InvalidateBuffer;
+
+    MatrixTypeFor<dimensions, T>* const data = buffer.map<MatrixTypeFor<dimensions, T>>(
+        baseInstance*sizeof(MatrixTypeFor<dimensions, T>),
+        count*sizeof(MatrixTypeFor<dimensions, T>), flags);
+    CORRADE_INTERNAL_ASSERT(data);
+    std::copy(_transformations.begin(), _transformations.end(), data);
+    CORRADE_INTERNAL_ASSERT_OUTPUT(buffer.unmap());
+    #else
+    /* Respecify the whole buffer, the driver takes care of not stalling */
+    buffer.setData(_transformations, BufferUsage::StreamDraw);
+    #endif
+
+    drawInstances(Int(count), baseInstance, camera);
+}
+
+}}
+
+#endif
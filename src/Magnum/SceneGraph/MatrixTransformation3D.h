@@ -386,8 +386,10 @@ template<class T> struct Transformation<BasicMatrixTransformation3D<T>> {
         return transformation;
     }
 
+    /* Not using the (constexpr) operator, so the product is SIMD-accelerated
+       where available */
     static Math::Matrix4<T> compose(const Math::Matrix4<T>& parent, const Math::Matrix4<T>& child) {
-        return parent*child;
+        return Math::Implementation::MatrixMultiply<4, T>::multiply(parent, child);
     }
 
     static Math::Matrix4<T> inverted(const Math::Matrix4<T>& transformation) {
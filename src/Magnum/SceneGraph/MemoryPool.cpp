@@ -0,0 +1,125 @@
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#include "MemoryPool.h"
+
+#include <new>
+#include <Corrade/Utility/Assert.h>
+#include <Corrade/Utility/Debug.h>
+
+namespace Magnum { namespace SceneGraph {
+
+MemoryPool::MemoryPool(const std::size_t blockSize): _blockSize{blockSize}, _allocationCount{}, _blockRemaining{}, _blockCurrent{}, _free{} {
+    CORRADE_ASSERT(blockSize >= MaxSize,
+        "SceneGraph::MemoryPool: block size must be at least" << std::size_t(MaxSize) << "bytes, got" << blockSize, );
+}
+
+MemoryPool::~MemoryPool() {
+    CORRADE_ASSERT(!_allocationCount,
+        "SceneGraph::MemoryPool: destroyed with" << _allocationCount << "allocations still alive", );
+    for(void* block: _blocks) ::operator delete(block);
+}
+
+void* MemoryPool::allocate(const std::size_t size) {
+    if(size > MaxSize) return ::operator new(size);
+
+    ++_allocationCount;
+
+    /* Reuse freed slot of the same size class */
+    const std::size_t sizeClass = size ? (size - 1)/Granularity : 0;
+    if(FreeSlot* const slot = _free[sizeClass]) {
+        _free[sizeClass] = slot->next;
+        return slot;
+    }
+
+    /* Carve new slot from current block, allocate new one if there's not
+       enough space. The rest of the previous block is wasted, but that's
+       less than MaxSize. */
+    const std::size_t slotSize = (sizeClass + 1)*Granularity;
+    if(_blockRemaining < slotSize) {
+        _blocks.push_back(::operator new(_blockSize));
+        _blockCurrent = static_cast<char*>(_blocks.back());
+        _blockRemaining = _blockSize - _blockSize % Granularity;
+    }
+
+    void* const slot = _blockCurrent;
+    _blockCurrent += slotSize;
+    _blockRemaining -= slotSize;
+    return slot;
+}
+
+void MemoryPool::deallocate(void* const pointer, const std::size_t size) {
+    if(size > MaxSize) return ::operator delete(pointer);
+
+    CORRADE_INTERNAL_ASSERT(_allocationCount);
+    --_allocationCount;
+
+    const std::size_t sizeClass = size ? (size - 1)/Granularity : 0;
+    FreeSlot* const slot = static_cast<FreeSlot*>(pointer);
+    slot->next = _free[sizeClass];
+    _free[sizeClass] = slot;
+}
+
+namespace {
+    /* Pool the memory was allocated from and allocation size are stored in
+       front of the object. The header size keeps the object aligned to
+       MemoryPool::Granularity. */
+    struct Header {
+        MemoryPool* pool;
+        std::size_t size;
+    };
+
+    enum: std::size_t { HeaderSize = MemoryPool::Granularity };
+    static_assert(sizeof(Header) <= HeaderSize, "header too large");
+
+    void* initializeHeader(void* const memory, MemoryPool* const pool, const std::size_t size) {
+        Header* const header = static_cast<Header*>(memory);
+        header->pool = pool;
+        header->size = size;
+        return static_cast<char*>(memory) + HeaderSize;
+    }
+}
+
+void* PoolAllocated::operator new(const std::size_t size, MemoryPool& pool) {
+    return initializeHeader(pool.allocate(size + HeaderSize), &pool, size + HeaderSize);
+}
+
+void* PoolAllocated::operator new(const std::size_t size) {
+    return initializeHeader(::operator new(size + HeaderSize), nullptr, size + HeaderSize);
+}
+
+void PoolAllocated::operator delete(void* const pointer) {
+    if(!pointer) return;
+
+    Header* const header = reinterpret_cast<Header*>(static_cast<char*>(pointer) - HeaderSize);
+    if(header->pool) header->pool->deallocate(header, header->size);
+    else ::operator delete(header);
+}
+
+void PoolAllocated::operator delete(void* const pointer, MemoryPool&) {
+    operator delete(pointer);
+}
+
+}}
@@ -0,0 +1,185 @@
+#ifndef Magnum_SceneGraph_MemoryPool_h
+#define Magnum_SceneGraph_MemoryPool_h
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+/** @file
+ * @brief Class @ref Magnum::SceneGraph::MemoryPool, @ref Magnum::SceneGraph::PoolAllocated
+ */
+
+#include <cstddef>
+#include <vector>
+
+#include "Magnum/Magnum.h"
+#include "Magnum/SceneGraph/visibility.h"
+
+namespace Magnum { namespace SceneGraph {
+
+/**
+@brief Memory pool
+
+Allocator for objects and features, keeping allocations of similar size next
+to each other and recycling freed slots. Allocations are rounded up to
+multiples of @ref Granularity bytes and each size class has its own free
+list, with slots being carved from large blocks allocated on demand. Freed
+slots are reused by the next allocation of the same size class, so after a
+warm-up phase creating and destroying objects doesn't touch the global
+allocator at all. Allocations larger than @ref MaxSize are passed to the
+global allocator.
+
+Slots are carved from a block in allocation order, so an object and features
+allocated right after it end up next to each other as long as there are no
+freed slots to reuse. Freed slots are however recycled per size class, so once
+objects and features of different sizes get destroyed and created again, an
+object and its features are generally not adjacent anymore -- the pool only
+keeps them in the same few blocks. To have an object and its features always
+in one contiguous piece of memory, derive a single class from both, as shown
+in the @ref PoolAllocated example.
+
+Each @ref Scene owns a memory pool, accessible through @ref Scene::pool(). The
+pool is used by classes deriving from @ref PoolAllocated, see its
+documentation for an example. The pool is not thread-safe.
+*/
+class MAGNUM_SCENEGRAPH_EXPORT MemoryPool {
+    public:
+        enum: std::size_t {
+            Granularity = 16,   /**< Allocation granularity and alignment */
+            MaxSize = 1024      /**< Max allocation size handled by the pool */
+        };
+
+        /**
+         * @brief Constructor
+         * @param blockSize     Size of blocks allocated from the global
+         *      allocator. Must be at least @ref MaxSize.
+         */
+        explicit MemoryPool(std::size_t blockSize = 65536);
+
+        /** @brief Copying is not allowed */
+        MemoryPool(const MemoryPool&) = delete;
+
+        /** @brief Moving is not allowed */
+        MemoryPool(MemoryPool&&) = delete;
+
+        /**
+         * @brief Destructor
+         *
+         * Expects that all allocations were freed.
+         */
+        ~MemoryPool();
+
+        /** @brief Copying is not allowed */
+        MemoryPool& operator=(const MemoryPool&) = delete;
+
+        /** @brief Moving is not allowed */
+        MemoryPool& operator=(MemoryPool&&) = delete;
+
+        /** @brief Block size */
+        std::size_t blockSize() const { return _blockSize; }
+
+        /** @brief Count of blocks allocated from the global allocator */
+        std::size_t blockCount() const { return _blocks.size(); }
+
+        /** @brief Count of live allocations */
+        std::size_t allocationCount() const { return _allocationCount; }
+
+        /**
+         * @brief Allocate memory
+         *
+         * The memory is aligned to @ref Granularity bytes.
+         */
+        void* allocate(std::size_t size);
+
+        /**
+         * @brief Free memory
+         *
+         * The @p size must be the same as passed to @ref allocate().
+         */
+        void deallocate(void* pointer, std::size_t size);
+
+    private:
+        struct FreeSlot { FreeSlot* next; };
+
+        std::size_t _blockSize, _allocationCount, _blockRemaining;
+        char* _blockCurrent;
+        std::vector<void*> _blocks;
+        FreeSlot* _free[MaxSize/Granularity];
+};
+
+/**
+@brief Base for pool-allocated objects and features
+
+Deriving a class from this one makes it possible to allocate it from a
+@ref MemoryPool using placement `new`. Objects allocated this way can be
+deleted with plain `delete` (either explicitly or by their parent object) and
+the memory is returned to the pool they were allocated from:
+@code
+class Ball: public Object3D, public SceneGraph::Drawable3D, public SceneGraph::PoolAllocated {
+    // ...
+};
+
+Scene3D scene;
+for(std::size_t i = 0; i != 10000; ++i)
+    new(scene.pool()) Ball{&scene, &drawables};
+@endcode
+
+Deriving the object class from the features, like above, makes the object
+and its features a single allocation, so they're always contiguous. Features
+allocated separately from the same pool share its blocks, but are not
+guaranteed to be adjacent to their object, see @ref MemoryPool for details.
+
+Pool and size of the allocation are stored in a small header in front of the
+object. The pool must outlive all objects allocated from it. That is always the case
+for the pool owned by @ref Scene and objects that are part of that scene, as
+the scene deletes all its children before destroying the pool. Using `new`
+without the pool argument allocates the object from the global allocator, so
+pooled and non-pooled instances of the same class can be mixed.
+
+@attention Deleting the object through base class pointer requires the class
+    hierarchy to have a virtual destructor. This is the case for all classes
+    deriving from @ref AbstractObject or @ref AbstractFeature.
+*/
+class MAGNUM_SCENEGRAPH_EXPORT PoolAllocated {
+    public:
+        /** @brief Allocate from given pool */
+        static void* operator new(std::size_t size, MemoryPool& pool);
+
+        /** @brief Allocate from the global allocator */
+        static void* operator new(std::size_t size);
+
+        /** @brief Free the memory */
+        static void operator delete(void* pointer);
+
+        #ifndef DOXYGEN_GENERATING_OUTPUT
+        /* Called only if constructor of object allocated from pool throws */
+        static void operator delete(void* pointer, MemoryPool& pool);
+        #endif
+
+    protected:
+        ~PoolAllocated() = default;
+};
+
+}}
+
+#endif
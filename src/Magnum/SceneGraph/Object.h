@@ -26,7 +26,7 @@
 */
 
 /** @file
- * @brief Class @ref Magnum::SceneGraph::Object
+ * @brief Class @ref Magnum::SceneGraph::Object, enum @ref Magnum::SceneGraph::DirtyPropagation
  */
 
 #include <Corrade/Containers/EnumSet.h>
@@ -41,7 +41,8 @@ namespace Implementation {
     enum class ObjectFlag: UnsignedByte {
         Dirty = 1 << 0,
         Visited = 1 << 1,
-        Joint = 1 << 2
+        Joint = 1 << 2,
+        LazyDirty = 1 << 3
     };
 
     typedef Containers::EnumSet<ObjectFlag> ObjectFlags;
@@ -49,6 +50,31 @@ namespace Implementation {
     CORRADE_ENUMSET_OPERATORS(ObjectFlags)
 }
 
+/**
+@brief Dirty propagation mode
+
+@see @ref Object::dirtyPropagation(), @ref Scene::setDirtyPropagation(),
+    @ref scenegraph-features-caching
+*/
+enum class DirtyPropagation: UnsignedByte {
+    /**
+     * @ref Object::setDirty() recursively marks all children as dirty and
+     * calls @ref AbstractFeature::markDirty() on all their features
+     * immediately. Default.
+     */
+    Immediate,
+
+    /**
+     * @ref Object::setDirty() only records that the object subtree changed,
+     * which is done in constant time. Whether an object is dirty is then
+     * decided by walking up the hierarchy and @ref AbstractFeature::markDirty()
+     * is called on its features only when the object is being cleaned, right
+     * before @ref AbstractFeature::clean() / @ref AbstractFeature::cleanInverted().
+     * Features on objects which are never cleaned thus never get notified.
+     */
+    Lazy
+};
+
 /**
 @brief Object
 
@@ -113,6 +139,7 @@ template<class Transformation> class Object: public AbstractObject<Transformatio
 {
     friend Containers::LinkedList<Object<Transformation>>;
     friend Containers::LinkedListItem<Object<Transformation>, Object<Transformation>>;
+    friend Scene<Transformation>;
 
     public:
         /** @brief Matrix type */
@@ -295,16 +322,37 @@ template<class Transformation> class Object: public AbstractObject<Transformatio
          */
         std::vector<MatrixType> transformationMatrices(const std::vector<std::reference_wrapper<Object<Transformation>>>& objects, const MatrixType& initialTransformationMatrix = MatrixType()) const;
 
+        /**
+         * @brief Transformation matrices of given set of objects relative to this object
+         *
+         * Same as above, but the result is written into
+         * @p transformationMatrices. Memory of the vector is reused, so
+         * repeated calls with the same vector don't allocate.
+         */
+        void transformationMatrices(const std::vector<std::reference_wrapper<Object<Transformation>>>& objects, std::vector<MatrixType>& transformationMatrices, const MatrixType& initialTransformationMatrix = MatrixType()) const;
+
         /**
          * @brief Transformations of given group of objects relative to this object
          *
          * All transformations can be premultiplied with @p initialTransformation,
-         * if specified.
+         * if specified. The computation is done in time linear to count of
+         * objects in the hierarchy between the objects and the scene, each of
+         * them is visited at most twice. Intermediate results are stored in
+         * memory kept in the @ref Scene, so repeated calls don't allocate
+         * except for the returned vector. If the scene has a
+         * @ref Scene::setThreadPool() "thread pool" set, large object groups
+         * are processed in parallel.
+         * @attention Even though the function is @cpp const @ce, the
+         *      intermediate results and temporary marks on the objects are
+         *      stored in the scene, so this function (and thus also
+         *      @ref transformationMatrices() and @ref Camera::draw()) is not
+         *      thread-safe and must not be called on the same scene from more
+         *      than one thread at a time. Concurrent calls are detected and
+         *      asserted. Use @ref Scene::setThreadPool() to compute the
+         *      transformations in parallel.
          * @see @ref transformationMatrices()
          */
-        /* `objects` passed by copy intentionally (to allow move from
-           transformationMatrices() and avoid copy in the function itself) */
-        std::vector<typename Transformation::DataType> transformations(std::vector<std::reference_wrapper<Object<Transformation>>> objects, const typename Transformation::DataType& initialTransformation =
+        std::vector<typename Transformation::DataType> transformations(const std::vector<std::reference_wrapper<Object<Transformation>>>& objects, const typename Transformation::DataType& initialTransformation =
             #ifndef CORRADE_MSVC2015_COMPATIBILITY /* I hate this inconsistency */
             typename Transformation::DataType()
             #else
@@ -312,6 +360,21 @@ template<class Transformation> class Object: public AbstractObject<Transformatio
             #endif
             ) const;
 
+        /**
+         * @brief Transformations of given group of objects relative to this object
+         *
+         * Same as above, but the result is written into @p transformations.
+         * Memory of the vector is reused, so repeated calls with the same
+         * vector don't allocate.
+         */
+        void transformations(const std::vector<std::reference_wrapper<Object<Transformation>>>& objects, std::vector<typename Transformation::DataType>& transformations, const typename Transformation::DataType& initialTransformation =
+            #ifndef CORRADE_MSVC2015_COMPATIBILITY
+            typename Transformation::DataType()
+            #else
+            Transformation::DataType()
+            #endif
+            ) const;
+
         /*@}*/
 
         /**
@@ -329,10 +392,44 @@ template<class Transformation> class Object: public AbstractObject<Transformatio
         /* `objects` passed by copy intentionally (to avoid copy internally) */
         static void setClean(std::vector<std::reference_wrapper<Object<Transformation>>> objects);
 
-        /** @copydoc AbstractObject::isDirty() */
-        bool isDirty() const { return !!(flags & Flag::Dirty); }
+        /**
+         * @brief Dirty propagation mode
+         *
+         * Inherited from the parent object, set for whole scene using
+         * @ref Scene::setDirtyPropagation(). Default is
+         * @ref DirtyPropagation::Immediate.
+         */
+        DirtyPropagation dirtyPropagation() const {
+            return flags & Flag::LazyDirty ? DirtyPropagation::Lazy : DirtyPropagation::Immediate;
+        }
+
+        /**
+         * @brief Whether absolute transformation is dirty
+         *
+         * Returns `true` if transformation of the object or any parent has
+         * changed since last call to @ref setClean(), `false` otherwise. All
+         * objects are dirty by default. The check is done in constant time
+         * for @ref DirtyPropagation::Immediate, with
+         * @ref DirtyPropagation::Lazy it goes up the hierarchy.
+         * @see @ref scenegraph-features-caching
+         */
+        bool isDirty() const {
+            return flags & Flag::LazyDirty ? isDirtyLazy() : !!(flags & Flag::Dirty);
+        }
 
-        /** @copydoc AbstractObject::setDirty() */
+        /**
+         * @brief Set object absolute transformation as dirty
+         *
+         * With @ref DirtyPropagation::Immediate calls
+         * @ref AbstractFeature::markDirty() on all object features and
+         * recursively calls @ref setDirty() on every child object which is not
+         * already dirty. If the object is already marked as dirty, the
+         * function does nothing. With @ref DirtyPropagation::Lazy the function
+         * only records the change in constant time and the children are
+         * treated as dirty implicitly.
+         * @see @ref scenegraph-features-caching, @ref setClean(),
+         *      @ref isDirty()
+         */
         void setDirty();
 
         /**
@@ -370,9 +467,11 @@ template<class Transformation> class Object: public AbstractObject<Transformatio
             return absoluteTransformationMatrix();
         }
 
-        std::vector<MatrixType> doTransformationMatrices(const std::vector<std::reference_wrapper<AbstractObject<Transformation::Dimensions, typename Transformation::Type>>>& objects, const MatrixType& initialTransformationMatrix) const override final;
+        void doTransformationMatrices(const std::vector<std::reference_wrapper<AbstractObject<Transformation::Dimensions, typename Transformation::Type>>>& objects, std::vector<MatrixType>& transformationMatrices, const MatrixType& initialTransformationMatrix) const override final;
 
-        typename Transformation::DataType MAGNUM_SCENEGRAPH_LOCAL computeJointTransformation(const std::vector<std::reference_wrapper<Object<Transformation>>>& jointObjects, std::vector<typename Transformation::DataType>& jointTransformations, const std::size_t joint, const typename Transformation::DataType& initialTransformation) const;
+        template<class U> void MAGNUM_SCENEGRAPH_LOCAL transformationMatricesInternal(const std::vector<std::reference_wrapper<U>>& objects, std::vector<MatrixType>& transformationMatrices, const MatrixType& initialTransformationMatrix) const;
+        template<class U> bool MAGNUM_SCENEGRAPH_LOCAL transformationsInternal(const std::vector<std::reference_wrapper<U>>& objects, const typename Transformation::DataType& initialTransformation) const;
+        template<class F> void MAGNUM_SCENEGRAPH_LOCAL parallelFor(std::size_t count, const F& f) const;
 
         bool MAGNUM_SCENEGRAPH_LOCAL doIsDirty() const override final { return isDirty(); }
         void MAGNUM_SCENEGRAPH_LOCAL doSetDirty() override final { setDirty(); }
@@ -381,10 +480,19 @@ template<class Transformation> class Object: public AbstractObject<Transformatio
 
         void MAGNUM_SCENEGRAPH_LOCAL setCleanInternal(const typename Transformation::DataType& absoluteTransformation);
 
+        bool isDirtyLazy() const;
+        void MAGNUM_SCENEGRAPH_LOCAL setCleanLazy();
+        void setDirtyPropagationInternal(DirtyPropagation propagation);
+        static UnsignedLong MAGNUM_SCENEGRAPH_LOCAL nextGeneration();
+
         typedef Implementation::ObjectFlag Flag;
         typedef Implementation::ObjectFlags Flags;
-        UnsignedShort counter;
         Flags flags;
+
+        /* Used only with DirtyPropagation::Lazy -- the object is dirty if
+           dirtyGeneration of itself or any parent is larger than its own
+           cleanGeneration */
+        UnsignedLong dirtyGeneration, cleanGeneration;
 };
 
 }}
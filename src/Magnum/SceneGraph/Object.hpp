@@ -30,6 +30,7 @@
  */
 
 #include <algorithm>
+#include <cstdint>
 #include <stack>
 
 #include "Magnum/SceneGraph/AbstractTransformation.h"
@@ -38,12 +39,40 @@
 
 namespace Magnum { namespace SceneGraph {
 
+namespace Implementation {
+
+/* Open-addressing hash table with linear probing, mapping objects to their
+   index in given list. Used by Object::transformations() instead of storing
+   the index in each object. */
+inline std::size_t objectIndexHash(const void* const object, const std::size_t mask) {
+    /* Fibonacci hashing, lowest bits are ignored as they are zero due to
+       alignment */
+    return std::size_t((reinterpret_cast<std::uintptr_t>(object) >> 4)*std::uintptr_t(0x9e3779b97f4a7c15ull)) & mask;
+}
+
+template<class T> void insertObjectIndex(std::vector<UnsignedInt>& table, const std::vector<T*>& objects, const UnsignedInt index) {
+    const std::size_t mask = table.size() - 1;
+    std::size_t i = objectIndexHash(objects[index], mask);
+    while(table[i] != ~UnsignedInt{}) i = (i + 1) & mask;
+    table[i] = index;
+}
+
+template<class T> UnsignedInt findObjectIndex(const std::vector<UnsignedInt>& table, const std::vector<T*>& objects, const T* const object) {
+    const std::size_t mask = table.size() - 1;
+    for(std::size_t i = objectIndexHash(object, mask); ; i = (i + 1) & mask) {
+        CORRADE_INTERNAL_ASSERT(table[i] != ~UnsignedInt{});
+        if(objects[table[i]] == object) return table[i];
+    }
+}
+
+}
+
 template<UnsignedInt dimensions, class T> AbstractObject<dimensions, T>::AbstractObject() {}
 template<UnsignedInt dimensions, class T> AbstractObject<dimensions, T>::~AbstractObject() {}
 
 template<UnsignedInt dimensions, class T> AbstractTransformation<dimensions, T>::AbstractTransformation() {}
 
-template<class Transformation> Object<Transformation>::Object(Object<Transformation>* parent): counter(0xFFFFu), flags(Flag::Dirty) {
+template<class Transformation> Object<Transformation>::Object(Object<Transformation>* parent): flags(Flag::Dirty), dirtyGeneration(1), cleanGeneration(0) {
     setParent(parent);
 }
 
@@ -88,6 +117,10 @@ template<class Transformation> Object<Transformation>& Object<Transformation>::s
     /* Add the object to list of new parent */
     if(parent) parent->Containers::LinkedList<Object<Transformation>>::insert(this);
 
+    /* Inherit dirty propagation mode of the new parent */
+    if(parent && parent->dirtyPropagation() != dirtyPropagation())
+        setDirtyPropagationInternal(parent->dirtyPropagation());
+
     setDirty();
     return *this;
 }
@@ -108,7 +141,58 @@ template<class Transformation> typename Transformation::DataType Object<Transfor
     return Implementation::Transformation<Transformation>::compose(parent()->absoluteTransformation(), Transformation::transformation());
 }
 
+template<class Transformation> UnsignedLong Object<Transformation>::nextGeneration() {
+    static UnsignedLong generation = 1;
+    return ++generation;
+}
+
+template<class Transformation> bool Object<Transformation>::isDirtyLazy() const {
+    for(const Object<Transformation>* p = this; p; p = p->parent())
+        if(p->dirtyGeneration > cleanGeneration) return true;
+
+    return false;
+}
+
+template<class Transformation> void Object<Transformation>::setDirtyPropagationInternal(const DirtyPropagation propagation) {
+    /* Go through the whole subtree using an explicit stack, the hierarchy
+       can be arbitrarily deep */
+    std::stack<Object<Transformation>*> objects;
+    objects.push(this);
+    while(!objects.empty()) {
+        Object<Transformation>* o = objects.top();
+        objects.pop();
+
+        /* Going to lazy propagation, convert the dirty flag to generations.
+           If the object is dirty, all its children are dirty too, so it's
+           enough to update just this object. If the object is clean, all its
+           parents are clean too and thus they have older dirty generation. */
+        if(propagation == DirtyPropagation::Lazy) {
+            if(o->flags & Flag::Dirty) o->dirtyGeneration = nextGeneration();
+            else o->cleanGeneration = nextGeneration();
+            o->flags |= Flag::LazyDirty;
+
+        /* Going to immediate propagation, convert generations to the dirty
+           flag. The generations of parents are still valid as they are kept,
+           so the order in which it's done doesn't matter. */
+        } else {
+            if(o->isDirtyLazy()) o->flags |= Flag::Dirty;
+            else o->flags &= ~Flag::Dirty;
+            o->flags &= ~Flag::LazyDirty;
+        }
+
+        for(Object<Transformation>& child: o->children())
+            objects.push(&child);
+    }
+}
+
 template<class Transformation> void Object<Transformation>::setDirty() {
+    /* Just record the change, the children find out about it themselves when
+       they're checked for dirtiness */
+    if(flags & Flag::LazyDirty) {
+        dirtyGeneration = nextGeneration();
+        return;
+    }
+
     /* The transformation of this object (and all children) is already dirty,
        nothing to do */
     if(flags & Flag::Dirty) return;
@@ -126,6 +210,10 @@ template<class Transformation> void Object<Transformation>::setDirty() {
 }
 
 template<class Transformation> void Object<Transformation>::setClean() {
+    /* Dirtiness is not known without going up the hierarchy, do it in a
+       single pass */
+    if(flags & Flag::LazyDirty) return setCleanLazy();
+
     /* The object (and all its parents) are already clean, nothing to do */
     if(!(flags & Flag::Dirty)) return;
 
@@ -162,24 +250,76 @@ template<class Transformation> void Object<Transformation>::setClean() {
     }
 }
 
-template<class Transformation> auto Object<Transformation>::doTransformationMatrices(const std::vector<std::reference_wrapper<AbstractObject<Transformation::Dimensions, typename Transformation::Type>>>& objects, const MatrixType& initialTransformationMatrix) const -> std::vector<MatrixType> {
-    std::vector<std::reference_wrapper<Object<Transformation>>> castObjects;
-    castObjects.reserve(objects.size());
-    /** @todo Ensure this doesn't crash, somehow */
-    for(auto o: objects) castObjects.push_back(static_cast<Object<Transformation>&>(o.get()));
+template<class Transformation> void Object<Transformation>::setCleanLazy() {
+    /* Collect all parents */
+    std::stack<Object<Transformation>*> objects;
+    for(Object<Transformation>* p = this; p; p = p->parent())
+        objects.push(p);
 
-    return transformationMatrices(std::move(castObjects), initialTransformationMatrix);
+    /* Go down from root object, accumulate both the transformation and the
+       newest dirty generation on the way and clean every object which has
+       older clean generation */
+    typename Transformation::DataType absoluteTransformation;
+    UnsignedLong dirtyGeneration = 0;
+    while(!objects.empty()) {
+        Object<Transformation>* o = objects.top();
+        objects.pop();
+
+        absoluteTransformation = Implementation::Transformation<Transformation>::compose(absoluteTransformation, o->transformation());
+        dirtyGeneration = std::max(dirtyGeneration, o->dirtyGeneration);
+        if(dirtyGeneration <= o->cleanGeneration) continue;
+
+        o->setCleanInternal(absoluteTransformation);
+        CORRADE_ASSERT(!o->isDirty(), "SceneGraph::Object::setClean(): original implementation was not called", );
+    }
 }
 
-template<class Transformation> auto Object<Transformation>::transformationMatrices(const std::vector<std::reference_wrapper<Object<Transformation>>>& objects, const MatrixType& initialTransformationMatrix) const -> std::vector<MatrixType> {
-    std::vector<typename Transformation::DataType> transformations = this->transformations(std::move(objects), Implementation::Transformation<Transformation>::fromMatrix(initialTransformationMatrix));
-    std::vector<MatrixType> transformationMatrices(transformations.size());
-    for(std::size_t i = 0; i != objects.size(); ++i)
-        transformationMatrices[i] = Implementation::Transformation<Transformation>::toMatrix(transformations[i]);
+template<class Transformation> void Object<Transformation>::doTransformationMatrices(const std::vector<std::reference_wrapper<AbstractObject<Transformation::Dimensions, typename Transformation::Type>>>& objects, std::vector<MatrixType>& transformationMatrices, const MatrixType& initialTransformationMatrix) const {
+    /** @todo Ensure this doesn't crash, somehow */
+    transformationMatricesInternal(objects, transformationMatrices, initialTransformationMatrix);
+}
 
+template<class Transformation> auto Object<Transformation>::transformationMatrices(const std::vector<std::reference_wrapper<Object<Transformation>>>& objects, const MatrixType& initialTransformationMatrix) const -> std::vector<MatrixType> {
+    std::vector<MatrixType> transformationMatrices;
+    transformationMatricesInternal(objects, transformationMatrices, initialTransformationMatrix);
     return transformationMatrices;
 }
 
+template<class Transformation> void Object<Transformation>::transformationMatrices(const std::vector<std::reference_wrapper<Object<Transformation>>>& objects, std::vector<MatrixType>& transformationMatrices, const MatrixType& initialTransformationMatrix) const {
+    transformationMatricesInternal(objects, transformationMatrices, initialTransformationMatrix);
+}
+
+template<class Transformation> template<class U> void Object<Transformation>::transformationMatricesInternal(const std::vector<std::reference_wrapper<U>>& objects, std::vector<MatrixType>& transformationMatrices, const MatrixType& initialTransformationMatrix) const {
+    if(!transformationsInternal(objects, Implementation::Transformation<Transformation>::fromMatrix(initialTransformationMatrix))) {
+        transformationMatrices.clear();
+        return;
+    }
+
+    /* Convert the results to matrices */
+    const std::vector<typename Transformation::DataType>& transformations = static_cast<const Scene<Transformation>*>(this)->_jointTransformations;
+    transformationMatrices.resize(objects.size());
+    parallelFor(objects.size(), [&transformations, &transformationMatrices](std::size_t begin, std::size_t end) {
+        for(std::size_t i = begin; i != end; ++i)
+            transformationMatrices[i] = Implementation::Transformation<Transformation>::toMatrix(transformations[i]);
+    });
+}
+
+template<class Transformation> auto Object<Transformation>::transformations(const std::vector<std::reference_wrapper<Object<Transformation>>>& objects, const typename Transformation::DataType& initialTransformation) const -> std::vector<typename Transformation::DataType> {
+    std::vector<typename Transformation::DataType> transformations;
+    this->transformations(objects, transformations, initialTransformation);
+    return transformations;
+}
+
+template<class Transformation> void Object<Transformation>::transformations(const std::vector<std::reference_wrapper<Object<Transformation>>>& objects, std::vector<typename Transformation::DataType>& transformations, const typename Transformation::DataType& initialTransformation) const {
+    if(!transformationsInternal(objects, initialTransformation)) {
+        transformations.clear();
+        return;
+    }
+
+    const std::vector<typename Transformation::DataType>& jointTransformations = static_cast<const Scene<Transformation>*>(this)->_jointTransformations;
+    transformations.assign(jointTransformations.begin(), jointTransformations.begin() + objects.size());
+}
+
 /*
 Computing absolute transformations for given list of objects
 
@@ -190,138 +330,189 @@ divided into two groups:
    child in the subtree
  - "non-joints", i.e. paths between joints
 
-Then for all joints their transformation (relative to parent joint) is
-computed and recursively concatenated together. Resulting transformations for
-joints which were originally in `object` list is then returned.
-*/
-template<class Transformation> std::vector<typename Transformation::DataType> Object<Transformation>::transformations(std::vector<std::reference_wrapper<Object<Transformation>>> objects, const typename Transformation::DataType& initialTransformation) const {
-    CORRADE_ASSERT(objects.size() < 0xFFFFu, "SceneGraph::Object::transformations(): too large scene", {});
+First, from each object the hierarchy is walked up and all objects on the way
+are marked as visited until an already visited object is found -- that one is
+a joint. Then for each joint its transformation relative to the parent joint
+is computed by walking up the path again. These walks are independent of each
+other and thus can be done in parallel. Lastly, the relative transformations
+are concatenated together, parent joints first, using an explicit stack. Every
+object is thus visited at most twice, without any recursion.
 
-    /* Remember object count for later */
-    std::size_t objectCount = objects.size();
+Resulting transformations are stored in first `objects.size()` items of
+`Scene::_jointTransformations`. Returns `false` on failure.
+*/
+template<class Transformation> template<class U> bool Object<Transformation>::transformationsInternal(const std::vector<std::reference_wrapper<U>>& objects, const typename Transformation::DataType& initialTransformation) const {
+    /* Nearest common ancestor not yet implemented - assert this is done on scene */
+    CORRADE_ASSERT(isScene(), "SceneGraph::Object::transformationMatrices(): currently implemented only for Scene", false);
+
+    /* Scratch memory kept in the scene, guard against concurrent use. The
+       flag is reset on every return path, including the graceful asserts. */
+    const Scene<Transformation>& scene = static_cast<const Scene<Transformation>&>(*this);
+    CORRADE_ASSERT(!scene._transformationsInProgress.exchange(true),
+        "SceneGraph::Object::transformations(): called concurrently on the same scene", false);
+    struct InProgressGuard {
+        ~InProgressGuard() { flag.store(false); }
+        std::atomic<bool>& flag;
+    } inProgressGuard{scene._transformationsInProgress};
+    std::vector<Object<Transformation>*>& jointObjects = scene._jointObjects;
+    std::vector<typename Transformation::DataType>& jointTransformations = scene._jointTransformations;
+    std::vector<UnsignedInt>& jointIndices = scene._jointIndices;
+    std::vector<UnsignedInt>& duplicates = scene._duplicates;
+    std::vector<UnsignedInt>& parentJoints = scene._parentJoints;
+    std::vector<UnsignedInt>& jointStack = scene._jointStack;
+
+    enum: UnsignedInt {
+        NoJoint = ~UnsignedInt{},
+        Resolved = ~UnsignedInt{} - 1
+    };
+
+    /* There is at most 2*objects.size() - 1 joints, size the index table so
+       it is never more than half full */
+    std::size_t jointIndexTableSize = 16;
+    while(jointIndexTableSize < 4*objects.size()) jointIndexTableSize <<= 1;
+    jointIndices.assign(jointIndexTableSize, NoJoint);
 
     /* Mark all original objects as joints and create initial list of joints
        from them */
+    jointObjects.clear();
+    duplicates.resize(objects.size());
     for(std::size_t i = 0; i != objects.size(); ++i) {
-        /* Multiple occurences of one object in the array, don't overwrite it
-           with different counter */
-        if(objects[i].get().counter != 0xFFFFu) continue;
+        /** @todo Ensure this doesn't crash, somehow */
+        Object<Transformation>& o = static_cast<Object<Transformation>&>(objects[i].get());
+        jointObjects.push_back(&o);
+
+        /* Multiple occurences of one object in the array, remember index of
+           the first one */
+        if(o.flags & Flag::Joint) {
+            duplicates[i] = Implementation::findObjectIndex(jointIndices, jointObjects, &o);
+            continue;
+        }
 
-        objects[i].get().counter = UnsignedShort(i);
-        objects[i].get().flags |= Flag::Joint;
+        duplicates[i] = NoJoint;
+        o.flags |= Flag::Joint;
+        Implementation::insertObjectIndex(jointIndices, jointObjects, i);
     }
-    std::vector<std::reference_wrapper<Object<Transformation>>> jointObjects(objects);
 
-    /* Scene object */
-    const Scene<Transformation>* scene = this->scene();
+    /* Walk up the hierarchy from each original object and mark all objects on
+       the way as visited */
+    for(std::size_t i = 0; i != objects.size(); ++i) {
+        Object<Transformation>* o = jointObjects[i];
 
-    /* Nearest common ancestor not yet implemented - assert this is done on scene */
-    CORRADE_ASSERT(scene == this, "SceneGraph::Object::transformationMatrices(): currently implemented only for Scene", {});
+        /* Already visited (duplicate occurence) */
+        if(o->flags & Flag::Visited) continue;
 
-    /* Mark all objects up the hierarchy as visited */
-    auto it = objects.begin();
-    while(!objects.empty()) {
-        /* Already visited, remove and continue to next (duplicate occurence) */
-        if(it->get().flags & Flag::Visited) {
-            it = objects.erase(it);
-            continue;
-        }
+        for(;;) {
+            o->flags |= Flag::Visited;
+            Object<Transformation>* parent = o->parent();
 
-        /* Mark the object as visited */
-        it->get().flags |= Flag::Visited;
+            /* Root object, done */
+            if(!parent) {
+                CORRADE_ASSERT(o == this, "SceneGraph::Object::transformations(): the objects are not part of the same tree", false);
+                break;
+            }
 
-        Object<Transformation>* parent = it->get().parent();
+            /* Parent is a joint, done */
+            if(parent->flags & Flag::Joint) break;
 
-        /* If this is root object, remove from list */
-        if(!parent) {
-            CORRADE_ASSERT(&it->get() == scene, "SceneGraph::Object::transformations(): the objects are not part of the same tree", {});
-            it = objects.erase(it);
+            /* Parent is already visited from another object, mark it as a
+               joint and add it to list of joint objects, done */
+            if(parent->flags & Flag::Visited) {
+                parent->flags |= Flag::Joint;
+                jointObjects.push_back(parent);
+                Implementation::insertObjectIndex(jointIndices, jointObjects, jointObjects.size() - 1);
+                break;
+            }
 
-        /* Parent is an joint or already visited - remove current from list */
-        } else if(parent->flags & (Flag::Visited|Flag::Joint)) {
-            it = objects.erase(it);
+            /* Else go up the hierarchy */
+            o = parent;
+        }
+    }
 
-            /* If not already marked as joint, mark it as such and add it to
-               list of joint objects */
-            if(!(parent->flags & Flag::Joint)) {
-                CORRADE_ASSERT(jointObjects.size() < 0xFFFFu,
-                               "SceneGraph::Object::transformations(): too large scene", {});
-                CORRADE_INTERNAL_ASSERT(parent->counter == 0xFFFFu);
-                parent->counter = UnsignedShort(jointObjects.size());
-                parent->flags |= Flag::Joint;
-                jointObjects.push_back(*parent);
+    /* Compute transformation of each joint relative to its parent joint. Only
+       flags of non-joint objects are modified, each of them belongs to exactly
+       one joint, so this can be done in parallel. */
+    jointTransformations.resize(jointObjects.size());
+    parentJoints.resize(jointObjects.size());
+    const std::size_t objectCount = objects.size();
+    parallelFor(jointObjects.size(), [&](std::size_t begin, std::size_t end) {
+        for(std::size_t joint = begin; joint != end; ++joint) {
+            /* Duplicate occurence, will be copied from the first one */
+            if(joint < objectCount && duplicates[joint] != NoJoint) continue;
+
+            Object<Transformation>* o = jointObjects[joint];
+            typename Transformation::DataType transformation = o->transformation();
+            for(;;) {
+                Object<Transformation>* parent = o->parent();
+
+                /* Root object, relative to the initial transformation */
+                if(!parent) {
+                    parentJoints[joint] = NoJoint;
+                    break;
+                }
+
+                /* Joint object, relative to it */
+                if(parent->flags & Flag::Joint) {
+                    parentJoints[joint] = Implementation::findObjectIndex(jointIndices, jointObjects, parent);
+                    break;
+                }
+
+                /* Else compose transformation with parent, clean its visited
+                   mark and go up the hierarchy */
+                transformation = Implementation::Transformation<Transformation>::compose(parent->transformation(), transformation);
+                CORRADE_INTERNAL_ASSERT(parent->flags & Flag::Visited);
+                parent->flags &= ~Flag::Visited;
+                o = parent;
             }
 
-        /* Else go up the hierarchy */
-        } else *it = *parent;
+            jointTransformations[joint] = transformation;
+        }
+    });
 
-        /* Cycle if reached end */
-        if(it == objects.end()) it = objects.begin();
-    }
+    /* Concatenate the relative transformations, resolving chains of parent
+       joints first */
+    for(std::size_t joint = 0; joint != jointObjects.size(); ++joint) {
+        if(joint < objectCount && duplicates[joint] != NoJoint) continue;
+
+        for(UnsignedInt j = joint; j != NoJoint && parentJoints[j] != Resolved; j = parentJoints[j])
+            jointStack.push_back(j);
 
-    /* Array of absolute transformations in joints */
-    std::vector<typename Transformation::DataType> jointTransformations(jointObjects.size());
+        while(!jointStack.empty()) {
+            const UnsignedInt j = jointStack.back();
+            jointStack.pop_back();
 
-    /* Compute transformations for all joints */
-    for(std::size_t i = 0; i != jointTransformations.size(); ++i)
-        computeJointTransformation(jointObjects, jointTransformations, i, initialTransformation);
+            const UnsignedInt parent = parentJoints[j];
+            jointTransformations[j] = Implementation::Transformation<Transformation>::compose(
+                parent == NoJoint ? initialTransformation : jointTransformations[parent],
+                jointTransformations[j]);
+            parentJoints[j] = Resolved;
+        }
+    }
 
     /* Copy transformation for second or next occurences from first occurence
        of duplicate object */
     for(std::size_t i = 0; i != objectCount; ++i) {
-        if(jointObjects[i].get().counter != i)
-            jointTransformations[i] = jointTransformations[jointObjects[i].get().counter];
+        if(duplicates[i] != NoJoint)
+            jointTransformations[i] = jointTransformations[duplicates[i]];
     }
 
-    /* All visited marks are now cleaned, clean joint marks and counters */
-    for(auto i: jointObjects) {
-        /* All not-already cleaned objects (...duplicate occurences) should
-           have joint mark */
-        CORRADE_INTERNAL_ASSERT(i.get().counter == 0xFFFFu || i.get().flags & Flag::Joint);
-        i.get().flags &= ~Flag::Joint;
-        i.get().counter = 0xFFFFu;
-    }
+    /* Clean joint and visited marks */
+    for(Object<Transformation>* o: jointObjects)
+        o->flags &= ~(Flag::Joint|Flag::Visited);
 
-    /* Shrink the array to contain only transformations of requested objects and return */
-    jointTransformations.resize(objectCount);
-    return jointTransformations;
+    return true;
 }
 
-template<class Transformation> typename Transformation::DataType Object<Transformation>::computeJointTransformation(const std::vector<std::reference_wrapper<Object<Transformation>>>& jointObjects, std::vector<typename Transformation::DataType>& jointTransformations, const std::size_t joint, const typename Transformation::DataType& initialTransformation) const {
-    std::reference_wrapper<Object<Transformation>> o = jointObjects[joint];
-
-    /* Transformation already computed ("unvisited" by this function before
-       either due to recursion or duplicate object occurences), done */
-    if(!(o.get().flags & Flag::Visited)) return jointTransformations[joint];
-
-    /* Initialize transformation */
-    jointTransformations[joint] = o.get().transformation();
-
-    /* Go up until next joint or root */
-    for(;;) {
-        /* Clean visited mark */
-        CORRADE_INTERNAL_ASSERT(o.get().flags & Flag::Visited);
-        o.get().flags &= ~Flag::Visited;
-
-        Object<Transformation>* parent = o.get().parent();
-
-        /* Root object, compose transformation with initial, done */
-        if(!parent) {
-            CORRADE_INTERNAL_ASSERT(o.get().isScene());
-            return (jointTransformations[joint] =
-                Implementation::Transformation<Transformation>::compose(initialTransformation, jointTransformations[joint]));
-
-        /* Joint object, compose transformation with the joint, done */
-        } else if(parent->flags & Flag::Joint) {
-            return (jointTransformations[joint] =
-                Implementation::Transformation<Transformation>::compose(computeJointTransformation(jointObjects, jointTransformations, parent->counter, initialTransformation), jointTransformations[joint]));
-
-        /* Else compose transformation with parent, go up the hierarchy */
-        } else {
-            jointTransformations[joint] = Implementation::Transformation<Transformation>::compose(parent->transformation(), jointTransformations[joint]);
-            o = *parent;
-        }
+template<class Transformation> template<class F> void Object<Transformation>::parallelFor(const std::size_t count, const F& f) const {
+    #ifdef MAGNUM_BUILD_MULTITHREADED
+    /* Not worth distributing small groups among threads */
+    ThreadPool* const pool = static_cast<const Scene<Transformation>*>(this)->_threadPool;
+    if(pool && count >= 4096) {
+        pool->run(count, f);
+        return;
     }
+    #endif
+
+    f(0, count);
 }
 
 template<class Transformation> void Object<Transformation>::doSetClean(const std::vector<std::reference_wrapper<AbstractObject<Transformation::Dimensions, typename Transformation::Type>>>& objects) {
@@ -379,6 +570,10 @@ template<class Transformation> void Object<Transformation>::setCleanInternal(con
 
     /* Clean all features */
     for(AbstractFeature<Transformation::Dimensions, typename Transformation::Type>& feature: this->features()) {
+        /* With lazy propagation the feature wasn't notified when the object
+           got dirty, do it now */
+        if(flags & Flag::LazyDirty) feature.markDirty();
+
         /* Cached absolute transformation, compute it if it wasn't
             computed already */
         if(feature.cachedTransformations() & CachedTransformation::Absolute) {
@@ -387,7 +582,7 @@ template<class Transformation> void Object<Transformation>::setCleanInternal(con
                 matrix = Implementation::Transformation<Transformation>::toMatrix(absoluteTransformation);
             }
 
-            feature.clean(matrix);
+            if(!feature.cleanBatched(matrix)) feature.clean(matrix);
         }
 
         /* Cached inverse absolute transformation, compute it if it wasn't
@@ -405,6 +600,7 @@ template<class Transformation> void Object<Transformation>::setCleanInternal(con
 
     /* Mark object as clean */
     flags &= ~Flag::Dirty;
+    if(flags & Flag::LazyDirty) cleanGeneration = nextGeneration();
 }
 
 }}
@@ -282,12 +282,21 @@ template<class T> struct Transformation<BasicRigidMatrixTransformation2D<T>> {
         return transformation;
     }
 
+    /* Both matrices are guaranteed to be rigid, so the bottom row is always
+       (0, 0, 1) and only the upper 2x3 part needs to be computed */
     static Math::Matrix3<T> compose(const Math::Matrix3<T>& parent, const Math::Matrix3<T>& child) {
-        return parent*child;
+        const Math::Vector2<T>& a = parent[0].xy();
+        const Math::Vector2<T>& b = parent[1].xy();
+        return {{a*child[0][0] + b*child[0][1], T(0)},
+                {a*child[1][0] + b*child[1][1], T(0)},
+                {a*child[2][0] + b*child[2][1] + parent[2].xy(), T(1)}};
     }
 
+    /* Same as Matrix3::invertedRigid(), but without the rigidity check, which
+       is already done when setting the transformation */
     static Math::Matrix3<T> inverted(const Math::Matrix3<T>& transformation) {
-        return transformation.invertedRigid();
+        const Math::Matrix2x2<T> inverseRotation = transformation.rotationScaling().transposed();
+        return Math::Matrix3<T>::from(inverseRotation, inverseRotation*-transformation.translation());
     }
 };
 
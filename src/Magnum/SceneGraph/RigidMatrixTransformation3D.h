@@ -396,12 +396,23 @@ template<class T> struct Transformation<BasicRigidMatrixTransformation3D<T>> {
         return transformation;
     }
 
+    /* Both matrices are guaranteed to be rigid, so the bottom row is always
+       (0, 0, 0, 1) and only the upper 3x4 part needs to be computed */
     static Math::Matrix4<T> compose(const Math::Matrix4<T>& parent, const Math::Matrix4<T>& child) {
-        return parent*child;
+        const Math::Vector3<T>& a = parent[0].xyz();
+        const Math::Vector3<T>& b = parent[1].xyz();
+        const Math::Vector3<T>& c = parent[2].xyz();
+        return {{a*child[0][0] + b*child[0][1] + c*child[0][2], T(0)},
+                {a*child[1][0] + b*child[1][1] + c*child[1][2], T(0)},
+                {a*child[2][0] + b*child[2][1] + c*child[2][2], T(0)},
+                {a*child[3][0] + b*child[3][1] + c*child[3][2] + parent[3].xyz(), T(1)}};
     }
 
+    /* Same as Matrix4::invertedRigid(), but without the rigidity check, which
+       is already done when setting the transformation */
     static Math::Matrix4<T> inverted(const Math::Matrix4<T>& transformation) {
-        return transformation.invertedRigid();
+        const Math::Matrix3x3<T> inverseRotation = transformation.rotationScaling().transposed();
+        return Math::Matrix4<T>::from(inverseRotation, inverseRotation*-transformation.translation());
     }
 };
 
@@ -29,22 +29,105 @@
  * @brief Class @ref Magnum::SceneGraph::Scene
  */
 
+#include <atomic>
+
+#include "Magnum/SceneGraph/MemoryPool.h"
 #include "Magnum/SceneGraph/Object.h"
 
+#ifdef MAGNUM_BUILD_MULTITHREADED
+#include "Magnum/SceneGraph/ThreadPool.h"
+#endif
+
 namespace Magnum { namespace SceneGraph {
 
+namespace Implementation {
+    /* Base of Scene, so the pool is destroyed only after all children are
+       deleted by Object destructor */
+    struct ScenePool {
+        MemoryPool pool;
+    };
+}
+
 /**
 @brief Scene
 
 Basically @ref Object which cannot have parent or non-default transformation.
 See @ref scenegraph for introduction.
 */
-template<class Transformation> class Scene: public Object<Transformation> {
+template<class Transformation> class Scene: private Implementation::ScenePool, public Object<Transformation> {
+    friend Object<Transformation>;
+
     public:
         explicit Scene() = default;
 
+        /**
+         * @brief Memory pool
+         *
+         * Pool for allocating objects and features in this scene, see
+         * @ref PoolAllocated for more information. The pool is destroyed
+         * after all objects in the scene.
+         */
+        MemoryPool& pool() { return Implementation::ScenePool::pool; }
+
+        /**
+         * @brief Set dirty propagation mode
+         * @return Reference to self (for method chaining)
+         *
+         * Sets the mode for the scene and all objects in it, objects added
+         * later inherit it from their parent. Default is
+         * @ref DirtyPropagation::Immediate. Dirty state of all objects is
+         * preserved. See @ref scenegraph-features-caching for more
+         * information.
+         */
+        Scene<Transformation>& setDirtyPropagation(DirtyPropagation propagation) {
+            if(propagation != Object<Transformation>::dirtyPropagation())
+                Object<Transformation>::setDirtyPropagationInternal(propagation);
+            return *this;
+        }
+
+        #if defined(MAGNUM_BUILD_MULTITHREADED) || defined(DOXYGEN_GENERATING_OUTPUT)
+        /**
+         * @brief Thread pool
+         *
+         * @note Available only if Magnum is compiled with
+         *      `BUILD_MULTITHREADED` enabled.
+         */
+        ThreadPool* threadPool() const { return _threadPool; }
+
+        /**
+         * @brief Set thread pool
+         * @return Reference to self (for method chaining)
+         *
+         * If set, @ref Object::transformations() and
+         * @ref Object::transformationMatrices() called on the scene (and
+         * thus also @ref Camera::draw()) compute transformations of large
+         * object groups using threads from given pool. The pool is not owned
+         * by the scene and must not be destroyed before the scene. Set to
+         * `nullptr` to compute everything in the calling thread, which is the
+         * default.
+         * @note Available only if Magnum is compiled with
+         *      `BUILD_MULTITHREADED` enabled.
+         */
+        Scene<Transformation>& setThreadPool(ThreadPool* pool) {
+            _threadPool = pool;
+            return *this;
+        }
+        #endif
+
     private:
         bool isScene() const override final { return true; }
+
+        /* Scratch memory for Object::transformations(), kept between calls to
+           avoid allocations. The flag is used to detect concurrent calls,
+           which would corrupt it. */
+        mutable std::atomic<bool> _transformationsInProgress{false};
+        mutable std::vector<Object<Transformation>*> _jointObjects;
+        mutable std::vector<typename Transformation::DataType> _jointTransformations;
+        mutable std::vector<UnsignedInt> _jointIndices, _duplicates, _parentJoints, _jointStack;
+
+        #ifdef MAGNUM_BUILD_MULTITHREADED
+        ThreadPool* _threadPool{};
+        #endif
 };
 
 }}
@@ -39,6 +39,7 @@ namespace Magnum { namespace SceneGraph {
 
 #ifndef DOXYGEN_GENERATING_OUTPUT
 enum class AspectRatioPolicy: UnsignedByte;
+enum class DrawOrder: UnsignedByte;
 
 /* Enum CachedTransformation and CachedTransformations used only directly */
 
@@ -112,6 +113,9 @@ template<class T> using AbstractBasicCamera3D CORRADE_DEPRECATED_ALIAS("use Basi
 CORRADE_DEPRECATED("use Camera3D instead") typedef Camera3D AbstractCamera3D;
 #endif
 
+enum class DirtyPropagation: UnsignedByte;
+
+enum class BoundingVolume: UnsignedByte;
 template<UnsignedInt, class> class Drawable;
 template<class T> using BasicDrawable2D = Drawable<2, T>;
 template<class T> using BasicDrawable3D = Drawable<3, T>;
@@ -135,11 +139,43 @@ template<class T> using BasicDrawableGroup3D = DrawableGroup<3, T>;
 typedef BasicDrawableGroup2D<Float> DrawableGroup2D;
 typedef BasicDrawableGroup3D<Float> DrawableGroup3D;
 
+template<UnsignedInt, class> class FlatObject;
+template<class T> using BasicFlatObject2D = FlatObject<2, T>;
+template<class T> using BasicFlatObject3D = FlatObject<3, T>;
+typedef BasicFlatObject2D<Float> FlatObject2D;
+typedef BasicFlatObject3D<Float> FlatObject3D;
+
+template<UnsignedInt, class> class FlatScene;
+template<class T> using BasicFlatScene2D = FlatScene<2, T>;
+template<class T> using BasicFlatScene3D = FlatScene<3, T>;
+typedef BasicFlatScene2D<Float> FlatScene2D;
+typedef BasicFlatScene3D<Float> FlatScene3D;
+
+template<UnsignedInt, class> class Instance;
+template<class T> using BasicInstance2D = Instance<2, T>;
+template<class T> using BasicInstance3D = Instance<3, T>;
+typedef BasicInstance2D<Float> Instance2D;
+typedef BasicInstance3D<Float> Instance3D;
+
+template<UnsignedInt dimensions, class T> using InstanceGroup = FeatureGroup<dimensions, Instance<dimensions, T>, T>;
+template<class T> using BasicInstanceGroup2D = InstanceGroup<2, T>;
+template<class T> using BasicInstanceGroup3D = InstanceGroup<3, T>;
+typedef BasicInstanceGroup2D<Float> InstanceGroup2D;
+typedef BasicInstanceGroup3D<Float> InstanceGroup3D;
+
+template<UnsignedInt, class> class InstancedDrawable;
+template<class T> using BasicInstancedDrawable2D = InstancedDrawable<2, T>;
+template<class T> using BasicInstancedDrawable3D = InstancedDrawable<3, T>;
+typedef BasicInstancedDrawable2D<Float> InstancedDrawable2D;
+typedef BasicInstancedDrawable3D<Float> InstancedDrawable3D;
+
 template<class> class BasicMatrixTransformation2D;
 template<class> class BasicMatrixTransformation3D;
 typedef BasicMatrixTransformation2D<Float> MatrixTransformation2D;
 typedef BasicMatrixTransformation3D<Float> MatrixTransformation3D;
 
+class MemoryPool;
+
 template<class Transformation> class Object;
 
 template<class> class BasicRigidMatrixTransformation2D;
@@ -147,8 +183,30 @@ template<class> class BasicRigidMatrixTransformation3D;
 typedef BasicRigidMatrixTransformation2D<Float> RigidMatrixTransformation2D;
 typedef BasicRigidMatrixTransformation3D<Float> RigidMatrixTransformation3D;
 
+class PoolAllocated;
+
 template<class Transformation> class Scene;
 
+template<UnsignedInt, class> class SpatialFeature;
+template<class T> using BasicSpatialFeature2D = SpatialFeature<2, T>;
+template<class T> using BasicSpatialFeature3D = SpatialFeature<3, T>;
+typedef BasicSpatialFeature2D<Float> SpatialFeature2D;
+typedef BasicSpatialFeature3D<Float> SpatialFeature3D;
+
+template<UnsignedInt, class> class SpatialIndex;
+template<class T> using BasicSpatialIndex2D = SpatialIndex<2, T>;
+template<class T> using BasicSpatialIndex3D = SpatialIndex<3, T>;
+typedef BasicSpatialIndex2D<Float> SpatialIndex2D;
+typedef BasicSpatialIndex3D<Float> SpatialIndex3D;
+
+#ifdef MAGNUM_BUILD_MULTITHREADED
+class ThreadPool;
+#endif
+
+enum class TrackInterpolation: UnsignedByte;
+template<class> class Track;
+template<class> class TrackSampler;
+
 template<UnsignedInt, class T, class = T> class TranslationTransformation;
 template<class T, class TranslationType = T> using BasicTranslationTransformation2D = TranslationTransformation<2, T, TranslationType>;
 template<class T, class TranslationType = T> using BasicTranslationTransformation3D = TranslationTransformation<3, T, TranslationType>;
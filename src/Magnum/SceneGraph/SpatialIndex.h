@@ -0,0 +1,400 @@
+#ifndef Magnum_SceneGraph_SpatialIndex_h
+#define Magnum_SceneGraph_SpatialIndex_h
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+/** @file
+ * @brief Class @ref Magnum::SceneGraph::SpatialIndex, @ref Magnum::SceneGraph::SpatialFeature, alias @ref Magnum::SceneGraph::BasicSpatialIndex2D, @ref Magnum::SceneGraph::BasicSpatialIndex3D, @ref Magnum::SceneGraph::BasicSpatialFeature2D, @ref Magnum::SceneGraph::BasicSpatialFeature3D, typedef @ref Magnum::SceneGraph::SpatialIndex2D, @ref Magnum::SceneGraph::SpatialIndex3D, @ref Magnum::SceneGraph::SpatialFeature2D, @ref Magnum::SceneGraph::SpatialFeature3D
+ */
+
+#include <vector>
+
+#include "Magnum/Math/Range.h"
+#include "Magnum/SceneGraph/AbstractFeature.h"
+
+namespace Magnum { namespace SceneGraph {
+
+namespace Implementation {
+    template<UnsignedInt dimensions, class T> struct SpatialIndexNode {
+        RangeTypeFor<dimensions, T> bounds;
+        UnsignedInt parent, left, right, height;
+        SpatialFeature<dimensions, T>* feature;
+    };
+}
+
+/**
+@brief Feature with bounds stored in spatial index
+
+Attaches object-local axis-aligned bounding box to an object and keeps its
+absolute counterpart in given @ref SpatialIndex. The feature has
+@ref CachedTransformation::Absolute enabled, so the index is refit every time
+the object is cleaned after its transformation changed. See
+@ref SpatialIndex for more information.
+
+## Explicit template specializations
+
+The following specializations are explicitly compiled into @ref SceneGraph
+library. For other specializations (e.g. using @ref Magnum::Double "Double"
+type) you have to use @ref SpatialIndex.hpp implementation file to avoid
+linker errors. See also @ref compilation-speedup-hpp for more information.
+
+-   @ref SpatialFeature2D
+-   @ref SpatialFeature3D
+
+@see @ref BasicSpatialFeature2D, @ref BasicSpatialFeature3D
+*/
+template<UnsignedInt dimensions, class T> class SpatialFeature: public AbstractFeature<dimensions, T> {
+    friend SpatialIndex<dimensions, T>;
+
+    public:
+        /**
+         * @brief Constructor
+         * @param object        Object this feature belongs to
+         * @param index         Index this feature belongs to
+         * @param localBounds   Bounds in object-local coordinates
+         *
+         * The index must outlive the feature. The feature gets inserted into
+         * the index hierarchy during next @ref SpatialIndex::setClean().
+         */
+        explicit SpatialFeature(AbstractObject<dimensions, T>& object, SpatialIndex<dimensions, T>& index, const RangeTypeFor<dimensions, T>& localBounds);
+
+        /**
+         * @brief Destructor
+         *
+         * Removes the feature from the index.
+         */
+        ~SpatialFeature();
+
+        /** @brief Index this feature belongs to */
+        SpatialIndex<dimensions, T>& index() { return _index; }
+
+        /** @overload */
+        const SpatialIndex<dimensions, T>& index() const { return _index; }
+
+        /** @brief Bounds in object-local coordinates */
+        RangeTypeFor<dimensions, T> localBounds() const { return _localBounds; }
+
+        /**
+         * @brief Set bounds in object-local coordinates
+         * @return Reference to self (for method chaining)
+         *
+         * Marks the object as dirty.
+         */
+        SpatialFeature<dimensions, T>& setLocalBounds(const RangeTypeFor<dimensions, T>& bounds);
+
+        /**
+         * @brief Absolute bounds
+         *
+         * Axis-aligned box enclosing transformed @ref localBounds(), as
+         * computed during last cleaning of the object.
+         */
+        RangeTypeFor<dimensions, T> bounds() const { return _bounds; }
+
+    private:
+        void markDirty() override;
+        void clean(const MatrixTypeFor<dimensions, T>& absoluteTransformationMatrix) override;
+
+        SpatialIndex<dimensions, T>& _index;
+        RangeTypeFor<dimensions, T> _localBounds, _bounds;
+        /* _dirtyId is position in SpatialIndex::_dirtyFeatures, if listed
+           there, so it can be removed from it in O(1) */
+        UnsignedInt _id, _node, _dirtyId;
+};
+
+/**
+@brief Spatial index
+
+Dynamic bounding volume hierarchy over absolute bounds of @ref SpatialFeature
+instances, answering sphere, box, frustum and ray queries in logarithmic time
+instead of testing all features one by one.
+@code
+SceneGraph::SpatialIndex3D index;
+
+Object3D* o = new Object3D{&scene};
+new SceneGraph::SpatialFeature3D{*o, index, {Vector3{-1.0f}, Vector3{1.0f}}};
+
+// ...
+
+std::vector<std::reference_wrapper<SceneGraph::SpatialFeature3D>> found;
+index.featuresInSphere({0.0f, 5.0f, 0.0f}, 10.0f, found);
+@endcode
+
+The hierarchy is an AVL-balanced binary tree of axis-aligned boxes with new
+leaves placed using the surface area heuristic. When an object with the
+feature is cleaned after its transformation changed, bounds of its leaf and
+all ancestors are refit without changing the tree structure. The index
+tracks which objects were marked as dirty and every query cleans just them
+before traversing the hierarchy. All features in one index are expected to be
+part of the same scene.
+
+@attention With @ref DirtyPropagation::Lazy the features are not notified
+    when their objects are marked as dirty. Call @ref setDirty() after moving
+    the objects in that case, the next query will then clean all objects in
+    the index.
+
+The queries are conservative, they return all features whose absolute
+bounds intersect given volume. Memory used by the hierarchy and the queries is
+kept between calls, so queries don't allocate once the buffers are large
+enough.
+
+## Explicit template specializations
+
+The following specializations are explicitly compiled into @ref SceneGraph
+library. For other specializations (e.g. using @ref Magnum::Double "Double"
+type) you have to use @ref SpatialIndex.hpp implementation file to avoid
+linker errors. See also @ref compilation-speedup-hpp for more information.
+
+-   @ref SpatialIndex2D
+-   @ref SpatialIndex3D
+
+@see @ref scenegraph, @ref BasicSpatialIndex2D, @ref BasicSpatialIndex3D
+*/
+template<UnsignedInt dimensions, class T> class SpatialIndex {
+    friend SpatialFeature<dimensions, T>;
+
+    public:
+        /** @brief Constructor */
+        explicit SpatialIndex();
+
+        /** @brief Copying is not allowed */
+        SpatialIndex(const SpatialIndex<dimensions, T>&) = delete;
+
+        /** @brief Moving is not allowed */
+        SpatialIndex(SpatialIndex<dimensions, T>&&) = delete;
+
+        /**
+         * @brief Destructor
+         *
+         * Expects that all features were removed from the index.
+         */
+        ~SpatialIndex();
+
+        /** @brief Copying is not allowed */
+        SpatialIndex<dimensions, T>& operator=(const SpatialIndex<dimensions, T>&) = delete;
+
+        /** @brief Moving is not allowed */
+        SpatialIndex<dimensions, T>& operator=(SpatialIndex<dimensions, T>&&) = delete;
+
+        /** @brief Whether the index is empty */
+        bool isEmpty() const { return _features.empty(); }
+
+        /** @brief Count of features in the index */
+        std::size_t size() const { return _features.size(); }
+
+        /** @brief Feature at given index */
+        SpatialFeature<dimensions, T>& operator[](std::size_t index) {
+            return *_features[index];
+        }
+
+        /** @overload */
+        const SpatialFeature<dimensions, T>& operator[](std::size_t index) const {
+            return *_features[index];
+        }
+
+        /**
+         * @brief Whether the index is dirty
+         *
+         * Returns `true` if any object in the index was marked as dirty or
+         * any feature was added since last @ref setClean().
+         */
+        bool isDirty() const { return _allDirty || !_dirtyFeatures.empty(); }
+
+        /**
+         * @brief Set all features in the index as dirty
+         *
+         * Next @ref setClean() will clean all objects in the index instead
+         * of only these that were marked as dirty.
+         */
+        void setDirty() { _allDirty = true; }
+
+        /**
+         * @brief Clean dirty objects and refit the hierarchy
+         *
+         * Called automatically by all queries.
+         */
+        void setClean();
+
+        /**
+         * @brief Hierarchy height
+         *
+         * `0` for empty index, `1` for index with one feature.
+         */
+        UnsignedInt height() const;
+
+        /**
+         * @brief Absolute bounds of all features
+         *
+         * Cleans the index first. Returns zero range if the index is empty.
+         */
+        RangeTypeFor<dimensions, T> bounds();
+
+        /**
+         * @brief Features intersecting given sphere
+         * @param center    Sphere center
+         * @param radius    Sphere radius
+         * @param features  Output list of features
+         *
+         * The output list is cleared first. Cleans the index before the
+         * query.
+         */
+        void featuresInSphere(const VectorTypeFor<dimensions, T>& center, T radius, std::vector<std::reference_wrapper<SpatialFeature<dimensions, T>>>& features);
+
+        /**
+         * @brief Features intersecting given box
+         *
+         * See @ref featuresInSphere() for more information.
+         */
+        void featuresInBox(const RangeTypeFor<dimensions, T>& box, std::vector<std::reference_wrapper<SpatialFeature<dimensions, T>>>& features);
+
+        /**
+         * @brief Features intersecting given view frustum
+         * @param transformationProjectionMatrix    Projection matrix
+         *      multiplied with @ref Camera::cameraMatrix()
+         * @param features                          Output list of features
+         *
+         * See @ref featuresInSphere() for more information.
+         */
+        void featuresInFrustum(const MatrixTypeFor<dimensions, T>& transformationProjectionMatrix, std::vector<std::reference_wrapper<SpatialFeature<dimensions, T>>>& features);
+
+        /**
+         * @brief Features intersecting given ray
+         * @param origin    Ray origin
+         * @param direction Ray direction, doesn't need to be normalized
+         * @param features  Output list of features
+         *
+         * Only intersections in positive direction from the origin are
+         * reported. See @ref featuresInSphere() for more information.
+         */
+        void featuresOnRay(const VectorTypeFor<dimensions, T>& origin, const VectorTypeFor<dimensions, T>& direction, std::vector<std::reference_wrapper<SpatialFeature<dimensions, T>>>& features);
+
+    private:
+        typedef Implementation::SpatialIndexNode<dimensions, T> Node;
+
+        void add(SpatialFeature<dimensions, T>& feature);
+        void remove(SpatialFeature<dimensions, T>& feature);
+        void markDirty(SpatialFeature<dimensions, T>& feature);
+
+        UnsignedInt allocateNode();
+        void freeNode(UnsignedInt node);
+        void insertLeaf(UnsignedInt leaf);
+        void removeLeaf(UnsignedInt leaf);
+        void refitLeaf(UnsignedInt leaf);
+        UnsignedInt balance(UnsignedInt node);
+        void fixUpwards(UnsignedInt node);
+
+        template<class Overlaps> void query(Overlaps overlaps, std::vector<std::reference_wrapper<SpatialFeature<dimensions, T>>>& features);
+
+        std::vector<SpatialFeature<dimensions, T>*> _features, _dirtyFeatures;
+        std::vector<Node> _nodes;
+        UnsignedInt _root, _freeNodes;
+        bool _allDirty;
+
+        /* Kept between calls to avoid allocations */
+        std::vector<std::reference_wrapper<AbstractObject<dimensions, T>>> _objects;
+        std::vector<UnsignedInt> _stack;
+};
+
+/**
+@brief Spatial feature for two-dimensional scenes
+
+Convenience alternative to `SpatialFeature<2, T>`. See @ref SpatialIndex for
+more information.
+@see @ref SpatialFeature2D, @ref BasicSpatialFeature3D
+*/
+#ifndef CORRADE_MSVC2015_COMPATIBILITY /* Multiple definitions still broken */
+template<class T> using BasicSpatialFeature2D = SpatialFeature<2, T>;
+#endif
+
+/**
+@brief Spatial feature for two-dimensional float scenes
+
+@see @ref SpatialFeature3D
+*/
+typedef BasicSpatialFeature2D<Float> SpatialFeature2D;
+
+/**
+@brief Spatial feature for three-dimensional scenes
+
+Convenience alternative to `SpatialFeature<3, T>`. See @ref SpatialIndex for
+more information.
+@see @ref SpatialFeature3D, @ref BasicSpatialFeature2D
+*/
+#ifndef CORRADE_MSVC2015_COMPATIBILITY /* Multiple definitions still broken */
+template<class T> using BasicSpatialFeature3D = SpatialFeature<3, T>;
+#endif
+
+/**
+@brief Spatial feature for three-dimensional float scenes
+
+@see @ref SpatialFeature2D
+*/
+typedef BasicSpatialFeature3D<Float> SpatialFeature3D;
+
+/**
+@brief Spatial index for two-dimensional scenes
+
+Convenience alternative to `SpatialIndex<2, T>`. See @ref SpatialIndex for
+more information.
+@see @ref SpatialIndex2D, @ref BasicSpatialIndex3D
+*/
+#ifndef CORRADE_MSVC2015_COMPATIBILITY /* Multiple definitions still broken */
+template<class T> using BasicSpatialIndex2D = SpatialIndex<2, T>;
+#endif
+
+/**
+@brief Spatial index for two-dimensional float scenes
+
+@see @ref SpatialIndex3D
+*/
+typedef BasicSpatialIndex2D<Float> SpatialIndex2D;
+
+/**
+@brief Spatial index for three-dimensional scenes
+
+Convenience alternative to `SpatialIndex<3, T>`. See @ref SpatialIndex for
+more information.
+@see @ref SpatialIndex3D, @ref BasicSpatialIndex2D
+*/
+#ifndef CORRADE_MSVC2015_COMPATIBILITY /* Multiple definitions still broken */
+template<class T> using BasicSpatialIndex3D = SpatialIndex<3, T>;
+#endif
+
+/**
+@brief Spatial index for three-dimensional float scenes
+
+@see @ref SpatialIndex2D
+*/
+typedef BasicSpatialIndex3D<Float> SpatialIndex3D;
+
+#if defined(CORRADE_TARGET_WINDOWS) && !defined(__MINGW32__)
+extern template class MAGNUM_SCENEGRAPH_EXPORT SpatialFeature<2, Float>;
+extern template class MAGNUM_SCENEGRAPH_EXPORT SpatialFeature<3, Float>;
+extern template class MAGNUM_SCENEGRAPH_EXPORT SpatialIndex<2, Float>;
+extern template class MAGNUM_SCENEGRAPH_EXPORT SpatialIndex<3, Float>;
+#endif
+
+}}
+
+#endif
@@ -0,0 +1,478 @@
+#ifndef Magnum_SceneGraph_SpatialIndex_hpp
+#define Magnum_SceneGraph_SpatialIndex_hpp
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+/** @file
+ * @brief @ref compilation-speedup-hpp "Template implementation" for @ref SpatialIndex.h
+ */
+
+#include <algorithm>
+#include <limits>
+
+#include "Magnum/Math/Functions.h"
+#include "Magnum/SceneGraph/AbstractObject.h"
+#include "Magnum/SceneGraph/SpatialIndex.h"
+#include "Magnum/SceneGraph/frustumImplementation.h"
+
+namespace Magnum { namespace SceneGraph {
+
+namespace Implementation {
+
+enum: UnsignedInt {
+    SpatialIndexNoNode = ~UnsignedInt{},
+    SpatialIndexNotDirty = ~UnsignedInt{}
+};
+
+template<UnsignedInt dimensions, class T> RangeTypeFor<dimensions, T> joinBounds(const RangeTypeFor<dimensions, T>& a, const RangeTypeFor<dimensions, T>& b) {
+    return {Math::min(a.min(), b.min()), Math::max(a.max(), b.max())};
+}
+
+template<UnsignedInt dimensions, class T> bool boundsDiffer(const RangeTypeFor<dimensions, T>& a, const RangeTypeFor<dimensions, T>& b) {
+    /* Not using Range::operator==(), as fuzzy compare could leave parent
+       bounds slightly smaller than the children */
+    for(UnsignedInt i = 0; i != dimensions; ++i)
+        if(a.min()[i] != b.min()[i] || a.max()[i] != b.max()[i]) return true;
+    return false;
+}
+
+/* Surface area (or perimeter in 2D), halved */
+template<UnsignedInt dimensions, class T> T boundsCost(const RangeTypeFor<dimensions, T>& bounds) {
+    const VectorTypeFor<dimensions, T> size = bounds.size();
+    T cost{};
+    for(UnsignedInt i = 0; i != dimensions; ++i)
+        cost += dimensions == 2 ? size[i] : size[i]*size[(i + 1) % dimensions];
+    return cost;
+}
+
+/* Axis-aligned box enclosing transformed box */
+template<UnsignedInt dimensions, class T> RangeTypeFor<dimensions, T> transformBounds(const MatrixTypeFor<dimensions, T>& transformationMatrix, const RangeTypeFor<dimensions, T>& bounds) {
+    const VectorTypeFor<dimensions, T> center = transformationMatrix.transformPoint(bounds.center());
+    const VectorTypeFor<dimensions, T> halfSize = bounds.size()/T(2);
+    VectorTypeFor<dimensions, T> extent;
+    for(UnsignedInt k = 0; k != dimensions; ++k)
+        for(UnsignedInt j = 0; j != dimensions; ++j)
+            extent[k] += Math::abs(transformationMatrix[j][k])*halfSize[j];
+    return {center - extent, center + extent};
+}
+
+}
+
+template<UnsignedInt dimensions, class T> SpatialFeature<dimensions, T>::SpatialFeature(AbstractObject<dimensions, T>& object, SpatialIndex<dimensions, T>& index, const RangeTypeFor<dimensions, T>& localBounds): AbstractFeature<dimensions, T>(object), _index(index), _localBounds(localBounds), _id{}, _node{Implementation::SpatialIndexNoNode}, _dirtyId{Implementation::SpatialIndexNotDirty} {
+    AbstractFeature<dimensions, T>::setCachedTransformations(CachedTransformation::Absolute);
+    _index.add(*this);
+
+    /* Make sure clean() gets called to compute the absolute bounds */
+    object.setDirty();
+}
+
+template<UnsignedInt dimensions, class T> SpatialFeature<dimensions, T>::~SpatialFeature() {
+    _index.remove(*this);
+}
+
+template<UnsignedInt dimensions, class T> SpatialFeature<dimensions, T>& SpatialFeature<dimensions, T>::setLocalBounds(const RangeTypeFor<dimensions, T>& bounds) {
+    _localBounds = bounds;
+
+    /* The object might be dirty already, in which case markDirty() isn't
+       called again */
+    _index.markDirty(*this);
+    AbstractFeature<dimensions, T>::object().setDirty();
+    return *this;
+}
+
+template<UnsignedInt dimensions, class T> void SpatialFeature<dimensions, T>::markDirty() {
+    _index.markDirty(*this);
+}
+
+template<UnsignedInt dimensions, class T> void SpatialFeature<dimensions, T>::clean(const MatrixTypeFor<dimensions, T>& absoluteTransformationMatrix) {
+    _bounds = Implementation::transformBounds<dimensions, T>(absoluteTransformationMatrix, _localBounds);
+
+    /* Features not yet in the hierarchy are inserted in SpatialIndex::setClean() */
+    if(_node != Implementation::SpatialIndexNoNode) _index.refitLeaf(_node);
+}
+
+template<UnsignedInt dimensions, class T> SpatialIndex<dimensions, T>::SpatialIndex(): _root{Implementation::SpatialIndexNoNode}, _freeNodes{Implementation::SpatialIndexNoNode}, _allDirty{false} {}
+
+template<UnsignedInt dimensions, class T> SpatialIndex<dimensions, T>::~SpatialIndex() {
+    CORRADE_ASSERT(_features.empty(),
+        "SceneGraph::SpatialIndex: destroyed while still having" << _features.size() << "features", );
+}
+
+template<UnsignedInt dimensions, class T> void SpatialIndex<dimensions, T>::add(SpatialFeature<dimensions, T>& feature) {
+    feature._id = _features.size();
+    _features.push_back(&feature);
+    markDirty(feature);
+}
+
+template<UnsignedInt dimensions, class T> void SpatialIndex<dimensions, T>::remove(SpatialFeature<dimensions, T>& feature) {
+    if(feature._node != Implementation::SpatialIndexNoNode) {
+        removeLeaf(feature._node);
+        freeNode(feature._node);
+    }
+
+    /* Move last dirty feature to the place of removed one */
+    if(feature._dirtyId != Implementation::SpatialIndexNotDirty) {
+        SpatialFeature<dimensions, T>* const lastDirty = _dirtyFeatures.back();
+        _dirtyFeatures[feature._dirtyId] = lastDirty;
+        lastDirty->_dirtyId = feature._dirtyId;
+        _dirtyFeatures.pop_back();
+    }
+
+    /* Move last feature to the place of removed one */
+    SpatialFeature<dimensions, T>* const last = _features.back();
+    _features[feature._id] = last;
+    last->_id = feature._id;
+    _features.pop_back();
+}
+
+template<UnsignedInt dimensions, class T> void SpatialIndex<dimensions, T>::markDirty(SpatialFeature<dimensions, T>& feature) {
+    if(feature._dirtyId != Implementation::SpatialIndexNotDirty) return;
+
+    feature._dirtyId = _dirtyFeatures.size();
+    _dirtyFeatures.push_back(&feature);
+}
+
+template<UnsignedInt dimensions, class T> void SpatialIndex<dimensions, T>::setClean() {
+    if(!isDirty()) return;
+
+    /* Clean the objects, which refits leaves of features that are already in
+       the hierarchy */
+    const std::vector<SpatialFeature<dimensions, T>*>& features = _allDirty ? _features : _dirtyFeatures;
+    _objects.clear();
+    _objects.reserve(features.size());
+    for(SpatialFeature<dimensions, T>* feature: features)
+        _objects.push_back(feature->object());
+    AbstractObject<dimensions, T>::setClean(_objects);
+
+    /* Insert new features. These are always in the dirty list. */
+    for(SpatialFeature<dimensions, T>* feature: _dirtyFeatures) {
+        feature->_dirtyId = Implementation::SpatialIndexNotDirty;
+        if(feature->_node != Implementation::SpatialIndexNoNode) continue;
+
+        const UnsignedInt leaf = allocateNode();
+        _nodes[leaf].bounds = feature->_bounds;
+        _nodes[leaf].feature = feature;
+        feature->_node = leaf;
+        insertLeaf(leaf);
+    }
+
+    _dirtyFeatures.clear();
+    _allDirty = false;
+}
+
+template<UnsignedInt dimensions, class T> UnsignedInt SpatialIndex<dimensions, T>::height() const {
+    return _root == Implementation::SpatialIndexNoNode ? 0 : _nodes[_root].height + 1;
+}
+
+template<UnsignedInt dimensions, class T> RangeTypeFor<dimensions, T> SpatialIndex<dimensions, T>::bounds() {
+    setClean();
+    return _root == Implementation::SpatialIndexNoNode ? RangeTypeFor<dimensions, T>{} : _nodes[_root].bounds;
+}
+
+template<UnsignedInt dimensions, class T> UnsignedInt SpatialIndex<dimensions, T>::allocateNode() {
+    UnsignedInt node;
+    if(_freeNodes != Implementation::SpatialIndexNoNode) {
+        node = _freeNodes;
+        _freeNodes = _nodes[node].parent;
+    } else {
+        node = _nodes.size();
+        _nodes.emplace_back();
+    }
+
+    Node& n = _nodes[node];
+    n.parent = n.left = n.right = Implementation::SpatialIndexNoNode;
+    n.height = 0;
+    n.feature = nullptr;
+    return node;
+}
+
+template<UnsignedInt dimensions, class T> void SpatialIndex<dimensions, T>::freeNode(const UnsignedInt node) {
+    _nodes[node].parent = _freeNodes;
+    _freeNodes = node;
+}
+
+template<UnsignedInt dimensions, class T> void SpatialIndex<dimensions, T>::insertLeaf(const UnsignedInt leaf) {
+    if(_root == Implementation::SpatialIndexNoNode) {
+        _root = leaf;
+        _nodes[leaf].parent = Implementation::SpatialIndexNoNode;
+        return;
+    }
+
+    /* Find the best sibling for the leaf using surface area heuristic */
+    const RangeTypeFor<dimensions, T> bounds = _nodes[leaf].bounds;
+    UnsignedInt index = _root;
+    while(_nodes[index].left != Implementation::SpatialIndexNoNode) {
+        const Node& node = _nodes[index];
+        const T cost = Implementation::boundsCost<dimensions, T>(node.bounds);
+        const T combinedCost = Implementation::boundsCost<dimensions, T>(Implementation::joinBounds<dimensions, T>(node.bounds, bounds));
+
+        /* Cost of creating new parent for this node and the leaf and the
+           minimum cost of pushing the leaf further down the tree */
+        const T siblingCost = T(2)*combinedCost;
+        const T inheritanceCost = T(2)*(combinedCost - cost);
+        auto childCost = [&](const UnsignedInt child) {
+            const Node& c = _nodes[child];
+            const T joinedCost = Implementation::boundsCost<dimensions, T>(Implementation::joinBounds<dimensions, T>(c.bounds, bounds));
+            return (c.left == Implementation::SpatialIndexNoNode ? joinedCost : joinedCost - Implementation::boundsCost<dimensions, T>(c.bounds)) + inheritanceCost;
+        };
+        const T leftCost = childCost(node.left);
+        const T rightCost = childCost(node.right);
+
+        if(siblingCost < leftCost && siblingCost < rightCost) break;
+        index = leftCost < rightCost ? node.left : node.right;
+    }
+
+    /* Create new parent for the sibling and the leaf */
+    const UnsignedInt sibling = index;
+    const UnsignedInt oldParent = _nodes[sibling].parent;
+    const UnsignedInt newParent = allocateNode();
+    Node& parent = _nodes[newParent];
+    parent.parent = oldParent;
+    parent.left = sibling;
+    parent.right = leaf;
+    _nodes[sibling].parent = newParent;
+    _nodes[leaf].parent = newParent;
+
+    if(oldParent == Implementation::SpatialIndexNoNode) _root = newParent;
+    else if(_nodes[oldParent].left == sibling) _nodes[oldParent].left = newParent;
+    else _nodes[oldParent].right = newParent;
+
+    fixUpwards(newParent);
+}
+
+template<UnsignedInt dimensions, class T> void SpatialIndex<dimensions, T>::removeLeaf(const UnsignedInt leaf) {
+    if(leaf == _root) {
+        _root = Implementation::SpatialIndexNoNode;
+        return;
+    }
+
+    /* Replace the parent with the sibling */
+    const UnsignedInt parent = _nodes[leaf].parent;
+    const UnsignedInt grandParent = _nodes[parent].parent;
+    const UnsignedInt sibling = _nodes[parent].left == leaf ? _nodes[parent].right : _nodes[parent].left;
+    _nodes[sibling].parent = grandParent;
+    freeNode(parent);
+
+    if(grandParent == Implementation::SpatialIndexNoNode) {
+        _root = sibling;
+        return;
+    }
+
+    if(_nodes[grandParent].left == parent) _nodes[grandParent].left = sibling;
+    else _nodes[grandParent].right = sibling;
+    fixUpwards(grandParent);
+}
+
+template<UnsignedInt dimensions, class T> void SpatialIndex<dimensions, T>::refitLeaf(const UnsignedInt leaf) {
+    _nodes[leaf].bounds = _nodes[leaf].feature->_bounds;
+
+    /* Walk up until the bounds stop changing */
+    for(UnsignedInt index = _nodes[leaf].parent; index != Implementation::SpatialIndexNoNode; index = _nodes[index].parent) {
+        Node& node = _nodes[index];
+        const RangeTypeFor<dimensions, T> bounds = Implementation::joinBounds<dimensions, T>(_nodes[node.left].bounds, _nodes[node.right].bounds);
+        if(!Implementation::boundsDiffer<dimensions, T>(bounds, node.bounds)) break;
+        node.bounds = bounds;
+    }
+}
+
+template<UnsignedInt dimensions, class T> void SpatialIndex<dimensions, T>::fixUpwards(UnsignedInt index) {
+    while(index != Implementation::SpatialIndexNoNode) {
+        index = balance(index);
+
+        Node& node = _nodes[index];
+        node.height = 1 + std::max(_nodes[node.left].height, _nodes[node.right].height);
+        node.bounds = Implementation::joinBounds<dimensions, T>(_nodes[node.left].bounds, _nodes[node.right].bounds);
+        index = node.parent;
+    }
+}
+
+template<UnsignedInt dimensions, class T> UnsignedInt SpatialIndex<dimensions, T>::balance(const UnsignedInt a) {
+    Node& nodeA = _nodes[a];
+    if(nodeA.left == Implementation::SpatialIndexNoNode || nodeA.height < 2) return a;
+
+    const UnsignedInt b = nodeA.left;
+    const UnsignedInt c = nodeA.right;
+    Node& nodeB = _nodes[b];
+    Node& nodeC = _nodes[c];
+    const Int balance = Int(nodeC.height) - Int(nodeB.height);
+
+    /* Rotate C up, A becomes its child */
+    if(balance > 1) {
+        const UnsignedInt f = nodeC.left;
+        const UnsignedInt g = nodeC.right;
+        Node& nodeF = _nodes[f];
+        Node& nodeG = _nodes[g];
+
+        nodeC.left = a;
+        nodeC.parent = nodeA.parent;
+        nodeA.parent = c;
+        if(nodeC.parent == Implementation::SpatialIndexNoNode) _root = c;
+        else if(_nodes[nodeC.parent].left == a) _nodes[nodeC.parent].left = c;
+        else _nodes[nodeC.parent].right = c;
+
+        /* The taller of C children stays with C */
+        if(nodeF.height > nodeG.height) {
+            nodeC.right = f;
+            nodeA.right = g;
+            nodeG.parent = a;
+            nodeA.bounds = Implementation::joinBounds<dimensions, T>(nodeB.bounds, nodeG.bounds);
+            nodeC.bounds = Implementation::joinBounds<dimensions, T>(nodeA.bounds, nodeF.bounds);
+            nodeA.height = 1 + std::max(nodeB.height, nodeG.height);
+            nodeC.height = 1 + std::max(nodeA.height, nodeF.height);
+        } else {
+            nodeC.right = g;
+            nodeA.right = f;
+            nodeF.parent = a;
+            nodeA.bounds = Implementation::joinBounds<dimensions, T>(nodeB.bounds, nodeF.bounds);
+            nodeC.bounds = Implementation::joinBounds<dimensions, T>(nodeA.bounds, nodeG.bounds);
+            nodeA.height = 1 + std::max(nodeB.height, nodeF.height);
+            nodeC.height = 1 + std::max(nodeA.height, nodeG.height);
+        }
+
+        return c;
+    }
+
+    /* Rotate B up, A becomes its child */
+    if(balance < -1) {
+        const UnsignedInt d = nodeB.left;
+        const UnsignedInt e = nodeB.right;
+        Node& nodeD = _nodes[d];
+        Node& nodeE = _nodes[e];
+
+        nodeB.left = a;
+        nodeB.parent = nodeA.parent;
+        nodeA.parent = b;
+        if(nodeB.parent == Implementation::SpatialIndexNoNode) _root = b;
+        else if(_nodes[nodeB.parent].left == a) _nodes[nodeB.parent].left = b;
+        else _nodes[nodeB.parent].right = b;
+
+        /* The taller of B children stays with B */
+        if(nodeD.height > nodeE.height) {
+            nodeB.right = d;
+            nodeA.left = e;
+            nodeE.parent = a;
+            nodeA.bounds = Implementation::joinBounds<dimensions, T>(nodeC.bounds, nodeE.bounds);
+            nodeB.bounds = Implementation::joinBounds<dimensions, T>(nodeA.bounds, nodeD.bounds);
+            nodeA.height = 1 + std::max(nodeC.height, nodeE.height);
+            nodeB.height = 1 + std::max(nodeA.height, nodeD.height);
+        } else {
+            nodeB.right = e;
+            nodeA.left = d;
+            nodeD.parent = a;
+            nodeA.bounds = Implementation::joinBounds<dimensions, T>(nodeC.bounds, nodeD.bounds);
+            nodeB.bounds = Implementation::joinBounds<dimensions, T>(nodeA.bounds, nodeE.bounds);
+            nodeA.height = 1 + std::max(nodeC.height, nodeD.height);
+            nodeB.height = 1 + std::max(nodeA.height, nodeE.height);
+        }
+
+        return b;
+    }
+
+    return a;
+}
+
+template<UnsignedInt dimensions, class T> template<class Overlaps> void SpatialIndex<dimensions, T>::query(Overlaps overlaps, std::vector<std::reference_wrapper<SpatialFeature<dimensions, T>>>& features) {
+    features.clear();
+    setClean();
+    if(_root == Implementation::SpatialIndexNoNode) return;
+
+    _stack.clear();
+    _stack.push_back(_root);
+    while(!_stack.empty()) {
+        const Node& node = _nodes[_stack.back()];
+        _stack.pop_back();
+        if(!overlaps(node.bounds)) continue;
+
+        if(node.left == Implementation::SpatialIndexNoNode)
+            features.push_back(*node.feature);
+        else {
+            _stack.push_back(node.left);
+            _stack.push_back(node.right);
+        }
+    }
+}
+
+template<UnsignedInt dimensions, class T> void SpatialIndex<dimensions, T>::featuresInSphere(const VectorTypeFor<dimensions, T>& center, const T radius, std::vector<std::reference_wrapper<SpatialFeature<dimensions, T>>>& features) {
+    query([&center, radius](const RangeTypeFor<dimensions, T>& bounds) {
+        T distanceSquared{};
+        for(UnsignedInt i = 0; i != dimensions; ++i) {
+            const T d = std::max(bounds.min()[i] - center[i], T(0)) + std::max(center[i] - bounds.max()[i], T(0));
+            distanceSquared += d*d;
+        }
+        return distanceSquared <= radius*radius;
+    }, features);
+}
+
+template<UnsignedInt dimensions, class T> void SpatialIndex<dimensions, T>::featuresInBox(const RangeTypeFor<dimensions, T>& box, std::vector<std::reference_wrapper<SpatialFeature<dimensions, T>>>& features) {
+    query([&box](const RangeTypeFor<dimensions, T>& bounds) {
+        for(UnsignedInt i = 0; i != dimensions; ++i)
+            if(bounds.min()[i] > box.max()[i] || bounds.max()[i] < box.min()[i]) return false;
+        return true;
+    }, features);
+}
+
+template<UnsignedInt dimensions, class T> void SpatialIndex<dimensions, T>::featuresInFrustum(const MatrixTypeFor<dimensions, T>& transformationProjectionMatrix, std::vector<std::reference_wrapper<SpatialFeature<dimensions, T>>>& features) {
+    Math::Vector<dimensions + 1, T> planes[dimensions*2];
+    Implementation::frustumPlanes<dimensions, T>(transformationProjectionMatrix, planes);
+
+    query([&planes](const RangeTypeFor<dimensions, T>& bounds) {
+        const VectorTypeFor<dimensions, T> center = bounds.center();
+        const VectorTypeFor<dimensions, T> halfSize = bounds.size()/T(2);
+        for(const Math::Vector<dimensions + 1, T>& plane: planes) {
+            T distance = plane[dimensions];
+            for(UnsignedInt i = 0; i != dimensions; ++i)
+                distance += plane[i]*center[i] + Math::abs(plane[i])*halfSize[i];
+            if(distance < T(0)) return false;
+        }
+        return true;
+    }, features);
+}
+
+template<UnsignedInt dimensions, class T> void SpatialIndex<dimensions, T>::featuresOnRay(const VectorTypeFor<dimensions, T>& origin, const VectorTypeFor<dimensions, T>& direction, std::vector<std::reference_wrapper<SpatialFeature<dimensions, T>>>& features) {
+    query([&origin, &direction](const RangeTypeFor<dimensions, T>& bounds) {
+        /* Slab test */
+        T tMin = T(0);
+        T tMax = std::numeric_limits<T>::infinity();
+        for(UnsignedInt i = 0; i != dimensions; ++i) {
+            if(direction[i] == T(0)) {
+                if(origin[i] < bounds.min()[i] || origin[i] > bounds.max()[i]) return false;
+                continue;
+            }
+
+            const T inverse = T(1)/direction[i];
+            T a = (bounds.min()[i] - origin[i])*inverse;
+            T b = (bounds.max()[i] - origin[i])*inverse;
+            if(a > b) std::swap(a, b);
+            tMin = std::max(tMin, a);
+            tMax = std::min(tMax, b);
+            if(tMin > tMax) return false;
+        }
+        return true;
+    }, features);
+}
+
+}}
+
+#endif
@@ -30,6 +30,10 @@
 #include "Magnum/SceneGraph/AnimableGroup.h"
 #include "Magnum/SceneGraph/MatrixTransformation3D.h"
 
+#ifdef MAGNUM_BUILD_MULTITHREADED
+#include "Magnum/SceneGraph/ThreadPool.h"
+#endif
+
 namespace Magnum { namespace SceneGraph { namespace Test {
 
 struct AnimableTest: TestSuite::Tester {
@@ -41,6 +45,12 @@ struct AnimableTest: TestSuite::Tester {
     void repeat();
     void stop();
     void pause();
+    void sleeping();
+    void removeRunning();
+    void moveRunning();
+    #ifdef MAGNUM_BUILD_MULTITHREADED
+    void threadPool();
+    #endif
 
     void debug();
 };
@@ -54,6 +64,12 @@ AnimableTest::AnimableTest() {
               &AnimableTest::repeat,
               &AnimableTest::stop,
               &AnimableTest::pause,
+              &AnimableTest::sleeping,
+              &AnimableTest::removeRunning,
+              &AnimableTest::moveRunning,
+              #ifdef MAGNUM_BUILD_MULTITHREADED
+              &AnimableTest::threadPool,
+              #endif
 
               &AnimableTest::debug});
 }
@@ -351,6 +367,176 @@ void AnimableTest::pause() {
     CORRADE_COMPARE(animable.time, 2.0f);
 }
 
+class CountingAnimable: public SceneGraph::Animable3D {
+    public:
+        CountingAnimable(AbstractObject3D& object, AnimableGroup3D* group = nullptr, Float duration = 0.0f): SceneGraph::Animable3D(object, group), steps(0), time(-1.0f) {
+            setDuration(duration);
+        }
+
+        UnsignedInt steps;
+        Float time;
+
+    protected:
+        void animationStep(Float t, Float) override {
+            ++steps;
+            time = t;
+        }
+};
+
+void AnimableTest::sleeping() {
+    Object3D object;
+    AnimableGroup3D group;
+    std::vector<CountingAnimable*> animables;
+    for(std::size_t i = 0; i != 100; ++i)
+        animables.push_back(new CountingAnimable(object, &group));
+
+    /* Only every tenth is running, the state change is applied in next step */
+    for(std::size_t i = 0; i < animables.size(); i += 10)
+        animables[i]->setState(AnimationState::Running);
+    CORRADE_COMPARE(group.runningCount(), 0);
+    group.step(1.0f, 0.5f);
+    group.step(1.5f, 0.5f);
+    CORRADE_COMPARE(group.runningCount(), 10);
+    for(std::size_t i = 0; i != animables.size(); ++i) {
+        CORRADE_COMPARE(animables[i]->steps, i % 10 ? 0 : 2);
+        CORRADE_COMPARE(animables[i]->time, i % 10 ? -1.0f : 0.5f);
+    }
+
+    /* Pause some and stop some, the rest continues */
+    animables[10]->setState(AnimationState::Paused);
+    animables[50]->setState(AnimationState::Stopped);
+    animables[90]->setState(AnimationState::Paused);
+    group.step(2.0f, 0.5f);
+    CORRADE_COMPARE(group.runningCount(), 7);
+    CORRADE_COMPARE(animables[0]->steps, 3);
+    CORRADE_COMPARE(animables[10]->steps, 2);
+    CORRADE_COMPARE(animables[50]->steps, 2);
+    CORRADE_COMPARE(animables[80]->steps, 3);
+    CORRADE_COMPARE(animables[90]->steps, 2);
+
+    /* Changing state back and forth before step does nothing */
+    animables[20]->setState(AnimationState::Paused);
+    animables[20]->setState(AnimationState::Running);
+    animables[1]->setState(AnimationState::Running);
+    animables[1]->setState(AnimationState::Stopped);
+    group.step(2.5f, 0.5f);
+    CORRADE_COMPARE(group.runningCount(), 7);
+    CORRADE_COMPARE(animables[20]->steps, 4);
+    CORRADE_COMPARE(animables[20]->time, 1.5f);
+    CORRADE_COMPARE(animables[1]->steps, 0);
+
+    /* Resuming continues from paused time */
+    animables[10]->setState(AnimationState::Running);
+    group.step(3.0f, 0.5f);
+    CORRADE_COMPARE(group.runningCount(), 8);
+    CORRADE_COMPARE(animables[10]->time, 1.0f);
+}
+
+void AnimableTest::removeRunning() {
+    Object3D object;
+    AnimableGroup3D group;
+    auto a = new CountingAnimable(object, &group);
+    auto b = new CountingAnimable(object, &group);
+    auto c = new CountingAnimable(object, &group);
+    a->setState(AnimationState::Running);
+    b->setState(AnimationState::Running);
+    c->setState(AnimationState::Running);
+    group.step(1.0f, 0.5f);
+    CORRADE_COMPARE(group.runningCount(), 3);
+
+    /* Deleting running animable removes it from the running list */
+    delete a;
+    CORRADE_COMPARE(group.size(), 2);
+    CORRADE_COMPARE(group.runningCount(), 2);
+    group.step(1.5f, 0.5f);
+    CORRADE_COMPARE(b->steps, 2);
+    CORRADE_COMPARE(c->steps, 2);
+
+    /* Deleting animable with pending state change */
+    b->setState(AnimationState::Paused);
+    delete b;
+    group.step(2.0f, 0.5f);
+    CORRADE_COMPARE(group.runningCount(), 1);
+    CORRADE_COMPARE(c->steps, 3);
+
+    /* Removing from the group stops stepping it, but keeps the state */
+    group.remove(*c);
+    CORRADE_COMPARE(group.runningCount(), 0);
+    group.step(2.5f, 0.5f);
+    CORRADE_COMPARE(c->steps, 3);
+    CORRADE_COMPARE(c->state(), AnimationState::Running);
+}
+
+void AnimableTest::moveRunning() {
+    Object3D object;
+    AnimableGroup3D first;
+    AnimableGroup3D second;
+    auto a = new CountingAnimable(object, &first);
+    a->setState(AnimationState::Running);
+    first.step(1.0f, 0.5f);
+    first.step(1.5f, 0.5f);
+    CORRADE_COMPARE(first.runningCount(), 1);
+    CORRADE_COMPARE(a->steps, 2);
+
+    /* The animation continues in the other group */
+    second.add(*a);
+    CORRADE_COMPARE(first.size(), 0);
+    CORRADE_COMPARE(first.runningCount(), 0);
+    first.step(2.0f, 0.5f);
+    second.step(2.0f, 0.5f);
+    CORRADE_COMPARE(second.runningCount(), 1);
+    CORRADE_COMPARE(a->steps, 3);
+    CORRADE_COMPARE(a->time, 1.0f);
+
+    /* Moving with pending state change applies it in the new group */
+    auto b = new CountingAnimable(object, &first);
+    b->setState(AnimationState::Running);
+    second.add(*b);
+    first.step(2.5f, 0.5f);
+    CORRADE_COMPARE(b->steps, 0);
+    second.step(2.5f, 0.5f);
+    CORRADE_COMPARE(second.runningCount(), 2);
+    CORRADE_COMPARE(b->steps, 1);
+    CORRADE_COMPARE(b->time, 0.0f);
+
+    /* Animable added to a group only later gets its state applied */
+    auto c = new CountingAnimable(object);
+    c->setState(AnimationState::Running);
+    second.add(*c);
+    second.step(3.0f, 0.5f);
+    CORRADE_COMPARE(second.runningCount(), 3);
+    CORRADE_COMPARE(c->steps, 1);
+}
+
+#ifdef MAGNUM_BUILD_MULTITHREADED
+void AnimableTest::threadPool() {
+    /* Large enough group to be stepped in parallel */
+    Object3D object;
+    AnimableGroup3D group;
+    std::vector<CountingAnimable*> animables;
+    for(std::size_t i = 0; i != 3000; ++i) {
+        animables.push_back(new CountingAnimable(object, &group, i % 5 ? 0.0f : 1.0f));
+        if(i % 3) animables.back()->setState(AnimationState::Running);
+    }
+
+    ThreadPool pool{4};
+    group.setThreadPool(&pool);
+    CORRADE_VERIFY(group.threadPool() == &pool);
+
+    group.step(1.0f, 0.5f);
+    group.step(1.5f, 0.5f);
+    CORRADE_COMPARE(group.runningCount(), 2000);
+    group.step(2.5f, 0.5f);
+    CORRADE_COMPARE(group.runningCount(), 1600);
+    for(std::size_t i = 0; i != animables.size(); ++i) {
+        const UnsignedInt expected = i % 3 ? (i % 5 ? 3 : 2) : 0;
+        CORRADE_COMPARE(animables[i]->steps, expected);
+    }
+
+    group.setThreadPool(nullptr);
+}
+#endif
+
 void AnimableTest::debug() {
     std::ostringstream o;
     Debug(&o) << AnimationState::Running;
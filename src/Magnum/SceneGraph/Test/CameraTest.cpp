@@ -25,11 +25,15 @@
 
 #include <Corrade/TestSuite/Tester.h>
 
-#include "Magnum/SceneGraph/Camera.hpp" /* only for aspectRatioFix(), so it doesn't have to be exported */
-#include "Magnum/SceneGraph/Camera.h"
-#include "Magnum/SceneGraph/Drawable.h"
+/* The .hpp files are for aspectRatioFix(), which isn't exported, and for the
+   Double instantiations */
+#include "Magnum/SceneGraph/AbstractFeature.hpp"
+#include "Magnum/SceneGraph/Camera.hpp"
+#include "Magnum/SceneGraph/Drawable.hpp"
+#include "Magnum/SceneGraph/FeatureGroup.hpp"
 #include "Magnum/SceneGraph/MatrixTransformation2D.h"
 #include "Magnum/SceneGraph/MatrixTransformation3D.h"
+#include "Magnum/SceneGraph/Object.hpp"
 #include "Magnum/SceneGraph/Scene.h"
 
 namespace Magnum { namespace SceneGraph { namespace Test {
@@ -46,10 +50,18 @@ struct CameraTest: TestSuite::Tester {
     void projectionSizePerspective();
     void projectionSizeViewport();
     void draw();
+    void drawFloatOutput();
+    void frustumPlanes();
+    void boundingVolume();
+    void drawCulled2D();
+    void drawCulled3D();
+    void radixSort();
+    void drawSorted();
 };
 
 typedef SceneGraph::Object<SceneGraph::MatrixTransformation2D> Object2D;
 typedef SceneGraph::Object<SceneGraph::MatrixTransformation3D> Object3D;
+typedef SceneGraph::Scene<SceneGraph::MatrixTransformation2D> Scene2D;
 typedef SceneGraph::Scene<SceneGraph::MatrixTransformation3D> Scene3D;
 
 CameraTest::CameraTest() {
@@ -61,7 +73,14 @@ CameraTest::CameraTest() {
               &CameraTest::projectionSizeOrthographic,
               &CameraTest::projectionSizePerspective,
               &CameraTest::projectionSizeViewport,
-              &CameraTest::draw});
+              &CameraTest::draw,
+              &CameraTest::drawFloatOutput,
+              &CameraTest::frustumPlanes,
+              &CameraTest::boundingVolume,
+              &CameraTest::drawCulled2D,
+              &CameraTest::drawCulled3D,
+              &CameraTest::radixSort,
+              &CameraTest::drawSorted});
 }
 
 void CameraTest::fixAspectRatio() {
@@ -210,6 +229,357 @@ void CameraTest::draw() {
     CORRADE_COMPARE(thirdTransformation, Matrix4());
 }
 
+void CameraTest::drawFloatOutput() {
+    typedef SceneGraph::Object<SceneGraph::BasicMatrixTransformation3D<Double>> Object3Dd;
+    typedef SceneGraph::Scene<SceneGraph::BasicMatrixTransformation3D<Double>> Scene3Dd;
+
+    class Drawable: public SceneGraph::BasicDrawable3D<Double> {
+        public:
+            Drawable(AbstractBasicObject3D<Double>& object, BasicDrawableGroup3D<Double>* group, Matrix4d& result, Matrix4& resultFloat): SceneGraph::BasicDrawable3D<Double>(object, group), result(result), resultFloat(resultFloat) {}
+
+        protected:
+            void draw(const Matrix4d& transformationMatrix, BasicCamera3D<Double>&) override {
+                result = transformationMatrix;
+            }
+
+            void drawFloat(const Matrix4& transformationMatrix, BasicCamera3D<Double>&) override {
+                resultFloat = transformationMatrix;
+            }
+
+        private:
+            Matrix4d& result;
+            Matrix4& resultFloat;
+    };
+
+    /* Doesn't override drawFloat(), gets a converted matrix in draw() */
+    class DoubleOnlyDrawable: public SceneGraph::BasicDrawable3D<Double> {
+        public:
+            DoubleOnlyDrawable(AbstractBasicObject3D<Double>& object, BasicDrawableGroup3D<Double>* group, Matrix4d& result): SceneGraph::BasicDrawable3D<Double>(object, group), result(result) {}
+
+        protected:
+            void draw(const Matrix4d& transformationMatrix, BasicCamera3D<Double>&) override {
+                result = transformationMatrix;
+            }
+
+        private:
+            Matrix4d& result;
+    };
+
+    BasicDrawableGroup3D<Double> group;
+    Scene3Dd scene;
+
+    /* Objects ten thousand kilometers away from the origin, where float
+       precision is about a meter */
+    Object3Dd first{&scene};
+    first.translate({1.0e7 + 0.125, 2.0e7, -1.0e7 + 0.25});
+    Matrix4d firstTransformation;
+    Matrix4 firstTransformationFloat;
+    new Drawable{first, &group, firstTransformation, firstTransformationFloat};
+
+    Object3Dd second{&scene};
+    second.scale(Vector3d{2.0})
+        .translate({1.0e7 - 0.375, 2.0e7 + 0.5, -1.0e7});
+    Matrix4d secondTransformation;
+    new DoubleOnlyDrawable{second, &group, secondTransformation};
+
+    Object3Dd cameraObject{&scene};
+    cameraObject.translate({1.0e7, 2.0e7, -1.0e7 + 2.0});
+    BasicCamera3D<Double> camera{cameraObject};
+    CORRADE_VERIFY(!camera.isFloatOutput());
+
+    /* Double output by default */
+    camera.draw(group);
+    CORRADE_COMPARE(firstTransformation, Matrix4d::translation({0.125, 0.0, -1.75}));
+    CORRADE_COMPARE(firstTransformationFloat, Matrix4{});
+    CORRADE_COMPARE(secondTransformation, Matrix4d::translation({-0.375, 0.5, -2.0})*Matrix4d::scaling(Vector3d{2.0}));
+
+    /* Float output, the relative transformation is computed in double
+       precision and only then converted */
+    firstTransformation = {};
+    secondTransformation = {};
+    camera.setFloatOutput(true)
+        .draw(group);
+    CORRADE_VERIFY(camera.isFloatOutput());
+    CORRADE_COMPARE(firstTransformation, Matrix4d{});
+    CORRADE_COMPARE(firstTransformationFloat, Matrix4::translation({0.125f, 0.0f, -1.75f}));
+    CORRADE_COMPARE(secondTransformation, Matrix4d::translation({-0.375, 0.5, -2.0})*Matrix4d::scaling(Vector3d{2.0}));
+
+    /* Sorted draw order goes through the same path */
+    firstTransformationFloat = {};
+    camera.setDrawOrder(DrawOrder::Sorted)
+        .draw(group);
+    CORRADE_COMPARE(firstTransformationFloat, Matrix4::translation({0.125f, 0.0f, -1.75f}));
+}
+
+void CameraTest::frustumPlanes() {
+    Math::Vector<4, Float> planes[6];
+    Implementation::frustumPlanes<3, Float>(Matrix4::orthographicProjection({4.0f, 2.0f}, 1.0f, 9.0f), planes);
+
+    /* Point in the middle is inside, distances to the planes are scaled by
+       the projection */
+    const Vector4 point{0.0f, 0.0f, -5.0f, 1.0f};
+    CORRADE_COMPARE(Math::dot(planes[0], point), 1.0f);
+    CORRADE_COMPARE(Math::dot(planes[1], point), 1.0f);
+    CORRADE_COMPARE(Math::dot(planes[2], point), 1.0f);
+    CORRADE_COMPARE(Math::dot(planes[3], point), 1.0f);
+    CORRADE_COMPARE(Math::dot(planes[4], point), 1.0f);
+    CORRADE_COMPARE(Math::dot(planes[5], point), 1.0f);
+
+    /* Points on the boundary */
+    CORRADE_COMPARE(Math::dot(planes[0], Vector4{-2.0f, 0.0f, -5.0f, 1.0f}), 0.0f);
+    CORRADE_COMPARE(Math::dot(planes[3], Vector4{0.0f, 1.0f, -5.0f, 1.0f}), 0.0f);
+    CORRADE_COMPARE(Math::dot(planes[4], Vector4{0.0f, 0.0f, -1.0f, 1.0f}), 0.0f);
+    CORRADE_COMPARE(Math::dot(planes[5], Vector4{0.0f, 0.0f, -9.0f, 1.0f}), 0.0f);
+}
+
+namespace {
+    class CountingDrawable2D: public SceneGraph::Drawable2D {
+        public:
+            CountingDrawable2D(AbstractObject2D& object, DrawableGroup2D* group, Int& drawn): SceneGraph::Drawable2D{object, group}, _drawn(drawn) {}
+
+        protected:
+            void draw(const Matrix3&, Camera2D&) override { ++_drawn; }
+
+        private:
+            Int& _drawn;
+    };
+
+    class CountingDrawable3D: public SceneGraph::Drawable3D {
+        public:
+            CountingDrawable3D(AbstractObject3D& object, DrawableGroup3D* group, Int& drawn): SceneGraph::Drawable3D{object, group}, _drawn(drawn) {}
+
+        protected:
+            void draw(const Matrix4&, Camera3D&) override { ++_drawn; }
+
+        private:
+            Int& _drawn;
+    };
+}
+
+void CameraTest::boundingVolume() {
+    Scene3D scene;
+    Object3D object{&scene};
+    Int drawn = 0;
+    CountingDrawable3D drawable{object, nullptr, drawn};
+    CORRADE_VERIFY(drawable.boundingVolume() == BoundingVolume::None);
+
+    drawable.setBoundingSphere({1.0f, 2.0f, 3.0f}, 0.5f);
+    CORRADE_VERIFY(drawable.boundingVolume() == BoundingVolume::Sphere);
+    CORRADE_COMPARE(drawable.boundingCenter(), (Vector3{1.0f, 2.0f, 3.0f}));
+    CORRADE_COMPARE(drawable.boundingRadius(), 0.5f);
+    CORRADE_COMPARE(drawable.boundingHalfSize(), Vector3{});
+
+    drawable.setBoundingBox({{-1.0f, 0.0f, 2.0f}, {3.0f, 1.0f, 4.0f}});
+    CORRADE_VERIFY(drawable.boundingVolume() == BoundingVolume::Box);
+    CORRADE_COMPARE(drawable.boundingCenter(), (Vector3{1.0f, 0.5f, 3.0f}));
+    CORRADE_COMPARE(drawable.boundingRadius(), 0.0f);
+    CORRADE_COMPARE(drawable.boundingHalfSize(), (Vector3{2.0f, 0.5f, 1.0f}));
+
+    drawable.resetBoundingVolume();
+    CORRADE_VERIFY(drawable.boundingVolume() == BoundingVolume::None);
+}
+
+void CameraTest::drawCulled2D() {
+    Scene2D scene;
+    DrawableGroup2D group;
+    Int drawn = 0;
+
+    /* Visible */
+    Object2D a{&scene};
+    a.translate({0.5f, 0.0f});
+    (new CountingDrawable2D{a, &group, drawn})->setBoundingSphere({}, 0.1f);
+
+    /* Outside, but the box reaches inside */
+    Object2D b{&scene};
+    b.translate({1.5f, 0.0f});
+    (new CountingDrawable2D{b, &group, drawn})->setBoundingBox({{-0.75f, -0.1f}, {0.0f, 0.1f}});
+
+    /* Outside */
+    Object2D c{&scene};
+    c.translate({0.0f, -2.0f});
+    (new CountingDrawable2D{c, &group, drawn})->setBoundingSphere({}, 0.5f);
+
+    Object2D cameraObject{&scene};
+    Camera2D camera{cameraObject};
+    camera.draw(group);
+
+    CORRADE_COMPARE(drawn, 2);
+    CORRADE_COMPARE(camera.visibleCount(), 2);
+    CORRADE_COMPARE(camera.culledCount(), 1);
+}
+
+void CameraTest::drawCulled3D() {
+    Scene3D scene;
+    DrawableGroup3D group;
+    Int drawn = 0;
+
+    /* Without bounding volume, always drawn */
+    Object3D unbounded{&scene};
+    unbounded.translate(Vector3::zAxis(100.0f));
+    new CountingDrawable3D{unbounded, &group, drawn};
+
+    /* In front of the camera */
+    Object3D front{&scene};
+    front.translate(Vector3::zAxis(-5.0f));
+    (new CountingDrawable3D{front, &group, drawn})->setBoundingSphere({}, 1.0f);
+
+    /* Behind the camera */
+    Object3D behind{&scene};
+    behind.translate(Vector3::zAxis(5.0f));
+    (new CountingDrawable3D{behind, &group, drawn})->setBoundingSphere({}, 1.0f);
+
+    /* Beyond far plane */
+    Object3D beyond{&scene};
+    beyond.translate(Vector3::zAxis(-200.0f));
+    (new CountingDrawable3D{beyond, &group, drawn})->setBoundingBox({Vector3{-1.0f}, Vector3{1.0f}});
+
+    /* Far to the left, but scaled so it reaches into the frustum */
+    Object3D scaled{&scene};
+    scaled.scale(Vector3{20.0f})
+        .translate({-20.0f, 0.0f, -10.0f});
+    (new CountingDrawable3D{scaled, &group, drawn})->setBoundingSphere({}, 1.0f);
+
+    /* Far to the left, with box offset back into the frustum */
+    Object3D offset{&scene};
+    offset.translate({-20.0f, 0.0f, -10.0f});
+    (new CountingDrawable3D{offset, &group, drawn})->setBoundingBox({{19.0f, -1.0f, -1.0f}, {21.0f, 1.0f, 1.0f}});
+
+    /* Rotated box near the left plane */
+    Object3D rotated{&scene};
+    rotated.rotateY(Deg(45.0f))
+        .translate({-11.0f, 0.0f, -10.0f});
+    (new CountingDrawable3D{rotated, &group, drawn})->setBoundingBox({Vector3{-1.5f}, Vector3{1.5f}});
+
+    /* Far to the right */
+    Object3D right{&scene};
+    right.translate({20.0f, 0.0f, -10.0f});
+    (new CountingDrawable3D{right, &group, drawn})->setBoundingBox({Vector3{-1.0f}, Vector3{1.0f}});
+
+    Object3D cameraObject{&scene};
+    Camera3D camera{cameraObject};
+    camera.setProjectionMatrix(Matrix4::perspectiveProjection(Deg(90.0f), 1.0f, 0.1f, 100.0f));
+    camera.draw(group);
+
+    CORRADE_COMPARE(drawn, 5);
+    CORRADE_COMPARE(camera.visibleCount(), 5);
+    CORRADE_COMPARE(camera.culledCount(), 3);
+
+    /* Turning the camera around shows the object behind, hides the others */
+    drawn = 0;
+    cameraObject.rotateY(Deg(180.0f));
+    camera.draw(group);
+
+    CORRADE_COMPARE(drawn, 2);
+    CORRADE_COMPARE(camera.visibleCount(), 2);
+    CORRADE_COMPARE(camera.culledCount(), 6);
+}
+
+void CameraTest::radixSort() {
+    std::vector<UnsignedLong> keys{
+        0x0001000000000000ull,
+        0x0000000000000003ull,
+        0x0001000000000000ull,
+        0xff00000000000001ull,
+        0x0000000000000003ull,
+        0x0000000000010000ull};
+    std::vector<UnsignedInt> values{0, 1, 2, 3, 4, 5};
+    std::vector<UnsignedLong> keyScratch;
+    std::vector<UnsignedInt> valueScratch;
+    Implementation::radixSort(keys, values, keyScratch, valueScratch);
+
+    /* The sort is stable */
+    CORRADE_COMPARE(keys, (std::vector<UnsignedLong>{
+        0x0000000000000003ull,
+        0x0000000000000003ull,
+        0x0000000000010000ull,
+        0x0001000000000000ull,
+        0x0001000000000000ull,
+        0xff00000000000001ull}));
+    CORRADE_COMPARE(values, (std::vector<UnsignedInt>{1, 4, 5, 0, 2, 3}));
+
+    /* Keys differing only in one byte need just one pass, the result ends up
+       in the scratch buffer and is swapped back */
+    keys = {0x300, 0x100, 0x200};
+    values = {0, 1, 2};
+    Implementation::radixSort(keys, values, keyScratch, valueScratch);
+    CORRADE_COMPARE(keys, (std::vector<UnsignedLong>{0x100, 0x200, 0x300}));
+    CORRADE_COMPARE(values, (std::vector<UnsignedInt>{1, 2, 0}));
+}
+
+void CameraTest::drawSorted() {
+    class Drawable: public SceneGraph::Drawable3D {
+        public:
+            Drawable(AbstractObject3D& object, DrawableGroup3D* group, std::vector<Int>& order, Int id): SceneGraph::Drawable3D(object, group), _order(order), _id{id} {}
+
+        protected:
+            void draw(const Matrix4&, Camera3D&) override {
+                _order.push_back(_id);
+            }
+
+        private:
+            std::vector<Int>& _order;
+            Int _id;
+    };
+
+    Scene3D scene;
+    DrawableGroup3D group;
+    std::vector<Int> order;
+
+    /* Shader 1 / material 0 at different depths, interleaved with shader 0 /
+       materials 0 and 1 */
+    Object3D a{&scene};
+    a.translate(Vector3::zAxis(-10.0f));
+    (new Drawable{a, &group, order, 0})->setSortKey(1, 0, 0);
+
+    Object3D b{&scene};
+    b.translate(Vector3::zAxis(-5.0f));
+    (new Drawable{b, &group, order, 1})->setSortKey(0, 1, 0);
+
+    Object3D c{&scene};
+    c.translate(Vector3::zAxis(-2.0f));
+    (new Drawable{c, &group, order, 2})->setSortKey(1, 0, 0);
+
+    Object3D d{&scene};
+    d.translate(Vector3::zAxis(-3.0f));
+    (new Drawable{d, &group, order, 3})->setSortKey(0, 0, 0);
+
+    Object3D e{&scene};
+    e.translate(Vector3::zAxis(-1.0f));
+    (new Drawable{e, &group, order, 4})->setSortKey(0, 1, 0);
+
+    /* Culled, doesn't take part in sorting */
+    Object3D f{&scene};
+    f.translate(Vector3::zAxis(10.0f));
+    Drawable* culled = new Drawable{f, &group, order, 5};
+    culled->setSortKey(1, 1, 1)
+        .setBoundingSphere({}, 1.0f);
+
+    Object3D cameraObject{&scene};
+    Camera3D camera{cameraObject};
+    camera.setProjectionMatrix(Matrix4::perspectiveProjection(Deg(90.0f), 1.0f, 0.1f, 100.0f));
+    CORRADE_VERIFY(camera.drawOrder() == DrawOrder::Insertion);
+
+    /* Insertion order by default */
+    camera.draw(group);
+    CORRADE_COMPARE(order, (std::vector<Int>{0, 1, 2, 3, 4}));
+    CORRADE_COMPARE(camera.shaderRebindsAvoided(), 0);
+    CORRADE_COMPARE(camera.textureRebindsAvoided(), 0);
+
+    /* Sorted by shader, material and then front to back */
+    order.clear();
+    camera.setDrawOrder(DrawOrder::Sorted)
+        .draw(group);
+    CORRADE_COMPARE(order, (std::vector<Int>{3, 4, 1, 2, 0}));
+    CORRADE_COMPARE(camera.visibleCount(), 5);
+    CORRADE_COMPARE(camera.culledCount(), 1);
+
+    /* Shader is bound four times in insertion order and twice sorted,
+       shader+material combination five times in insertion order and three
+       times sorted */
+    CORRADE_COMPARE(camera.shaderRebindsAvoided(), 2);
+    CORRADE_COMPARE(camera.textureRebindsAvoided(), 2);
+}
+
 }}}
 
 CORRADE_TEST_MAIN(Magnum::SceneGraph::Test::CameraTest)
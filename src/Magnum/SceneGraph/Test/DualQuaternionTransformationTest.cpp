@@ -79,6 +79,11 @@ void DualQuaternionTransformationTest::toMatrix() {
     DualQuaternion q = DualQuaternion::rotation(Deg(17.0f), Vector3::xAxis())*DualQuaternion::translation({1.0f, -0.3f, 2.3f});
     Matrix4 m = Matrix4::rotationX(Deg(17.0f))*Matrix4::translation({1.0f, -0.3f, 2.3f});
     CORRADE_COMPARE(Implementation::Transformation<DualQuaternionTransformation>::toMatrix(q), m);
+
+    /* Arbitrary axis, translation applied both before and after rotation */
+    DualQuaternion a = DualQuaternion::translation({-0.5f, 2.0f, 1.5f})*DualQuaternion::rotation(Deg(-74.0f), Vector3(1.0f, 2.0f, -2.0f).normalized())*DualQuaternion::translation({1.0f, -0.3f, 2.3f});
+    Matrix4 b = Matrix4::translation({-0.5f, 2.0f, 1.5f})*Matrix4::rotation(Deg(-74.0f), Vector3(1.0f, 2.0f, -2.0f).normalized())*Matrix4::translation({1.0f, -0.3f, 2.3f});
+    CORRADE_COMPARE(Implementation::Transformation<DualQuaternionTransformation>::toMatrix(a), b);
 }
 
 void DualQuaternionTransformationTest::compose() {
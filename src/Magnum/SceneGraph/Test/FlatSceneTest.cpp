@@ -0,0 +1,269 @@
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#include <sstream>
+#include <Corrade/TestSuite/Tester.h>
+
+#include "Magnum/SceneGraph/AbstractFeature.h"
+#include "Magnum/SceneGraph/Camera.h"
+#include "Magnum/SceneGraph/Drawable.h"
+#include "Magnum/SceneGraph/FlatScene.h"
+
+namespace Magnum { namespace SceneGraph { namespace Test {
+
+struct FlatSceneTest: TestSuite::Tester {
+    explicit FlatSceneTest();
+
+    void addObject();
+    void addObjectDifferentScene();
+    void absoluteTransformation();
+    void transformationMatrices();
+    void transformationMatricesDifferentScene();
+    void setClean();
+    void draw();
+};
+
+FlatSceneTest::FlatSceneTest() {
+    addTests({&FlatSceneTest::addObject,
+              &FlatSceneTest::addObjectDifferentScene,
+              &FlatSceneTest::absoluteTransformation,
+              &FlatSceneTest::transformationMatrices,
+              &FlatSceneTest::transformationMatricesDifferentScene,
+              &FlatSceneTest::setClean,
+              &FlatSceneTest::draw});
+}
+
+void FlatSceneTest::addObject() {
+    FlatScene3D scene;
+    FlatObject3D& a = scene.addObject();
+    FlatObject3D& b = scene.addObject(&a);
+    FlatObject3D& c = scene.addObject(&b);
+
+    CORRADE_COMPARE(scene.objectCount(), 3);
+    CORRADE_COMPARE(a.id(), 0);
+    CORRADE_COMPARE(b.id(), 1);
+    CORRADE_COMPARE(c.id(), 2);
+    CORRADE_COMPARE(&scene.object(2), &c);
+    CORRADE_VERIFY(a.parent() == nullptr);
+    CORRADE_VERIFY(b.parent() == &a);
+    CORRADE_VERIFY(c.parent() == &b);
+    CORRADE_VERIFY(c.scene() == &scene);
+    CORRADE_VERIFY(&c.flatScene() == &scene);
+    CORRADE_VERIFY(scene.scene() == &scene);
+
+    /* Everything is dirty by default */
+    CORRADE_VERIFY(!scene.isDirty());
+    CORRADE_VERIFY(a.isDirty());
+    CORRADE_VERIFY(c.isDirty());
+}
+
+void FlatSceneTest::addObjectDifferentScene() {
+    std::ostringstream out;
+    Error::setOutput(&out);
+
+    FlatScene3D scene;
+    FlatScene3D another;
+    FlatObject3D& a = another.addObject();
+    scene.addObject(&a);
+
+    CORRADE_COMPARE(scene.objectCount(), 0);
+    CORRADE_COMPARE(out.str(), "SceneGraph::FlatScene::addObject(): parent is not part of this scene\n");
+}
+
+void FlatSceneTest::absoluteTransformation() {
+    FlatScene3D scene;
+    FlatObject3D& a = scene.addObject();
+    FlatObject3D& b = scene.addObject(&a);
+    FlatObject3D& c = scene.addObject();
+    FlatObject3D& d = scene.addObject(&b);
+
+    a.setTransformation(Matrix4::scaling(Vector3(2.0f)));
+    b.setTransformation(Matrix4::translation(Vector3::xAxis(1.0f)));
+    c.setTransformation(Matrix4::rotationX(Deg(35.0f)));
+    d.setTransformation(Matrix4::translation(Vector3::yAxis(3.0f)))
+     .transform(Matrix4::rotationZ(Deg(90.0f)));
+
+    CORRADE_COMPARE(d.transformation(), Matrix4::rotationZ(Deg(90.0f))*Matrix4::translation(Vector3::yAxis(3.0f)));
+    CORRADE_COMPARE(b.absoluteTransformationMatrix(), Matrix4::scaling(Vector3(2.0f))*Matrix4::translation(Vector3::xAxis(1.0f)));
+    CORRADE_COMPARE(c.absoluteTransformationMatrix(), Matrix4::rotationX(Deg(35.0f)));
+    CORRADE_COMPARE(d.absoluteTransformationMatrix(), Matrix4::scaling(Vector3(2.0f))*Matrix4::translation(Vector3::xAxis(1.0f))*Matrix4::rotationZ(Deg(90.0f))*Matrix4::translation(Vector3::yAxis(3.0f)));
+
+    /* Change in parent is reflected in children */
+    a.resetTransformation();
+    CORRADE_COMPARE(scene.absoluteTransformationMatrices().size(), 4);
+    CORRADE_COMPARE(scene.absoluteTransformationMatrices()[1], Matrix4::translation(Vector3::xAxis(1.0f)));
+    CORRADE_COMPARE(d.absoluteTransformationMatrix(), Matrix4::translation(Vector3::xAxis(1.0f))*Matrix4::rotationZ(Deg(90.0f))*Matrix4::translation(Vector3::yAxis(3.0f)));
+
+    /* Only objects from the first changed one are recomputed, which includes
+       children of earlier objects as well as newly added objects */
+    c.setTransformation(Matrix4::rotationY(Deg(15.0f)));
+    FlatObject3D& e = scene.addObject(&a);
+    e.setTransformation(Matrix4::translation(Vector3::zAxis(2.0f)));
+    CORRADE_COMPARE(c.absoluteTransformationMatrix(), Matrix4::rotationY(Deg(15.0f)));
+    CORRADE_COMPARE(d.absoluteTransformationMatrix(), Matrix4::translation(Vector3::xAxis(1.0f))*Matrix4::rotationZ(Deg(90.0f))*Matrix4::translation(Vector3::yAxis(3.0f)));
+    CORRADE_COMPARE(e.absoluteTransformationMatrix(), Matrix4::translation(Vector3::zAxis(2.0f)));
+
+    d.setTransformation({});
+    CORRADE_COMPARE(d.absoluteTransformationMatrix(), Matrix4::translation(Vector3::xAxis(1.0f)));
+}
+
+void FlatSceneTest::transformationMatrices() {
+    FlatScene3D scene;
+    FlatObject3D& a = scene.addObject();
+    FlatObject3D& b = scene.addObject(&a);
+    a.setTransformation(Matrix4::scaling(Vector3(2.0f)));
+    b.setTransformation(Matrix4::translation(Vector3::xAxis(1.0f)));
+
+    const Matrix4 initial = Matrix4::translation(Vector3::zAxis(-1.0f));
+    CORRADE_COMPARE(scene.transformationMatrices({b, scene, a}, initial), (std::vector<Matrix4>{
+        initial*Matrix4::scaling(Vector3(2.0f))*Matrix4::translation(Vector3::xAxis(1.0f)),
+        initial,
+        initial*Matrix4::scaling(Vector3(2.0f))
+    }));
+}
+
+void FlatSceneTest::transformationMatricesDifferentScene() {
+    std::ostringstream out;
+    Error::setOutput(&out);
+
+    FlatScene3D scene;
+    FlatScene3D another;
+    FlatObject3D& a = scene.addObject();
+    FlatObject3D& b = another.addObject();
+
+    CORRADE_COMPARE(b.transformationMatrices({a}), std::vector<Matrix4>{});
+    CORRADE_COMPARE(scene.transformationMatrices({a, b}), std::vector<Matrix4>{});
+    CORRADE_COMPARE(out.str(),
+        "SceneGraph::FlatObject::transformationMatrices(): currently implemented only for FlatScene\n"
+        "SceneGraph::FlatScene::transformationMatrices(): the objects are not part of the same scene\n");
+}
+
+void FlatSceneTest::setClean() {
+    class CachingFeature: public AbstractFeature3D {
+        public:
+            explicit CachingFeature(AbstractObject3D& object): AbstractFeature3D{object}, dirtyCount{}, cleanCount{} {
+                setCachedTransformations(CachedTransformation::Absolute|CachedTransformation::InvertedAbsolute);
+            }
+
+            Int dirtyCount, cleanCount;
+            Matrix4 cleanedAbsoluteTransformation,
+                cleanedInvertedAbsoluteTransformation;
+
+        private:
+            void markDirty() override { ++dirtyCount; }
+
+            void clean(const Matrix4& absoluteTransformation) override {
+                ++cleanCount;
+                cleanedAbsoluteTransformation = absoluteTransformation;
+            }
+
+            void cleanInverted(const Matrix4& invertedAbsoluteTransformation) override {
+                cleanedInvertedAbsoluteTransformation = invertedAbsoluteTransformation;
+            }
+    };
+
+    FlatScene3D scene;
+    FlatObject3D& a = scene.addObject();
+    FlatObject3D& b = scene.addObject(&a);
+    FlatObject3D& c = scene.addObject();
+    a.setTransformation(Matrix4::scaling(Vector3(2.0f)));
+    b.setTransformation(Matrix4::translation(Vector3::xAxis(1.0f)));
+    CachingFeature& aFeature = a.addFeature<CachingFeature>();
+    CachingFeature& bFeature = b.addFeature<CachingFeature>();
+    CachingFeature& cFeature = c.addFeature<CachingFeature>();
+
+    /* Cleaning any object cleans the whole scene */
+    b.setClean();
+    CORRADE_VERIFY(!a.isDirty());
+    CORRADE_VERIFY(!b.isDirty());
+    CORRADE_VERIFY(!c.isDirty());
+    CORRADE_COMPARE(aFeature.cleanCount, 1);
+    CORRADE_COMPARE(bFeature.cleanCount, 1);
+    CORRADE_COMPARE(cFeature.cleanCount, 1);
+    CORRADE_COMPARE(bFeature.cleanedAbsoluteTransformation, Matrix4::scaling(Vector3(2.0f))*Matrix4::translation(Vector3::xAxis(1.0f)));
+    CORRADE_COMPARE(bFeature.cleanedInvertedAbsoluteTransformation, Matrix4::translation(Vector3::xAxis(-1.0f))*Matrix4::scaling(Vector3(0.5f)));
+
+    /* Changing the parent makes the children dirty, but features are notified
+       only when cleaning */
+    a.setTransformation(Matrix4::scaling(Vector3(3.0f)));
+    CORRADE_VERIFY(a.isDirty());
+    CORRADE_VERIFY(b.isDirty());
+    CORRADE_VERIFY(!c.isDirty());
+    CORRADE_COMPARE(bFeature.dirtyCount, 1);
+
+    scene.setClean();
+    CORRADE_VERIFY(!b.isDirty());
+    CORRADE_COMPARE(aFeature.dirtyCount, 2);
+    CORRADE_COMPARE(bFeature.dirtyCount, 2);
+    CORRADE_COMPARE(cFeature.dirtyCount, 1);
+    CORRADE_COMPARE(aFeature.cleanCount, 2);
+    CORRADE_COMPARE(bFeature.cleanCount, 2);
+    CORRADE_COMPARE(cFeature.cleanCount, 1);
+    CORRADE_COMPARE(bFeature.cleanedAbsoluteTransformation, Matrix4::scaling(Vector3(3.0f))*Matrix4::translation(Vector3::xAxis(1.0f)));
+}
+
+void FlatSceneTest::draw() {
+    class Drawable: public SceneGraph::Drawable3D {
+        public:
+            Drawable(AbstractObject3D& object, DrawableGroup3D* group, Matrix4& result): SceneGraph::Drawable3D(object, group), result(result) {}
+
+        protected:
+            void draw(const Matrix4& transformationMatrix, Camera3D&) override {
+                result = transformationMatrix;
+            }
+
+        private:
+            Matrix4& result;
+    };
+
+    DrawableGroup3D group;
+    FlatScene3D scene;
+
+    FlatObject3D& first = scene.addObject();
+    Matrix4 firstTransformation;
+    first.setTransformation(Matrix4::scaling(Vector3(5.0f)));
+    new Drawable(first, &group, firstTransformation);
+
+    FlatObject3D& second = scene.addObject();
+    Matrix4 secondTransformation;
+    second.setTransformation(Matrix4::translation(Vector3::yAxis(3.0f)));
+    new Drawable(second, &group, secondTransformation);
+
+    FlatObject3D& third = scene.addObject(&second);
+    Matrix4 thirdTransformation;
+    third.setTransformation(Matrix4::translation(Vector3::zAxis(-1.5f)));
+    new Drawable(third, &group, thirdTransformation);
+
+    Camera3D camera(third);
+    camera.draw(group);
+
+    CORRADE_COMPARE(firstTransformation, Matrix4::translation({0.0f, -3.0f, 1.5f})*Matrix4::scaling(Vector3(5.0f)));
+    CORRADE_COMPARE(secondTransformation, Matrix4::translation(Vector3::zAxis(1.5f)));
+    CORRADE_COMPARE(thirdTransformation, Matrix4());
+}
+
+}}}
+
+CORRADE_TEST_MAIN(Magnum::SceneGraph::Test::FlatSceneTest)
@@ -0,0 +1,222 @@
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#include <sstream>
+#include <Corrade/TestSuite/Tester.h>
+
+#include "Magnum/SceneGraph/Camera.h"
+#include "Magnum/SceneGraph/InstancedDrawable.h"
+#include "Magnum/SceneGraph/MatrixTransformation2D.h"
+#include "Magnum/SceneGraph/MatrixTransformation3D.h"
+#include "Magnum/SceneGraph/Scene.h"
+
+namespace Magnum { namespace SceneGraph { namespace Test {
+
+/* The tests don't have GL context, so only the parts not touching the
+   instance buffer are tested */
+struct InstancedDrawableTest: TestSuite::Tester {
+    explicit InstancedDrawableTest();
+
+    void construct();
+    void instances();
+    void collect2D();
+    void collect3D();
+    void collectCulled();
+    void collectNoScene();
+    void instanceRadiusInvalid();
+};
+
+typedef Object<MatrixTransformation2D> Object2D;
+typedef Object<MatrixTransformation3D> Object3D;
+typedef Scene<MatrixTransformation2D> Scene2D;
+typedef Scene<MatrixTransformation3D> Scene3D;
+
+InstancedDrawableTest::InstancedDrawableTest() {
+    addTests({&InstancedDrawableTest::construct,
+              &InstancedDrawableTest::instances,
+              &InstancedDrawableTest::collect2D,
+              &InstancedDrawableTest::collect3D,
+              &InstancedDrawableTest::collectCulled,
+              &InstancedDrawableTest::collectNoScene,
+              &InstancedDrawableTest::instanceRadiusInvalid});
+}
+
+namespace {
+
+template<UnsignedInt dimensions> class Crowd: public InstancedDrawable<dimensions, Float> {
+    public:
+        explicit Crowd(AbstractObject<dimensions, Float>& object, DrawableGroup<dimensions, Float>* drawables = nullptr): InstancedDrawable<dimensions, Float>{object, drawables} {}
+
+    private:
+        void drawInstances(Int, UnsignedInt, Camera<dimensions, Float>&) override {}
+};
+
+}
+
+void InstancedDrawableTest::construct() {
+    Scene3D scene;
+    DrawableGroup3D drawables;
+    Crowd<3> crowd{scene, &drawables};
+    CORRADE_VERIFY(crowd.drawables() == &drawables);
+    CORRADE_VERIFY(crowd.instances().isEmpty());
+    CORRADE_COMPARE(crowd.instanceRadius(), 0.0f);
+    CORRADE_COMPARE(crowd.instanceCount(), 0);
+
+    crowd.setInstanceRadius(2.5f);
+    CORRADE_COMPARE(crowd.instanceRadius(), 2.5f);
+}
+
+void InstancedDrawableTest::instances() {
+    Scene3D scene;
+    Object3D a{&scene};
+    Object3D b{&scene};
+
+    auto crowd = new Crowd<3>{scene};
+    auto instanceA = new Instance3D{a, &crowd->instances()};
+    auto instanceB = new Instance3D{b};
+    CORRADE_COMPARE(crowd->instances().size(), 1);
+    CORRADE_VERIFY(instanceA->instances() == &crowd->instances());
+    CORRADE_VERIFY(!instanceB->instances());
+
+    crowd->instances().add(*instanceB);
+    CORRADE_COMPARE(crowd->instances().size(), 2);
+
+    /* Deleting the drawable removes the instances from the group */
+    delete crowd;
+    CORRADE_VERIFY(!instanceA->instances());
+    CORRADE_VERIFY(!instanceB->instances());
+}
+
+void InstancedDrawableTest::collect2D() {
+    Scene2D scene;
+    Object2D cameraObject{&scene};
+    cameraObject.translate({1.0f, 0.0f});
+    Camera2D camera{cameraObject};
+
+    Object2D parent{&scene};
+    parent.translate({0.0f, 2.0f});
+    Object2D a{&parent};
+    a.rotate(Deg(30.0f));
+    Object2D b{&scene};
+    b.scale({2.0f, 1.0f});
+
+    Crowd<2> crowd{scene};
+    new Instance2D{a, &crowd.instances()};
+    new Instance2D{b, &crowd.instances()};
+
+    std::vector<Matrix3> transformations;
+    crowd.collectInstances(camera, transformations);
+    CORRADE_COMPARE(transformations, (std::vector<Matrix3>{
+        Matrix3::translation({-1.0f, 2.0f})*Matrix3::rotation(Deg(30.0f)),
+        Matrix3::translation({-1.0f, 0.0f})*Matrix3::scaling({2.0f, 1.0f})}));
+}
+
+void InstancedDrawableTest::collect3D() {
+    Scene3D scene;
+    Object3D cameraObject{&scene};
+    cameraObject.rotateY(Deg(90.0f));
+    Camera3D camera{cameraObject};
+
+    Crowd<3> crowd{scene};
+    std::vector<Object3D*> objects;
+    for(Int i = 0; i != 5; ++i) {
+        Object3D* o = new Object3D{&scene};
+        o->translate({Float(i), 0.0f, 1.0f});
+        new Instance3D{*o, &crowd.instances()};
+        objects.push_back(o);
+    }
+
+    /* Memory is reused, previous contents discarded */
+    std::vector<Matrix4> transformations{Matrix4{}};
+    crowd.collectInstances(camera, transformations);
+    CORRADE_COMPARE(transformations.size(), 5);
+    for(std::size_t i = 0; i != objects.size(); ++i)
+        CORRADE_COMPARE(transformations[i], camera.cameraMatrix()*objects[i]->absoluteTransformationMatrix());
+}
+
+void InstancedDrawableTest::collectCulled() {
+    Scene3D scene;
+    Object3D cameraObject{&scene};
+    Camera3D camera{cameraObject};
+    camera.setProjectionMatrix(Matrix4::perspectiveProjection(Deg(90.0f), 1.0f, 0.1f, 100.0f));
+
+    Crowd<3> crowd{scene};
+    const Vector3 positions[]{
+        {0.0f, 0.0f, -5.0f},        /* in front */
+        {0.0f, 0.0f, 5.0f},         /* behind */
+        {0.0f, 0.0f, -200.0f},      /* beyond far plane */
+        {-10.5f, 0.0f, -10.0f},     /* just outside left, radius reaches in */
+        {20.0f, 0.0f, -10.0f}       /* far right */
+    };
+    for(const Vector3& position: positions) {
+        Object3D* o = new Object3D{&scene};
+        o->translate(position);
+        new Instance3D{*o, &crowd.instances()};
+    }
+
+    /* Scaled so the radius reaches into the frustum */
+    Object3D scaled{&scene};
+    scaled.scale(Vector3{20.0f})
+        .translate({-20.0f, 0.0f, -10.0f});
+    new Instance3D{scaled, &crowd.instances()};
+
+    /* Without radius everything is collected */
+    std::vector<Matrix4> transformations;
+    crowd.collectInstances(camera, transformations);
+    CORRADE_COMPARE(transformations.size(), 6);
+
+    crowd.setInstanceRadius(1.0f);
+    crowd.collectInstances(camera, transformations);
+    CORRADE_COMPARE(transformations.size(), 3);
+    CORRADE_COMPARE(transformations[0].translation(), (Vector3{0.0f, 0.0f, -5.0f}));
+    CORRADE_COMPARE(transformations[1].translation(), (Vector3{-10.5f, 0.0f, -10.0f}));
+    CORRADE_COMPARE(transformations[2].translation(), (Vector3{-20.0f, 0.0f, -10.0f}));
+}
+
+void InstancedDrawableTest::collectNoScene() {
+    std::ostringstream out;
+    Error::setOutput(&out);
+
+    Object3D cameraObject;
+    Camera3D camera{cameraObject};
+    Crowd<3> crowd{cameraObject};
+    std::vector<Matrix4> transformations;
+    crowd.collectInstances(camera, transformations);
+    CORRADE_COMPARE(out.str(), "SceneGraph::InstancedDrawable::collectInstances(): camera is not part of any scene\n");
+}
+
+void InstancedDrawableTest::instanceRadiusInvalid() {
+    std::ostringstream out;
+    Error::setOutput(&out);
+
+    Scene3D scene;
+    Crowd<3> crowd{scene};
+    crowd.setInstanceRadius(-1.0f);
+    CORRADE_COMPARE(out.str(), "SceneGraph::InstancedDrawable::setInstanceRadius(): negative radius\n");
+}
+
+}}}
+
+CORRADE_TEST_MAIN(Magnum::SceneGraph::Test::InstancedDrawableTest)
@@ -0,0 +1,206 @@
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+#include <Corrade/TestSuite/Tester.h>
+
+#include "Magnum/SceneGraph/MemoryPool.h"
+
+namespace Magnum { namespace SceneGraph { namespace Test {
+
+struct MemoryPoolTest: TestSuite::Tester {
+    explicit MemoryPoolTest();
+
+    void allocate();
+    void recycle();
+    void sizeClasses();
+    void large();
+    void newBlock();
+    void adjacent();
+    void poolAllocated();
+    void poolAllocatedGlobal();
+};
+
+MemoryPoolTest::MemoryPoolTest() {
+    addTests({&MemoryPoolTest::allocate,
+              &MemoryPoolTest::recycle,
+              &MemoryPoolTest::sizeClasses,
+              &MemoryPoolTest::large,
+              &MemoryPoolTest::newBlock,
+              &MemoryPoolTest::adjacent,
+              &MemoryPoolTest::poolAllocated,
+              &MemoryPoolTest::poolAllocatedGlobal});
+}
+
+void MemoryPoolTest::allocate() {
+    MemoryPool pool;
+    CORRADE_COMPARE(pool.blockSize(), 65536);
+    CORRADE_COMPARE(pool.blockCount(), 0);
+    CORRADE_COMPARE(pool.allocationCount(), 0);
+
+    /* Allocations are aligned and next to each other */
+    char* a = static_cast<char*>(pool.allocate(24));
+    char* b = static_cast<char*>(pool.allocate(20));
+    CORRADE_COMPARE(reinterpret_cast<std::size_t>(a) % MemoryPool::Granularity, 0);
+    CORRADE_COMPARE(b - a, 32);
+    CORRADE_COMPARE(pool.blockCount(), 1);
+    CORRADE_COMPARE(pool.allocationCount(), 2);
+
+    pool.deallocate(a, 24);
+    pool.deallocate(b, 20);
+    CORRADE_COMPARE(pool.allocationCount(), 0);
+}
+
+void MemoryPoolTest::recycle() {
+    MemoryPool pool;
+    void* a = pool.allocate(100);
+    void* b = pool.allocate(100);
+    pool.deallocate(a, 100);
+    pool.deallocate(b, 100);
+
+    /* Freed slots are reused in LIFO order */
+    CORRADE_COMPARE(pool.allocate(100), b);
+    CORRADE_COMPARE(pool.allocate(100), a);
+    CORRADE_COMPARE(pool.blockCount(), 1);
+
+    pool.deallocate(a, 100);
+    pool.deallocate(b, 100);
+}
+
+void MemoryPoolTest::sizeClasses() {
+    MemoryPool pool;
+    void* a = pool.allocate(32);
+    pool.deallocate(a, 32);
+
+    /* Different size class doesn't reuse the slot */
+    void* b = pool.allocate(48);
+    CORRADE_VERIFY(b != a);
+
+    /* Same size class does */
+    void* c = pool.allocate(17);
+    CORRADE_COMPARE(c, a);
+
+    pool.deallocate(b, 48);
+    pool.deallocate(c, 17);
+}
+
+void MemoryPoolTest::large() {
+    MemoryPool pool;
+    void* a = pool.allocate(MemoryPool::MaxSize + 1);
+    CORRADE_COMPARE(pool.blockCount(), 0);
+    CORRADE_COMPARE(pool.allocationCount(), 0);
+    pool.deallocate(a, MemoryPool::MaxSize + 1);
+}
+
+void MemoryPoolTest::newBlock() {
+    MemoryPool pool{2048};
+    std::vector<void*> allocations;
+    for(std::size_t i = 0; i != 5; ++i)
+        allocations.push_back(pool.allocate(1000));
+
+    /* Two 1008-byte slots fit into one block */
+    CORRADE_COMPARE(pool.blockCount(), 3);
+    CORRADE_COMPARE(pool.allocationCount(), 5);
+
+    for(void* a: allocations) pool.deallocate(a, 1000);
+    CORRADE_COMPARE(pool.allocationCount(), 0);
+
+    /* No new blocks are needed after everything is freed */
+    for(void*& a: allocations) a = pool.allocate(1000);
+    CORRADE_COMPARE(pool.blockCount(), 3);
+    for(void* a: allocations) pool.deallocate(a, 1000);
+}
+
+void MemoryPoolTest::adjacent() {
+    MemoryPool pool;
+
+    /* Allocations of different size classes are carved one after another */
+    char* a = static_cast<char*>(pool.allocate(64));
+    char* b = static_cast<char*>(pool.allocate(32));
+    CORRADE_COMPARE(b, a + 64);
+
+    /* The 64-byte slot is recycled, but there's no free 16-byte slot, so
+       that one is carved from the block and the two are no longer adjacent */
+    pool.deallocate(a, 64);
+    pool.deallocate(b, 32);
+    char* c = static_cast<char*>(pool.allocate(64));
+    char* d = static_cast<char*>(pool.allocate(16));
+    CORRADE_COMPARE(c, a);
+    CORRADE_COMPARE(d, b + 32);
+
+    pool.deallocate(c, 64);
+    pool.deallocate(d, 16);
+}
+
+namespace {
+    struct Base {
+        virtual ~Base() = default;
+    };
+
+    struct Pooled: Base, PoolAllocated {
+        explicit Pooled(Int& destructed): destructed(destructed) {}
+        ~Pooled() { ++destructed; }
+
+        Int& destructed;
+        char data[50];
+    };
+}
+
+void MemoryPoolTest::poolAllocated() {
+    MemoryPool pool;
+    Int destructed = 0;
+
+    Base* a = new(pool) Pooled{destructed};
+    Base* b = new(pool) Pooled{destructed};
+    CORRADE_COMPARE(pool.allocationCount(), 2);
+    CORRADE_COMPARE(reinterpret_cast<std::size_t>(a) % MemoryPool::Granularity, 0);
+
+    /* Deleting through base pointer returns the memory to the pool */
+    delete a;
+    CORRADE_COMPARE(destructed, 1);
+    CORRADE_COMPARE(pool.allocationCount(), 1);
+
+    /* ... and the slot is reused */
+    Base* c = new(pool) Pooled{destructed};
+    CORRADE_COMPARE(c, a);
+
+    delete b;
+    delete c;
+    CORRADE_COMPARE(destructed, 3);
+    CORRADE_COMPARE(pool.allocationCount(), 0);
+}
+
+void MemoryPoolTest::poolAllocatedGlobal() {
+    MemoryPool pool;
+    Int destructed = 0;
+
+    /* Without the pool the global allocator is used */
+    Base* a = new Pooled{destructed};
+    CORRADE_COMPARE(pool.allocationCount(), 0);
+    delete a;
+    CORRADE_COMPARE(destructed, 1);
+}
+
+}}}
+
+CORRADE_TEST_MAIN(Magnum::SceneGraph::Test::MemoryPoolTest)
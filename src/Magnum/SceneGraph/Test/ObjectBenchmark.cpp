@@ -0,0 +1,155 @@
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#include <Corrade/TestSuite/Tester.h>
+
+#include "Magnum/SceneGraph/AbstractFeature.h"
+#include "Magnum/SceneGraph/MatrixTransformation3D.h"
+#include "Magnum/SceneGraph/Scene.h"
+#include "Magnum/Test/Benchmark.h"
+
+namespace Magnum { namespace SceneGraph { namespace Test {
+
+typedef SceneGraph::Object<SceneGraph::MatrixTransformation3D> Object3D;
+typedef SceneGraph::Scene<SceneGraph::MatrixTransformation3D> Scene3D;
+
+struct ObjectBenchmark: TestSuite::Tester {
+    explicit ObjectBenchmark();
+
+    void transformationMatrices100k();
+    void transformationMatrices1M();
+    void spawnDespawnGlobal();
+    void spawnDespawnPool();
+
+    private:
+        void transformationMatrices(std::size_t count);
+        template<class Spawn> void spawnDespawn(Scene3D& scene, const char* name, Spawn spawn);
+};
+
+ObjectBenchmark::ObjectBenchmark() {
+    addTests({&ObjectBenchmark::transformationMatrices100k,
+              &ObjectBenchmark::transformationMatrices1M,
+              &ObjectBenchmark::spawnDespawnGlobal,
+              &ObjectBenchmark::spawnDespawnPool});
+}
+
+void ObjectBenchmark::transformationMatrices100k() {
+    transformationMatrices(100000);
+}
+
+void ObjectBenchmark::transformationMatrices1M() {
+    transformationMatrices(1000000);
+}
+
+void ObjectBenchmark::transformationMatrices(const std::size_t count) {
+    /* Shallow and wide hierarchy, similar to what a vegetation scene would
+       have. Every object is requested, as if it had a drawable attached. */
+    Scene3D scene;
+    std::vector<Object3D*> all;
+    all.reserve(count);
+    std::vector<std::reference_wrapper<Object3D>> objects;
+    objects.reserve(count);
+    UnsignedInt seed = 1;
+    for(std::size_t i = 0; i != count; ++i) {
+        seed = seed*1103515245u + 12345u;
+        Object3D* parent = i < 1000 ? &scene : all[(seed >> 8) % all.size()];
+        Object3D* o = new Object3D{parent};
+        o->translate({Float(i % 17), Float(i % 5), Float(i % 11)})
+          .rotateY(Deg(Float(i % 360)));
+        all.push_back(o);
+        objects.push_back(*o);
+    }
+
+    std::vector<Matrix4> transformations;
+    const std::int64_t time = Magnum::Test::measure([&]() {
+        scene.transformationMatrices(objects, transformations);
+    });
+
+    CORRADE_COMPARE(transformations.size(), count);
+    for(std::size_t i = 0; i < count; i += count/10)
+        CORRADE_COMPARE(transformations[i], objects[i].get().absoluteTransformationMatrix());
+
+    Debug() << "Object::transformationMatrices() on" << count << "objects:" << time << "us";
+}
+
+namespace {
+    struct Feature: AbstractFeature3D {
+        explicit Feature(AbstractObject3D& object): AbstractFeature3D{object} {}
+    };
+
+    struct PooledObject: Object3D, PoolAllocated {
+        explicit PooledObject(Object3D* parent): Object3D{parent} {}
+    };
+
+    struct PooledFeature: Feature, PoolAllocated {
+        explicit PooledFeature(AbstractObject3D& object): Feature{object} {}
+    };
+}
+
+void ObjectBenchmark::spawnDespawnGlobal() {
+    Scene3D scene;
+    spawnDespawn(scene, "Global", [&scene]() -> Object3D* {
+        Object3D* o = new Object3D{&scene};
+        new Feature{*o};
+        new Feature{*o};
+        return o;
+    });
+}
+
+void ObjectBenchmark::spawnDespawnPool() {
+    Scene3D scene;
+    spawnDespawn(scene, "Pooled", [&scene]() -> Object3D* {
+        Object3D* o = new(scene.pool()) PooledObject{&scene};
+        new(scene.pool()) PooledFeature{*o};
+        new(scene.pool()) PooledFeature{*o};
+        return o;
+    });
+
+    CORRADE_COMPARE(scene.pool().allocationCount(), 30000);
+}
+
+template<class Spawn> void ObjectBenchmark::spawnDespawn(Scene3D& scene, const char* name, Spawn spawn) {
+    /* Keep 10k entities alive, each with two features, and replace a
+       thousand of them in every frame */
+    std::vector<Object3D*> objects(10000);
+    for(Object3D*& o: objects) o = spawn();
+
+    const std::int64_t time = Magnum::Test::measure([&]() {
+        for(std::size_t frame = 0; frame != 100; ++frame) {
+            for(std::size_t j = frame % 10; j < objects.size(); j += 10) {
+                delete objects[j];
+                objects[j] = spawn();
+            }
+        }
+    });
+
+    CORRADE_COMPARE(scene.children().last(), objects.back());
+
+    Debug() << name << "spawn and despawn of 100k entities:" << time << "us";
+}
+
+}}}
+
+CORRADE_TEST_MAIN(Magnum::SceneGraph::Test::ObjectBenchmark)
@@ -26,6 +26,8 @@
 #include <sstream>
 #include <Corrade/TestSuite/Tester.h>
 
+#include "Magnum/SceneGraph/AbstractGroupedFeature.h"
+#include "Magnum/SceneGraph/FeatureGroup.h"
 #include "Magnum/SceneGraph/MatrixTransformation3D.h"
 #include "Magnum/SceneGraph/Scene.h"
 
@@ -45,9 +47,18 @@ struct ObjectTest: TestSuite::Tester {
     void transformationsRelative();
     void transformationsOrphan();
     void transformationsDuplicate();
+    void transformationsDeep();
+    void transformationsLarge();
+    void transformationsOutput();
+    #ifdef MAGNUM_BUILD_MULTITHREADED
+    void transformationsThreadPool();
+    #endif
     void setClean();
     void setCleanListHierarchy();
     void setCleanListBulk();
+    void setCleanFeatureGroup();
+    void setCleanLazy();
+    void dirtyPropagation();
 
     void rangeBasedForChildren();
     void rangeBasedForFeatures();
@@ -82,9 +93,18 @@ ObjectTest::ObjectTest() {
               &ObjectTest::transformationsRelative,
               &ObjectTest::transformationsOrphan,
               &ObjectTest::transformationsDuplicate,
+              &ObjectTest::transformationsDeep,
+              &ObjectTest::transformationsLarge,
+              &ObjectTest::transformationsOutput,
+              #ifdef MAGNUM_BUILD_MULTITHREADED
+              &ObjectTest::transformationsThreadPool,
+              #endif
               &ObjectTest::setClean,
               &ObjectTest::setCleanListHierarchy,
               &ObjectTest::setCleanListBulk,
+              &ObjectTest::setCleanFeatureGroup,
+              &ObjectTest::setCleanLazy,
+              &ObjectTest::dirtyPropagation,
 
               &ObjectTest::rangeBasedForChildren,
               &ObjectTest::rangeBasedForFeatures});
@@ -285,6 +305,13 @@ void ObjectTest::transformationsOrphan() {
     Object3D orphan;
     CORRADE_COMPARE(s.transformations({orphan}), std::vector<Matrix4>());
     CORRADE_COMPARE(o.str(), "SceneGraph::Object::transformations(): the objects are not part of the same tree\n");
+
+    /* The concurrent use guard is released after the failure */
+    o.str({});
+    Object3D child{&s};
+    child.translate(Vector3::yAxis(2.0f));
+    CORRADE_COMPARE(s.transformations({child}), std::vector<Matrix4>{Matrix4::translation(Vector3::yAxis(2.0f))});
+    CORRADE_COMPARE(o.str(), "");
 }
 
 void ObjectTest::transformationsDuplicate() {
@@ -304,6 +331,121 @@ void ObjectTest::transformationsDuplicate() {
     }));
 }
 
+void ObjectTest::transformationsDeep() {
+    /* Long chain of objects, each of them being a joint. Requested in reverse
+       order so the parent joints are always resolved after the children. */
+    Scene3D s;
+    std::vector<std::reference_wrapper<Object3D>> objects;
+    Object3D* parent = &s;
+    for(std::size_t i = 0; i != 10000; ++i) {
+        parent = new Object3D{parent};
+        parent->translate(Vector3::xAxis(1.0f));
+        objects.insert(objects.begin(), *parent);
+    }
+
+    /* Every 100th object has a second child, which is not requested */
+    for(std::size_t i = 0; i != objects.size(); i += 100)
+        (new Object3D{&objects[i].get()})->translate(Vector3::yAxis(1.0f));
+
+    std::vector<Matrix4> transformations = s.transformations(objects);
+    CORRADE_COMPARE(transformations.size(), 10000);
+    CORRADE_COMPARE(transformations.front(), Matrix4::translation(Vector3::xAxis(10000.0f)));
+    CORRADE_COMPARE(transformations[5000], Matrix4::translation(Vector3::xAxis(5000.0f)));
+    CORRADE_COMPARE(transformations.back(), Matrix4::translation(Vector3::xAxis(1.0f)));
+
+    /* Only every 1000th object requested, the rest are non-joint paths */
+    std::vector<std::reference_wrapper<Object3D>> sparse;
+    for(std::size_t i = 0; i < objects.size(); i += 1000) sparse.push_back(objects[i]);
+    transformations = s.transformations(sparse);
+    CORRADE_COMPARE(transformations.size(), 10);
+    CORRADE_COMPARE(transformations[0], Matrix4::translation(Vector3::xAxis(10000.0f)));
+    CORRADE_COMPARE(transformations[9], Matrix4::translation(Vector3::xAxis(1000.0f)));
+}
+
+void ObjectTest::transformationsLarge() {
+    /* More objects than fits into 16 bits, each of them requested twice */
+    Scene3D s;
+    Object3D* parents[]{new Object3D{&s}, new Object3D{&s}};
+    parents[0]->translate(Vector3::xAxis(1.0f));
+    parents[1]->translate(Vector3::yAxis(1.0f));
+    std::vector<std::reference_wrapper<Object3D>> objects;
+    for(std::size_t i = 0; i != 70000; ++i) {
+        Object3D* o = new Object3D{parents[i % 2]};
+        o->translate(Vector3::zAxis(Float(i)));
+        objects.push_back(*o);
+    }
+    const std::vector<std::reference_wrapper<Object3D>> copy = objects;
+    objects.insert(objects.end(), copy.begin(), copy.end());
+
+    std::vector<Matrix4> transformations = s.transformations(objects);
+    CORRADE_COMPARE(transformations.size(), 140000);
+    CORRADE_COMPARE(transformations[0], Matrix4::translation({1.0f, 0.0f, 0.0f}));
+    CORRADE_COMPARE(transformations[69999], Matrix4::translation({0.0f, 1.0f, 69999.0f}));
+    CORRADE_COMPARE(transformations[70000 + 65536], Matrix4::translation({1.0f, 0.0f, 65536.0f}));
+}
+
+void ObjectTest::transformationsOutput() {
+    Scene3D s;
+    Object3D first(&s);
+    first.rotateZ(Deg(30.0f));
+    Object3D second(&first);
+    second.scale(Vector3(0.5f));
+    Object3D third(&first);
+    third.translate(Vector3::xAxis(5.0f));
+
+    Matrix4 firstExpected = Matrix4::rotationZ(Deg(30.0f));
+    Matrix4 secondExpected = Matrix4::rotationZ(Deg(30.0f))*Matrix4::scaling(Vector3(0.5f));
+    Matrix4 thirdExpected = Matrix4::rotationZ(Deg(30.0f))*Matrix4::translation(Vector3::xAxis(5.0f));
+
+    std::vector<Matrix4> transformations;
+    s.transformations({second, third, first}, transformations);
+    CORRADE_COMPARE(transformations, (std::vector<Matrix4>{
+        secondExpected, thirdExpected, firstExpected}));
+
+    /* The memory is reused for smaller output */
+    const Matrix4* data = transformations.data();
+    s.transformationMatrices({third, second}, transformations);
+    CORRADE_COMPARE(transformations, (std::vector<Matrix4>{
+        thirdExpected, secondExpected}));
+    CORRADE_VERIFY(transformations.data() == data);
+
+    /* Through the abstract interface */
+    const AbstractObject3D& abstractScene = s;
+    abstractScene.transformationMatrices({first}, transformations, Matrix4::translation(Vector3::zAxis(1.0f)));
+    CORRADE_COMPARE(transformations, std::vector<Matrix4>{
+        Matrix4::translation(Vector3::zAxis(1.0f))*firstExpected});
+}
+
+#ifdef MAGNUM_BUILD_MULTITHREADED
+void ObjectTest::transformationsThreadPool() {
+    /* Large enough tree to be processed in parallel */
+    Scene3D s;
+    std::vector<Object3D*> all{&s};
+    std::vector<std::reference_wrapper<Object3D>> objects;
+    for(std::size_t i = 0; i != 20000; ++i) {
+        Object3D* o = new Object3D{all[(i*7919) % all.size()]};
+        o->translate({Float(i % 13), Float(i % 7), 1.0f})
+          .rotateY(Deg(Float(i % 90)));
+        all.push_back(o);
+        if(i % 3 != 1) objects.push_back(*o);
+    }
+
+    std::vector<Matrix4> expected = s.transformationMatrices(objects);
+
+    ThreadPool pool{4};
+    s.setThreadPool(&pool);
+    CORRADE_VERIFY(s.threadPool() == &pool);
+
+    std::vector<Matrix4> transformations;
+    s.transformationMatrices(objects, transformations);
+    CORRADE_VERIFY(transformations == expected);
+    for(std::size_t i = 0; i < objects.size(); i += 997)
+        CORRADE_COMPARE(transformations[i], objects[i].get().absoluteTransformationMatrix());
+
+    s.setThreadPool(nullptr);
+}
+#endif
+
 void ObjectTest::setClean() {
     Scene3D scene;
 
@@ -484,6 +626,214 @@ void ObjectTest::setCleanListBulk() {
     CORRADE_COMPARE(d.cleanedAbsoluteTransformation, Matrix4::translation(Vector3::zAxis(3.0f))*Matrix4::scaling(Vector3(-2.0f)));
 }
 
+namespace {
+    struct BatchFeature;
+
+    struct BatchGroup: FeatureGroup3D<BatchFeature> {
+        std::vector<std::size_t> batchSizes;
+
+        void doClean(const std::vector<std::reference_wrapper<AbstractFeature3D>>& features, const std::vector<Matrix4>& absoluteTransformationMatrices) override;
+    };
+
+    struct BatchFeature: AbstractGroupedFeature3D<BatchFeature> {
+        explicit BatchFeature(AbstractObject3D& object, BatchGroup& group): AbstractGroupedFeature3D<BatchFeature>{object, &group}, cleanCount{} {
+            setCachedTransformations(CachedTransformation::Absolute);
+        }
+
+        Int cleanCount;
+        Matrix4 cleanedAbsoluteTransformation;
+
+        void clean(const Matrix4& absoluteTransformation) override {
+            ++cleanCount;
+            cleanedAbsoluteTransformation = absoluteTransformation;
+        }
+    };
+
+    void BatchGroup::doClean(const std::vector<std::reference_wrapper<AbstractFeature3D>>& features, const std::vector<Matrix4>& absoluteTransformationMatrices) {
+        CORRADE_INTERNAL_ASSERT(features.size() == absoluteTransformationMatrices.size());
+        batchSizes.push_back(features.size());
+        for(std::size_t i = 0; i != features.size(); ++i)
+            static_cast<BatchFeature&>(features[i].get()).cleanedAbsoluteTransformation = absoluteTransformationMatrices[i];
+    }
+}
+
+void ObjectTest::setCleanFeatureGroup() {
+    Scene3D scene;
+    BatchGroup group;
+
+    Object3D a{&scene};
+    a.translate(Vector3::xAxis(2.0f));
+    BatchFeature fa{a, group};
+    BatchFeature fa2{a, group};
+    Object3D b{&a};
+    b.scale(Vector3(3.0f));
+    BatchFeature fb{b, group};
+    CachingObject c{&b};
+    BatchFeature fc{c, group};
+    Object3D d{&scene};
+    BatchFeature fd{d, group};
+    d.setClean();
+
+    /* Cleaning an object directly goes through the usual path */
+    CORRADE_COMPARE(fd.cleanCount, 1);
+    CORRADE_VERIFY(group.batchSizes.empty());
+
+    /* All features of dirty objects are cleaned in one batch, other features
+       are cleaned as usual */
+    group.setClean();
+    CORRADE_VERIFY(!a.isDirty());
+    CORRADE_VERIFY(!b.isDirty());
+    CORRADE_VERIFY(!c.isDirty());
+    CORRADE_COMPARE(group.batchSizes, (std::vector<std::size_t>{4}));
+    CORRADE_COMPARE(fa.cleanCount + fa2.cleanCount + fb.cleanCount + fc.cleanCount, 0);
+    CORRADE_COMPARE(fa.cleanedAbsoluteTransformation, Matrix4::translation(Vector3::xAxis(2.0f)));
+    CORRADE_COMPARE(fa2.cleanedAbsoluteTransformation, Matrix4::translation(Vector3::xAxis(2.0f)));
+    CORRADE_COMPARE(fb.cleanedAbsoluteTransformation, Matrix4::translation(Vector3::xAxis(2.0f))*Matrix4::scaling(Vector3(3.0f)));
+    CORRADE_COMPARE(fc.cleanedAbsoluteTransformation, fb.cleanedAbsoluteTransformation);
+    CORRADE_COMPARE(c.cleanedAbsoluteTransformation, fb.cleanedAbsoluteTransformation);
+
+    /* Nothing dirty, nothing to do */
+    group.setClean();
+    CORRADE_COMPARE(group.batchSizes, (std::vector<std::size_t>{4}));
+
+    /* Only the dirty subtree is cleaned */
+    b.translate(Vector3::yAxis(1.0f));
+    group.setClean();
+    CORRADE_COMPARE(group.batchSizes, (std::vector<std::size_t>{4, 2}));
+    CORRADE_COMPARE(fc.cleanedAbsoluteTransformation, Matrix4::translation({2.0f, 1.0f, 0.0f})*Matrix4::scaling(Vector3(3.0f)));
+
+    /* Feature removed from the group is cleaned as usual again */
+    group.remove(fd);
+    d.setDirty();
+    d.setClean();
+    CORRADE_COMPARE(fd.cleanCount, 2);
+}
+
+void ObjectTest::setCleanLazy() {
+    class CountingFeature: public AbstractFeature3D {
+        public:
+            explicit CountingFeature(AbstractObject3D& object): AbstractFeature3D{object}, dirtyCount{}, cleanCount{} {
+                setCachedTransformations(CachedTransformation::Absolute);
+            }
+
+            Int dirtyCount, cleanCount;
+            Matrix4 cleanedAbsoluteTransformation;
+
+        private:
+            void markDirty() override { ++dirtyCount; }
+
+            void clean(const Matrix4& absoluteTransformation) override {
+                ++cleanCount;
+                cleanedAbsoluteTransformation = absoluteTransformation;
+            }
+    };
+
+    Scene3D scene;
+    scene.setDirtyPropagation(DirtyPropagation::Lazy);
+
+    Object3D* a = new Object3D{&scene};
+    a->translate(Vector3::xAxis(1.0f));
+    Object3D* b = new Object3D{a};
+    b->scale(Vector3(2.0f));
+    CountingFeature& feature = b->addFeature<CountingFeature>();
+    CORRADE_VERIFY(b->dirtyPropagation() == DirtyPropagation::Lazy);
+
+    /* Features are notified only when cleaning */
+    CORRADE_VERIFY(a->isDirty());
+    CORRADE_VERIFY(b->isDirty());
+    CORRADE_COMPARE(feature.dirtyCount, 0);
+    b->setClean();
+    CORRADE_VERIFY(!scene.isDirty());
+    CORRADE_VERIFY(!a->isDirty());
+    CORRADE_VERIFY(!b->isDirty());
+    CORRADE_COMPARE(feature.dirtyCount, 1);
+    CORRADE_COMPARE(feature.cleanCount, 1);
+    CORRADE_COMPARE(feature.cleanedAbsoluteTransformation,
+        Matrix4::translation(Vector3::xAxis(1.0f))*Matrix4::scaling(Vector3(2.0f)));
+
+    /* Changing parent transformation makes the children dirty without
+       touching them */
+    a->rotateZ(Deg(90.0f));
+    CORRADE_VERIFY(!scene.isDirty());
+    CORRADE_VERIFY(a->isDirty());
+    CORRADE_VERIFY(b->isDirty());
+    CORRADE_COMPARE(feature.dirtyCount, 1);
+    b->setClean();
+    CORRADE_VERIFY(!a->isDirty());
+    CORRADE_VERIFY(!b->isDirty());
+    CORRADE_COMPARE(feature.dirtyCount, 2);
+    CORRADE_COMPARE(feature.cleanCount, 2);
+    CORRADE_COMPARE(feature.cleanedAbsoluteTransformation, b->absoluteTransformationMatrix());
+
+    /* Already clean object isn't cleaned again */
+    b->setClean();
+    CORRADE_COMPARE(feature.cleanCount, 2);
+
+    /* Cleaning the parent doesn't clean the children */
+    a->translate(Vector3::yAxis(3.0f));
+    a->setClean();
+    CORRADE_VERIFY(!a->isDirty());
+    CORRADE_VERIFY(b->isDirty());
+
+    /* Bulk cleaning */
+    Object3D::setClean({*b, *b});
+    CORRADE_VERIFY(!b->isDirty());
+    CORRADE_COMPARE(feature.dirtyCount, 3);
+    CORRADE_COMPARE(feature.cleanCount, 3);
+    CORRADE_COMPARE(feature.cleanedAbsoluteTransformation, b->absoluteTransformationMatrix());
+
+    /* Reparenting makes the object dirty, but not the old parent */
+    b->setParent(&scene);
+    CORRADE_VERIFY(!a->isDirty());
+    CORRADE_VERIFY(b->isDirty());
+    b->setClean();
+    CORRADE_COMPARE(feature.cleanedAbsoluteTransformation, Matrix4::scaling(Vector3(2.0f)));
+}
+
+void ObjectTest::dirtyPropagation() {
+    Scene3D another;
+    Scene3D scene;
+    Object3D a{&scene};
+    Object3D b{&a};
+    Object3D c{&scene};
+    CORRADE_VERIFY(scene.dirtyPropagation() == DirtyPropagation::Immediate);
+    CORRADE_VERIFY(b.dirtyPropagation() == DirtyPropagation::Immediate);
+    a.setClean();
+
+    /* Switching the mode preserves the dirty state */
+    scene.setDirtyPropagation(DirtyPropagation::Lazy);
+    CORRADE_VERIFY(a.dirtyPropagation() == DirtyPropagation::Lazy);
+    CORRADE_VERIFY(b.dirtyPropagation() == DirtyPropagation::Lazy);
+    CORRADE_VERIFY(!scene.isDirty());
+    CORRADE_VERIFY(!a.isDirty());
+    CORRADE_VERIFY(b.isDirty());
+    CORRADE_VERIFY(c.isDirty());
+
+    /* New objects inherit the mode */
+    Object3D d{&c};
+    CORRADE_VERIFY(d.dirtyPropagation() == DirtyPropagation::Lazy);
+
+    /* Orphan keeps the mode and is reset when put into another scene */
+    Object3D e{&b};
+    e.setParent(nullptr);
+    CORRADE_VERIFY(e.dirtyPropagation() == DirtyPropagation::Lazy);
+    e.setParent(&another);
+    CORRADE_VERIFY(e.dirtyPropagation() == DirtyPropagation::Immediate);
+
+    b.setClean();
+    a.translate(Vector3::xAxis(1.0f));
+    c.setClean();
+
+    /* And back */
+    scene.setDirtyPropagation(DirtyPropagation::Immediate);
+    CORRADE_VERIFY(b.dirtyPropagation() == DirtyPropagation::Immediate);
+    CORRADE_VERIFY(!scene.isDirty());
+    CORRADE_VERIFY(a.isDirty());
+    CORRADE_VERIFY(b.isDirty());
+    CORRADE_VERIFY(!c.isDirty());
+    CORRADE_VERIFY(d.isDirty());
+}
+
 void ObjectTest::rangeBasedForChildren() {
     Scene3D scene;
     Object3D a(&scene);
@@ -85,6 +85,11 @@ void RigidMatrixTransformation2DTest::compose() {
     Matrix3 parent = Matrix3::rotation(Deg(17.0f));
     Matrix3 child = Matrix3::translation({1.0f, -0.3f});
     CORRADE_COMPARE(Implementation::Transformation<RigidMatrixTransformation2D>::compose(parent, child), parent*child);
+
+    /* Reflection and translation in both */
+    Matrix3 a = Matrix3::reflection(Vector2(1.0f/Constants::sqrt2()))*Matrix3::translation({0.5f, -2.0f});
+    Matrix3 b = Matrix3::translation({1.0f, -0.3f})*Matrix3::rotation(Deg(35.0f));
+    CORRADE_COMPARE(Implementation::Transformation<RigidMatrixTransformation2D>::compose(a, b), a*b);
 }
 
 void RigidMatrixTransformation2DTest::inverted() {
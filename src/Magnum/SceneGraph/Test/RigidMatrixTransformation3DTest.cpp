@@ -85,11 +85,17 @@ void RigidMatrixTransformation3DTest::compose() {
     Matrix4 parent = Matrix4::rotationX(Deg(17.0f));
     Matrix4 child = Matrix4::translation({1.0f, -0.3f, 2.3f});
     CORRADE_COMPARE(Implementation::Transformation<RigidMatrixTransformation3D>::compose(parent, child), parent*child);
+
+    /* Reflection and translation in both */
+    Matrix4 a = Matrix4::reflection(Vector3(1.0f/Constants::sqrt3()))*Matrix4::translation({0.5f, 1.0f, -2.0f});
+    Matrix4 b = Matrix4::translation({1.0f, -0.3f, 2.3f})*Matrix4::rotation(Deg(35.0f), Vector3::yAxis());
+    CORRADE_COMPARE(Implementation::Transformation<RigidMatrixTransformation3D>::compose(a, b), a*b);
 }
 
 void RigidMatrixTransformation3DTest::inverted() {
     Matrix4 m = Matrix4::rotationX(Deg(17.0f))*Matrix4::translation({1.0f, -0.3f, 2.3f});
     CORRADE_COMPARE(Implementation::Transformation<RigidMatrixTransformation3D>::inverted(m)*m, Matrix4());
+    CORRADE_COMPARE(Implementation::Transformation<RigidMatrixTransformation3D>::inverted(m), m.invertedRigid());
 }
 
 void RigidMatrixTransformation3DTest::setTransformation() {
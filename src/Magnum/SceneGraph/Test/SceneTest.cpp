@@ -25,6 +25,7 @@
 
 #include <Corrade/TestSuite/Tester.h>
 
+#include "Magnum/SceneGraph/AbstractFeature.h"
 #include "Magnum/SceneGraph/MatrixTransformation3D.h"
 #include "Magnum/SceneGraph/Scene.h"
 
@@ -35,6 +36,7 @@ struct SceneTest: TestSuite::Tester {
 
     void transformation();
     void parent();
+    void pool();
 };
 
 typedef SceneGraph::Scene<SceneGraph::MatrixTransformation3D> Scene3D;
@@ -42,7 +44,8 @@ typedef SceneGraph::Object<SceneGraph::MatrixTransformation3D> Object3D;
 
 SceneTest::SceneTest() {
     addTests({&SceneTest::transformation,
-              &SceneTest::parent});
+              &SceneTest::parent,
+              &SceneTest::pool});
 }
 
 void SceneTest::transformation() {
@@ -65,6 +68,46 @@ void SceneTest::parent() {
     CORRADE_VERIFY(object.children().isEmpty());
 }
 
+void SceneTest::pool() {
+    struct PooledObject: Object3D, PoolAllocated {
+        explicit PooledObject(Object3D* parent): Object3D{parent} {}
+    };
+
+    struct PooledFeature: AbstractFeature3D, PoolAllocated {
+        explicit PooledFeature(AbstractObject3D& object): AbstractFeature3D{object} {}
+    };
+
+    Scene3D scene;
+    MemoryPool& pool = scene.pool();
+
+    /* Objects and their features */
+    std::vector<Object3D*> objects;
+    for(std::size_t i = 0; i != 100; ++i) {
+        Object3D* o = new(pool) PooledObject{&scene};
+        new(pool) PooledFeature{*o};
+        new(pool) PooledObject{o};
+        objects.push_back(o);
+    }
+    CORRADE_COMPARE(pool.allocationCount(), 300);
+    const std::size_t blockCount = pool.blockCount();
+
+    /* Deleting an object deletes its children and features, freeing the
+       memory to the pool */
+    for(std::size_t i = 0; i != 100; i += 2) delete objects[i];
+    CORRADE_COMPARE(pool.allocationCount(), 150);
+
+    /* The slots are reused */
+    for(std::size_t i = 0; i != 100; i += 2) {
+        objects[i] = new(pool) PooledObject{&scene};
+        new(pool) PooledFeature{*objects[i]};
+        new(pool) PooledObject{objects[i]};
+    }
+    CORRADE_COMPARE(pool.allocationCount(), 300);
+    CORRADE_COMPARE(pool.blockCount(), blockCount);
+
+    /* The rest is deleted by the scene before the pool is destroyed */
+}
+
 }}}
 
 CORRADE_TEST_MAIN(Magnum::SceneGraph::Test::SceneTest)
@@ -0,0 +1,378 @@
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#include <algorithm>
+#include <memory>
+#include <Corrade/TestSuite/Tester.h>
+
+#include "Magnum/Math/Functions.h"
+#include "Magnum/SceneGraph/MatrixTransformation2D.h"
+#include "Magnum/SceneGraph/MatrixTransformation3D.h"
+#include "Magnum/SceneGraph/Scene.h"
+#include "Magnum/SceneGraph/SpatialIndex.h"
+
+namespace Magnum { namespace SceneGraph { namespace Test {
+
+struct SpatialIndexTest: TestSuite::Tester {
+    explicit SpatialIndexTest();
+
+    void construct();
+    void removeFeature();
+    void refit();
+    void refitParent();
+    void setLocalBounds();
+    void lazyDirtyPropagation();
+    void queries2D();
+    void queries3D();
+    void queriesAfterMovingAndRemoving();
+
+    private:
+        void verifyQueries(SpatialIndex3D& index);
+};
+
+typedef SceneGraph::Object<SceneGraph::MatrixTransformation2D> Object2D;
+typedef SceneGraph::Scene<SceneGraph::MatrixTransformation2D> Scene2D;
+typedef SceneGraph::Object<SceneGraph::MatrixTransformation3D> Object3D;
+typedef SceneGraph::Scene<SceneGraph::MatrixTransformation3D> Scene3D;
+
+SpatialIndexTest::SpatialIndexTest() {
+    addTests({&SpatialIndexTest::construct,
+              &SpatialIndexTest::removeFeature,
+              &SpatialIndexTest::refit,
+              &SpatialIndexTest::refitParent,
+              &SpatialIndexTest::setLocalBounds,
+              &SpatialIndexTest::lazyDirtyPropagation,
+              &SpatialIndexTest::queries2D,
+              &SpatialIndexTest::queries3D,
+              &SpatialIndexTest::queriesAfterMovingAndRemoving});
+}
+
+namespace {
+    template<UnsignedInt dimensions> std::vector<SpatialFeature<dimensions, Float>*> sorted(const std::vector<std::reference_wrapper<SpatialFeature<dimensions, Float>>>& features) {
+        std::vector<SpatialFeature<dimensions, Float>*> out;
+        for(SpatialFeature<dimensions, Float>& feature: features) out.push_back(&feature);
+        std::sort(out.begin(), out.end());
+        return out;
+    }
+}
+
+void SpatialIndexTest::construct() {
+    Scene3D scene;
+    SpatialIndex3D index;
+    CORRADE_VERIFY(index.isEmpty());
+    CORRADE_VERIFY(!index.isDirty());
+    CORRADE_COMPARE(index.height(), 0);
+    CORRADE_COMPARE(index.bounds(), Range3D{});
+
+    Object3D a{&scene};
+    a.translate({1.0f, 2.0f, 3.0f});
+    SpatialFeature3D fa{a, index, {Vector3{-1.0f}, Vector3{1.0f}}};
+    CORRADE_COMPARE(index.size(), 1);
+    CORRADE_COMPARE(&index[0], &fa);
+    CORRADE_COMPARE(&fa.index(), &index);
+    CORRADE_VERIFY(index.isDirty());
+
+    /* Inserted to the hierarchy on cleaning */
+    CORRADE_COMPARE(index.height(), 0);
+    index.setClean();
+    CORRADE_VERIFY(!index.isDirty());
+    CORRADE_COMPARE(index.height(), 1);
+    CORRADE_COMPARE(fa.bounds(), (Range3D{{0.0f, 1.0f, 2.0f}, {2.0f, 3.0f, 4.0f}}));
+    CORRADE_COMPARE(index.bounds(), fa.bounds());
+
+    /* Rotated and scaled object has enclosing box as bounds */
+    Object3D b{&scene};
+    b.scale(Vector3{2.0f})
+     .rotateZ(Deg(45.0f))
+     .translate({-10.0f, 0.0f, 0.0f});
+    SpatialFeature3D fb{b, index, {Vector3{-1.0f}, Vector3{1.0f}}};
+    CORRADE_COMPARE(index.bounds(), (Range3D{{-10.0f - 2.0f*Constants::sqrt2(), -2.0f*Constants::sqrt2(), -2.0f}, {2.0f, 3.0f, 4.0f}}));
+    CORRADE_COMPARE(index.height(), 2);
+
+    /* Two features on the same object */
+    SpatialFeature3D fc{b, index, {Vector3{-0.5f}, Vector3{0.5f}}};
+    index.setClean();
+    CORRADE_COMPARE(index.size(), 3);
+    CORRADE_COMPARE(fc.bounds(), (Range3D{{-10.0f - Constants::sqrt2(), -Constants::sqrt2(), -1.0f}, {-10.0f + Constants::sqrt2(), Constants::sqrt2(), 1.0f}}));
+    CORRADE_COMPARE(index.height(), 3);
+}
+
+void SpatialIndexTest::removeFeature() {
+    Scene3D scene;
+    SpatialIndex3D index;
+    Object3D a{&scene};
+    Object3D b{&scene};
+    b.translate(Vector3::xAxis(5.0f));
+    Object3D c{&scene};
+    c.translate(Vector3::xAxis(10.0f));
+
+    SpatialFeature3D fa{a, index, {Vector3{-1.0f}, Vector3{1.0f}}};
+    std::unique_ptr<SpatialFeature3D> fb{new SpatialFeature3D{b, index, {Vector3{-1.0f}, Vector3{1.0f}}}};
+    {
+        /* Removed before being inserted into the hierarchy */
+        SpatialFeature3D fc{c, index, {Vector3{-1.0f}, Vector3{1.0f}}};
+        CORRADE_COMPARE(index.size(), 3);
+    }
+    CORRADE_COMPARE(index.size(), 2);
+    CORRADE_COMPARE(index.bounds(), (Range3D{Vector3{-1.0f}, {6.0f, 1.0f, 1.0f}}));
+
+    /* Removed from the hierarchy */
+    fb.reset();
+    CORRADE_COMPARE(index.size(), 1);
+    CORRADE_COMPARE(&index[0], &fa);
+    CORRADE_COMPARE(index.height(), 1);
+    CORRADE_COMPARE(index.bounds(), (Range3D{Vector3{-1.0f}, Vector3{1.0f}}));
+
+    /* Removed from the middle of the dirty list, the remaining dirty features
+       are still cleaned */
+    Object3D d{&scene};
+    d.translate(Vector3::yAxis(5.0f));
+    Object3D e{&scene};
+    e.translate(Vector3::yAxis(-5.0f));
+    std::unique_ptr<SpatialFeature3D> fd{new SpatialFeature3D{d, index, {Vector3{-1.0f}, Vector3{1.0f}}}};
+    SpatialFeature3D fe{e, index, {Vector3{-1.0f}, Vector3{1.0f}}};
+    a.translate(Vector3::zAxis(3.0f));
+    fd.reset();
+    CORRADE_COMPARE(index.size(), 2);
+    CORRADE_COMPARE(index.bounds(), (Range3D{{-1.0f, -6.0f, -1.0f}, {1.0f, 1.0f, 4.0f}}));
+    CORRADE_COMPARE(index.height(), 2);
+}
+
+void SpatialIndexTest::refit() {
+    Scene3D scene;
+    SpatialIndex3D index;
+    Object3D a{&scene};
+    Object3D b{&scene};
+    b.translate(Vector3::xAxis(5.0f));
+    SpatialFeature3D fa{a, index, {Vector3{-1.0f}, Vector3{1.0f}}};
+    SpatialFeature3D fb{b, index, {Vector3{-1.0f}, Vector3{1.0f}}};
+    CORRADE_COMPARE(index.bounds(), (Range3D{Vector3{-1.0f}, {6.0f, 1.0f, 1.0f}}));
+
+    /* Moving the object marks the index dirty, cleaning refits it */
+    b.translate(Vector3::yAxis(-5.0f));
+    CORRADE_VERIFY(index.isDirty());
+    CORRADE_COMPARE(index.bounds(), (Range3D{{-1.0f, -6.0f, -1.0f}, {6.0f, 1.0f, 1.0f}}));
+    CORRADE_VERIFY(!index.isDirty());
+
+    /* Cleaning the object directly refits the index too */
+    b.translate(Vector3::yAxis(5.0f));
+    b.setClean();
+    CORRADE_VERIFY(!b.isDirty());
+    CORRADE_COMPARE(index.bounds(), (Range3D{Vector3{-1.0f}, {6.0f, 1.0f, 1.0f}}));
+}
+
+void SpatialIndexTest::refitParent() {
+    Scene3D scene;
+    SpatialIndex3D index;
+    Object3D parent{&scene};
+    Object3D child{&parent};
+    child.translate(Vector3::xAxis(2.0f));
+    SpatialFeature3D feature{child, index, {Vector3{-1.0f}, Vector3{1.0f}}};
+    CORRADE_COMPARE(index.bounds(), (Range3D{{1.0f, -1.0f, -1.0f}, {3.0f, 1.0f, 1.0f}}));
+
+    /* Moving parent refits the child */
+    parent.translate(Vector3::zAxis(10.0f));
+    CORRADE_VERIFY(index.isDirty());
+    CORRADE_COMPARE(index.bounds(), (Range3D{{1.0f, -1.0f, 9.0f}, {3.0f, 1.0f, 11.0f}}));
+}
+
+void SpatialIndexTest::setLocalBounds() {
+    Scene3D scene;
+    SpatialIndex3D index;
+    Object3D a{&scene};
+    a.translate(Vector3::xAxis(2.0f));
+    SpatialFeature3D feature{a, index, {Vector3{-1.0f}, Vector3{1.0f}}};
+    index.setClean();
+
+    feature.setLocalBounds({Vector3{-3.0f}, Vector3{0.0f}});
+    CORRADE_COMPARE(feature.localBounds(), (Range3D{Vector3{-3.0f}, Vector3{0.0f}}));
+    CORRADE_VERIFY(index.isDirty());
+    CORRADE_COMPARE(index.bounds(), (Range3D{{-1.0f, -3.0f, -3.0f}, {2.0f, 0.0f, 0.0f}}));
+}
+
+void SpatialIndexTest::lazyDirtyPropagation() {
+    Scene3D scene;
+    scene.setDirtyPropagation(DirtyPropagation::Lazy);
+    SpatialIndex3D index;
+    Object3D parent{&scene};
+    Object3D child{&parent};
+    SpatialFeature3D feature{child, index, {Vector3{-1.0f}, Vector3{1.0f}}};
+    CORRADE_COMPARE(index.bounds(), (Range3D{Vector3{-1.0f}, Vector3{1.0f}}));
+
+    /* The feature isn't notified, the index needs to be marked explicitly */
+    parent.translate(Vector3::xAxis(5.0f));
+    index.setDirty();
+    CORRADE_VERIFY(index.isDirty());
+    CORRADE_COMPARE(index.bounds(), (Range3D{{4.0f, -1.0f, -1.0f}, {6.0f, 1.0f, 1.0f}}));
+}
+
+void SpatialIndexTest::queries2D() {
+    Scene2D scene;
+    SpatialIndex2D index;
+    Object2D a{&scene};
+    a.translate({5.0f, 0.0f});
+    Object2D b{&scene};
+    b.translate({0.0f, 5.0f});
+    Object2D c{&scene};
+    c.translate({-5.0f, -5.0f});
+    SpatialFeature2D fa{a, index, {Vector2{-1.0f}, Vector2{1.0f}}};
+    SpatialFeature2D fb{b, index, {Vector2{-1.0f}, Vector2{1.0f}}};
+    SpatialFeature2D fc{c, index, {Vector2{-1.0f}, Vector2{1.0f}}};
+
+    std::vector<std::reference_wrapper<SpatialFeature2D>> found;
+    index.featuresInSphere({3.0f, 3.0f}, 2.5f, found);
+    CORRADE_COMPARE(sorted(found), sorted<2>({fa, fb}));
+
+    index.featuresInBox({{-6.0f, -6.0f}, {0.0f, 0.0f}}, found);
+    CORRADE_COMPARE(sorted(found), sorted<2>({fc}));
+
+    index.featuresInFrustum(Matrix3::projection({4.0f, 4.0f})*Matrix3::translation({-5.0f, 0.0f}), found);
+    CORRADE_COMPARE(sorted(found), sorted<2>({fa}));
+
+    /* Pointing the other way from fc, only positive direction is reported */
+    index.featuresOnRay({-5.0f, -10.0f}, {0.0f, 1.0f}, found);
+    CORRADE_COMPARE(sorted(found), sorted<2>({fc}));
+    index.featuresOnRay({-5.0f, -10.0f}, {0.0f, -1.0f}, found);
+    CORRADE_VERIFY(found.empty());
+    index.featuresOnRay({0.0f, 0.0f}, {1.0f, 1.0f}, found);
+    CORRADE_VERIFY(found.empty());
+}
+
+namespace {
+    struct Grid {
+        explicit Grid(Scene3D& scene, SpatialIndex3D& index) {
+            for(Int z = 0; z != 10; ++z) for(Int y = 0; y != 10; ++y) for(Int x = 0; x != 10; ++x) {
+                Object3D* o = new Object3D{&scene};
+                o->translate(Vector3(x, y, z)*3.0f);
+                objects.push_back(o);
+                features.push_back(new SpatialFeature3D{*o, index, {Vector3{-0.5f}, Vector3{0.5f}}});
+            }
+        }
+
+        std::vector<Object3D*> objects;
+        std::vector<SpatialFeature3D*> features;
+    };
+
+    template<class Predicate> std::vector<SpatialFeature3D*> bruteForce(SpatialIndex3D& index, Predicate predicate) {
+        std::vector<SpatialFeature3D*> out;
+        for(std::size_t i = 0; i != index.size(); ++i)
+            if(predicate(index[i].bounds())) out.push_back(&index[i]);
+        std::sort(out.begin(), out.end());
+        return out;
+    }
+}
+
+void SpatialIndexTest::verifyQueries(SpatialIndex3D& index) {
+    std::vector<std::reference_wrapper<SpatialFeature3D>> found;
+
+    index.featuresInSphere({10.0f, 12.0f, 5.0f}, 6.0f, found);
+    std::vector<SpatialFeature3D*> expected = bruteForce(index, [](const Range3D& b) {
+        const Vector3 closest = Math::min(Math::max(Vector3{10.0f, 12.0f, 5.0f}, b.min()), b.max());
+        return (closest - Vector3{10.0f, 12.0f, 5.0f}).dot() <= 36.0f;
+    });
+    CORRADE_VERIFY(!expected.empty());
+    CORRADE_COMPARE(sorted(found), expected);
+
+    index.featuresInBox({{2.0f, 2.0f, 2.0f}, {8.0f, 20.0f, 4.0f}}, found);
+    expected = bruteForce(index, [](const Range3D& b) {
+        return (b.min() <= Vector3{8.0f, 20.0f, 4.0f}).all() && (b.max() >= Vector3{2.0f, 2.0f, 2.0f}).all();
+    });
+    CORRADE_VERIFY(!expected.empty());
+    CORRADE_COMPARE(sorted(found), expected);
+
+    /* Ray along a row of objects */
+    index.featuresOnRay({-5.0f, 3.0f, 6.0f}, {1.0f, 0.0f, 0.0f}, found);
+    expected = bruteForce(index, [](const Range3D& b) {
+        return b.min().y() <= 3.0f && b.max().y() >= 3.0f && b.min().z() <= 6.0f && b.max().z() >= 6.0f && b.max().x() >= -5.0f;
+    });
+    CORRADE_VERIFY(!expected.empty());
+    CORRADE_COMPARE(sorted(found), expected);
+}
+
+void SpatialIndexTest::queries3D() {
+    Scene3D scene;
+    SpatialIndex3D index;
+    Grid grid{scene, index};
+
+    index.setClean();
+    CORRADE_COMPARE(index.size(), 1000);
+    /* Balanced tree with 1000 leaves has height 11 */
+    CORRADE_VERIFY(index.height() <= 16);
+    CORRADE_COMPARE(index.bounds(), (Range3D{Vector3{-0.5f}, Vector3{27.5f}}));
+
+    verifyQueries(index);
+
+    /* Orthographic frustum covering x in [0, 6], y in [-3, 3] and z in
+       [3, 9] */
+    std::vector<std::reference_wrapper<SpatialFeature3D>> found;
+    index.featuresInFrustum(Matrix4::orthographicProjection({6.0f, 6.0f}, 1.0f, 7.0f)*Matrix4::translation({-3.0f, 0.0f, -10.0f}), found);
+    std::vector<SpatialFeature3D*> expected = bruteForce(index, [](const Range3D& b) {
+        return b.max().x() >= 0.0f && b.min().x() <= 6.0f && b.max().y() >= -3.0f && b.min().y() <= 3.0f && b.max().z() >= 3.0f && b.min().z() <= 9.0f;
+    });
+    CORRADE_COMPARE(expected.size(), 18);
+    CORRADE_COMPARE(sorted(found), expected);
+
+    /* Perspective frustum from far away, catching everything */
+    index.featuresInFrustum(Matrix4::perspectiveProjection(Deg(90.0f), 1.0f, 0.1f, 200.0f)*Matrix4::translation({-13.5f, -13.5f, -100.0f}), found);
+    CORRADE_COMPARE(found.size(), 1000);
+
+    /* Perspective frustum behind the grid, catching nothing */
+    index.featuresInFrustum(Matrix4::perspectiveProjection(Deg(90.0f), 1.0f, 0.1f, 200.0f)*Matrix4::translation({-13.5f, -13.5f, 100.0f}), found);
+    CORRADE_VERIFY(found.empty());
+
+    for(SpatialFeature3D* f: grid.features) delete f;
+}
+
+void SpatialIndexTest::queriesAfterMovingAndRemoving() {
+    Scene3D scene;
+    SpatialIndex3D index;
+    Grid grid{scene, index};
+    index.setClean();
+
+    /* Move every third object, rotate every fifth */
+    for(std::size_t i = 0; i < grid.objects.size(); i += 3)
+        grid.objects[i]->translate({1.0f, -2.0f, 0.5f});
+    for(std::size_t i = 0; i < grid.objects.size(); i += 5)
+        grid.objects[i]->rotateX(Deg(30.0f));
+    verifyQueries(index);
+
+    /* Remove every seventh feature */
+    for(std::size_t i = 0; i < grid.features.size(); i += 7) {
+        delete grid.features[i];
+        grid.features[i] = nullptr;
+    }
+    CORRADE_COMPARE(index.size(), 857);
+    CORRADE_VERIFY(index.height() <= 16);
+    verifyQueries(index);
+
+    /* Remove everything */
+    for(SpatialFeature3D* f: grid.features) delete f;
+    CORRADE_VERIFY(index.isEmpty());
+    CORRADE_COMPARE(index.height(), 0);
+}
+
+}}}
+
+CORRADE_TEST_MAIN(Magnum::SceneGraph::Test::SpatialIndexTest)
@@ -0,0 +1,101 @@
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#include <algorithm>
+#include <atomic>
+#include <Corrade/TestSuite/Tester.h>
+
+#include "Magnum/SceneGraph/ThreadPool.h"
+
+namespace Magnum { namespace SceneGraph { namespace Test {
+
+struct ThreadPoolTest: TestSuite::Tester {
+    explicit ThreadPoolTest();
+
+    void construct();
+    void constructDefault();
+    void run();
+    void runSmall();
+    void runEmpty();
+};
+
+ThreadPoolTest::ThreadPoolTest() {
+    addTests({&ThreadPoolTest::construct,
+              &ThreadPoolTest::constructDefault,
+              &ThreadPoolTest::run,
+              &ThreadPoolTest::runSmall,
+              &ThreadPoolTest::runEmpty});
+}
+
+void ThreadPoolTest::construct() {
+    ThreadPool pool{3};
+    CORRADE_COMPARE(pool.threadCount(), 3);
+}
+
+void ThreadPoolTest::constructDefault() {
+    ThreadPool pool;
+    CORRADE_VERIFY(pool.threadCount() >= 1);
+}
+
+void ThreadPoolTest::run() {
+    ThreadPool pool{4};
+
+    /* Each item should be processed exactly once, repeatedly */
+    std::vector<Int> data(10007);
+    for(Int iteration = 0; iteration != 50; ++iteration) {
+        pool.run(data.size(), [&data](std::size_t begin, std::size_t end) {
+            for(std::size_t i = begin; i != end; ++i) ++data[i];
+        });
+    }
+
+    CORRADE_COMPARE(std::count(data.begin(), data.end(), 50), data.size());
+}
+
+void ThreadPoolTest::runSmall() {
+    ThreadPool pool{8};
+
+    /* Less items than threads */
+    std::vector<Int> data(3);
+    std::atomic<Int> calls{0};
+    pool.run(data.size(), [&data, &calls](std::size_t begin, std::size_t end) {
+        ++calls;
+        for(std::size_t i = begin; i != end; ++i) ++data[i];
+    });
+
+    CORRADE_COMPARE(data, (std::vector<Int>{1, 1, 1}));
+    CORRADE_VERIFY(calls <= 8);
+}
+
+void ThreadPoolTest::runEmpty() {
+    ThreadPool pool{2};
+
+    bool called = false;
+    pool.run(0, [&called](std::size_t, std::size_t) { called = true; });
+    CORRADE_VERIFY(!called);
+}
+
+}}}
+
+CORRADE_TEST_MAIN(Magnum::SceneGraph::Test::ThreadPoolTest)
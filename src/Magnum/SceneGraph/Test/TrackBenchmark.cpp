@@ -0,0 +1,149 @@
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#include <Corrade/TestSuite/Tester.h>
+
+#include "Magnum/SceneGraph/MatrixTransformation3D.h"
+#include "Magnum/SceneGraph/Scene.h"
+#include "Magnum/SceneGraph/TrackSampler.h"
+#include "Magnum/Test/Benchmark.h"
+
+namespace Magnum { namespace SceneGraph { namespace Test {
+
+typedef SceneGraph::Object<SceneGraph::MatrixTransformation3D> Object3D;
+typedef SceneGraph::Scene<SceneGraph::MatrixTransformation3D> Scene3D;
+
+struct TrackBenchmark: TestSuite::Tester {
+    explicit TrackBenchmark();
+
+    void skeletalLinearSearch();
+    void skeletalSampler();
+
+    private:
+        template<class Sample> void skeletal(const char* name, Sample sample);
+};
+
+namespace {
+    enum: std::size_t {
+        CharacterCount = 500,
+        BoneCount = 50,
+        KeyframeCount = 60
+    };
+
+    /* One clip shared by all characters, a translation and rotation track
+       for each bone */
+    struct Clip {
+        explicit Clip() {
+            std::vector<Float> keys;
+            for(std::size_t i = 0; i != KeyframeCount; ++i)
+                keys.push_back(i/30.0f);
+
+            for(std::size_t bone = 0; bone != BoneCount; ++bone) {
+                std::vector<Vector3> translationValues;
+                std::vector<Quaternion> rotationValues;
+                for(std::size_t i = 0; i != KeyframeCount; ++i) {
+                    translationValues.emplace_back(Float(bone % 3), 0.1f*Float(i % 7), 1.0f);
+                    rotationValues.push_back(Quaternion::rotation(Deg(Float((bone*7 + i*11) % 360)), Vector3::yAxis()));
+                }
+
+                translations.emplace_back(keys, translationValues, TrackInterpolation::Linear);
+                rotations.emplace_back(keys, rotationValues, TrackInterpolation::Spherical);
+            }
+        }
+
+        std::vector<Track<Vector3>> translations;
+        std::vector<Track<Quaternion>> rotations;
+    };
+
+    /* What animationStep() implementations usually do by hand */
+    template<class V, class Interpolate> V sampleLinearSearch(const Track<V>& track, Float time, Interpolate interpolate) {
+        const std::vector<Float>& keys = track.keys();
+        std::size_t i = 0;
+        while(i + 2 < keys.size() && keys[i + 1] <= time) ++i;
+        const Float t = Math::max(Math::min((time - keys[i])/(keys[i + 1] - keys[i]), 1.0f), 0.0f);
+        return interpolate(track.values()[i], track.values()[i + 1], t);
+    }
+}
+
+TrackBenchmark::TrackBenchmark() {
+    addTests({&TrackBenchmark::skeletalLinearSearch,
+              &TrackBenchmark::skeletalSampler});
+}
+
+void TrackBenchmark::skeletalLinearSearch() {
+    skeletal("Linear search", [](const Clip& clip, const std::vector<Object3D*>& bones, std::vector<TrackSampler<MatrixTransformation3D>>&, Float time) {
+        for(std::size_t i = 0; i != bones.size(); ++i) {
+            const std::size_t bone = i % BoneCount;
+            const Vector3 translation = sampleLinearSearch(clip.translations[bone], time, [](const Vector3& a, const Vector3& b, Float t) { return Math::lerp(a, b, t); });
+            const Quaternion rotation = sampleLinearSearch(clip.rotations[bone], time, [](const Quaternion& a, const Quaternion& b, Float t) { return Math::slerp(a, b, t); });
+            bones[i]->setTransformation(Matrix4::from(rotation.toMatrix(), translation));
+        }
+    });
+}
+
+void TrackBenchmark::skeletalSampler() {
+    skeletal("TrackSampler", [](const Clip&, const std::vector<Object3D*>&, std::vector<TrackSampler<MatrixTransformation3D>>& samplers, Float time) {
+        for(TrackSampler<MatrixTransformation3D>& sampler: samplers)
+            sampler.sample(time);
+    });
+}
+
+template<class Sample> void TrackBenchmark::skeletal(const char* name, Sample sample) {
+    Clip clip;
+
+    /* Each character is a chain of bones, all characters play the same clip
+       in sync */
+    Scene3D scene;
+    std::vector<Object3D*> bones;
+    std::vector<TrackSampler<MatrixTransformation3D>> samplers(CharacterCount);
+    for(std::size_t character = 0; character != CharacterCount; ++character) {
+        Object3D* parent = new Object3D{&scene};
+        for(std::size_t bone = 0; bone != BoneCount; ++bone) {
+            Object3D* o = new Object3D{parent};
+            bones.push_back(o);
+            samplers[character].add(*o, &clip.translations[bone], &clip.rotations[bone]);
+            parent = o;
+        }
+    }
+
+    /* Play the whole clip, a frame at 60 FPS */
+    const std::int64_t time = Magnum::Test::measure([&]() {
+        for(Float time = 0.0f; time < clip.translations[0].end(); time += 1.0f/60.0f)
+            sample(clip, bones, samplers, time);
+    });
+
+    const std::size_t frames = std::size_t(clip.translations[0].end()*60.0f) + 1;
+    CORRADE_COMPARE(bones.size(), CharacterCount*BoneCount);
+    sample(clip, bones, samplers, 1.0f);
+    CORRADE_COMPARE(bones[BoneCount + 2]->transformationMatrix().translation(),
+        clip.translations[2].at(1.0f));
+
+    Debug() << name << "playback of" << CharacterCount << "characters with" << BoneCount << "bones:"
+        << time/frames << "us per frame";
+}
+
+}}}
+
+CORRADE_TEST_MAIN(Magnum::SceneGraph::Test::TrackBenchmark)
@@ -0,0 +1,317 @@
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#include <sstream>
+#include <Corrade/TestSuite/Tester.h>
+
+#include "Magnum/SceneGraph/DualQuaternionTransformation.h"
+#include "Magnum/SceneGraph/MatrixTransformation3D.h"
+#include "Magnum/SceneGraph/Scene.h"
+#include "Magnum/SceneGraph/TrackSampler.h"
+
+namespace Magnum { namespace SceneGraph { namespace Test {
+
+struct TrackTest: TestSuite::Tester {
+    explicit TrackTest();
+
+    void construct();
+    void constructInvalid();
+    void keyframe();
+    void sampleHint();
+    void step();
+    void linear();
+    void linearQuaternion();
+    void spherical();
+    void cubic();
+    void singleKeyframe();
+
+    void sampler();
+    void samplerRigid();
+    void samplerClear();
+
+    void debugInterpolation();
+};
+
+typedef Object<MatrixTransformation3D> Object3D;
+typedef Scene<MatrixTransformation3D> Scene3D;
+
+TrackTest::TrackTest() {
+    addTests({&TrackTest::construct,
+              &TrackTest::constructInvalid,
+              &TrackTest::keyframe,
+              &TrackTest::sampleHint,
+              &TrackTest::step,
+              &TrackTest::linear,
+              &TrackTest::linearQuaternion,
+              &TrackTest::spherical,
+              &TrackTest::cubic,
+              &TrackTest::singleKeyframe,
+
+              &TrackTest::sampler,
+              &TrackTest::samplerRigid,
+              &TrackTest::samplerClear,
+
+              &TrackTest::debugInterpolation});
+}
+
+void TrackTest::construct() {
+    Track<Float> track{{1.0f, 2.0f, 4.0f}, {3.0f, 5.0f, 1.0f}, TrackInterpolation::Step};
+    CORRADE_COMPARE(track.keys(), (std::vector<Float>{1.0f, 2.0f, 4.0f}));
+    CORRADE_COMPARE(track.values(), (std::vector<Float>{3.0f, 5.0f, 1.0f}));
+    CORRADE_COMPARE(track.interpolation(), TrackInterpolation::Step);
+    CORRADE_COMPARE(track.begin(), 1.0f);
+    CORRADE_COMPARE(track.end(), 4.0f);
+    CORRADE_COMPARE(track.duration(), 3.0f);
+}
+
+void TrackTest::constructInvalid() {
+    std::ostringstream out;
+    Error::setOutput(&out);
+
+    Track<Float>{{}, {}};
+    Track<Float>{{1.0f, 2.0f}, {3.0f}};
+    Track<Float>{{1.0f, 0.5f}, {3.0f, 4.0f}};
+    CORRADE_COMPARE(out.str(),
+        "SceneGraph::Track: expected the same non-zero count of keys and values but got 0 and 0\n"
+        "SceneGraph::Track: expected the same non-zero count of keys and values but got 2 and 1\n"
+        "SceneGraph::Track: keys are not sorted\n");
+}
+
+void TrackTest::keyframe() {
+    const std::vector<Float> keys{0.0f, 1.0f, 2.0f, 3.0f, 4.0f};
+
+    /* Correct hint, next segment, far away */
+    CORRADE_COMPARE(Implementation::trackKeyframe(keys, 1.5f, 1), 1);
+    CORRADE_COMPARE(Implementation::trackKeyframe(keys, 2.5f, 1), 2);
+    CORRADE_COMPARE(Implementation::trackKeyframe(keys, 3.5f, 0), 3);
+    CORRADE_COMPARE(Implementation::trackKeyframe(keys, 0.5f, 3), 0);
+
+    /* Exactly on a key */
+    CORRADE_COMPARE(Implementation::trackKeyframe(keys, 2.0f, 0), 2);
+    CORRADE_COMPARE(Implementation::trackKeyframe(keys, 2.0f, 2), 2);
+
+    /* Out of range, clamped so the next keyframe exists */
+    CORRADE_COMPARE(Implementation::trackKeyframe(keys, -1.0f, 2), 0);
+    CORRADE_COMPARE(Implementation::trackKeyframe(keys, 4.0f, 0), 3);
+    CORRADE_COMPARE(Implementation::trackKeyframe(keys, 7.0f, 3), 3);
+    CORRADE_COMPARE(Implementation::trackKeyframe(keys, 7.0f, 100), 3);
+
+    /* Single and two keyframes */
+    CORRADE_COMPARE(Implementation::trackKeyframe({1.0f}, 7.0f, 3), 0);
+    CORRADE_COMPARE(Implementation::trackKeyframe({1.0f, 2.0f}, 7.0f, 0), 0);
+}
+
+void TrackTest::sampleHint() {
+    Track<Float> track{{0.0f, 1.0f, 2.0f, 3.0f}, {0.0f, 2.0f, 4.0f, 6.0f}};
+
+    std::size_t hint = 0;
+    CORRADE_COMPARE(track.at(0.5f, hint), 1.0f);
+    CORRADE_COMPARE(hint, 0);
+    CORRADE_COMPARE(track.at(1.25f, hint), 2.5f);
+    CORRADE_COMPARE(hint, 1);
+    CORRADE_COMPARE(track.at(2.75f, hint), 5.5f);
+    CORRADE_COMPARE(hint, 2);
+
+    /* Going back */
+    CORRADE_COMPARE(track.at(0.25f, hint), 0.5f);
+    CORRADE_COMPARE(hint, 0);
+
+    /* Without hint */
+    CORRADE_COMPARE(track.at(2.5f), 5.0f);
+}
+
+void TrackTest::step() {
+    Track<Vector2> track{{1.0f, 2.0f, 3.0f}, {{1.0f, 0.0f}, {2.0f, 1.0f}, {3.0f, 4.0f}}, TrackInterpolation::Step};
+    CORRADE_COMPARE(track.at(0.0f), Vector2(1.0f, 0.0f));
+    CORRADE_COMPARE(track.at(1.0f), Vector2(1.0f, 0.0f));
+    CORRADE_COMPARE(track.at(1.9f), Vector2(1.0f, 0.0f));
+    CORRADE_COMPARE(track.at(2.0f), Vector2(2.0f, 1.0f));
+    CORRADE_COMPARE(track.at(2.5f), Vector2(2.0f, 1.0f));
+    CORRADE_COMPARE(track.at(3.0f), Vector2(3.0f, 4.0f));
+    CORRADE_COMPARE(track.at(10.0f), Vector2(3.0f, 4.0f));
+}
+
+void TrackTest::linear() {
+    Track<Vector3> track{{1.0f, 2.0f, 4.0f}, {{}, {2.0f, 0.0f, 1.0f}, {2.0f, 4.0f, 1.0f}}};
+    CORRADE_COMPARE(track.at(0.0f), Vector3());
+    CORRADE_COMPARE(track.at(1.5f), Vector3(1.0f, 0.0f, 0.5f));
+    CORRADE_COMPARE(track.at(3.0f), Vector3(2.0f, 2.0f, 1.0f));
+    CORRADE_COMPARE(track.at(5.0f), Vector3(2.0f, 4.0f, 1.0f));
+}
+
+void TrackTest::linearQuaternion() {
+    const Quaternion a = Quaternion::rotation(Deg(10.0f), Vector3::xAxis());
+    const Quaternion b = Quaternion::rotation(Deg(80.0f), Vector3::xAxis());
+    Track<Quaternion> track{{0.0f, 1.0f}, {a, b}};
+    CORRADE_COMPARE(track.at(0.5f), Math::lerp(a, b, 0.5f));
+
+    /* Keyframe in the other hemisphere is flipped so the interpolation goes
+       the shortest way */
+    Track<Quaternion> flipped{{0.0f, 1.0f}, {a, -b}};
+    CORRADE_COMPARE(flipped.values()[1], b);
+    CORRADE_COMPARE(flipped.at(0.5f), Math::lerp(a, b, 0.5f));
+}
+
+void TrackTest::spherical() {
+    const Quaternion a = Quaternion::rotation(Deg(10.0f), Vector3::yAxis());
+    const Quaternion b = Quaternion::rotation(Deg(120.0f), Vector3::yAxis());
+    Track<Quaternion> track{{0.0f, 2.0f, 3.0f}, {a, b, b}, TrackInterpolation::Spherical};
+    CORRADE_COMPARE(track.at(0.5f), Math::slerp(a, b, 0.25f));
+    CORRADE_COMPARE(track.at(1.0f), Quaternion::rotation(Deg(65.0f), Vector3::yAxis()));
+
+    /* Identical keyframes don't produce NaNs */
+    CORRADE_COMPARE(track.at(2.5f), b);
+
+    /* Other types are interpolated linearly */
+    Track<Float> scalar{{0.0f, 2.0f}, {1.0f, 3.0f}, TrackInterpolation::Spherical};
+    CORRADE_COMPARE(scalar.at(1.5f), 2.5f);
+}
+
+void TrackTest::cubic() {
+    Track<Float> track{{0.0f, 1.0f, 2.0f, 3.0f}, {0.0f, 1.0f, 0.0f, 1.0f}, TrackInterpolation::Cubic};
+
+    /* Goes through the keyframes */
+    CORRADE_COMPARE(track.at(0.0f), 0.0f);
+    CORRADE_COMPARE(track.at(1.0f), 1.0f);
+    CORRADE_COMPARE(track.at(2.0f), 0.0f);
+    CORRADE_COMPARE(track.at(3.0f), 1.0f);
+
+    /* Tangent at the peak is zero, the middle of the segment is halfway */
+    CORRADE_COMPARE(track.at(1.5f), 0.5f);
+
+    /* First segment: one-sided tangent 1 at start, 0 at the peak */
+    CORRADE_COMPARE(track.at(0.5f), 0.625f);
+
+    /* Linear data stay linear */
+    Track<Vector2> line{{0.0f, 1.0f, 2.0f, 3.0f}, {{}, {1.0f, 2.0f}, {2.0f, 4.0f}, {3.0f, 6.0f}}, TrackInterpolation::Cubic};
+    CORRADE_COMPARE(line.at(0.25f), Vector2(0.25f, 0.5f));
+    CORRADE_COMPARE(line.at(1.5f), Vector2(1.5f, 3.0f));
+    CORRADE_COMPARE(line.at(2.75f), Vector2(2.75f, 5.5f));
+
+    /* Quaternions are normalized */
+    Track<Quaternion> rotation{{0.0f, 1.0f, 2.0f}, {
+        Quaternion::rotation(Deg(0.0f), Vector3::zAxis()),
+        Quaternion::rotation(Deg(45.0f), Vector3::zAxis()),
+        Quaternion::rotation(Deg(90.0f), Vector3::zAxis())}, TrackInterpolation::Cubic};
+    CORRADE_VERIFY(rotation.at(0.3f).isNormalized());
+    CORRADE_COMPARE(rotation.at(1.0f), Quaternion::rotation(Deg(45.0f), Vector3::zAxis()));
+}
+
+void TrackTest::singleKeyframe() {
+    Track<Float> track{{1.0f}, {3.5f}, TrackInterpolation::Cubic};
+    std::size_t hint = 5;
+    CORRADE_COMPARE(track.at(0.0f, hint), 3.5f);
+    CORRADE_COMPARE(track.at(7.0f, hint), 3.5f);
+    CORRADE_COMPARE(hint, 0);
+    CORRADE_COMPARE(track.duration(), 0.0f);
+}
+
+void TrackTest::sampler() {
+    Scene3D scene;
+    Object3D root{&scene};
+    Object3D child{&root};
+    Object3D other{&scene};
+
+    Track<Vector3> translation{{0.0f, 2.0f}, {{}, {4.0f, 0.0f, 0.0f}}};
+    Track<Quaternion> rotation{{0.0f, 1.0f}, {
+        Quaternion(),
+        Quaternion::rotation(Deg(90.0f), Vector3::zAxis())}, TrackInterpolation::Spherical};
+    Track<Vector3> scaling{{0.0f, 3.0f}, {Vector3{1.0f}, Vector3{4.0f}}};
+
+    TrackSampler<MatrixTransformation3D> sampler;
+    CORRADE_COMPARE(sampler.size(), 0);
+    CORRADE_COMPARE(sampler.end(), 0.0f);
+    sampler.add(root, &translation, &rotation)
+        .add(child, nullptr, &rotation, &scaling)
+        .add(other, &translation, nullptr);
+    CORRADE_COMPARE(sampler.size(), 3);
+    CORRADE_VERIFY(&sampler.object(1) == &child);
+    CORRADE_COMPARE(sampler.end(), 3.0f);
+
+    /* Shared tracks sampled for each object separately */
+    sampler.sample(0.5f);
+    const Matrix4 halfway = Matrix4::rotationZ(Deg(45.0f));
+    CORRADE_COMPARE(root.transformationMatrix(),
+        Matrix4::translation({1.0f, 0.0f, 0.0f})*halfway);
+    CORRADE_COMPARE(child.transformationMatrix(),
+        halfway*Matrix4::scaling(Vector3{1.5f}));
+    CORRADE_COMPARE(other.transformationMatrix(),
+        Matrix4::translation({1.0f, 0.0f, 0.0f}));
+
+    /* Sets the object dirty, absolute transformation updated */
+    sampler.sample(2.0f);
+    CORRADE_VERIFY(child.isDirty());
+    CORRADE_COMPARE(child.absoluteTransformationMatrix(),
+        Matrix4::translation({4.0f, 0.0f, 0.0f})*Matrix4::rotationZ(Deg(180.0f))*Matrix4::scaling(Vector3{3.0f}));
+}
+
+void TrackTest::samplerRigid() {
+    typedef Object<DualQuaternionTransformation> Object3D;
+
+    Object3D object;
+    Track<Vector3> translation{{0.0f, 1.0f}, {{}, {0.0f, 2.0f, 0.0f}}};
+    Track<Quaternion> rotation{{0.0f, 1.0f}, {
+        Quaternion(), Quaternion::rotation(Deg(90.0f), Vector3::xAxis())}, TrackInterpolation::Spherical};
+
+    TrackSampler<DualQuaternionTransformation> sampler;
+    sampler.add(object, &translation, &rotation);
+    sampler.sample(0.5f);
+    CORRADE_COMPARE(object.transformation(),
+        DualQuaternion::translation({0.0f, 1.0f, 0.0f})*DualQuaternion::rotation(Deg(45.0f), Vector3::xAxis()));
+
+    /* The rotation is used directly, without a round trip through a matrix */
+    const Quaternion expected = rotation.at(0.5f);
+    const Quaternion actual = object.transformation().rotation();
+    CORRADE_VERIFY(actual.vector().x() == expected.vector().x());
+    CORRADE_VERIFY(actual.vector().y() == expected.vector().y());
+    CORRADE_VERIFY(actual.vector().z() == expected.vector().z());
+    CORRADE_VERIFY(actual.scalar() == expected.scalar());
+}
+
+void TrackTest::samplerClear() {
+    Object3D object;
+    object.translate({1.0f, 2.0f, 3.0f});
+    Track<Vector3> translation{{0.0f, 1.0f}, {{}, {0.0f, 2.0f, 0.0f}}};
+
+    TrackSampler<MatrixTransformation3D> sampler;
+    sampler.add(object, &translation, nullptr);
+    sampler.clear();
+    CORRADE_COMPARE(sampler.size(), 0);
+    CORRADE_COMPARE(sampler.end(), 0.0f);
+
+    /* No object to animate */
+    sampler.sample(0.5f);
+    CORRADE_COMPARE(object.transformationMatrix(), Matrix4::translation({1.0f, 2.0f, 3.0f}));
+}
+
+void TrackTest::debugInterpolation() {
+    std::ostringstream o;
+    Debug(&o) << TrackInterpolation::Spherical << TrackInterpolation(0xde);
+    CORRADE_COMPARE(o.str(), "SceneGraph::TrackInterpolation::Spherical SceneGraph::TrackInterpolation::(invalid)\n");
+}
+
+}}}
+
+CORRADE_TEST_MAIN(Magnum::SceneGraph::Test::TrackTest)
@@ -0,0 +1,129 @@
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#include <Corrade/TestSuite/Tester.h>
+
+#include "Magnum/SceneGraph/DualQuaternionTransformation.h"
+#include "Magnum/SceneGraph/MatrixTransformation3D.h"
+#include "Magnum/SceneGraph/RigidMatrixTransformation3D.h"
+#include "Magnum/SceneGraph/Scene.h"
+#include "Magnum/Test/Benchmark.h"
+
+namespace Magnum { namespace SceneGraph { namespace Test {
+
+struct TransformationBenchmark: TestSuite::Tester {
+    explicit TransformationBenchmark();
+
+    void deepMatrix();
+    void deepRigidMatrix();
+    void deepDualQuaternion();
+    void wideMatrix();
+    void wideRigidMatrix();
+    void wideDualQuaternion();
+
+    private:
+        template<class Transformation> void benchmark(const char* name, std::size_t chainLength);
+};
+
+namespace {
+    template<class> struct TransformationName;
+    template<> struct TransformationName<MatrixTransformation3D> {
+        static const char* name() { return "MatrixTransformation3D"; }
+    };
+    template<> struct TransformationName<RigidMatrixTransformation3D> {
+        static const char* name() { return "RigidMatrixTransformation3D"; }
+    };
+    template<> struct TransformationName<DualQuaternionTransformation> {
+        static const char* name() { return "DualQuaternionTransformation"; }
+    };
+
+    enum: std::size_t { ObjectCount = 200000 };
+}
+
+TransformationBenchmark::TransformationBenchmark() {
+    addTests({&TransformationBenchmark::deepMatrix,
+              &TransformationBenchmark::deepRigidMatrix,
+              &TransformationBenchmark::deepDualQuaternion,
+              &TransformationBenchmark::wideMatrix,
+              &TransformationBenchmark::wideRigidMatrix,
+              &TransformationBenchmark::wideDualQuaternion});
+}
+
+/* Long chains, similar to skeletal hierarchies */
+void TransformationBenchmark::deepMatrix() {
+    benchmark<MatrixTransformation3D>("deep", 100);
+}
+
+void TransformationBenchmark::deepRigidMatrix() {
+    benchmark<RigidMatrixTransformation3D>("deep", 100);
+}
+
+void TransformationBenchmark::deepDualQuaternion() {
+    benchmark<DualQuaternionTransformation>("deep", 100);
+}
+
+/* Objects attached directly to the scene or to one parent, similar to props
+   or vegetation */
+void TransformationBenchmark::wideMatrix() {
+    benchmark<MatrixTransformation3D>("wide", 2);
+}
+
+void TransformationBenchmark::wideRigidMatrix() {
+    benchmark<RigidMatrixTransformation3D>("wide", 2);
+}
+
+void TransformationBenchmark::wideDualQuaternion() {
+    benchmark<DualQuaternionTransformation>("wide", 2);
+}
+
+template<class Transformation> void TransformationBenchmark::benchmark(const char* name, const std::size_t chainLength) {
+    Scene<Transformation> scene;
+    std::vector<std::reference_wrapper<Object<Transformation>>> objects;
+    objects.reserve(ObjectCount);
+    Object<Transformation>* parent = &scene;
+    for(std::size_t i = 0; i != ObjectCount; ++i) {
+        if(i % chainLength == 0) parent = &scene;
+        auto* o = new Object<Transformation>{parent};
+        o->rotate(Deg(Float(i % 360)), Vector3(1.0f, 2.0f, -2.0f).normalized())
+          .translate({Float(i % 17)*0.01f, Float(i % 5)*0.01f, Float(i % 11)*0.01f});
+        objects.push_back(*o);
+        parent = o;
+    }
+
+    std::vector<Matrix4> transformations;
+    const std::int64_t time = Magnum::Test::measure([&]() {
+        scene.transformationMatrices(objects, transformations);
+    });
+
+    CORRADE_COMPARE(transformations.size(), std::size_t(ObjectCount));
+    CORRADE_COMPARE(transformations[chainLength - 1], objects[chainLength - 1].get().absoluteTransformationMatrix());
+
+    Debug() << TransformationName<Transformation>::name() << "on" << name << "hierarchy:"
+        << time << "us";
+}
+
+}}}
+
+CORRADE_TEST_MAIN(Magnum::SceneGraph::Test::TransformationBenchmark)
@@ -0,0 +1,98 @@
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#include "ThreadPool.h"
+
+#include <algorithm>
+
+namespace Magnum { namespace SceneGraph {
+
+ThreadPool::ThreadPool(UnsignedInt threadCount): _work{}, _workContext{}, _count{}, _generation{}, _pending{}, _quit{false} {
+    if(!threadCount) threadCount = std::max(std::thread::hardware_concurrency(), 1u);
+
+    /* The calling thread processes one chunk as well */
+    _threads.reserve(threadCount - 1);
+    for(UnsignedInt i = 1; i != threadCount; ++i)
+        _threads.emplace_back(&ThreadPool::worker, this, i);
+}
+
+ThreadPool::~ThreadPool() {
+    {
+        std::lock_guard<std::mutex> lock{_mutex};
+        _quit = true;
+    }
+    _workAvailable.notify_all();
+
+    for(std::thread& thread: _threads) thread.join();
+}
+
+void ThreadPool::runInternal(const std::size_t count, const Work work, const void* const context) {
+    /* Not worth waking up the threads */
+    if(_threads.empty() || count < 2) {
+        if(count) work(context, 0, count);
+        return;
+    }
+
+    {
+        std::lock_guard<std::mutex> lock{_mutex};
+        _work = work;
+        _workContext = context;
+        _count = count;
+        _pending = _threads.size();
+        ++_generation;
+    }
+    _workAvailable.notify_all();
+
+    /* First chunk is processed by the calling thread */
+    work(context, 0, count/threadCount());
+
+    std::unique_lock<std::mutex> lock{_mutex};
+    _workDone.wait(lock, [this]() { return _pending == 0; });
+    _work = nullptr;
+    _workContext = nullptr;
+}
+
+void ThreadPool::worker(const UnsignedInt id) {
+    UnsignedLong generation = 0;
+    for(;;) {
+        std::unique_lock<std::mutex> lock{_mutex};
+        _workAvailable.wait(lock, [this, generation]() { return _quit || _generation != generation; });
+        if(_quit) return;
+
+        generation = _generation;
+        const Work work = _work;
+        const void* const context = _workContext;
+        const std::size_t begin = _count*id/threadCount();
+        const std::size_t end = _count*(id + 1)/threadCount();
+        lock.unlock();
+
+        if(begin != end) work(context, begin, end);
+
+        lock.lock();
+        if(--_pending == 0) _workDone.notify_one();
+    }
+}
+
+}}
@@ -0,0 +1,134 @@
+#ifndef Magnum_SceneGraph_ThreadPool_h
+#define Magnum_SceneGraph_ThreadPool_h
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+
+/** @file
+ * @brief Class @ref Magnum::SceneGraph::ThreadPool
+ */
+
+#include "Magnum/configure.h"
+
+#if defined(MAGNUM_BUILD_MULTITHREADED) || defined(DOXYGEN_GENERATING_OUTPUT)
+#include <condition_variable>
+#include <mutex>
+#include <thread>
+#include <type_traits>
+#include <vector>
+
+#include "Magnum/Magnum.h"
+#include "Magnum/SceneGraph/visibility.h"
+
+namespace Magnum { namespace SceneGraph {
+
+/**
+@brief Thread pool
+
+Set of persistent worker threads used for computing transformations of large
+object groups in parallel, see @ref Scene::setThreadPool() for more
+information. The threads are created in constructor and wait for work until
+the pool is destroyed.
+
+@note This class is available only if Magnum is compiled with
+    `BUILD_MULTITHREADED` enabled. See @ref building-features
+    for more information.
+*/
+class MAGNUM_SCENEGRAPH_EXPORT ThreadPool {
+    public:
+        /**
+         * @brief Constructor
+         * @param threadCount   Count of threads executing the work, including
+         *      the calling thread. If `0`, `std::thread::hardware_concurrency()`
+         *      is used.
+         */
+        explicit ThreadPool(UnsignedInt threadCount = 0);
+
+        /** @brief Copying is not allowed */
+        ThreadPool(const ThreadPool&) = delete;
+
+        /** @brief Moving is not allowed */
+        ThreadPool(ThreadPool&&) = delete;
+
+        /**
+         * @brief Destructor
+         *
+         * Waits for the worker threads to finish.
+         */
+        ~ThreadPool();
+
+        /** @brief Copying is not allowed */
+        ThreadPool& operator=(const ThreadPool&) = delete;
+
+        /** @brief Moving is not allowed */
+        ThreadPool& operator=(ThreadPool&&) = delete;
+
+        /** @brief Count of threads executing the work, including calling thread */
+        UnsignedInt threadCount() const { return _threads.size() + 1; }
+
+        /**
+         * @brief Execute work in parallel
+         * @param count     Count of items to process
+         * @param work      Function processing items in range `[begin, end)`
+         *
+         * Splits the range into @ref threadCount() contiguous chunks and calls
+         * @p work for each of them, one chunk is processed in the calling
+         * thread. Returns after all chunks are processed. Not reentrant, the
+         * function must not be called from multiple threads at once.
+         *
+         * The @p work callable is taken by reference and isn't copied or
+         * type-erased into an allocating wrapper, so capturing lambdas can
+         * be passed without any allocation.
+         */
+        template<class F> void run(std::size_t count, F&& work) {
+            runInternal(count, [](const void* context, std::size_t begin, std::size_t end) {
+                (*static_cast<typename std::remove_reference<F>::type*>(const_cast<void*>(context)))(begin, end);
+            }, &work);
+        }
+
+    private:
+        typedef void(*Work)(const void*, std::size_t, std::size_t);
+
+        void runInternal(std::size_t count, Work work, const void* context);
+        void MAGNUM_SCENEGRAPH_LOCAL worker(UnsignedInt id);
+
+        std::vector<std::thread> _threads;
+        std::mutex _mutex;
+        std::condition_variable _workAvailable, _workDone;
+
+        Work _work;
+        const void* _workContext;
+        std::size_t _count;
+        UnsignedLong _generation;
+        UnsignedInt _pending;
+        bool _quit;
+};
+
+}}
+#else
+#error this header is available only on multithreaded build
+#endif
+
+#endif
@@ -0,0 +1,70 @@
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#include "Track.h"
+
+#include <algorithm>
+#include <Corrade/Utility/Debug.h>
+
+namespace Magnum { namespace SceneGraph {
+
+Debug& operator<<(Debug& debug, const TrackInterpolation value) {
+    switch(value) {
+        #define _c(value) case TrackInterpolation::value: return debug << "SceneGraph::TrackInterpolation::" #value;
+        _c(Step)
+        _c(Linear)
+        _c(Spherical)
+        _c(Cubic)
+        #undef _c
+    }
+
+    return debug << "SceneGraph::TrackInterpolation::(invalid)";
+}
+
+namespace Implementation {
+
+std::size_t trackKeyframe(const std::vector<Float>& keys, const Float time, std::size_t hint) {
+    if(keys.size() < 2) return 0;
+
+    /* Last keyframe which has a next one */
+    const std::size_t last = keys.size() - 2;
+    if(hint > last) hint = last;
+
+    /* Playing forward, the time is usually in the hinted segment or the one
+       right after it */
+    if(keys[hint] <= time) {
+        if(hint == last || time < keys[hint + 1]) return hint;
+        if(hint + 1 == last || time < keys[hint + 2]) return hint + 1;
+    }
+
+    /* First key greater than the time, the segment starts right before it.
+       Times before the first key map to the first segment, times after the
+       last key to the last segment. */
+    return std::upper_bound(keys.begin() + 1, keys.end() - 1, time) - keys.begin() - 1;
+}
+
+}
+
+}}
@@ -0,0 +1,258 @@
+#ifndef Magnum_SceneGraph_Track_h
+#define Magnum_SceneGraph_Track_h
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+/** @file
+ * @brief Class @ref Magnum::SceneGraph::Track, enum @ref Magnum::SceneGraph::TrackInterpolation
+ */
+
+#include <vector>
+#include <Corrade/Utility/Assert.h>
+
+#include "Magnum/Magnum.h"
+#include "Magnum/Math/Functions.h"
+#include "Magnum/Math/Quaternion.h"
+#include "Magnum/SceneGraph/SceneGraph.h"
+#include "Magnum/SceneGraph/visibility.h"
+
+namespace Magnum { namespace SceneGraph {
+
+/**
+@brief Track interpolation
+
+@see @ref Track::interpolation()
+*/
+enum class TrackInterpolation: UnsignedByte {
+    /** Value of the previous keyframe is used until the next one. */
+    Step,
+
+    /**
+     * Linear interpolation between neighboring keyframes. Quaternions are
+     * interpolated using normalized linear interpolation, see
+     * @ref Math::lerp(const Quaternion<T>&, const Quaternion<T>&, T).
+     */
+    Linear,
+
+    /**
+     * Spherical linear interpolation of quaternions, see
+     * @ref Math::slerp(). For other types same as
+     * @ref TrackInterpolation::Linear.
+     */
+    Spherical,
+
+    /**
+     * Cubic Hermite interpolation with tangents calculated from neighboring
+     * keyframes (Catmull-Rom spline). Quaternions are normalized after the
+     * interpolation.
+     */
+    Cubic
+};
+
+/** @debugoperatorenum{Magnum::SceneGraph::TrackInterpolation} */
+MAGNUM_SCENEGRAPH_EXPORT Debug& operator<<(Debug& debug, TrackInterpolation value);
+
+namespace Implementation {
+    /* Index of keyframe at or before given time, clamped so the next keyframe
+       always exists. Checks the hint and the keyframe after it first, falls
+       back to binary search. */
+    MAGNUM_SCENEGRAPH_EXPORT std::size_t trackKeyframe(const std::vector<Float>& keys, Float time, std::size_t hint);
+
+    template<class V> struct TrackTraits {
+        static void prepare(std::vector<V>&) {}
+        static V normalize(const V& value) { return value; }
+        static V slerp(const V& a, const V& b, Float t) { return a + (b - a)*t; }
+    };
+
+    template<class T> struct TrackTraits<Math::Quaternion<T>> {
+        /* Flip neighboring keyframes into the same hemisphere so the
+           interpolation always takes the shortest path */
+        static void prepare(std::vector<Math::Quaternion<T>>& values) {
+            for(std::size_t i = 1; i < values.size(); ++i)
+                if(Math::dot(values[i - 1], values[i]) < T(0))
+                    values[i] = -values[i];
+        }
+
+        static Math::Quaternion<T> normalize(const Math::Quaternion<T>& value) {
+            return value.normalized();
+        }
+
+        /* Math::slerp() without the assertions and with lerp fallback for
+           nearly identical rotations, where sin() of the angle is zero */
+        static Math::Quaternion<T> slerp(const Math::Quaternion<T>& a, const Math::Quaternion<T>& b, Float t) {
+            const T cosAngle = Math::dot(a, b);
+            if(cosAngle > T(0.9995))
+                return (a + (b - a)*t).normalized();
+            const T angle = std::acos(cosAngle);
+            return (std::sin((T(1) - t)*angle)*a + std::sin(t*angle)*b)/std::sin(angle);
+        }
+    };
+}
+
+/**
+@brief Keyframe track
+@tparam V   Value type, e.g. @ref Magnum::Vector3 "Vector3" or
+    @ref Magnum::Quaternion "Quaternion"
+
+Stores keyframe times and values in two separate contiguous arrays, so
+looking up the keyframe touches only the times. Sampled with @ref at(),
+optionally with a cursor hint, which makes the lookup constant-time for
+playback going forward. Sampling outside of keyframe range returns value of
+the first or last keyframe, looping is up to the caller.
+
+For animating whole object hierarchies (e.g. skeletons) see
+@ref TrackSampler, which samples many tracks at once and writes the result
+directly into object transformations.
+@code
+SceneGraph::Track<Vector3> translation{
+    {0.0f, 1.0f, 2.5f},
+    {{}, Vector3::xAxis(2.0f), Vector3::yAxis(1.0f)},
+    SceneGraph::TrackInterpolation::Cubic};
+
+std::size_t hint = 0;
+Vector3 position = translation.at(0.75f, hint);
+@endcode
+@see @ref scenegraph
+*/
+template<class V> class Track {
+    public:
+        /** @brief Value type */
+        typedef V ValueType;
+
+        /**
+         * @brief Constructor
+         * @param keys          Keyframe times
+         * @param values        Keyframe values
+         * @param interpolation Interpolation between the keyframes
+         *
+         * Expects that there is at least one keyframe, the key and value
+         * counts are the same and the keys are sorted in ascending order.
+         * Quaternion keyframes are expected to be normalized, consecutive
+         * quaternion keyframes are negated if needed so the interpolation
+         * always takes the shortest path.
+         */
+        explicit Track(std::vector<Float> keys, std::vector<V> values, TrackInterpolation interpolation = TrackInterpolation::Linear);
+
+        /** @brief Keyframe times */
+        const std::vector<Float>& keys() const { return _keys; }
+
+        /** @brief Keyframe values */
+        const std::vector<V>& values() const { return _values; }
+
+        /** @brief Interpolation */
+        TrackInterpolation interpolation() const { return _interpolation; }
+
+        /** @brief Time of first keyframe */
+        Float begin() const { return _keys.front(); }
+
+        /** @brief Time of last keyframe */
+        Float end() const { return _keys.back(); }
+
+        /** @brief Track duration */
+        Float duration() const { return _keys.back() - _keys.front(); }
+
+        /**
+         * @brief Sample the track
+         * @param time      Time at which to sample
+         * @param hint      Keyframe index found in previous call, updated
+         *      with the current one
+         *
+         * If the @p time is between the hinted keyframe and the one after
+         * it, the lookup is done in constant time, otherwise using binary
+         * search. Keep one hint per playback position.
+         */
+        V at(Float time, std::size_t& hint) const;
+
+        /**
+         * @brief Sample the track without a hint
+         *
+         * The keyframe is looked up using binary search.
+         */
+        V at(Float time) const {
+            std::size_t hint = 0;
+            return at(time, hint);
+        }
+
+    private:
+        std::vector<Float> _keys;
+        std::vector<V> _values;
+        TrackInterpolation _interpolation;
+};
+
+template<class V> Track<V>::Track(std::vector<Float> keys, std::vector<V> values, const TrackInterpolation interpolation): _keys{std::move(keys)}, _values{std::move(values)}, _interpolation{interpolation} {
+    CORRADE_ASSERT(!_keys.empty() && _keys.size() == _values.size(),
+        "SceneGraph::Track: expected the same non-zero count of keys and values but got" << _keys.size() << "and" << _values.size(), );
+    #ifndef CORRADE_NO_ASSERT
+    for(std::size_t i = 1; i < _keys.size(); ++i)
+        CORRADE_ASSERT(_keys[i - 1] <= _keys[i],
+            "SceneGraph::Track: keys are not sorted", );
+    #endif
+
+    Implementation::TrackTraits<V>::prepare(_values);
+}
+
+template<class V> V Track<V>::at(const Float time, std::size_t& hint) const {
+    const std::size_t i = hint = Implementation::trackKeyframe(_keys, time, hint);
+    if(_keys.size() == 1) return _values[0];
+
+    /* Interpolation phase, clamped for times outside of the keyframe range */
+    const Float k1 = _keys[i], k2 = _keys[i + 1];
+    const Float t = k2 > k1 ? Math::max(Math::min((time - k1)/(k2 - k1), 1.0f), 0.0f) : 1.0f;
+    const V& v1 = _values[i];
+    const V& v2 = _values[i + 1];
+
+    switch(_interpolation) {
+        case TrackInterpolation::Step:
+            return t < 1.0f ? v1 : v2;
+
+        case TrackInterpolation::Linear:
+            return Implementation::TrackTraits<V>::normalize(v1 + (v2 - v1)*t);
+
+        case TrackInterpolation::Spherical:
+            return Implementation::TrackTraits<V>::slerp(v1, v2, t);
+
+        case TrackInterpolation::Cubic: {
+            /* Tangents from neighboring keyframes, scaled to the segment
+               duration, one-sided at the track ends */
+            const std::size_t i0 = i ? i - 1 : i;
+            const std::size_t i3 = i + 2 < _keys.size() ? i + 2 : i + 1;
+            const Float duration = k2 - k1;
+            const Float d1 = _keys[i + 1] - _keys[i0], d2 = _keys[i3] - _keys[i];
+            const V m1 = (v2 - _values[i0])*(d1 > 0.0f ? duration/d1 : 0.0f);
+            const V m2 = (_values[i3] - v1)*(d2 > 0.0f ? duration/d2 : 0.0f);
+
+            const Float t2 = t*t, t3 = t2*t;
+            return Implementation::TrackTraits<V>::normalize(
+                v1*(2.0f*t3 - 3.0f*t2 + 1.0f) + m1*(t3 - 2.0f*t2 + t) +
+                v2*(-2.0f*t3 + 3.0f*t2) + m2*(t3 - t2));
+        }
+    }
+
+    CORRADE_ASSERT_UNREACHABLE();
+}
+
+}}
+
+#endif
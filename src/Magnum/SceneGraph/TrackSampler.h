@@ -0,0 +1,162 @@
+#ifndef Magnum_SceneGraph_TrackSampler_h
+#define Magnum_SceneGraph_TrackSampler_h
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+/** @file
+ * @brief Class @ref Magnum::SceneGraph::TrackSampler
+ */
+
+#include <vector>
+
+#include "Magnum/Math/Vector3.h"
+#include "Magnum/SceneGraph/Track.h"
+
+namespace Magnum { namespace SceneGraph {
+
+/**
+@brief Batched keyframe track sampler
+@tparam Transformation  Object transformation, three-dimensional
+
+Samples translation, rotation and scaling @ref Track "tracks" of many
+objects at once (for example all bones of skinned characters) and writes the
+result directly into transformations of given objects. The sampling is done
+in separate passes over all channels, first looking up keyframes and
+interpolating each track type, then composing and setting the
+transformations. Each channel keeps its own keyframe hints, so the same
+tracks can be shared among many channels played at different times.
+
+Missing tracks are treated as identity, i.e. zero translation, identity
+rotation and unit scaling. Scaling tracks are supported only with
+transformations allowing scaling, such as @ref MatrixTransformation3D. For
+@ref DualQuaternionTransformation the result is built directly from the
+sampled rotation and translation, without going through a matrix.
+Call @ref sample() from e.g. @ref Animable::animationStep():
+@code
+SceneGraph::Track<Vector3> translation{...};
+SceneGraph::Track<Quaternion> rotation{...};
+
+SceneGraph::TrackSampler<SceneGraph::MatrixTransformation3D> sampler;
+sampler.add(hand, &translation, &rotation)
+    .add(finger, nullptr, &rotation);
+
+void Character::animationStep(Float time, Float) {
+    sampler.sample(time);
+}
+@endcode
+
+The sampler doesn't own the objects or the tracks, they must be available
+for the whole lifetime of the sampler (or until @ref clear() is called).
+
+## Explicit template specializations
+
+The following specializations are explicitly compiled into @ref SceneGraph
+library. For other specializations (e.g. using @ref Magnum::Double "Double"
+type) you have to use @ref TrackSampler.hpp implementation file to avoid
+linker errors. See also @ref compilation-speedup-hpp for more information.
+
+-   @ref TrackSampler "TrackSampler<MatrixTransformation3D>"
+-   @ref TrackSampler "TrackSampler<RigidMatrixTransformation3D>"
+-   @ref TrackSampler "TrackSampler<DualQuaternionTransformation>"
+
+@see @ref scenegraph, @ref Animable
+*/
+template<class Transformation> class TrackSampler {
+    static_assert(Transformation::Dimensions == 3, "SceneGraph::TrackSampler: only three-dimensional transformations are supported");
+
+    public:
+        /** @brief Underlying floating-point type */
+        typedef typename Transformation::Type Type;
+
+        /** @brief Translation and scaling track type */
+        typedef Track<Math::Vector3<Type>> VectorTrack;
+
+        /** @brief Rotation track type */
+        typedef Track<Math::Quaternion<Type>> RotationTrack;
+
+        explicit TrackSampler();
+
+        /** @brief Count of animated objects */
+        std::size_t size() const { return _objects.size(); }
+
+        /** @brief Animated object */
+        Object<Transformation>& object(std::size_t id) { return *_objects[id]; }
+        const Object<Transformation>& object(std::size_t id) const { return *_objects[id]; } /**< @overload */
+
+        /**
+         * @brief Time of last keyframe
+         *
+         * Maximum of @ref Track::end() of all added tracks, `0.0f` if there
+         * are no tracks.
+         */
+        Float end() const { return _end; }
+
+        /**
+         * @brief Add animated object
+         * @param object        Object to animate
+         * @param translation   Translation track or `nullptr`
+         * @param rotation      Rotation track or `nullptr`
+         * @param scaling       Scaling track or `nullptr`
+         * @return Reference to self (for method chaining)
+         */
+        TrackSampler<Transformation>& add(Object<Transformation>& object, const VectorTrack* translation, const RotationTrack* rotation, const VectorTrack* scaling = nullptr);
+
+        /**
+         * @brief Remove all objects
+         * @return Reference to self (for method chaining)
+         */
+        TrackSampler<Transformation>& clear();
+
+        /**
+         * @brief Sample the tracks and set object transformations
+         *
+         * Samples all tracks at given @p time and sets the composed
+         * transformation on each object.
+         */
+        void sample(Float time);
+
+    private:
+        Float _end;
+
+        /* Channels */
+        std::vector<Object<Transformation>*> _objects;
+        std::vector<const VectorTrack*> _translationTracks, _scalingTracks;
+        std::vector<const RotationTrack*> _rotationTracks;
+        std::vector<std::size_t> _translationHints, _rotationHints, _scalingHints;
+
+        /* Sampled values, kept between calls to avoid allocations */
+        std::vector<Math::Vector3<Type>> _translations, _scalings;
+        std::vector<Math::Quaternion<Type>> _rotations;
+};
+
+#if defined(CORRADE_TARGET_WINDOWS) && !defined(__MINGW32__)
+extern template class MAGNUM_SCENEGRAPH_EXPORT TrackSampler<BasicMatrixTransformation3D<Float>>;
+extern template class MAGNUM_SCENEGRAPH_EXPORT TrackSampler<BasicRigidMatrixTransformation3D<Float>>;
+extern template class MAGNUM_SCENEGRAPH_EXPORT TrackSampler<BasicDualQuaternionTransformation<Float>>;
+#endif
+
+}}
+
+#endif
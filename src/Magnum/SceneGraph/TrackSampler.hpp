@@ -0,0 +1,114 @@
+#ifndef Magnum_SceneGraph_TrackSampler_hpp
+#define Magnum_SceneGraph_TrackSampler_hpp
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+/** @file
+ * @brief @ref compilation-speedup-hpp "Template implementation" for @ref TrackSampler.h
+ */
+
+#include "Magnum/Math/DualQuaternion.h"
+#include "Magnum/Math/Matrix4.h"
+#include "Magnum/SceneGraph/Object.h"
+#include "Magnum/SceneGraph/TrackSampler.h"
+
+namespace Magnum { namespace SceneGraph {
+
+namespace Implementation {
+    /* Composing the sampled values. Rotation matrix columns are scaled
+       directly instead of multiplying by scaling matrix. */
+    template<class TransformationType> struct TrackSamplerComposer {
+        typedef typename TransformationType::Type T;
+
+        static typename TransformationType::DataType compose(const Math::Vector3<T>& translation, const Math::Quaternion<T>& rotation, const Math::Vector3<T>& scaling) {
+            Math::Matrix3x3<T> rotationScaling = rotation.toMatrix();
+            rotationScaling[0] *= scaling.x();
+            rotationScaling[1] *= scaling.y();
+            rotationScaling[2] *= scaling.z();
+            return Transformation<TransformationType>::fromMatrix(Math::Matrix4<T>::from(rotationScaling, translation));
+        }
+    };
+
+    /* Dual quaternions are built directly from the rotation to avoid a lossy
+       and slow round trip through a matrix. Scaling is not supported. */
+    template<class T> struct TrackSamplerComposer<BasicDualQuaternionTransformation<T>> {
+        static Math::DualQuaternion<T> compose(const Math::Vector3<T>& translation, const Math::Quaternion<T>& rotation, const Math::Vector3<T>&) {
+            return Math::DualQuaternion<T>::translation(translation)*Math::DualQuaternion<T>{rotation};
+        }
+    };
+
+    template<class V> void sampleTracks(const std::vector<const Track<V>*>& tracks, std::vector<std::size_t>& hints, std::vector<V>& values, const Float time, const V& defaultValue) {
+        for(std::size_t i = 0; i != tracks.size(); ++i)
+            values[i] = tracks[i] ? tracks[i]->at(time, hints[i]) : defaultValue;
+    }
+}
+
+template<class Transformation> TrackSampler<Transformation>::TrackSampler(): _end{} {}
+
+template<class Transformation> TrackSampler<Transformation>& TrackSampler<Transformation>::add(Object<Transformation>& object, const VectorTrack* const translation, const RotationTrack* const rotation, const VectorTrack* const scaling) {
+    _objects.push_back(&object);
+    _translationTracks.push_back(translation);
+    _rotationTracks.push_back(rotation);
+    _scalingTracks.push_back(scaling);
+    _translationHints.push_back(0);
+    _rotationHints.push_back(0);
+    _scalingHints.push_back(0);
+
+    if(translation) _end = Math::max(_end, translation->end());
+    if(rotation) _end = Math::max(_end, rotation->end());
+    if(scaling) _end = Math::max(_end, scaling->end());
+    return *this;
+}
+
+template<class Transformation> TrackSampler<Transformation>& TrackSampler<Transformation>::clear() {
+    _end = 0.0f;
+    _objects.clear();
+    _translationTracks.clear();
+    _rotationTracks.clear();
+    _scalingTracks.clear();
+    _translationHints.clear();
+    _rotationHints.clear();
+    _scalingHints.clear();
+    return *this;
+}
+
+template<class Transformation> void TrackSampler<Transformation>::sample(const Float time) {
+    _translations.resize(_objects.size());
+    _rotations.resize(_objects.size());
+    _scalings.resize(_objects.size());
+
+    /* Sample each track type in a separate pass */
+    Implementation::sampleTracks(_translationTracks, _translationHints, _translations, time, Math::Vector3<Type>{});
+    Implementation::sampleTracks(_rotationTracks, _rotationHints, _rotations, time, Math::Quaternion<Type>{});
+    Implementation::sampleTracks(_scalingTracks, _scalingHints, _scalings, time, Math::Vector3<Type>{Type(1)});
+
+    /* Compose the transformations */
+    for(std::size_t i = 0; i != _objects.size(); ++i)
+        _objects[i]->setTransformation(Implementation::TrackSamplerComposer<Transformation>::compose(_translations[i], _rotations[i], _scalings[i]));
+}
+
+}}
+
+#endif
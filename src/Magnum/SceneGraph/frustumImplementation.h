@@ -0,0 +1,49 @@
+#ifndef Magnum_SceneGraph_frustumImplementation_h
+#define Magnum_SceneGraph_frustumImplementation_h
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#include "Magnum/DimensionTraits.h"
+#include "Magnum/Math/Matrix3.h"
+#include "Magnum/Math/Matrix4.h"
+
+namespace Magnum { namespace SceneGraph { namespace Implementation {
+
+/* Frustum planes extracted from (camera-relative) projection matrix, in order
+   left, right, bottom, top (, near, far). Point `p` is inside if
+   `dot(plane.xyz, p) + plane.w >= 0` for all planes. Shared by Camera,
+   SpatialIndex and InstancedDrawable culling. */
+template<UnsignedInt dimensions, class T> void frustumPlanes(const MatrixTypeFor<dimensions, T>& projectionMatrix, Math::Vector<dimensions + 1, T>(&planes)[dimensions*2]) {
+    const Math::Vector<dimensions + 1, T> w = projectionMatrix.row(dimensions);
+    for(UnsignedInt i = 0; i != dimensions; ++i) {
+        const Math::Vector<dimensions + 1, T> row = projectionMatrix.row(i);
+        planes[2*i] = w + row;
+        planes[2*i + 1] = w - row;
+    }
+}
+
+}}}
+
+#endif
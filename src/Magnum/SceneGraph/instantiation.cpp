@@ -30,11 +30,15 @@
 #include "Magnum/SceneGraph/DualComplexTransformation.h"
 #include "Magnum/SceneGraph/DualQuaternionTransformation.h"
 #include "Magnum/SceneGraph/FeatureGroup.hpp"
+#include "Magnum/SceneGraph/FlatScene.hpp"
+#include "Magnum/SceneGraph/InstancedDrawable.hpp"
 #include "Magnum/SceneGraph/MatrixTransformation2D.h"
 #include "Magnum/SceneGraph/MatrixTransformation3D.h"
 #include "Magnum/SceneGraph/Object.hpp"
 #include "Magnum/SceneGraph/RigidMatrixTransformation2D.h"
 #include "Magnum/SceneGraph/RigidMatrixTransformation3D.h"
+#include "Magnum/SceneGraph/SpatialIndex.hpp"
+#include "Magnum/SceneGraph/TrackSampler.hpp"
 #include "Magnum/SceneGraph/TranslationTransformation.h"
 
 namespace Magnum { namespace SceneGraph {
@@ -69,6 +73,14 @@ template class MAGNUM_SCENEGRAPH_EXPORT_HPP Camera<3, Float>;
 template class MAGNUM_SCENEGRAPH_EXPORT_HPP Drawable<2, Float>;
 template class MAGNUM_SCENEGRAPH_EXPORT_HPP Drawable<3, Float>;
 
+template class MAGNUM_SCENEGRAPH_EXPORT_HPP FlatObject<2, Float>;
+template class MAGNUM_SCENEGRAPH_EXPORT_HPP FlatObject<3, Float>;
+template class MAGNUM_SCENEGRAPH_EXPORT_HPP FlatScene<2, Float>;
+template class MAGNUM_SCENEGRAPH_EXPORT_HPP FlatScene<3, Float>;
+
+template class MAGNUM_SCENEGRAPH_EXPORT_HPP InstancedDrawable<2, Float>;
+template class MAGNUM_SCENEGRAPH_EXPORT_HPP InstancedDrawable<3, Float>;
+
 template class MAGNUM_SCENEGRAPH_EXPORT_HPP Object<BasicDualComplexTransformation<Float>>;
 template class MAGNUM_SCENEGRAPH_EXPORT_HPP Object<BasicDualQuaternionTransformation<Float>>;
 template class MAGNUM_SCENEGRAPH_EXPORT_HPP Object<BasicMatrixTransformation2D<Float>>;
@@ -77,6 +89,15 @@ template class MAGNUM_SCENEGRAPH_EXPORT_HPP Object<BasicRigidMatrixTransformatio
 template class MAGNUM_SCENEGRAPH_EXPORT_HPP Object<BasicRigidMatrixTransformation3D<Float>>;
 template class MAGNUM_SCENEGRAPH_EXPORT_HPP Object<TranslationTransformation<2, Float>>;
 template class MAGNUM_SCENEGRAPH_EXPORT_HPP Object<TranslationTransformation<3, Float>>;
+
+template class MAGNUM_SCENEGRAPH_EXPORT_HPP SpatialFeature<2, Float>;
+template class MAGNUM_SCENEGRAPH_EXPORT_HPP SpatialFeature<3, Float>;
+template class MAGNUM_SCENEGRAPH_EXPORT_HPP SpatialIndex<2, Float>;
+template class MAGNUM_SCENEGRAPH_EXPORT_HPP SpatialIndex<3, Float>;
+
+template class MAGNUM_SCENEGRAPH_EXPORT_HPP TrackSampler<BasicDualQuaternionTransformation<Float>>;
+template class MAGNUM_SCENEGRAPH_EXPORT_HPP TrackSampler<BasicMatrixTransformation3D<Float>>;
+template class MAGNUM_SCENEGRAPH_EXPORT_HPP TrackSampler<BasicRigidMatrixTransformation3D<Float>>;
 #endif
 
 }}
@@ -27,13 +27,19 @@
 
 #include <Corrade/Utility/Debug.h>
 
+#include "Magnum/Math/Matrix3.h"
+#include "Magnum/Math/Matrix4.h"
 #include "Magnum/Shapes/Collision.h"
 #include "Magnum/Shapes/ShapeGroup.h"
 #include "Magnum/Shapes/Implementation/CollisionDispatch.h"
 
 namespace Magnum { namespace Shapes {
 
-template<UnsignedInt dimensions> AbstractShape<dimensions>::AbstractShape(SceneGraph::AbstractObject<dimensions, Float>& object, ShapeGroup<dimensions>* group): SceneGraph::AbstractGroupedFeature<dimensions, AbstractShape<dimensions>, Float>(object, group) {
+template<UnsignedInt dimensions> AbstractShape<dimensions>::AbstractShape(SceneGraph::AbstractObject<dimensions, Float>& object, const Type type, ShapeGroup<dimensions>* group): SceneGraph::AbstractGroupedFeature<dimensions, AbstractShape<dimensions>, Float>(object, group), _type{type}, _hasType{true} {
+    SceneGraph::AbstractFeature<dimensions, Float>::setCachedTransformations(SceneGraph::CachedTransformation::Absolute);
+}
+
+template<UnsignedInt dimensions> AbstractShape<dimensions>::AbstractShape(SceneGraph::AbstractObject<dimensions, Float>& object, ShapeGroup<dimensions>* group): SceneGraph::AbstractGroupedFeature<dimensions, AbstractShape<dimensions>, Float>(object, group), _type{}, _hasType{false} {
     SceneGraph::AbstractFeature<dimensions, Float>::setCachedTransformations(SceneGraph::CachedTransformation::Absolute);
 }
 
@@ -45,10 +51,6 @@ template<UnsignedInt dimensions> const ShapeGroup<dimensions>* AbstractShape<dim
     return static_cast<const ShapeGroup<dimensions>*>(SceneGraph::AbstractGroupedFeature<dimensions, AbstractShape<dimensions>, Float>::group());
 }
 
-template<UnsignedInt dimensions> auto AbstractShape<dimensions>::type() const -> Type {
-    return abstractTransformedShape().type();
-}
-
 template<UnsignedInt dimensions> bool AbstractShape<dimensions>::collides(const AbstractShape<dimensions>& other) const {
     return Implementation::collides(abstractTransformedShape(), other.abstractTransformedShape());
 }
@@ -57,6 +59,13 @@ template<UnsignedInt dimensions> Collision<dimensions> AbstractShape<dimensions>
     return Implementation::collision(abstractTransformedShape(), other.abstractTransformedShape());
 }
 
+template<UnsignedInt dimensions> void AbstractShape<dimensions>::cleanBatch(const std::vector<std::reference_wrapper<SceneGraph::AbstractFeature<dimensions, Float>>>& shapes, const std::vector<MatrixTypeFor<dimensions, Float>>& absoluteTransformationMatrices, const std::vector<UnsignedInt>& indices, const std::size_t begin, const std::size_t end) {
+    for(std::size_t i = begin; i != end; ++i) {
+        const UnsignedInt index = indices[i];
+        static_cast<AbstractShape<dimensions>&>(shapes[index].get()).clean(absoluteTransformationMatrices[index]);
+    }
+}
+
 template<UnsignedInt dimensions> void AbstractShape<dimensions>::markDirty() {
     if(group()) group()->setDirty();
 }
@@ -29,6 +29,8 @@
  * @brief Class @ref Magnum::Shapes::AbstractShape, typedef @ref Magnum::Shapes::AbstractShape2D, @ref Magnum::Shapes::AbstractShape3D
  */
 
+#include <vector>
+
 #include "Magnum/Magnum.h"
 #include "Magnum/DimensionTraits.h"
 #include "Magnum/SceneGraph/AbstractGroupedFeature.h"
@@ -57,6 +59,7 @@ template<UnsignedInt dimensions> class MAGNUM_SHAPES_EXPORT AbstractShape: publi
     /* Otherwise it complains that this is not a function */
     template<UnsignedInt dimensions_> friend const Implementation::AbstractShape<dimensions_>& Implementation::getAbstractShape(const Shapes::AbstractShape<dimensions_>&);
     #endif
+    friend ShapeGroup<dimensions>;
 
     public:
         enum: UnsignedInt {
@@ -83,8 +86,22 @@ template<UnsignedInt dimensions> class MAGNUM_SHAPES_EXPORT AbstractShape: publi
         /**
          * @brief Constructor
          * @param object    Object holding this feature
+         * @param type      Shape type
          * @param group     Group this shape belongs to
          */
+        explicit AbstractShape(SceneGraph::AbstractObject<dimensions, Float>& object, Type type, ShapeGroup<dimensions>* group = nullptr);
+
+        /**
+         * @brief Constructor
+         * @param object    Object holding this feature
+         * @param group     Group this shape belongs to
+         *
+         * Kept for subclasses that don't pass their shape type explicitly.
+         * The type is then queried through the transformed shape on each
+         * @ref type() call and @ref ShapeGroup cleans such shapes one by one
+         * through @ref clean() instead of in a batch. Prefer the above
+         * overload.
+         */
         explicit AbstractShape(SceneGraph::AbstractObject<dimensions, Float>& object, ShapeGroup<dimensions>* group = nullptr);
 
         /**
@@ -96,7 +113,9 @@ template<UnsignedInt dimensions> class MAGNUM_SHAPES_EXPORT AbstractShape: publi
         const ShapeGroup<dimensions>* group() const; /**< @overload */
 
         /** @brief Shape type */
-        Type type() const;
+        Type type() const {
+            return _hasType ? _type : abstractTransformedShape().type();
+        }
 
         /**
          * @brief Detect collision with other shape
@@ -118,6 +137,19 @@ template<UnsignedInt dimensions> class MAGNUM_SHAPES_EXPORT AbstractShape: publi
 
     private:
         virtual const Implementation::AbstractShape<dimensions> MAGNUM_SHAPES_LOCAL & abstractTransformedShape() const = 0;
+
+        /* Transforms shapes `shapes[indices[begin]]` to `shapes[indices[end - 1]]`,
+           which are all of the same type as this one, in a single loop. Called
+           from ShapeGroup::doClean(). Default implementation calls clean() on
+           each of them. */
+        virtual void cleanBatch(const std::vector<std::reference_wrapper<SceneGraph::AbstractFeature<dimensions, Float>>>& shapes, const std::vector<MatrixTypeFor<dimensions, Float>>& absoluteTransformationMatrices, const std::vector<UnsignedInt>& indices, std::size_t begin, std::size_t end);
+
+        /* Stored so type() doesn't need to go through the virtual
+           abstractTransformedShape(), ShapeGroup::doClean() sorts by it. If
+           not passed to the constructor, _hasType is false and the shape is
+           not batched with others. */
+        Type _type;
+        bool _hasType;
 };
 
 /** @brief Base class for two-dimensional object shapes */
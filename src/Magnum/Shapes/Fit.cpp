@@ -0,0 +1,461 @@
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#include "Fit.h"
+
+#include "Magnum/Math/Batch.h"
+#include "Magnum/Math/Matrix4.h"
+#include "Magnum/Math/Algorithms/Svd3x3.h"
+
+#ifdef MAGNUM_BUILD_SIMD
+#include "Magnum/Math/simdImplementation.h"
+#endif
+
+namespace Magnum { namespace Shapes {
+
+#ifdef MAGNUM_MATH_SIMD
+namespace { namespace Simd {
+
+using namespace Math::Implementation::Simd;
+
+/* Batch minimum and maximum of three-component vectors projected onto three
+   axes, given as nine floats of a column-major 3x3 matrix. The @p min and
+   @p max arrays are expected to be already initialized, returns count of
+   processed vectors. */
+std::size_t projectedMinmax3(const Float* axes, const Float* data, const std::size_t count, Float* min, Float* max) {
+    if(count < 4) return 0;
+
+    Float4 ax[9];
+    for(std::size_t j = 0; j != 9; ++j) ax[j] = set(axes[j], axes[j], axes[j], axes[j]);
+
+    Float4 lo[3], hi[3];
+    for(std::size_t j = 0; j != 3; ++j) {
+        lo[j] = set(min[j], min[j], min[j], min[j]);
+        hi[j] = set(max[j], max[j], max[j], max[j]);
+    }
+
+    std::size_t i = 0;
+    for(; i + 4 <= count; i += 4) {
+        Float4 x, y, z;
+        deinterleave3(data + i*3, x, y, z);
+        for(std::size_t j = 0; j != 3; ++j) {
+            const Float4 p = add(add(mul(x, ax[3*j]), mul(y, ax[3*j + 1])), mul(z, ax[3*j + 2]));
+            lo[j] = Simd::min(lo[j], p);
+            hi[j] = Simd::max(hi[j], p);
+        }
+    }
+
+    Float l[4], h[4];
+    for(std::size_t j = 0; j != 3; ++j) {
+        store(l, lo[j]);
+        store(h, hi[j]);
+        for(std::size_t k = 0; k != 4; ++k) {
+            if(l[k] < min[j]) min[j] = l[k];
+            if(h[k] > max[j]) max[j] = h[k];
+        }
+    }
+
+    return i;
+}
+
+/* Projection of a three-component vector relative to given origin onto
+   one of the seven directions used by ditoExtremes() below */
+Float ditoProjection(const Float* data, const Float* origin, const std::size_t direction) {
+    const Float x = data[0] - origin[0];
+    const Float y = data[1] - origin[1];
+    const Float z = data[2] - origin[2];
+    switch(direction) {
+        case 0: return x;
+        case 1: return y;
+        case 2: return z;
+        case 3: return (x + y) + z;
+        case 4: return (x + y) - z;
+        case 5: return (x - y) + z;
+        default: return (x - y) - z;
+    }
+}
+
+/* Extremes of three-component vectors relative to given origin projected
+   onto the coordinate axes and four diagonals {1, 1, 1}, {1, 1, -1},
+   {1, -1, 1} and {1, -1, -1}, together with sums of the relative vectors
+   and products of their components {xx, yy, zz, xy, xz, yz}. The
+   projections are calculated the same way as in Extremes::add() below.
+
+   Tracking the item index along with each of the fourteen extremes would
+   need too many registers, so only the block of 64 items containing it is
+   tracked and the index is found by going through the winning block again
+   at the end. Updates the seven-item @p min, @p max and index arrays,
+   keeping the lowest index on ties, the sums are added to @p sums. Returns
+   count of processed vectors. */
+std::size_t ditoExtremes(const Float* data, const std::size_t count, const Float* origin, Float* min, std::size_t* minIndex, Float* max, std::size_t* maxIndex, Float* sums) {
+    enum: std::size_t {
+        BlockSize = 64,
+        MaxChunkSize = std::size_t(BlockSize) << 24
+    };
+
+    const Float4 ox = set(origin[0], origin[0], origin[0], origin[0]);
+    const Float4 oy = set(origin[1], origin[1], origin[1], origin[1]);
+    const Float4 oz = set(origin[2], origin[2], origin[2], origin[2]);
+
+    Float4 sum[9];
+    for(std::size_t j = 0; j != 9; ++j) sum[j] = zero();
+
+    const std::size_t end = count/4*4;
+    std::size_t i = 0;
+    while(i != end) {
+        const std::size_t chunkBegin = i;
+        const std::size_t chunkEnd = chunkBegin + std::min(end - i, std::size_t(MaxChunkSize));
+        Float4 lo[7], hi[7], loBlock[7], hiBlock[7];
+        for(std::size_t j = 0; j != 7; ++j) {
+            lo[j] = set(min[j], min[j], min[j], min[j]);
+            hi[j] = set(max[j], max[j], max[j], max[j]);
+            loBlock[j] = hiBlock[j] = set(-1.0f, -1.0f, -1.0f, -1.0f);
+        }
+
+        Float4 block = zero();
+        while(i != chunkEnd) {
+            const std::size_t blockEnd = i + std::min(chunkEnd - i, std::size_t(BlockSize));
+            Float4 blockLo[7], blockHi[7];
+            for(std::size_t j = 0; j != 7; ++j) {
+                blockLo[j] = lo[j];
+                blockHi[j] = hi[j];
+            }
+
+            for(; i != blockEnd; i += 4) {
+                Float4 x, y, z;
+                deinterleave3(data + i*3, x, y, z);
+                x = sub(x, ox);
+                y = sub(y, oy);
+                z = sub(z, oz);
+
+                sum[0] = add(sum[0], x);
+                sum[1] = add(sum[1], y);
+                sum[2] = add(sum[2], z);
+                sum[3] = add(sum[3], mul(x, x));
+                sum[4] = add(sum[4], mul(y, y));
+                sum[5] = add(sum[5], mul(z, z));
+                sum[6] = add(sum[6], mul(x, y));
+                sum[7] = add(sum[7], mul(x, z));
+                sum[8] = add(sum[8], mul(y, z));
+
+                const Float4 xPlusY = add(x, y);
+                const Float4 xMinusY = sub(x, y);
+                const Float4 p[]{x, y, z, add(xPlusY, z), sub(xPlusY, z), add(xMinusY, z), sub(xMinusY, z)};
+                for(std::size_t j = 0; j != 7; ++j) {
+                    blockLo[j] = Simd::min(p[j], blockLo[j]);
+                    blockHi[j] = Simd::max(p[j], blockHi[j]);
+                }
+            }
+
+            for(std::size_t j = 0; j != 7; ++j) {
+                loBlock[j] = select(lessThan(blockLo[j], lo[j]), block, loBlock[j]);
+                hiBlock[j] = select(greaterThan(blockHi[j], hi[j]), block, hiBlock[j]);
+                lo[j] = blockLo[j];
+                hi[j] = blockHi[j];
+            }
+            block = add(block, set(1.0f, 1.0f, 1.0f, 1.0f));
+        }
+
+        /* Lowest index with given value in given lane of a block. The value
+           is always there, NaNs are filtered out by the callers. */
+        auto find = [&](const std::size_t direction, const Float value, const std::size_t blockIndex, const std::size_t lane) {
+            std::size_t k = chunkBegin + blockIndex*BlockSize + lane;
+            while(ditoProjection(data + k*3, origin, direction) != value) k += 4;
+            return k;
+        };
+
+        Float values[4], blocks[4];
+        for(std::size_t j = 0; j != 7; ++j) {
+            store(values, lo[j]);
+            store(blocks, loBlock[j]);
+            for(std::size_t lane = 0; lane != 4; ++lane) {
+                if(blocks[lane] < 0.0f || !(values[lane] <= min[j])) continue;
+                const std::size_t candidate = find(j, values[lane], std::size_t(blocks[lane]), lane);
+                if(values[lane] < min[j] || candidate < minIndex[j]) {
+                    min[j] = values[lane];
+                    minIndex[j] = candidate;
+                }
+            }
+
+            store(values, hi[j]);
+            store(blocks, hiBlock[j]);
+            for(std::size_t lane = 0; lane != 4; ++lane) {
+                if(blocks[lane] < 0.0f || !(values[lane] >= max[j])) continue;
+                const std::size_t candidate = find(j, values[lane], std::size_t(blocks[lane]), lane);
+                if(values[lane] > max[j] || candidate < maxIndex[j]) {
+                    max[j] = values[lane];
+                    maxIndex[j] = candidate;
+                }
+            }
+        }
+    }
+
+    Float values[4];
+    for(std::size_t j = 0; j != 9; ++j) {
+        store(values, sum[j]);
+        sums[j] += (values[0] + values[1]) + (values[2] + values[3]);
+    }
+
+    return i;
+}
+
+}}
+#endif
+
+AxisAlignedBox2D fitAxisAlignedBox(const Containers::ArrayView<const Vector2> points) {
+    CORRADE_ASSERT(!points.empty(), "Shapes::fitAxisAlignedBox(): the array is empty", {});
+    const Range2D range = Math::Batch::range(points);
+    return {range.min(), range.max()};
+}
+
+AxisAlignedBox3D fitAxisAlignedBox(const Containers::ArrayView<const Vector3> points) {
+    CORRADE_ASSERT(!points.empty(), "Shapes::fitAxisAlignedBox(): the array is empty", {});
+    const Range3D range = Math::Batch::range(points);
+    return {range.min(), range.max()};
+}
+
+namespace {
+
+/* Seven DiTO-14 directions (unnormalized), the first three are coordinate
+   axes so the axis-aligned box falls out for free */
+constexpr std::size_t DirectionCount = 7;
+
+/* Points extremal along the DiTO directions, relative to the first point */
+struct Extremes {
+    void add(const Vector3& p, const std::size_t i) {
+        const Float xPlusY = p.x() + p.y();
+        const Float xMinusY = p.x() - p.y();
+        const Float projections[DirectionCount]{
+            p.x(), p.y(), p.z(),
+            xPlusY + p.z(), xPlusY - p.z(), xMinusY + p.z(), xMinusY - p.z()};
+        for(std::size_t j = 0; j != DirectionCount; ++j) {
+            if(projections[j] < minValue[j]) {
+                minValue[j] = projections[j];
+                minIndex[j] = i;
+            }
+            if(projections[j] > maxValue[j]) {
+                maxValue[j] = projections[j];
+                maxIndex[j] = i;
+            }
+        }
+    }
+
+    std::size_t minIndex[DirectionCount]{}, maxIndex[DirectionCount]{};
+    Float minValue[DirectionCount]{}, maxValue[DirectionCount]{};
+};
+
+/* Half of surface area of a box with given extents */
+Float halfArea(const Vector3& size) {
+    return size.x()*size.y() + size.y()*size.z() + size.z()*size.x();
+}
+
+/* Best orientation found so far, evaluated on the extremal points only */
+struct Candidate {
+    Matrix3x3 axes{Math::IdentityInit};
+    Float area{Constants::inf()};
+};
+
+void tryAxes(Candidate& best, const Matrix3x3& axes, const Vector3* points, const std::size_t count) {
+    /* The axes are in columns, so projection is multiplication with the
+       transpose */
+    const Matrix3x3 projection = axes.transposed();
+    Vector3 min = projection*points[0], max = min;
+    for(std::size_t i = 1; i != count; ++i) {
+        const Vector3 p = projection*points[i];
+        min = Math::min(min, p);
+        max = Math::max(max, p);
+    }
+
+    const Float area = halfArea(max - min);
+    if(area < best.area) {
+        best.axes = axes;
+        best.area = area;
+    }
+}
+
+/* Orientation given by normalized triangle normal and one of its edges */
+void tryTriangleEdge(Candidate& best, const Vector3& normal, const Vector3& edge, const Vector3* points, const std::size_t count) {
+    const Float length = edge.length();
+    if(length < Math::TypeTraits<Float>::epsilon()) return;
+    const Vector3 e = edge/length;
+    tryAxes(best, {e, normal, Math::cross(e, normal)}, points, count);
+}
+
+/* Orientations given by the triangle normal and all three edges. Degenerate
+   triangles are skipped. */
+void tryTriangle(Candidate& best, const Vector3& a, const Vector3& b, const Vector3& c, const Vector3* points, const std::size_t count) {
+    const Vector3 n = Math::cross(b - a, c - a);
+    const Float length = n.length();
+    if(length < Math::TypeTraits<Float>::epsilon()) return;
+
+    const Vector3 normal = n/length;
+    tryTriangleEdge(best, normal, b - a, points, count);
+    tryTriangleEdge(best, normal, c - b, points, count);
+    tryTriangleEdge(best, normal, a - c, points, count);
+}
+
+}
+
+Box3D fitBox(const Containers::ArrayView<const Vector3> points) {
+    CORRADE_ASSERT(!points.empty(), "Shapes::fitBox(): the array is empty", {});
+
+    /* First pass: points extremal along the DiTO directions and the first
+       and second moments. Everything is calculated relative to the first
+       point to avoid catastrophic cancellation in the covariance. The SIMD
+       kernel does the same for four points at once, the rest is done here. */
+    const Vector3 origin = points[0];
+    Extremes extremes;
+    Float moments[9]{};
+    std::size_t i = 0;
+    #ifdef MAGNUM_MATH_SIMD
+    i = Simd::ditoExtremes(reinterpret_cast<const Float*>(points.data()), points.size(), origin.data(), extremes.minValue, extremes.minIndex, extremes.maxValue, extremes.maxIndex, moments);
+    #endif
+
+    for(; i != points.size(); ++i) {
+        const Vector3 p = points[i] - origin;
+        moments[0] += p.x();
+        moments[1] += p.y();
+        moments[2] += p.z();
+        moments[3] += p.x()*p.x();
+        moments[4] += p.y()*p.y();
+        moments[5] += p.z()*p.z();
+        moments[6] += p.x()*p.y();
+        moments[7] += p.x()*p.z();
+        moments[8] += p.y()*p.z();
+        extremes.add(p, i);
+    }
+
+    /* The axis-aligned box is known exactly already */
+    const Vector3 aabbMin = origin + Vector3{extremes.minValue[0], extremes.minValue[1], extremes.minValue[2]};
+    const Vector3 aabbMax = origin + Vector3{extremes.maxValue[0], extremes.maxValue[1], extremes.maxValue[2]};
+    const Float aabbArea = halfArea(aabbMax - aabbMin);
+
+    Vector3 extremal[DirectionCount*2];
+    for(std::size_t j = 0; j != DirectionCount; ++j) {
+        extremal[2*j] = points[extremes.minIndex[j]];
+        extremal[2*j + 1] = points[extremes.maxIndex[j]];
+    }
+
+    Candidate best;
+
+    /* Principal axes, made right-handed */
+    {
+        const Float n = Float(points.size());
+        const Vector3 mean = Vector3{moments[0], moments[1], moments[2]}/n;
+        const Float xy = moments[6]/n - mean.x()*mean.y();
+        const Float xz = moments[7]/n - mean.x()*mean.z();
+        const Float yz = moments[8]/n - mean.y()*mean.z();
+        const Matrix3x3 covariance{
+            Vector3{moments[3]/n - mean.x()*mean.x(), xy, xz},
+            Vector3{xy, moments[4]/n - mean.y()*mean.y(), yz},
+            Vector3{xz, yz, moments[5]/n - mean.z()*mean.z()}};
+        Matrix3x3 axes = Math::Algorithms::symmetricEigen3x3(covariance).second;
+        axes[2] = Math::cross(Vector3{axes[0]}, Vector3{axes[1]});
+        tryAxes(best, axes, extremal, DirectionCount*2);
+    }
+
+    /* DiTO. The two most distant extremal points of the same direction
+       form the first edge of the base triangle. */
+    std::size_t farthest = 0;
+    Float farthestDistance = 0.0f;
+    for(std::size_t j = 0; j != DirectionCount; ++j) {
+        const Float distance = (extremal[2*j + 1] - extremal[2*j]).dot();
+        if(distance > farthestDistance) {
+            farthest = j;
+            farthestDistance = distance;
+        }
+    }
+
+    if(farthestDistance > 0.0f) {
+        const Vector3 p0 = extremal[2*farthest];
+        const Vector3 p1 = extremal[2*farthest + 1];
+        const Vector3 e0 = (p1 - p0).normalized();
+
+        /* Third vertex is the extremal point farthest from the first edge */
+        Vector3 p2 = p0;
+        Float p2Distance = 0.0f;
+        for(const Vector3& p: extremal) {
+            const Vector3 d = p - p0;
+            const Float distance = (d - Math::dot(d, e0)*e0).dot();
+            if(distance > p2Distance) {
+                p2 = p;
+                p2Distance = distance;
+            }
+        }
+
+        if(p2Distance > 0.0f) {
+            tryTriangle(best, p0, p1, p2, extremal, DirectionCount*2);
+
+            /* Apexes of the two tetrahedra are extremal points farthest
+               from the base triangle on both sides */
+            const Vector3 normal = Math::cross(p1 - p0, p2 - p0);
+            Vector3 above = p0, below = p0;
+            Float aboveDistance = 0.0f, belowDistance = 0.0f;
+            for(const Vector3& p: extremal) {
+                const Float distance = Math::dot(p - p0, normal);
+                if(distance > aboveDistance) {
+                    above = p;
+                    aboveDistance = distance;
+                } else if(distance < belowDistance) {
+                    below = p;
+                    belowDistance = distance;
+                }
+            }
+
+            for(const Vector3& apex: {above, below}) {
+                tryTriangle(best, p0, p1, apex, extremal, DirectionCount*2);
+                tryTriangle(best, p1, p2, apex, extremal, DirectionCount*2);
+                tryTriangle(best, p2, p0, apex, extremal, DirectionCount*2);
+            }
+
+        /* All extremal points are collinear, any perpendicular will do */
+        } else {
+            const Vector3 perpendicular = Math::cross(e0, std::abs(e0.x()) < 0.5f ? Vector3::xAxis() : Vector3::yAxis()).normalized();
+            tryAxes(best, {e0, perpendicular, Math::cross(e0, perpendicular)}, extremal, DirectionCount*2);
+        }
+    }
+
+    /* Second pass: exact bounds along the best axes */
+    const Matrix3x3 projection = best.axes.transposed();
+    Vector3 min = projection*points[0], max = min;
+    std::size_t processed = 0;
+    #ifdef MAGNUM_MATH_SIMD
+    processed = Simd::projectedMinmax3(best.axes.data(), reinterpret_cast<const Float*>(points.data()), points.size(), min.data(), max.data());
+    #endif
+    for(std::size_t i = processed; i != points.size(); ++i) {
+        const Vector3 p = projection*points[i];
+        min = Math::min(min, p);
+        max = Math::max(max, p);
+    }
+
+    /* Use the axis-aligned box if it's better */
+    if(aabbArea <= halfArea(max - min))
+        return Box3D{Matrix4::translation((aabbMin + aabbMax)*0.5f)*Matrix4::scaling((aabbMax - aabbMin)*0.5f)};
+
+    const Vector3 halfSize = (max - min)*0.5f;
+    return Box3D{Matrix4::from({best.axes[0]*halfSize.x(), best.axes[1]*halfSize.y(), best.axes[2]*halfSize.z()}, best.axes*((min + max)*0.5f))};
+}
+
+}}
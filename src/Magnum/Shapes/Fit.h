@@ -0,0 +1,84 @@
+#ifndef Magnum_Shapes_Fit_h
+#define Magnum_Shapes_Fit_h
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+/** @file
+ * @brief Function @ref Magnum::Shapes::fitAxisAlignedBox(), @ref Magnum::Shapes::fitBox()
+ */
+
+#include <Corrade/Containers/ArrayView.h>
+
+#include "Magnum/Magnum.h"
+#include "Magnum/Shapes/AxisAlignedBox.h"
+#include "Magnum/Shapes/Box.h"
+#include "Magnum/Shapes/visibility.h"
+
+namespace Magnum { namespace Shapes {
+
+/**
+@brief Fit axis-aligned box to given points
+
+Uses @ref Math::Batch::range(), which is SIMD-accelerated when Magnum is built
+with `BUILD_SIMD` enabled. Expects that the array is not empty.
+@see @ref fitBox()
+*/
+AxisAlignedBox2D MAGNUM_SHAPES_EXPORT fitAxisAlignedBox(Containers::ArrayView<const Vector2> points);
+
+/** @overload */
+AxisAlignedBox3D MAGNUM_SHAPES_EXPORT fitAxisAlignedBox(Containers::ArrayView<const Vector3> points);
+
+/**
+@brief Fit oriented box to given points
+
+Returns a box which tightly encloses given points, with orientation chosen to
+minimize its surface area. The orientation is picked from these candidates:
+
+-   coordinate axes, i.e. the axis-aligned box,
+-   principal axes of the point set, calculated with
+    @ref Math::Algorithms::symmetricEigen3x3() from covariance matrix of the
+    points,
+-   axes given by faces and edges of a ditetrahedron built from points
+    extremal along seven fixed directions, as described in *Larsson, T.;
+    Källberg, L. (2011). "Fast Computation of Tight-Fitting Oriented Bounding
+    Boxes"* (DiTO-14).
+
+The candidates are compared on the fourteen extremal points only, the best
+one is then evaluated on the whole set and compared against the axis-aligned
+box. The whole calculation is two passes over the data, the second one is
+SIMD-accelerated when Magnum is built with `BUILD_SIMD` enabled. The result is
+not the minimal-volume box, but is usually within a few percent of it.
+
+The transformation of returned box has the box axes scaled by half-extents in
+its rotation part, its translation is the box center. The axes form
+right-handed orthonormal basis, flat point sets result in zero scaling along
+one axis. Expects that the array is not empty.
+@see @ref fitAxisAlignedBox()
+*/
+Box3D MAGNUM_SHAPES_EXPORT fitBox(Containers::ArrayView<const Vector3> points);
+
+}}
+
+#endif
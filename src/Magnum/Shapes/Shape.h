@@ -76,17 +76,17 @@ template<class T> class Shape: public AbstractShape<T::Dimensions> {
          * @param shape     Shape
          * @param group     Group this shape belongs to
          */
-        explicit Shape(SceneGraph::AbstractObject<T::Dimensions, Float>& object, const T& shape, ShapeGroup<T::Dimensions>* group = nullptr): AbstractShape<T::Dimensions>(object, group) {
+        explicit Shape(SceneGraph::AbstractObject<T::Dimensions, Float>& object, const T& shape, ShapeGroup<T::Dimensions>* group = nullptr): AbstractShape<T::Dimensions>(object, Implementation::TypeOf<T>::type(), group) {
             Implementation::ShapeHelper<T>::set(*this, shape);
         }
 
         /** @overload */
-        explicit Shape(SceneGraph::AbstractObject<T::Dimensions, Float>& object, T&& shape, ShapeGroup<T::Dimensions>* group = nullptr): AbstractShape<T::Dimensions>(object, group) {
+        explicit Shape(SceneGraph::AbstractObject<T::Dimensions, Float>& object, T&& shape, ShapeGroup<T::Dimensions>* group = nullptr): AbstractShape<T::Dimensions>(object, Implementation::TypeOf<T>::type(), group) {
             Implementation::ShapeHelper<T>::set(*this, std::move(shape));
         }
 
         /** @overload */
-        explicit Shape(SceneGraph::AbstractObject<T::Dimensions, Float>& object, ShapeGroup<T::Dimensions>* group = nullptr): AbstractShape<T::Dimensions>(object, group) {}
+        explicit Shape(SceneGraph::AbstractObject<T::Dimensions, Float>& object, ShapeGroup<T::Dimensions>* group = nullptr): AbstractShape<T::Dimensions>(object, Implementation::TypeOf<T>::type(), group) {}
 
         /** @brief Shape */
         const T& shape() const { return _shape.shape; }
@@ -115,6 +115,8 @@ template<class T> class Shape: public AbstractShape<T::Dimensions> {
             return _transformedShape;
         }
 
+        void cleanBatch(const std::vector<std::reference_wrapper<SceneGraph::AbstractFeature<T::Dimensions, Float>>>& shapes, const std::vector<MatrixTypeFor<T::Dimensions, Float>>& absoluteTransformationMatrices, const std::vector<UnsignedInt>& indices, std::size_t begin, std::size_t end) override;
+
         Implementation::Shape<T> _shape, _transformedShape;
 };
 
@@ -133,6 +135,13 @@ template<class T> void Shape<T>::clean(const MatrixTypeFor<T::Dimensions, Float>
     Implementation::ShapeHelper<T>::transform(*this, absoluteTransformationMatrix);
 }
 
+template<class T> void Shape<T>::cleanBatch(const std::vector<std::reference_wrapper<SceneGraph::AbstractFeature<T::Dimensions, Float>>>& shapes, const std::vector<MatrixTypeFor<T::Dimensions, Float>>& absoluteTransformationMatrices, const std::vector<UnsignedInt>& indices, const std::size_t begin, const std::size_t end) {
+    for(std::size_t i = begin; i != end; ++i) {
+        const UnsignedInt index = indices[i];
+        Implementation::ShapeHelper<T>::transform(static_cast<Shape<T>&>(shapes[index].get()), absoluteTransformationMatrices[index]);
+    }
+}
+
 namespace Implementation {
     template<class T> struct ShapeHelper {
         static void set(Shapes::Shape<T>& shape, const T& s) {
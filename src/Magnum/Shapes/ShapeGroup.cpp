@@ -25,24 +25,53 @@
 
 #include "ShapeGroup.h"
 
+#include <Corrade/Utility/Assert.h>
+
 #include "Magnum/Shapes/AbstractShape.h"
 
 namespace Magnum { namespace Shapes {
 
 template<UnsignedInt dimensions> void ShapeGroup<dimensions>::setClean() {
-    /* Clean all objects */
-    if(!this->isEmpty()) {
-        std::vector<std::reference_wrapper<SceneGraph::AbstractObject<dimensions, Float>>> objects;
-        objects.reserve(this->size());
-        for(std::size_t i = 0; i != this->size(); ++i)
-            objects.push_back((*this)[i].object());
-
-        SceneGraph::AbstractObject<dimensions, Float>::setClean(objects);
-    }
+    /* Clean all objects, the shapes are then transformed in doClean() */
+    SceneGraph::FeatureGroup<dimensions, AbstractShape<dimensions>, Float>::setClean();
 
     dirty = false;
 }
 
+template<UnsignedInt dimensions> void ShapeGroup<dimensions>::doClean(const std::vector<std::reference_wrapper<SceneGraph::AbstractFeature<dimensions, Float>>>& shapes, const std::vector<MatrixTypeFor<dimensions, Float>>& absoluteTransformationMatrices) {
+    /* Counting sort of the shapes by type, the type values are all less than
+       32. Shapes that didn't pass their type to the constructor can't be
+       assumed to be Shape<T>, so they go to a separate bucket 32 that's
+       cleaned one by one. After this, offsets[i] is the end of type i in the
+       sorted order. */
+    std::size_t offsets[34]{};
+    _types.resize(shapes.size());
+    for(std::size_t i = 0; i != shapes.size(); ++i) {
+        AbstractShape<dimensions>& shape = static_cast<AbstractShape<dimensions>&>(shapes[i].get());
+        _types[i] = shape._hasType ? UnsignedByte(shape._type) : 32;
+        CORRADE_INTERNAL_ASSERT(_types[i] <= 32);
+        ++offsets[_types[i] + 1];
+    }
+    for(std::size_t i = 1; i != 34; ++i) offsets[i] += offsets[i - 1];
+    _order.resize(shapes.size());
+    for(std::size_t i = 0; i != shapes.size(); ++i)
+        _order[offsets[_types[i]]++] = i;
+
+    /* Transform all shapes of each type in one go */
+    std::size_t begin = 0;
+    for(std::size_t type = 0; type != 32; ++type) {
+        const std::size_t end = offsets[type];
+        if(begin != end) static_cast<AbstractShape<dimensions>&>(shapes[_order[begin]].get())
+            .cleanBatch(shapes, absoluteTransformationMatrices, _order, begin, end);
+        begin = end;
+    }
+
+    /* Shapes without known type, calling the default implementation
+       non-virtually */
+    if(begin != offsets[32]) static_cast<AbstractShape<dimensions>&>(shapes[_order[begin]].get())
+        .AbstractShape<dimensions>::cleanBatch(shapes, absoluteTransformationMatrices, _order, begin, offsets[32]);
+}
+
 template<UnsignedInt dimensions> AbstractShape<dimensions>* ShapeGroup<dimensions>::firstCollision(const AbstractShape<dimensions>& shape) {
     setClean();
     for(std::size_t i = 0; i != this->size(); ++i)
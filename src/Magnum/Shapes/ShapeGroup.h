@@ -74,7 +74,9 @@ template<UnsignedInt dimensions> class MAGNUM_SHAPES_EXPORT ShapeGroup: public S
          * @brief Set the group and all bodies as clean
          *
          * This function is called before computing any collisions to ensure
-         * all objects are cleaned.
+         * all objects are cleaned. Shapes of dirty objects are transformed in
+         * a batch, with one loop for each shape type.
+         * @see @ref SceneGraph::FeatureGroup::setClean()
          */
         void setClean();
 
@@ -88,7 +90,11 @@ template<UnsignedInt dimensions> class MAGNUM_SHAPES_EXPORT ShapeGroup: public S
         AbstractShape<dimensions>* firstCollision(const AbstractShape<dimensions>& shape);
 
     private:
+        void doClean(const std::vector<std::reference_wrapper<SceneGraph::AbstractFeature<dimensions, Float>>>& shapes, const std::vector<MatrixTypeFor<dimensions, Float>>& absoluteTransformationMatrices) override;
+
         bool dirty;
+        std::vector<UnsignedByte> _types;
+        std::vector<UnsignedInt> _order;
 };
 
 /**
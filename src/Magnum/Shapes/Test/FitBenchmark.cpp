@@ -0,0 +1,109 @@
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#include <chrono>
+#include <vector>
+#include <Corrade/TestSuite/Tester.h>
+
+#include "Magnum/Magnum.h"
+#include "Magnum/Math/Functions.h"
+#include "Magnum/Math/Matrix4.h"
+#include "Magnum/Shapes/Fit.h"
+#include "Magnum/Test/Benchmark.h"
+
+namespace Magnum { namespace Shapes { namespace Test {
+
+/* Compares a plain scalar bounding box loop with the batch one and the
+   oriented box fitting on 10k points, which is a typical skinned mesh size */
+struct FitBenchmark: TestSuite::Tester {
+    explicit FitBenchmark();
+
+    void axisAlignedBox();
+    void box();
+};
+
+FitBenchmark::FitBenchmark() {
+    addTests({&FitBenchmark::axisAlignedBox,
+              &FitBenchmark::box});
+}
+
+namespace {
+    enum: std::size_t { Count = 10000 };
+
+    std::vector<Vector3> points() {
+        const Matrix4 transformation = Matrix4::rotation(Deg(35.0f), Vector3{1.0f, 2.0f, 0.5f}.normalized());
+        std::vector<Vector3> out;
+        out.reserve(Count);
+        for(std::size_t i = 0; i != Count; ++i)
+            out.push_back(transformation.transformPoint({
+                Float((i*7919) % 10007)*0.001f,
+                Float((i*104729) % 10007)*0.0002f,
+                Float((i*1299709) % 10007)*0.0001f}));
+        return out;
+    }
+
+    /* The operations are short, so more runs and a finer unit */
+    template<class F> std::int64_t measure(F f) {
+        return Magnum::Test::measure<std::chrono::nanoseconds>(f, 20);
+    }
+}
+
+void FitBenchmark::axisAlignedBox() {
+    const std::vector<Vector3> data = points();
+
+    Vector3 min, max;
+    const std::int64_t scalar = measure([&]() {
+        min = max = data[0];
+        for(const Vector3& p: data) {
+            min = Math::min(min, p);
+            max = Math::max(max, p);
+        }
+    });
+
+    AxisAlignedBox3D box;
+    const std::int64_t batch = measure([&]() {
+        box = fitAxisAlignedBox({data.data(), data.size()});
+    });
+
+    CORRADE_COMPARE(box.min(), min);
+    CORRADE_COMPARE(box.max(), max);
+    Debug() << "fitAxisAlignedBox() scalar loop:" << scalar << "ns, batch:" << batch << "ns";
+}
+
+void FitBenchmark::box() {
+    const std::vector<Vector3> data = points();
+
+    Box3D box;
+    const std::int64_t time = measure([&]() {
+        box = fitBox({data.data(), data.size()});
+    });
+
+    CORRADE_VERIFY(box.transformation().rotationScaling().determinant() > 0.0f);
+    Debug() << "fitBox():" << time << "ns";
+}
+
+}}}
+
+CORRADE_TEST_MAIN(Magnum::Shapes::Test::FitBenchmark)
@@ -0,0 +1,246 @@
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#include <algorithm>
+#include <sstream>
+#include <vector>
+#include <Corrade/TestSuite/Tester.h>
+
+#include "Magnum/Magnum.h"
+#include "Magnum/Math/Functions.h"
+#include "Magnum/Math/Matrix4.h"
+#include "Magnum/Shapes/Fit.h"
+
+namespace Magnum { namespace Shapes { namespace Test {
+
+struct FitTest: TestSuite::Tester {
+    explicit FitTest();
+
+    void axisAlignedBox2D();
+    void axisAlignedBox3D();
+    void axisAlignedBoxEmpty();
+
+    void box();
+    void boxAxisAligned();
+    void boxPointCloud();
+    void boxFlat();
+    void boxCollinear();
+    void boxSinglePoint();
+    void boxEmpty();
+};
+
+FitTest::FitTest() {
+    addTests({&FitTest::axisAlignedBox2D,
+              &FitTest::axisAlignedBox3D,
+              &FitTest::axisAlignedBoxEmpty,
+
+              &FitTest::box,
+              &FitTest::boxAxisAligned,
+              &FitTest::boxPointCloud,
+              &FitTest::boxFlat,
+              &FitTest::boxCollinear,
+              &FitTest::boxSinglePoint,
+              &FitTest::boxEmpty});
+}
+
+namespace {
+    /* Deterministic pseudo-random points in given box */
+    std::vector<Vector3> points(std::size_t count, const Vector3& halfSize, const Matrix4& transformation) {
+        std::vector<Vector3> out;
+        UnsignedInt seed = 7;
+        for(std::size_t i = 0; i != count; ++i) {
+            Vector3 p;
+            for(std::size_t j = 0; j != 3; ++j) {
+                seed = seed*1664525u + 1013904223u;
+                p[j] = (Float(seed >> 8)/Float(1 << 24)*2.0f - 1.0f)*halfSize[j];
+            }
+            out.push_back(transformation.transformPoint(p));
+        }
+        return out;
+    }
+
+    /* Corners of given box */
+    void addCorners(std::vector<Vector3>& out, const Vector3& halfSize, const Matrix4& transformation) {
+        for(std::size_t i = 0; i != 8; ++i)
+            out.push_back(transformation.transformPoint(halfSize*Vector3{
+                i & 1 ? 1.0f : -1.0f, i & 2 ? 1.0f : -1.0f, i & 4 ? 1.0f : -1.0f}));
+    }
+
+    /* Whether all points are inside the box, the box can be flat */
+    bool contains(const Box3D& box, const std::vector<Vector3>& points) {
+        const Matrix4 t = box.transformation();
+        for(const Vector3& p: points) {
+            const Vector3 d = p - t.translation();
+            for(std::size_t i = 0; i != 3; ++i) {
+                const Float length = t[i].xyz().length();
+                const Float projected = length == 0.0f ? 0.0f : Math::abs(Math::dot(d, t[i].xyz()))/length;
+                if(projected > length + 1.0e-4f) return false;
+            }
+        }
+        return true;
+    }
+
+    /* Sorted half extents of the box */
+    Vector3 halfSize(const Box3D& box) {
+        const Matrix4 t = box.transformation();
+        Vector3 size{t[0].xyz().length(), t[1].xyz().length(), t[2].xyz().length()};
+        std::sort(size.data(), size.data() + 3);
+        return size;
+    }
+
+    Containers::ArrayView<const Vector3> view(const std::vector<Vector3>& data) {
+        return {data.data(), data.size()};
+    }
+}
+
+void FitTest::axisAlignedBox2D() {
+    const Vector2 data[]{{1.0f, -2.0f}, {3.0f, 0.5f}, {-1.5f, 4.0f}};
+    const AxisAlignedBox2D box = fitAxisAlignedBox(Containers::ArrayView<const Vector2>{data});
+    CORRADE_COMPARE(box.min(), (Vector2{-1.5f, -2.0f}));
+    CORRADE_COMPARE(box.max(), (Vector2{3.0f, 4.0f}));
+}
+
+void FitTest::axisAlignedBox3D() {
+    const std::vector<Vector3> data = points(37, {1.0f, 2.0f, 3.0f}, Matrix4::translation({5.0f, -1.0f, 0.5f}));
+    Vector3 min = data[0], max = data[0];
+    for(const Vector3& p: data) {
+        min = Math::min(min, p);
+        max = Math::max(max, p);
+    }
+
+    const AxisAlignedBox3D box = fitAxisAlignedBox(view(data));
+    CORRADE_COMPARE(box.min(), min);
+    CORRADE_COMPARE(box.max(), max);
+}
+
+void FitTest::axisAlignedBoxEmpty() {
+    std::ostringstream out;
+    Error::setOutput(&out);
+
+    fitAxisAlignedBox(Containers::ArrayView<const Vector2>{});
+    fitAxisAlignedBox(Containers::ArrayView<const Vector3>{});
+    CORRADE_COMPARE(out.str(),
+        "Shapes::fitAxisAlignedBox(): the array is empty\n"
+        "Shapes::fitAxisAlignedBox(): the array is empty\n");
+}
+
+void FitTest::box() {
+    /* Rotated box with corners present should be recovered exactly */
+    const Matrix4 transformation = Matrix4::translation({10.0f, -3.0f, 2.0f})*
+        Matrix4::rotation(Deg(35.0f), Vector3{1.0f, 2.0f, 0.5f}.normalized());
+    const Vector3 size{3.0f, 1.0f, 0.25f};
+    std::vector<Vector3> data = points(101, size, transformation);
+    addCorners(data, size, transformation);
+
+    const Box3D box = fitBox(view(data));
+    CORRADE_VERIFY(contains(box, data));
+    CORRADE_COMPARE(halfSize(box), (Vector3{0.25f, 1.0f, 3.0f}));
+    CORRADE_COMPARE(box.transformation().translation(), transformation.translation());
+
+    /* The axes are right-handed */
+    const Matrix4 t = box.transformation();
+    CORRADE_VERIFY(t.rotationScaling().determinant() > 0.0f);
+}
+
+void FitTest::boxAxisAligned() {
+    /* Axis-aligned data give the axis-aligned box */
+    const std::vector<Vector3> data = points(50, {1.0f, 2.0f, 3.0f}, Matrix4::translation({5.0f, -1.0f, 0.5f}));
+    const AxisAlignedBox3D expected = fitAxisAlignedBox(view(data));
+
+    const Box3D box = fitBox(view(data));
+    CORRADE_COMPARE(box.transformation(),
+        Matrix4::translation((expected.min() + expected.max())*0.5f)*
+        Matrix4::scaling((expected.max() - expected.min())*0.5f));
+}
+
+void FitTest::boxPointCloud() {
+    /* Without corners the fit is not exact, but it should be much better
+       than the axis-aligned box */
+    const Matrix4 transformation = Matrix4::rotation(Deg(-50.0f), Vector3{0.0f, 1.0f, 1.0f}.normalized());
+    const std::vector<Vector3> data = points(1000, {4.0f, 1.0f, 0.5f}, transformation);
+
+    const Box3D box = fitBox(view(data));
+    CORRADE_VERIFY(contains(box, data));
+
+    const AxisAlignedBox3D aabb = fitAxisAlignedBox(view(data));
+    const Float aabbVolume = (aabb.max() - aabb.min()).product();
+    const Float volume = halfSize(box).product()*8.0f;
+    CORRADE_VERIFY(volume < aabbVolume*0.5f);
+    CORRADE_VERIFY(volume < 4.0f*1.0f*0.5f*8.0f*1.2f);
+
+    /* Spatially sorted points, where nearly every item is a new extreme,
+       should give the same result */
+    std::vector<Vector3> sorted = data;
+    std::sort(sorted.begin(), sorted.end(), [](const Vector3& a, const Vector3& b) { return a.x() < b.x(); });
+    const Box3D sortedBox = fitBox(view(sorted));
+    CORRADE_VERIFY(contains(sortedBox, sorted));
+    CORRADE_COMPARE(halfSize(sortedBox), halfSize(box));
+}
+
+void FitTest::boxFlat() {
+    /* Points in a rotated plane give zero size along the normal */
+    const Matrix4 transformation = Matrix4::translation({1.0f, 2.0f, 3.0f})*
+        Matrix4::rotationX(Deg(30.0f))*Matrix4::rotationZ(Deg(20.0f));
+    std::vector<Vector3> data = points(20, {2.0f, 1.0f, 0.0f}, transformation);
+    addCorners(data, {2.0f, 1.0f, 0.0f}, transformation);
+
+    const Box3D box = fitBox(view(data));
+    CORRADE_VERIFY(contains(box, data));
+    const Vector3 size = halfSize(box);
+    CORRADE_VERIFY(size[0] < 1.0e-5f);
+    CORRADE_COMPARE(size[1], 1.0f);
+    CORRADE_COMPARE(size[2], 2.0f);
+}
+
+void FitTest::boxCollinear() {
+    const Vector3 data[]{{1.0f, 1.0f, 1.0f}, {3.0f, 2.0f, 3.0f}, {2.0f, 1.5f, 2.0f}, {-1.0f, 0.0f, -1.0f}};
+
+    const Box3D box = fitBox(Containers::ArrayView<const Vector3>{data});
+    CORRADE_VERIFY(contains(box, {std::begin(data), std::end(data)}));
+    CORRADE_COMPARE(box.transformation().translation(), (Vector3{1.0f, 1.0f, 1.0f}));
+    const Vector3 size = halfSize(box);
+    CORRADE_VERIFY(size[0] < 1.0e-5f);
+    CORRADE_VERIFY(size[1] < 1.0e-5f);
+    CORRADE_COMPARE(size[2], 3.0f);
+}
+
+void FitTest::boxSinglePoint() {
+    const Vector3 data[]{{1.0f, -2.0f, 3.0f}};
+
+    const Box3D box = fitBox(Containers::ArrayView<const Vector3>{data});
+    CORRADE_COMPARE(box.transformation(), Matrix4::translation({1.0f, -2.0f, 3.0f})*Matrix4::scaling(Vector3{0.0f}));
+}
+
+void FitTest::boxEmpty() {
+    std::ostringstream out;
+    Error::setOutput(&out);
+
+    fitBox(Containers::ArrayView<const Vector3>{});
+    CORRADE_COMPARE(out.str(), "Shapes::fitBox(): the array is empty\n");
+}
+
+}}}
+
+CORRADE_TEST_MAIN(Magnum::Shapes::Test::FitTest)
@@ -44,6 +44,8 @@ struct ShapeTest: TestSuite::Tester {
     void collision();
     void firstCollision();
     void shapeGroup();
+    void shapeGroupBatchClean();
+    void shapeGroupBatchCleanUntyped();
 };
 
 typedef SceneGraph::Scene<SceneGraph::MatrixTransformation2D> Scene2D;
@@ -56,7 +58,9 @@ ShapeTest::ShapeTest() {
               &ShapeTest::collides,
               &ShapeTest::collision,
               &ShapeTest::firstCollision,
-              &ShapeTest::shapeGroup});
+              &ShapeTest::shapeGroup,
+              &ShapeTest::shapeGroupBatchClean,
+              &ShapeTest::shapeGroupBatchCleanUntyped});
 }
 
 void ShapeTest::clean() {
@@ -222,6 +226,86 @@ void ShapeTest::shapeGroup() {
     CORRADE_COMPARE(point.position(), Vector2(5.25f, -1.0f));
 }
 
+void ShapeTest::shapeGroupBatchClean() {
+    Scene3D scene;
+    ShapeGroup3D shapes;
+
+    /* Interleaved shapes of different types */
+    Object3D a(&scene);
+    a.translate(Vector3::xAxis(1.0f));
+    auto aPoint = new Shapes::Shape<Shapes::Point3D>(a, {{0.0f, 1.0f, 0.0f}}, &shapes);
+    auto aSphere = new Shapes::Shape<Shapes::Sphere3D>(a, {{}, 0.5f}, &shapes);
+    Object3D b(&a);
+    b.scale(Vector3(2.0f));
+    auto bPoint = new Shapes::Shape<Shapes::Point3D>(b, {{0.0f, 0.0f, 1.0f}}, &shapes);
+    auto bComposition = new Shapes::Shape<Shapes::Composition3D>(b, Shapes::Sphere3D({}, 1.0f) || Shapes::Point3D({1.0f, 0.0f, 0.0f}), &shapes);
+    auto bSphere = new Shapes::Shape<Shapes::Sphere3D>(b, {{0.0f, 1.0f, 0.0f}, 0.25f}, &shapes);
+    CORRADE_VERIFY(aPoint->type() == AbstractShape3D::Type::Point);
+    CORRADE_VERIFY(bComposition->type() == AbstractShape3D::Type::Composition);
+    CORRADE_VERIFY(bSphere->type() == AbstractShape3D::Type::Sphere);
+
+    shapes.setClean();
+    CORRADE_VERIFY(!shapes.isDirty());
+    CORRADE_VERIFY(!a.isDirty());
+    CORRADE_VERIFY(!b.isDirty());
+    CORRADE_COMPARE(aPoint->transformedShape().position(), Vector3(1.0f, 1.0f, 0.0f));
+    CORRADE_COMPARE(aSphere->transformedShape().position(), Vector3(1.0f, 0.0f, 0.0f));
+    CORRADE_COMPARE(aSphere->transformedShape().radius(), 0.5f);
+    CORRADE_COMPARE(bPoint->transformedShape().position(), Vector3(1.0f, 0.0f, 2.0f));
+    CORRADE_COMPARE(bComposition->transformedShape().get<Shapes::Point3D>(1).position(), Vector3(3.0f, 0.0f, 0.0f));
+    CORRADE_COMPARE(bSphere->transformedShape().position(), Vector3(1.0f, 2.0f, 0.0f));
+    CORRADE_COMPARE(bSphere->transformedShape().radius(), 0.5f);
+
+    /* Only the dirty object gets updated */
+    b.translate(Vector3::yAxis(-1.0f));
+    shapes.setClean();
+    CORRADE_COMPARE(aPoint->transformedShape().position(), Vector3(1.0f, 1.0f, 0.0f));
+    CORRADE_COMPARE(bPoint->transformedShape().position(), Vector3(1.0f, -1.0f, 2.0f));
+    CORRADE_COMPARE(bSphere->transformedShape().position(), Vector3(1.0f, 1.0f, 0.0f));
+}
+
+namespace {
+    /* Subclass not passing its type to the AbstractShape constructor */
+    class UntypedPoint: public AbstractShape3D {
+        public:
+            explicit UntypedPoint(Object3D& object, const Point3D& point, ShapeGroup3D* group): AbstractShape3D{object, group}, _point{point}, _cleanCount{} {}
+
+            const Point3D& transformedPoint() const { return _transformedPoint.shape; }
+            Int cleanCount() const { return _cleanCount; }
+
+        private:
+            void clean(const Matrix4& absoluteTransformationMatrix) override {
+                _transformedPoint.shape = _point.shape.transformed(absoluteTransformationMatrix);
+                ++_cleanCount;
+            }
+
+            const Implementation::AbstractShape<3>& abstractTransformedShape() const override {
+                return _transformedPoint;
+            }
+
+            Implementation::Shape<Point3D> _point, _transformedPoint;
+            Int _cleanCount;
+    };
+}
+
+void ShapeTest::shapeGroupBatchCleanUntyped() {
+    Scene3D scene;
+    ShapeGroup3D shapes;
+
+    Object3D a(&scene);
+    a.translate(Vector3::xAxis(1.0f));
+    auto aPoint = new Shapes::Shape<Shapes::Point3D>(a, {{0.0f, 1.0f, 0.0f}}, &shapes);
+    auto aUntyped = new UntypedPoint(a, {{0.0f, 0.0f, 1.0f}}, &shapes);
+    CORRADE_VERIFY(aUntyped->type() == AbstractShape3D::Type::Point);
+
+    /* The untyped shape isn't batched together with Shape<Point3D>, but
+       cleaned through its own clean() */
+    shapes.setClean();
+    CORRADE_COMPARE(aPoint->transformedShape().position(), Vector3(1.0f, 1.0f, 0.0f));
+    CORRADE_COMPARE(aUntyped->transformedPoint().position(), Vector3(1.0f, 0.0f, 1.0f));
+    CORRADE_COMPARE(aUntyped->cleanCount(), 1);
+}
+
 }}}
 
 CORRADE_TEST_MAIN(Magnum::Shapes::Test::ShapeTest)
@@ -25,6 +25,9 @@
 
 #include "Renderer.h"
 
+#include <list>
+#include <unordered_map>
+
 #include "Magnum/Context.h"
 #include "Magnum/Extensions.h"
 #include "Magnum/Mesh.h"
@@ -195,11 +198,8 @@ std::pair<Containers::Array<char>, Mesh::IndexType> renderIndicesInternal(const
     return {std::move(indices), indexType};
 }
 
-std::tuple<Mesh, Range2D> renderInternal(AbstractFont& font, const GlyphCache& cache, Float size, const std::string& text, Buffer& vertexBuffer, Buffer& indexBuffer, BufferUsage usage, Alignment alignment) {
-    /* Render vertices and upload them */
-    std::vector<Vertex> vertices;
-    Range2D rectangle;
-    std::tie(vertices, rectangle) = renderVerticesInternal(font, cache, size, text, alignment);
+std::tuple<Mesh, Range2D> renderInternal(const std::vector<Vertex>& vertices, const Range2D& rectangle, Buffer& vertexBuffer, Buffer& indexBuffer, BufferUsage usage) {
+    /* Upload the vertices */
     vertexBuffer.setData(vertices, usage);
 
     const UnsignedInt glyphCount = vertices.size()/4;
@@ -221,13 +221,116 @@ std::tuple<Mesh, Range2D> renderInternal(AbstractFont& font, const GlyphCache& c
     return std::make_tuple(std::move(mesh), rectangle);
 }
 
+/* Text is referenced, not copied, so lookups don't need to allocate */
+struct LayoutKey {
+    AbstractFont* font;
+    const GlyphCache* cache;
+    Float size;
+    Alignment alignment;
+    const std::string* text;
+
+    bool operator==(const LayoutKey& other) const {
+        return font == other.font && cache == other.cache && size == other.size && alignment == other.alignment && *text == *other.text;
+    }
+};
+
+struct LayoutKeyHash {
+    std::size_t operator()(const LayoutKey& key) const {
+        std::size_t hash = std::hash<std::string>{}(*key.text);
+        for(const std::size_t h: {std::hash<const void*>{}(key.font),
+                                  std::hash<const void*>{}(key.cache),
+                                  std::hash<Float>{}(key.size),
+                                  std::size_t(key.alignment)})
+            hash ^= h + 0x9e3779b9 + (hash << 6) + (hash >> 2);
+        return hash;
+    }
+};
+
 }
 
-std::tuple<std::vector<Vector2>, std::vector<Vector2>, std::vector<UnsignedInt>, Range2D> AbstractRenderer::render(AbstractFont& font, const GlyphCache& cache, Float size, const std::string& text, Alignment alignment) {
-    /* Render vertices */
+struct LayoutCache::Layout {
     std::vector<Vertex> vertices;
     Range2D rectangle;
-    std::tie(vertices, rectangle) = renderVerticesInternal(font, cache, size, text, alignment);
+};
+
+struct LayoutCache::Data {
+    struct Entry {
+        AbstractFont* font;
+        const GlyphCache* cache;
+        Float size;
+        Alignment alignment;
+        std::string text;
+        Layout layout;
+    };
+
+    explicit Data(std::size_t capacity): capacity{capacity}, hits{}, misses{} {}
+
+    std::size_t capacity, hits, misses;
+
+    /* Most recently used first, keys in the index point to text stored in
+       the entries, list nodes don't move so the pointers stay valid */
+    std::list<Entry> entries;
+    std::unordered_map<LayoutKey, std::list<Entry>::iterator, LayoutKeyHash> index;
+};
+
+LayoutCache::LayoutCache(const std::size_t capacity): _data{new Data{capacity}} {
+    CORRADE_ASSERT(capacity, "Text::LayoutCache: capacity must not be zero", );
+}
+
+LayoutCache::~LayoutCache() = default;
+
+std::size_t LayoutCache::capacity() const { return _data->capacity; }
+
+std::size_t LayoutCache::size() const { return _data->entries.size(); }
+
+std::size_t LayoutCache::hitCount() const { return _data->hits; }
+
+std::size_t LayoutCache::missCount() const { return _data->misses; }
+
+void LayoutCache::clear() {
+    _data->index.clear();
+    _data->entries.clear();
+    _data->hits = _data->misses = 0;
+}
+
+const LayoutCache::Layout& LayoutCache::layout(LayoutCache* const layoutCache, Layout& storage, AbstractFont& font, const GlyphCache& cache, const Float size, const std::string& text, const Alignment alignment) {
+    /* No cache, just lay out the text */
+    if(!layoutCache) {
+        std::tie(storage.vertices, storage.rectangle) = renderVerticesInternal(font, cache, size, text, alignment);
+        return storage;
+    }
+
+    Data& d = *layoutCache->_data;
+
+    /* Cache hit, move the entry to the front */
+    const auto found = d.index.find(LayoutKey{&font, &cache, size, alignment, &text});
+    if(found != d.index.end()) {
+        ++d.hits;
+        d.entries.splice(d.entries.begin(), d.entries, found->second);
+        return found->second->layout;
+    }
+
+    /* Cache miss, discard the least recently used entry if full */
+    ++d.misses;
+    if(d.entries.size() >= d.capacity && !d.entries.empty()) {
+        const Data::Entry& last = d.entries.back();
+        d.index.erase(LayoutKey{last.font, last.cache, last.size, last.alignment, &last.text});
+        d.entries.pop_back();
+    }
+
+    /* Lay out the text and put it to the front */
+    d.entries.push_front(Data::Entry{&font, &cache, size, alignment, text, {}});
+    Data::Entry& entry = d.entries.front();
+    std::tie(entry.layout.vertices, entry.layout.rectangle) = renderVerticesInternal(font, cache, size, text, alignment);
+    d.index.emplace(LayoutKey{entry.font, entry.cache, entry.size, entry.alignment, &entry.text}, d.entries.begin());
+    return entry.layout;
+}
+
+std::tuple<std::vector<Vector2>, std::vector<Vector2>, std::vector<UnsignedInt>, Range2D> AbstractRenderer::render(AbstractFont& font, const GlyphCache& cache, Float size, const std::string& text, Alignment alignment, LayoutCache* const layoutCache) {
+    /* Render vertices or take them from the cache */
+    LayoutCache::Layout storage;
+    const LayoutCache::Layout& layout = LayoutCache::layout(layoutCache, storage, font, cache, size, text, alignment);
+    const std::vector<Vertex>& vertices = layout.vertices;
 
     /* Deinterleave the vertices */
     std::vector<Vector2> positions, textureCoordinates;
@@ -243,12 +346,16 @@ std::tuple<std::vector<Vector2>, std::vector<Vector2>, std::vector<UnsignedInt>,
     std::vector<UnsignedInt> indices(glyphCount*6);
     createIndices<UnsignedInt>(indices.data(), glyphCount);
 
-    return std::make_tuple(std::move(positions), std::move(textureCoordinates), std::move(indices), rectangle);
+    return std::make_tuple(std::move(positions), std::move(textureCoordinates), std::move(indices), layout.rectangle);
 }
 
-template<UnsignedInt dimensions> std::tuple<Mesh, Range2D> Renderer<dimensions>::render(AbstractFont& font, const GlyphCache& cache, Float size, const std::string& text, Buffer& vertexBuffer, Buffer& indexBuffer, BufferUsage usage, Alignment alignment) {
+template<UnsignedInt dimensions> std::tuple<Mesh, Range2D> Renderer<dimensions>::render(AbstractFont& font, const GlyphCache& cache, Float size, const std::string& text, Buffer& vertexBuffer, Buffer& indexBuffer, BufferUsage usage, Alignment alignment, LayoutCache* const layoutCache) {
+    /* Render vertices or take them from the cache */
+    LayoutCache::Layout storage;
+    const LayoutCache::Layout& layout = LayoutCache::layout(layoutCache, storage, font, cache, size, text, alignment);
+
     /* Finalize mesh configuration and return the result */
-    auto r = renderInternal(font, cache, size, text, vertexBuffer, indexBuffer, usage, alignment);
+    auto r = renderInternal(layout.vertices, layout.rectangle, vertexBuffer, indexBuffer, usage);
     Mesh& mesh = std::get<0>(r);
     mesh.addVertexBuffer(vertexBuffer, 0,
             typename Shaders::AbstractVector<dimensions>::Position(
@@ -303,7 +410,7 @@ void AbstractRenderer::bufferUnmapImplementationDefault(Buffer& buffer)
     #endif
 }
 
-AbstractRenderer::AbstractRenderer(AbstractFont& font, const GlyphCache& cache, const Float size, const Alignment alignment): _vertexBuffer{Buffer::TargetHint::Array}, _indexBuffer{Buffer::TargetHint::ElementArray}, font(font), cache(cache), size(size), _alignment(alignment), _capacity(0) {
+AbstractRenderer::AbstractRenderer(AbstractFont& font, const GlyphCache& cache, const Float size, const Alignment alignment): _vertexBuffer{Buffer::TargetHint::Array}, _indexBuffer{Buffer::TargetHint::ElementArray}, font(font), cache(cache), size(size), _alignment(alignment), _capacity(0), _layoutCache(nullptr) {
     #ifndef MAGNUM_TARGET_GLES
     MAGNUM_ASSERT_EXTENSION_SUPPORTED(Extensions::GL::ARB::map_buffer_range);
     #elif defined(MAGNUM_TARGET_GLES2) && !defined(CORRADE_TARGET_EMSCRIPTEN)
@@ -352,6 +459,9 @@ void AbstractRenderer::reserve(const uint32_t glyphCount, const BufferUsage vert
     #endif
     _mesh.setCount(0);
 
+    /* The buffer contents are gone, render the text again next time */
+    _text.clear();
+
     /* Render indices */
     Containers::Array<char> indexData;
     Mesh::IndexType indexType;
@@ -374,10 +484,13 @@ void AbstractRenderer::reserve(const uint32_t glyphCount, const BufferUsage vert
 }
 
 void AbstractRenderer::render(const std::string& text) {
-    /* Render vertex data */
-    std::vector<Vertex> vertexData;
-    _rectangle = {};
-    std::tie(vertexData, _rectangle) = renderVerticesInternal(font, cache, size, text, _alignment);
+    /* Nothing changed since the last upload */
+    if(text == _text) return;
+
+    /* Render vertex data or take them from the cache */
+    LayoutCache::Layout storage;
+    const LayoutCache::Layout& layout = LayoutCache::layout(_layoutCache, storage, font, cache, size, text, _alignment);
+    const std::vector<Vertex>& vertexData = layout.vertices;
 
     const UnsignedInt glyphCount = vertexData.size()/4;
     const UnsignedInt vertexCount = glyphCount*4;
@@ -393,8 +506,10 @@ void AbstractRenderer::render(const std::string& text) {
     std::copy(vertexData.begin(), vertexData.end(), vertices.begin());
     bufferUnmapImplementation(_vertexBuffer);
 
-    /* Update index count */
+    /* Update index count, bounds and remember what's in the buffer */
     _mesh.setCount(indexCount);
+    _rectangle = layout.rectangle;
+    _text = text;
 }
 
 #ifndef DOXYGEN_GENERATING_OUTPUT
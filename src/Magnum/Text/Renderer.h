@@ -26,9 +26,10 @@
 */
 
 /** @file Text/Renderer.h
- * @brief Class @ref Magnum::Text::AbstractRenderer, @ref Magnum::Text::Renderer, typedef @ref Magnum::Text::Renderer2D, @ref Magnum::Text::Renderer3D
+ * @brief Class @ref Magnum::Text::LayoutCache, @ref Magnum::Text::AbstractRenderer, @ref Magnum::Text::Renderer, typedef @ref Magnum::Text::Renderer2D, @ref Magnum::Text::Renderer3D
  */
 
+#include <memory>
 #include <string>
 #include <tuple>
 #include <vector>
@@ -43,6 +44,91 @@
 
 namespace Magnum { namespace Text {
 
+/**
+@brief Text layout cache
+
+Remembers laid out and aligned glyph quads of recently rendered texts, keyed
+by font, glyph cache, size, alignment and the text itself. Passing the cache
+to @ref AbstractRenderer::render(AbstractFont&, const GlyphCache&, Float, const std::string&, Alignment, LayoutCache*) "Renderer::render()"
+or @ref AbstractRenderer::setLayoutCache() "Renderer::setLayoutCache()" makes
+repeated rendering of the same text (e.g. HUD labels re-rendered every frame)
+skip the layouting altogether. When the cache is full, the least recently
+used text is discarded.
+
+The cache references fonts and glyph caches only by their address and
+doesn't track changes in them, so call @ref clear() when a font or a glyph
+cache is destroyed or when new glyphs are added to a glyph cache.
+@see @ref Renderer
+*/
+class MAGNUM_TEXT_EXPORT LayoutCache {
+    friend AbstractRenderer;
+    template<UnsignedInt> friend class Renderer;
+
+    public:
+        /**
+         * @brief Constructor
+         * @param capacity      Max count of cached texts. Expected to be
+         *      nonzero.
+         */
+        explicit LayoutCache(std::size_t capacity);
+
+        /** @brief Copying is not allowed */
+        LayoutCache(const LayoutCache&) = delete;
+
+        /** @brief Moving is not allowed */
+        LayoutCache(LayoutCache&&) = delete;
+
+        ~LayoutCache();
+
+        /** @brief Copying is not allowed */
+        LayoutCache& operator=(const LayoutCache&) = delete;
+
+        /** @brief Moving is not allowed */
+        LayoutCache& operator=(LayoutCache&&) = delete;
+
+        /** @brief Max count of cached texts */
+        std::size_t capacity() const;
+
+        /** @brief Count of currently cached texts */
+        std::size_t size() const;
+
+        /**
+         * @brief Count of cache hits
+         *
+         * Count of renders which reused an already laid out text since
+         * construction or last call to @ref clear().
+         * @see @ref missCount()
+         */
+        std::size_t hitCount() const;
+
+        /**
+         * @brief Count of cache misses
+         *
+         * Count of renders which had to lay out the text since construction
+         * or last call to @ref clear().
+         * @see @ref hitCount()
+         */
+        std::size_t missCount() const;
+
+        /**
+         * @brief Clear the cache
+         *
+         * Discards all cached texts and resets hit and miss counters.
+         */
+        void clear();
+
+    private:
+        struct Data;
+        struct Layout;
+
+        /* Returns cached layout or lays out the text, putting it into the
+           cache. If the cache is null, lays out the text into the storage.
+           The returned reference is valid only until the next call. */
+        static MAGNUM_TEXT_LOCAL const Layout& layout(LayoutCache* layoutCache, Layout& storage, AbstractFont& font, const GlyphCache& cache, Float size, const std::string& text, Alignment alignment);
+
+        std::unique_ptr<Data> _data;
+};
+
 /**
 @brief Base for text renderers
 
@@ -58,11 +144,13 @@ class MAGNUM_TEXT_EXPORT AbstractRenderer {
          * @param size          Font size
          * @param text          Text to render
          * @param alignment     Text alignment
+         * @param layoutCache   Layout cache. If not `nullptr`, previously
+         *      laid out text is taken from the cache.
          *
          * Returns tuple with vertex positions, texture coordinates, indices
          * and rectangle spanning the rendered text.
          */
-        static std::tuple<std::vector<Vector2>, std::vector<Vector2>, std::vector<UnsignedInt>, Range2D> render(AbstractFont& font, const GlyphCache& cache, Float size, const std::string& text, Alignment alignment = Alignment::LineLeft);
+        static std::tuple<std::vector<Vector2>, std::vector<Vector2>, std::vector<UnsignedInt>, Range2D> render(AbstractFont& font, const GlyphCache& cache, Float size, const std::string& text, Alignment alignment = Alignment::LineLeft, LayoutCache* layoutCache = nullptr);
 
         /**
          * @brief Capacity for rendered glyphs
@@ -83,6 +171,23 @@ class MAGNUM_TEXT_EXPORT AbstractRenderer {
         /** @brief Mesh */
         Mesh& mesh() { return _mesh; }
 
+        /** @brief Layout cache */
+        LayoutCache* layoutCache() const { return _layoutCache; }
+
+        /**
+         * @brief Set layout cache
+         * @return Reference to self (for method chaining)
+         *
+         * If set, texts passed to @ref render(const std::string&) are taken
+         * from the cache if they were laid out previously. The cache is not
+         * owned by the renderer and is expected to outlive it. Initially no
+         * cache is set.
+         */
+        AbstractRenderer& setLayoutCache(LayoutCache* layoutCache) {
+            _layoutCache = layoutCache;
+            return *this;
+        }
+
         /**
          * @brief Reserve capacity for rendered glyphs
          *
@@ -102,7 +207,9 @@ class MAGNUM_TEXT_EXPORT AbstractRenderer {
          *
          * Renders the text to vertex buffer, reusing index buffer already
          * filled with @ref reserve(). Rectangle spanning the rendered text is
-         * available through @ref rectangle().
+         * available through @ref rectangle(). If the text is the same as in
+         * previous call, the function does nothing. Layout of already
+         * rendered texts can be reused with @ref setLayoutCache().
          *
          * Initially no text is rendered.
          * @attention The capacity must be large enough to contain all glyphs,
@@ -132,6 +239,8 @@ class MAGNUM_TEXT_EXPORT AbstractRenderer {
         Alignment _alignment;
         UnsignedInt _capacity;
         Range2D _rectangle;
+        LayoutCache* _layoutCache;
+        std::string _text;
 
         #if defined(MAGNUM_TARGET_GLES2) && !defined(CORRADE_TARGET_EMSCRIPTEN)
         typedef void*(*BufferMapImplementation)(Buffer&, GLsizeiptr);
@@ -200,8 +309,8 @@ shader.setTransformationProjectionMatrix(projection)
     .setVectorTexture(glyphCache->texture());
 mesh.draw(shader);
 @endcode
-See @ref render(AbstractFont&, const GlyphCache&, Float, const std::string&, Alignment) and
-@ref render(AbstractFont&, const GlyphCache&, Float, const std::string&, Buffer&, Buffer&, BufferUsage, Alignment)
+See @ref render(AbstractFont&, const GlyphCache&, Float, const std::string&, Alignment, LayoutCache*) and
+@ref render(AbstractFont&, const GlyphCache&, Float, const std::string&, Buffer&, Buffer&, BufferUsage, Alignment, LayoutCache*)
 for more information.
 
 While this method is sufficient for one-shot rendering of static texts, for
@@ -226,6 +335,26 @@ shader.setTransformationProjectionMatrix(projection)
 renderer.mesh().draw(shader);
 @endcode
 
+## Caching text layout
+
+Texts which are rendered over and over again (e.g. HUD labels recreated every
+frame) can reuse their layout through @ref LayoutCache. Rendering a text which
+is already in the cache doesn't call the font layouter at all. The mutable
+text renderer additionally doesn't touch the vertex buffer if the text didn't
+change since the last @ref render(const std::string&) call.
+@code
+Text::LayoutCache layoutCache{64};
+
+// Static rendering, the layout is reused when the same label is rendered again
+std::tie(mesh, std::ignore) = Text::Renderer2D::render(*font, cache, 0.15f,
+    "Score", vertexBuffer, indexBuffer, BufferUsage::StaticDraw,
+    Text::Alignment::LineLeft, &layoutCache);
+
+// Mutable rendering
+renderer.setLayoutCache(&layoutCache);
+renderer.render("Paused");
+@endcode
+
 ## Required OpenGL functionality
 
 Mutable text rendering requires @extension{ARB,map_buffer_range} on desktop
@@ -250,11 +379,13 @@ template<UnsignedInt dimensions> class MAGNUM_TEXT_EXPORT Renderer: public Abstr
          * @param indexBuffer   Buffer where to store indices
          * @param usage         Usage of vertex and index buffer
          * @param alignment     Text alignment
+         * @param layoutCache   Layout cache. If not `nullptr`, previously
+         *      laid out text is taken from the cache.
          *
          * Returns mesh prepared for use with @ref Shaders::AbstractVector
          * subclasses and rectangle spanning the rendered text.
          */
-        static std::tuple<Mesh, Range2D> render(AbstractFont& font, const GlyphCache& cache, Float size, const std::string& text, Buffer& vertexBuffer, Buffer& indexBuffer, BufferUsage usage, Alignment alignment = Alignment::LineLeft);
+        static std::tuple<Mesh, Range2D> render(AbstractFont& font, const GlyphCache& cache, Float size, const std::string& text, Buffer& vertexBuffer, Buffer& indexBuffer, BufferUsage usage, Alignment alignment = Alignment::LineLeft, LayoutCache* layoutCache = nullptr);
 
         /**
          * @brief Constructor
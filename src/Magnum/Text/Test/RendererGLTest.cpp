@@ -37,6 +37,10 @@ struct RendererGLTest: Magnum::Test::AbstractOpenGLTester {
     void renderMeshIndexType();
     void mutableText();
 
+    void layoutCache();
+    void layoutCacheEviction();
+    void mutableTextLayoutCache();
+
     void multiline();
 };
 
@@ -46,6 +50,10 @@ RendererGLTest::RendererGLTest() {
               &RendererGLTest::renderMeshIndexType,
               &RendererGLTest::mutableText,
 
+              &RendererGLTest::layoutCache,
+              &RendererGLTest::layoutCacheEviction,
+              &RendererGLTest::mutableTextLayoutCache,
+
               &RendererGLTest::multiline});
 }
 
@@ -68,17 +76,24 @@ class TestLayouter: public Text::AbstractLayouter {
 };
 
 class TestFont: public Text::AbstractFont {
-    Features doFeatures() const override { return Feature::OpenData; }
+    public:
+        explicit TestFont(): layoutCount{} {}
 
-    bool doIsOpened() const override { return true; }
-    void doClose() override {}
+        std::size_t layoutCount;
 
-    UnsignedInt doGlyphId(char32_t) override { return 0; }
-    Vector2 doGlyphAdvance(UnsignedInt) override { return {}; }
+    private:
+        Features doFeatures() const override { return Feature::OpenData; }
 
-    std::unique_ptr<AbstractLayouter> doLayout(const GlyphCache&, const Float size, const std::string& text) override {
-        return std::unique_ptr<AbstractLayouter>(new TestLayouter(size, text.size()));
-    }
+        bool doIsOpened() const override { return true; }
+        void doClose() override {}
+
+        UnsignedInt doGlyphId(char32_t) override { return 0; }
+        Vector2 doGlyphAdvance(UnsignedInt) override { return {}; }
+
+        std::unique_ptr<AbstractLayouter> doLayout(const GlyphCache&, const Float size, const std::string& text) override {
+            ++layoutCount;
+            return std::unique_ptr<AbstractLayouter>(new TestLayouter(size, text.size()));
+        }
 };
 
 /* *static_cast<GlyphCache*>(nullptr) makes Clang Analyzer grumpy */
@@ -323,6 +338,151 @@ void RendererGLTest::mutableText() {
     #endif
 }
 
+void RendererGLTest::layoutCache() {
+    TestFont font;
+    LayoutCache layoutCache{4};
+    CORRADE_COMPARE(layoutCache.capacity(), 4);
+    CORRADE_COMPARE(layoutCache.size(), 0);
+
+    std::vector<Vector2> positions, cachedPositions;
+    std::vector<Vector2> textureCoordinates, cachedTextureCoordinates;
+    std::vector<UnsignedInt> indices, cachedIndices;
+    Range2D bounds, cachedBounds;
+    std::tie(positions, textureCoordinates, indices, bounds) = Text::AbstractRenderer::render(font, nullGlyphCache, 0.25f, "abc", Alignment::MiddleRightIntegral, &layoutCache);
+    CORRADE_COMPARE(font.layoutCount, 1);
+    CORRADE_COMPARE(layoutCache.size(), 1);
+    CORRADE_COMPARE(layoutCache.hitCount(), 0);
+    CORRADE_COMPARE(layoutCache.missCount(), 1);
+
+    /* Same text again, the layouter is not called and the output is the
+       same */
+    std::tie(cachedPositions, cachedTextureCoordinates, cachedIndices, cachedBounds) = Text::AbstractRenderer::render(font, nullGlyphCache, 0.25f, "abc", Alignment::MiddleRightIntegral, &layoutCache);
+    CORRADE_COMPARE(font.layoutCount, 1);
+    CORRADE_COMPARE(layoutCache.size(), 1);
+    CORRADE_COMPARE(layoutCache.hitCount(), 1);
+    CORRADE_COMPARE(layoutCache.missCount(), 1);
+    CORRADE_COMPARE(cachedPositions, positions);
+    CORRADE_COMPARE(cachedTextureCoordinates, textureCoordinates);
+    CORRADE_COMPARE(cachedIndices, indices);
+    CORRADE_COMPARE(cachedBounds, bounds);
+
+    /* Different size, alignment or text is a separate entry */
+    Text::AbstractRenderer::render(font, nullGlyphCache, 0.5f, "abc", Alignment::MiddleRightIntegral, &layoutCache);
+    Text::AbstractRenderer::render(font, nullGlyphCache, 0.25f, "abc", Alignment::LineLeft, &layoutCache);
+    Text::AbstractRenderer::render(font, nullGlyphCache, 0.25f, "ab", Alignment::MiddleRightIntegral, &layoutCache);
+    CORRADE_COMPARE(font.layoutCount, 4);
+    CORRADE_COMPARE(layoutCache.size(), 4);
+
+    /* The mesh renderer shares the cache */
+    Mesh mesh{NoCreate};
+    Buffer vertexBuffer, indexBuffer;
+    std::tie(mesh, cachedBounds) = Text::Renderer2D::render(font, nullGlyphCache,
+        0.25f, "abc", vertexBuffer, indexBuffer, BufferUsage::StaticDraw, Alignment::MiddleRightIntegral, &layoutCache);
+    MAGNUM_VERIFY_NO_ERROR();
+    CORRADE_COMPARE(font.layoutCount, 4);
+    CORRADE_COMPARE(layoutCache.hitCount(), 2);
+    CORRADE_COMPARE(cachedBounds, bounds);
+
+    layoutCache.clear();
+    CORRADE_COMPARE(layoutCache.size(), 0);
+    CORRADE_COMPARE(layoutCache.hitCount(), 0);
+    CORRADE_COMPARE(layoutCache.missCount(), 0);
+}
+
+void RendererGLTest::layoutCacheEviction() {
+    TestFont font;
+    LayoutCache layoutCache{2};
+
+    Text::AbstractRenderer::render(font, nullGlyphCache, 0.25f, "a", Alignment::LineLeft, &layoutCache);
+    Text::AbstractRenderer::render(font, nullGlyphCache, 0.25f, "b", Alignment::LineLeft, &layoutCache);
+    CORRADE_COMPARE(font.layoutCount, 2);
+
+    /* Touching "a" makes "b" the least recently used one, which then gets
+       discarded by "c" */
+    Text::AbstractRenderer::render(font, nullGlyphCache, 0.25f, "a", Alignment::LineLeft, &layoutCache);
+    Text::AbstractRenderer::render(font, nullGlyphCache, 0.25f, "c", Alignment::LineLeft, &layoutCache);
+    CORRADE_COMPARE(font.layoutCount, 3);
+    CORRADE_COMPARE(layoutCache.size(), 2);
+
+    Text::AbstractRenderer::render(font, nullGlyphCache, 0.25f, "a", Alignment::LineLeft, &layoutCache);
+    CORRADE_COMPARE(font.layoutCount, 3);
+    Text::AbstractRenderer::render(font, nullGlyphCache, 0.25f, "b", Alignment::LineLeft, &layoutCache);
+    CORRADE_COMPARE(font.layoutCount, 4);
+    CORRADE_COMPARE(layoutCache.size(), 2);
+}
+
+void RendererGLTest::mutableTextLayoutCache() {
+    #ifndef MAGNUM_TARGET_GLES
+    if(!Context::current()->isExtensionSupported<Extensions::GL::ARB::map_buffer_range>())
+        CORRADE_SKIP(Extensions::GL::ARB::map_buffer_range::string() + std::string(" is not supported"));
+    #elif defined(MAGNUM_TARGET_GLES2) && !defined(MAGNUM_TARGET_EMSCRIPTEN)
+    if(!Context::current()->isExtensionSupported<Extensions::GL::EXT::map_buffer_range>() &&
+       !Context::current()->isExtensionSupported<Extensions::GL::OES::mapbuffer>()
+       #ifdef CORRADE_TARGET_NACL
+       && !Context::current()->isExtensionSupported<Extensions::GL::CHROMIUM::map_sub>()
+       #endif
+    ) {
+        CORRADE_SKIP("No required extension is supported");
+    }
+    #endif
+
+    TestFont font;
+    LayoutCache layoutCache{4};
+    Text::Renderer2D renderer(font, nullGlyphCache, 0.25f);
+    CORRADE_VERIFY(!renderer.layoutCache());
+    renderer.setLayoutCache(&layoutCache);
+    CORRADE_COMPARE(renderer.layoutCache(), &layoutCache);
+    renderer.reserve(4, BufferUsage::DynamicDraw, BufferUsage::DynamicDraw);
+    MAGNUM_VERIFY_NO_ERROR();
+
+    /* Rendering the same text again doesn't do anything */
+    renderer.render("abc");
+    renderer.render("abc");
+    MAGNUM_VERIFY_NO_ERROR();
+    CORRADE_COMPARE(font.layoutCount, 1);
+    CORRADE_COMPARE(layoutCache.hitCount(), 0);
+    CORRADE_COMPARE(renderer.rectangle(), Range2D({0.0f, -0.5f}, {5.0f, 1.0f}));
+
+    /* Switching back and forth reuses the layout */
+    renderer.render("ab");
+    renderer.render("abc");
+    MAGNUM_VERIFY_NO_ERROR();
+    CORRADE_COMPARE(font.layoutCount, 2);
+    CORRADE_COMPARE(layoutCache.hitCount(), 1);
+    CORRADE_COMPARE(renderer.mesh().count(), 18);
+    CORRADE_COMPARE(renderer.rectangle(), Range2D({0.0f, -0.5f}, {5.0f, 1.0f}));
+
+    /* Reserving discards the buffer contents, so the text is uploaded again */
+    renderer.reserve(4, BufferUsage::DynamicDraw, BufferUsage::DynamicDraw);
+    CORRADE_COMPARE(renderer.mesh().count(), 0);
+    renderer.render("abc");
+    MAGNUM_VERIFY_NO_ERROR();
+    CORRADE_COMPARE(font.layoutCount, 2);
+    CORRADE_COMPARE(layoutCache.hitCount(), 2);
+    CORRADE_COMPARE(renderer.mesh().count(), 18);
+
+    /** @todo How to verify this on ES? */
+    #ifndef MAGNUM_TARGET_GLES
+    Containers::Array<Float> vertices = renderer.vertexBuffer().subData<Float>(0, 48);
+    CORRADE_COMPARE(std::vector<Float>(vertices.begin(), vertices.end()), (std::vector<Float>{
+        0.0f,  0.5f, 0.0f, 10.0f,
+        0.0f,  0.0f, 0.0f,  0.0f,
+        0.75f, 0.5f, 6.0f, 10.0f,
+        0.75f, 0.0f, 6.0f,  0.0f,
+
+        1.0f,  0.75f,  6.0f, 10.0f,
+        1.0f, -0.25f,  6.0f,  0.0f,
+        2.5f,  0.75f, 12.0f, 10.0f,
+        2.5f, -0.25f, 12.0f,  0.0f,
+
+        2.75f,  1.0f, 12.0f, 10.0f,
+        2.75f, -0.5f, 12.0f,  0.0f,
+        5.0f,   1.0f, 18.0f, 10.0f,
+        5.0f,  -0.5f, 18.0f,  0.0f
+    }));
+    #endif
+}
+
 void RendererGLTest::multiline() {
     class Layouter: public Text::AbstractLayouter {
         public:
@@ -0,0 +1,80 @@
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#include "Srgb.h"
+
+#include <tuple>
+#include <Corrade/Containers/Array.h>
+
+#include "Magnum/Image.h"
+#include "Magnum/ImageView.h"
+#include "Magnum/PixelFormat.h"
+#include "Magnum/Math/Batch.h"
+
+namespace Magnum { namespace TextureTools {
+
+namespace {
+
+template<class From, class To> Image2D convert(const ImageView2D& image, const PixelType outputType, void(*converter)(const From*, To*, std::size_t, bool)) {
+    const std::size_t componentCount = image.format() == PixelFormat::RGBA ? 4 : 3;
+
+    /* Input rows, respecting the storage parameters of the view */
+    std::size_t inputOffset;
+    Math::Vector3<std::size_t> inputDataSize;
+    std::tie(inputOffset, inputDataSize, std::ignore) = image.storage().dataProperties(image.format(), image.type(), Vector3i::pad(image.size(), 1));
+
+    /* Output with default storage parameters */
+    const PixelStorage outputStorage;
+    std::size_t outputOffset;
+    Math::Vector3<std::size_t> outputDataSize;
+    std::tie(outputOffset, outputDataSize, std::ignore) = outputStorage.dataProperties(image.format(), outputType, Vector3i::pad(image.size(), 1));
+    Containers::Array<char> data{outputOffset + outputDataSize.product()};
+
+    const std::size_t rowComponentCount = image.size().x()*componentCount;
+    for(std::size_t row = 0; row != std::size_t(image.size().y()); ++row)
+        converter(reinterpret_cast<const From*>(image.data() + inputOffset + row*inputDataSize.x()),
+            reinterpret_cast<To*>(data + outputOffset + row*outputDataSize.x()),
+            rowComponentCount, componentCount == 4);
+
+    return Image2D{outputStorage, image.format(), outputType, image.size(), std::move(data)};
+}
+
+}
+
+Image2D srgbToLinear(const ImageView2D& image) {
+    CORRADE_ASSERT((image.format() == PixelFormat::RGB || image.format() == PixelFormat::RGBA) && image.type() == PixelType::UnsignedByte,
+        "TextureTools::srgbToLinear(): expected RGB or RGBA image with unsigned byte components", (Image2D{image.format(), PixelType::Float}));
+
+    return convert(image, PixelType::Float, Math::Implementation::srgb8ToLinear);
+}
+
+Image2D linearToSrgb(const ImageView2D& image) {
+    CORRADE_ASSERT((image.format() == PixelFormat::RGB || image.format() == PixelFormat::RGBA) && image.type() == PixelType::Float,
+        "TextureTools::linearToSrgb(): expected RGB or RGBA image with float components", (Image2D{image.format(), PixelType::UnsignedByte}));
+
+    return convert(image, PixelType::UnsignedByte, Math::Implementation::linearToSrgb8);
+}
+
+}}
@@ -0,0 +1,69 @@
+#ifndef Magnum_TextureTools_Srgb_h
+#define Magnum_TextureTools_Srgb_h
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+/** @file
+ * @brief Function @ref Magnum::TextureTools::srgbToLinear(), @ref Magnum::TextureTools::linearToSrgb()
+ */
+
+#include "Magnum/Magnum.h"
+
+#include "Magnum/TextureTools/visibility.h"
+
+namespace Magnum { namespace TextureTools {
+
+/**
+@brief Convert 8-bit sRGB image to linear floats
+
+Expects that the image is @ref PixelFormat::RGB or @ref PixelFormat::RGBA with
+@ref PixelType::UnsignedByte. Returns image of the same size and format with
+@ref PixelType::Float and default @ref PixelStorage parameters. For
+@ref PixelFormat::RGBA the alpha channel is converted linearly. The result is
+equivalent to calling @ref Color3::fromSrgb() or @ref Color4::fromSrgbAlpha()
+on each pixel, but the conversion is done row by row using
+@ref Math::Batch::srgbToLinear(), which is considerably faster.
+@see @ref linearToSrgb()
+*/
+Image2D MAGNUM_TEXTURETOOLS_EXPORT srgbToLinear(const ImageView2D& image);
+
+/**
+@brief Convert linear float image to 8-bit sRGB
+
+Expects that the image is @ref PixelFormat::RGB or @ref PixelFormat::RGBA with
+@ref PixelType::Float. Returns image of the same size and format with
+@ref PixelType::UnsignedByte and default @ref PixelStorage parameters. Values
+are clamped to \f$ [0, 1] \f$ range and rounded to nearest, for
+@ref PixelFormat::RGBA the alpha channel is converted linearly. The result is
+equivalent to calling @ref Color3::toSrgb() const or
+@ref Color4::toSrgbAlpha() const on each pixel, but the conversion is done row
+by row using @ref Math::Batch::linearToSrgb(), which is considerably faster.
+@see @ref srgbToLinear()
+*/
+Image2D MAGNUM_TEXTURETOOLS_EXPORT linearToSrgb(const ImageView2D& image);
+
+}}
+
+#endif
@@ -0,0 +1,160 @@
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#include <cmath>
+#include <sstream>
+#include <Corrade/TestSuite/Tester.h>
+
+#include "Magnum/Image.h"
+#include "Magnum/ImageView.h"
+#include "Magnum/PixelFormat.h"
+#include "Magnum/Math/Color.h"
+#include "Magnum/TextureTools/Srgb.h"
+
+namespace Magnum { namespace TextureTools { namespace Test {
+
+struct SrgbTest: TestSuite::Tester {
+    explicit SrgbTest();
+
+    void srgbToLinear();
+    void srgbToLinearAlpha();
+    void srgbToLinearInvalid();
+    void linearToSrgb();
+    void linearToSrgbAlpha();
+    void linearToSrgbInvalid();
+};
+
+SrgbTest::SrgbTest() {
+    addTests({&SrgbTest::srgbToLinear,
+              &SrgbTest::srgbToLinearAlpha,
+              &SrgbTest::srgbToLinearInvalid,
+              &SrgbTest::linearToSrgb,
+              &SrgbTest::linearToSrgbAlpha,
+              &SrgbTest::linearToSrgbInvalid});
+}
+
+void SrgbTest::srgbToLinear() {
+    /* Rows are 6 bytes, padded to 8 with the default alignment */
+    constexpr UnsignedByte data[] = {
+        0x33, 0x66, 0x99, 0x00, 0xff, 0x80, 0, 0,
+        0xff, 0xff, 0xff, 0x10, 0x20, 0x30, 0, 0
+    };
+    const Image2D image = TextureTools::srgbToLinear(ImageView2D{PixelFormat::RGB, PixelType::UnsignedByte, {2, 2}, data});
+
+    CORRADE_COMPARE(image.format(), PixelFormat::RGB);
+    CORRADE_COMPARE(image.type(), PixelType::Float);
+    CORRADE_COMPARE(image.size(), Vector2i(2, 2));
+    CORRADE_COMPARE(image.data().size(), 4*sizeof(Color3));
+
+    const Color3* pixels = image.data<Color3>();
+    CORRADE_COMPARE(pixels[0], Color3::fromSrgb(Color3ub{0x33, 0x66, 0x99}));
+    CORRADE_COMPARE(pixels[1], Color3::fromSrgb(Color3ub{0x00, 0xff, 0x80}));
+    CORRADE_COMPARE(pixels[2], Color3::fromSrgb(Color3ub{0xff, 0xff, 0xff}));
+    CORRADE_COMPARE(pixels[3], Color3::fromSrgb(Color3ub{0x10, 0x20, 0x30}));
+}
+
+void SrgbTest::srgbToLinearAlpha() {
+    /* Skipping the first pixel of each row, the view requires data for the
+       whole last row including the skip */
+    constexpr UnsignedByte data[] = {
+        0xff, 0xff, 0xff, 0xff, 0x33, 0x66, 0x99, 0x80,
+        0xff, 0xff, 0xff, 0xff, 0x10, 0x20, 0x30, 0x40,
+        0, 0, 0, 0
+    };
+    const Image2D image = TextureTools::srgbToLinear(ImageView2D{
+        PixelStorage{}.setRowLength(2).setSkip({1, 0, 0}),
+        PixelFormat::RGBA, PixelType::UnsignedByte, {1, 2}, data});
+
+    CORRADE_COMPARE(image.format(), PixelFormat::RGBA);
+    CORRADE_COMPARE(image.type(), PixelType::Float);
+    CORRADE_COMPARE(image.size(), Vector2i(1, 2));
+
+    const Color4* pixels = image.data<Color4>();
+    CORRADE_COMPARE(pixels[0], Color4::fromSrgbAlpha(Color4ub{0x33, 0x66, 0x99, 0x80}));
+    CORRADE_COMPARE(pixels[1], Color4::fromSrgbAlpha(Color4ub{0x10, 0x20, 0x30, 0x40}));
+}
+
+void SrgbTest::srgbToLinearInvalid() {
+    std::ostringstream out;
+    Error::setOutput(&out);
+
+    constexpr Float data[4]{};
+    const Image2D image = TextureTools::srgbToLinear(ImageView2D{PixelFormat::RGBA, PixelType::Float, {1, 1}, data});
+    CORRADE_VERIFY(!image.data());
+    CORRADE_COMPARE(out.str(), "TextureTools::srgbToLinear(): expected RGB or RGBA image with unsigned byte components\n");
+}
+
+void SrgbTest::linearToSrgb() {
+    const Color3 data[] = {
+        {0.001f, 0.5f, 0.1f},
+        {-1.0f, 1.5f, 0.0f}
+    };
+    const Image2D image = TextureTools::linearToSrgb(ImageView2D{PixelFormat::RGB, PixelType::Float, {1, 2}, data});
+
+    CORRADE_COMPARE(image.format(), PixelFormat::RGB);
+    CORRADE_COMPARE(image.type(), PixelType::UnsignedByte);
+    CORRADE_COMPARE(image.size(), Vector2i(1, 2));
+    /* Rows are 3 bytes, padded to 4 with the default alignment */
+    CORRADE_COMPARE(image.data().size(), 8);
+
+    const UnsignedByte* pixels = image.data<UnsignedByte>();
+    CORRADE_COMPARE(Color3ub(pixels[0], pixels[1], pixels[2]), Color3ub(3, 188, 89));
+    CORRADE_COMPARE(Color3ub(pixels[4], pixels[5], pixels[6]), Color3ub(0, 255, 0));
+}
+
+void SrgbTest::linearToSrgbAlpha() {
+    const Color4 data[] = {
+        {0.001f, 0.5f, 0.1f, 0.5f},
+        {0.1f, 0.2f, 0.3f, 1.0f}
+    };
+    const Image2D image = TextureTools::linearToSrgb(ImageView2D{PixelFormat::RGBA, PixelType::Float, {2, 1}, data});
+
+    CORRADE_COMPARE(image.format(), PixelFormat::RGBA);
+    CORRADE_COMPARE(image.type(), PixelType::UnsignedByte);
+
+    const Color4ub* pixels = image.data<Color4ub>();
+    CORRADE_COMPARE(pixels[0], data[0].toSrgbAlpha<UnsignedByte>());
+    CORRADE_COMPARE(pixels[1], data[1].toSrgbAlpha<UnsignedByte>());
+
+    /* Converting back gets the original values within the 8-bit precision */
+    const Image2D linear = TextureTools::srgbToLinear(image);
+    const Color4* roundtrip = linear.data<Color4>();
+    for(std::size_t i = 0; i != 2; ++i) for(std::size_t j = 0; j != 4; ++j)
+        CORRADE_VERIFY(std::abs(roundtrip[i][j] - data[i][j]) < 0.005f);
+}
+
+void SrgbTest::linearToSrgbInvalid() {
+    std::ostringstream out;
+    Error::setOutput(&out);
+
+    constexpr UnsignedByte data[4]{};
+    const Image2D image = TextureTools::linearToSrgb(ImageView2D{PixelFormat::Red, PixelType::UnsignedByte, {4, 1}, data});
+    CORRADE_VERIFY(!image.data());
+    CORRADE_COMPARE(out.str(), "TextureTools::linearToSrgb(): expected RGB or RGBA image with float components\n");
+}
+
+}}}
+
+CORRADE_TEST_MAIN(Magnum::TextureTools::Test::SrgbTest)
@@ -24,6 +24,8 @@
 */
 
 #cmakedefine MAGNUM_BUILD_DEPRECATED
+#cmakedefine MAGNUM_BUILD_MULTITHREADED
+#cmakedefine MAGNUM_BUILD_SIMD
 #cmakedefine MAGNUM_BUILD_STATIC
 #cmakedefine MAGNUM_TARGET_GLES
 #cmakedefine MAGNUM_TARGET_GLES2